@@ -0,0 +1,425 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CMakeModules/FindDECKLINK.cmake"
+  "/root/repo/CMakeModules/FindPULSEAUDIO.cmake"
+  "/root/repo/CMakeModules/FindVIDEOMASTER.cmake"
+  "/root/repo/CMakeModules/GetGitRevisionDescription.cmake"
+  "/root/repo/CMakeModules/GetGitRevisionDescription.cmake.in"
+  "/root/repo/CMakeModules/cuda_module.cmake"
+  "/root/repo/CMakeModules/yuri_install.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/Doxyfile.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/apps/CMakeLists.txt"
+  "/root/repo/src/modules/CMakeLists.txt"
+  "/root/repo/src/modules/anaglyph/CMakeLists.txt"
+  "/root/repo/src/modules/artnet/CMakeLists.txt"
+  "/root/repo/src/modules/audio_convert/CMakeLists.txt"
+  "/root/repo/src/modules/audio_gen/CMakeLists.txt"
+  "/root/repo/src/modules/audio_latency/CMakeLists.txt"
+  "/root/repo/src/modules/audio_noise/CMakeLists.txt"
+  "/root/repo/src/modules/audio_visualization/CMakeLists.txt"
+  "/root/repo/src/modules/bayer/CMakeLists.txt"
+  "/root/repo/src/modules/black_white_generator/CMakeLists.txt"
+  "/root/repo/src/modules/blank/CMakeLists.txt"
+  "/root/repo/src/modules/color_key/CMakeLists.txt"
+  "/root/repo/src/modules/color_picker/CMakeLists.txt"
+  "/root/repo/src/modules/colors/CMakeLists.txt"
+  "/root/repo/src/modules/combine/CMakeLists.txt"
+  "/root/repo/src/modules/convert_planes/CMakeLists.txt"
+  "/root/repo/src/modules/crop/CMakeLists.txt"
+  "/root/repo/src/modules/delay/CMakeLists.txt"
+  "/root/repo/src/modules/dicaffeine/CMakeLists.txt"
+  "/root/repo/src/modules/dicaffeine/ndi_blank/CMakeLists.txt"
+  "/root/repo/src/modules/dicaffeine/ndi_combine/CMakeLists.txt"
+  "/root/repo/src/modules/dicaffeine/ndi_scale/CMakeLists.txt"
+  "/root/repo/src/modules/diff/CMakeLists.txt"
+  "/root/repo/src/modules/draw/CMakeLists.txt"
+  "/root/repo/src/modules/dup/CMakeLists.txt"
+  "/root/repo/src/modules/dvb/CMakeLists.txt"
+  "/root/repo/src/modules/event_info/CMakeLists.txt"
+  "/root/repo/src/modules/extrapolate_events/CMakeLists.txt"
+  "/root/repo/src/modules/fade/CMakeLists.txt"
+  "/root/repo/src/modules/file_picker/CMakeLists.txt"
+  "/root/repo/src/modules/filedump/CMakeLists.txt"
+  "/root/repo/src/modules/flip/CMakeLists.txt"
+  "/root/repo/src/modules/fps_fixer/CMakeLists.txt"
+  "/root/repo/src/modules/frame_info/CMakeLists.txt"
+  "/root/repo/src/modules/framebuffer/CMakeLists.txt"
+  "/root/repo/src/modules/freetype/CMakeLists.txt"
+  "/root/repo/src/modules/gpio/CMakeLists.txt"
+  "/root/repo/src/modules/hap_decoder/CMakeLists.txt"
+  "/root/repo/src/modules/invert/CMakeLists.txt"
+  "/root/repo/src/modules/irc_client/CMakeLists.txt"
+  "/root/repo/src/modules/jpeg/CMakeLists.txt"
+  "/root/repo/src/modules/json_config/CMakeLists.txt"
+  "/root/repo/src/modules/linky/CMakeLists.txt"
+  "/root/repo/src/modules/magnify/CMakeLists.txt"
+  "/root/repo/src/modules/merge_frames/CMakeLists.txt"
+  "/root/repo/src/modules/mix/CMakeLists.txt"
+  "/root/repo/src/modules/mjpeg_to_jpeg/CMakeLists.txt"
+  "/root/repo/src/modules/mosaic/CMakeLists.txt"
+  "/root/repo/src/modules/ndi/CMakeLists.txt"
+  "/root/repo/src/modules/null/CMakeLists.txt"
+  "/root/repo/src/modules/osc/CMakeLists.txt"
+  "/root/repo/src/modules/overlay/CMakeLists.txt"
+  "/root/repo/src/modules/pad/CMakeLists.txt"
+  "/root/repo/src/modules/png/CMakeLists.txt"
+  "/root/repo/src/modules/rawfilesource/CMakeLists.txt"
+  "/root/repo/src/modules/repack_audio/CMakeLists.txt"
+  "/root/repo/src/modules/rotate/CMakeLists.txt"
+  "/root/repo/src/modules/scale/CMakeLists.txt"
+  "/root/repo/src/modules/screen_grab/CMakeLists.txt"
+  "/root/repo/src/modules/select/CMakeLists.txt"
+  "/root/repo/src/modules/shm/CMakeLists.txt"
+  "/root/repo/src/modules/shout_source/CMakeLists.txt"
+  "/root/repo/src/modules/simple_rtp/CMakeLists.txt"
+  "/root/repo/src/modules/sockets/CMakeLists.txt"
+  "/root/repo/src/modules/split/CMakeLists.txt"
+  "/root/repo/src/modules/split_frames/CMakeLists.txt"
+  "/root/repo/src/modules/split_planes/CMakeLists.txt"
+  "/root/repo/src/modules/sync_frames/CMakeLists.txt"
+  "/root/repo/src/modules/synchronization/CMakeLists.txt"
+  "/root/repo/src/modules/testcard/CMakeLists.txt"
+  "/root/repo/src/modules/tests/CMakeLists.txt"
+  "/root/repo/src/modules/v4l2/CMakeLists.txt"
+  "/root/repo/src/modules/vncclient/CMakeLists.txt"
+  "/root/repo/src/modules/wav/CMakeLists.txt"
+  "/root/repo/src/modules/webserver/CMakeLists.txt"
+  "/root/repo/src/modules/yuriconvert/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/yuri/CMakeLists.txt"
+  "/root/repo/src/yuri/core/CMakeLists.txt"
+  "/root/repo/src/yuri/event/CMakeLists.txt"
+  "/root/repo/src/yuri/exception/CMakeLists.txt"
+  "/root/repo/src/yuri/gl/CMakeLists.txt"
+  "/root/repo/src/yuri/log/CMakeLists.txt"
+  "/root/repo/src/yuri/version.cpp.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindALSA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA/select_compute_arch.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFontconfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFreetype.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGLEW.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindImageMagick.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJPEG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenGL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindSDL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindX11.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/version.cpp"
+  "src/yuri/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/log/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/exception/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/event/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/yuri/gl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/anaglyph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/audio_convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/audio_noise/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/audio_latency/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/audio_gen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/audio_visualization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/bayer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/black_white_generator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/blank/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/colors/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/color_key/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/color_picker/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/combine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/convert_planes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/crop/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/delay/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dicaffeine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dicaffeine/ndi_blank/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dicaffeine/ndi_combine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dicaffeine/ndi_scale/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/diff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/draw/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/extrapolate_events/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/event_info/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/fade/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/filedump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/flip/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/fps_fixer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/frame_info/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/gpio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/hap_decoder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/invert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/irc_client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/magnify/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/merge_frames/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/mix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/mjpeg_to_jpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/mosaic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/ndi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/null/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/osc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/overlay/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/pad/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/repack_audio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/rotate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/scale/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/select/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/shout_source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/split/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/split_frames/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/split_planes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/sync_frames/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/testcard/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/yuriconvert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/vncclient/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/sockets/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/shm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/v4l2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/dvb/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/jpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/png/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/screen_grab/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/rawfilesource/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/artnet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/linky/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/webserver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/file_picker/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/json_config/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/freetype/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/wav/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/synchronization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/framebuffer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/simple_rtp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/Doxyfile"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/DependInfo.cmake"
+  "src/yuri/core/CMakeFiles/yuri_core_test.dir/DependInfo.cmake"
+  "src/apps/CMakeFiles/yuri2.dir/DependInfo.cmake"
+  "src/apps/CMakeFiles/yuri_test_module.dir/DependInfo.cmake"
+  "src/apps/CMakeFiles/yuri_wrapper.dir/DependInfo.cmake"
+  "src/apps/CMakeFiles/yuri_simple.dir/DependInfo.cmake"
+  "src/modules/anaglyph/CMakeFiles/anaglyph.dir/DependInfo.cmake"
+  "src/modules/audio_convert/CMakeFiles/audio_convert.dir/DependInfo.cmake"
+  "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/DependInfo.cmake"
+  "src/modules/audio_noise/CMakeFiles/audio_noise.dir/DependInfo.cmake"
+  "src/modules/audio_latency/CMakeFiles/audio_latency.dir/DependInfo.cmake"
+  "src/modules/audio_gen/CMakeFiles/audio_gen.dir/DependInfo.cmake"
+  "src/modules/audio_visualization/CMakeFiles/audio_visualization.dir/DependInfo.cmake"
+  "src/modules/bayer/CMakeFiles/bayer.dir/DependInfo.cmake"
+  "src/modules/black_white_generator/CMakeFiles/black_white_generator.dir/DependInfo.cmake"
+  "src/modules/blank/CMakeFiles/blank.dir/DependInfo.cmake"
+  "src/modules/colors/CMakeFiles/colors.dir/DependInfo.cmake"
+  "src/modules/color_key/CMakeFiles/color_key.dir/DependInfo.cmake"
+  "src/modules/color_picker/CMakeFiles/color_picker.dir/DependInfo.cmake"
+  "src/modules/combine/CMakeFiles/combine.dir/DependInfo.cmake"
+  "src/modules/convert_planes/CMakeFiles/convert_planes.dir/DependInfo.cmake"
+  "src/modules/crop/CMakeFiles/crop.dir/DependInfo.cmake"
+  "src/modules/delay/CMakeFiles/delay.dir/DependInfo.cmake"
+  "src/modules/dicaffeine/ndi_blank/CMakeFiles/ndi_blank.dir/DependInfo.cmake"
+  "src/modules/dicaffeine/ndi_combine/CMakeFiles/ndi_combine.dir/DependInfo.cmake"
+  "src/modules/dicaffeine/ndi_scale/CMakeFiles/ndi_scale.dir/DependInfo.cmake"
+  "src/modules/diff/CMakeFiles/diff.dir/DependInfo.cmake"
+  "src/modules/draw/CMakeFiles/draw.dir/DependInfo.cmake"
+  "src/modules/dup/CMakeFiles/dup.dir/DependInfo.cmake"
+  "src/modules/dup/CMakeFiles/module_dup_test.dir/DependInfo.cmake"
+  "src/modules/extrapolate_events/CMakeFiles/extrapolate_events.dir/DependInfo.cmake"
+  "src/modules/event_info/CMakeFiles/event_info.dir/DependInfo.cmake"
+  "src/modules/fade/CMakeFiles/fade.dir/DependInfo.cmake"
+  "src/modules/filedump/CMakeFiles/filedump.dir/DependInfo.cmake"
+  "src/modules/flip/CMakeFiles/flip.dir/DependInfo.cmake"
+  "src/modules/fps_fixer/CMakeFiles/fps_fixer.dir/DependInfo.cmake"
+  "src/modules/frame_info/CMakeFiles/frame_info.dir/DependInfo.cmake"
+  "src/modules/gpio/CMakeFiles/gpio.dir/DependInfo.cmake"
+  "src/modules/hap_decoder/CMakeFiles/hap_decoder.dir/DependInfo.cmake"
+  "src/modules/invert/CMakeFiles/invert.dir/DependInfo.cmake"
+  "src/modules/irc_client/CMakeFiles/irc_client.dir/DependInfo.cmake"
+  "src/modules/magnify/CMakeFiles/magnify.dir/DependInfo.cmake"
+  "src/modules/merge_frames/CMakeFiles/merge_frames.dir/DependInfo.cmake"
+  "src/modules/mix/CMakeFiles/mix.dir/DependInfo.cmake"
+  "src/modules/mix/CMakeFiles/module_mix_test.dir/DependInfo.cmake"
+  "src/modules/mjpeg_to_jpeg/CMakeFiles/mjpeg_to_jpeg.dir/DependInfo.cmake"
+  "src/modules/mosaic/CMakeFiles/mosaic.dir/DependInfo.cmake"
+  "src/modules/ndi/CMakeFiles/ndi.dir/DependInfo.cmake"
+  "src/modules/null/CMakeFiles/null.dir/DependInfo.cmake"
+  "src/modules/osc/CMakeFiles/osc_module.dir/DependInfo.cmake"
+  "src/modules/osc/CMakeFiles/module_osc_test.dir/DependInfo.cmake"
+  "src/modules/overlay/CMakeFiles/overlay.dir/DependInfo.cmake"
+  "src/modules/overlay/CMakeFiles/module_overlay_test.dir/DependInfo.cmake"
+  "src/modules/pad/CMakeFiles/pad.dir/DependInfo.cmake"
+  "src/modules/repack_audio/CMakeFiles/repack_audio.dir/DependInfo.cmake"
+  "src/modules/rotate/CMakeFiles/rotate.dir/DependInfo.cmake"
+  "src/modules/scale/CMakeFiles/scale.dir/DependInfo.cmake"
+  "src/modules/scale/CMakeFiles/module_scale_test.dir/DependInfo.cmake"
+  "src/modules/select/CMakeFiles/select.dir/DependInfo.cmake"
+  "src/modules/shout_source/CMakeFiles/shout_source.dir/DependInfo.cmake"
+  "src/modules/split/CMakeFiles/split.dir/DependInfo.cmake"
+  "src/modules/split_frames/CMakeFiles/split_frames.dir/DependInfo.cmake"
+  "src/modules/split_planes/CMakeFiles/split_planes.dir/DependInfo.cmake"
+  "src/modules/sync_frames/CMakeFiles/sync_frames.dir/DependInfo.cmake"
+  "src/modules/testcard/CMakeFiles/testcard.dir/DependInfo.cmake"
+  "src/modules/yuriconvert/CMakeFiles/yuri_convert.dir/DependInfo.cmake"
+  "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/DependInfo.cmake"
+  "src/modules/vncclient/CMakeFiles/vncclient.dir/DependInfo.cmake"
+  "src/modules/sockets/CMakeFiles/yuri_net.dir/DependInfo.cmake"
+  "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/DependInfo.cmake"
+  "src/modules/shm/CMakeFiles/shm.dir/DependInfo.cmake"
+  "src/modules/shm/CMakeFiles/module_shm_test.dir/DependInfo.cmake"
+  "src/modules/v4l2/CMakeFiles/v4l2_source.dir/DependInfo.cmake"
+  "src/modules/dvb/CMakeFiles/dvb.dir/DependInfo.cmake"
+  "src/modules/jpeg/CMakeFiles/jpeg_module.dir/DependInfo.cmake"
+  "src/modules/png/CMakeFiles/png_module.dir/DependInfo.cmake"
+  "src/modules/screen_grab/CMakeFiles/screen_grab.dir/DependInfo.cmake"
+  "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/DependInfo.cmake"
+  "src/modules/rawfilesource/CMakeFiles/module_rawfilesource_test.dir/DependInfo.cmake"
+  "src/modules/artnet/CMakeFiles/artnet.dir/DependInfo.cmake"
+  "src/modules/linky/CMakeFiles/linky.dir/DependInfo.cmake"
+  "src/modules/webserver/CMakeFiles/webserver.dir/DependInfo.cmake"
+  "src/modules/webserver/CMakeFiles/module_webserver_test.dir/DependInfo.cmake"
+  "src/modules/file_picker/CMakeFiles/file_picker.dir/DependInfo.cmake"
+  "src/modules/json_config/CMakeFiles/json_config.dir/DependInfo.cmake"
+  "src/modules/freetype/CMakeFiles/freetype.dir/DependInfo.cmake"
+  "src/modules/freetype/CMakeFiles/module_freetype_test.dir/DependInfo.cmake"
+  "src/modules/wav/CMakeFiles/wav.dir/DependInfo.cmake"
+  "src/modules/synchronization/CMakeFiles/synchronization.dir/DependInfo.cmake"
+  "src/modules/synchronization/CMakeFiles/module_onepc_protocol_test.dir/DependInfo.cmake"
+  "src/modules/synchronization/CMakeFiles/module_twopc_protocol_test.dir/DependInfo.cmake"
+  "src/modules/framebuffer/CMakeFiles/framebuffer.dir/DependInfo.cmake"
+  "src/modules/simple_rtp/CMakeFiles/simple_rtp.dir/DependInfo.cmake"
+  "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/DependInfo.cmake"
+  "src/modules/tests/CMakeFiles/module_generic_test.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/yuri_test_suite.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/yuri_test_register.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/yuri_bench_pipes.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/yuri_bench_event_expression.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_test_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("yuri")
+subdirs("apps")
+subdirs("modules")
+subdirs("tests")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/yuri/try_conversion.cpp" "src/apps/CMakeFiles/yuri2.dir/yuri/try_conversion.cpp.o" "gcc" "src/apps/CMakeFiles/yuri2.dir/yuri/try_conversion.cpp.o.d"
+  "/root/repo/src/apps/yuri/yuri_listings.cpp" "src/apps/CMakeFiles/yuri2.dir/yuri/yuri_listings.cpp.o" "gcc" "src/apps/CMakeFiles/yuri2.dir/yuri/yuri_listings.cpp.o.d"
+  "/root/repo/src/apps/yuri2.cpp" "src/apps/CMakeFiles/yuri2.dir/yuri2.cpp.o" "gcc" "src/apps/CMakeFiles/yuri2.dir/yuri2.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri2"
+  "../../bin/yuri2.pdb"
+  "CMakeFiles/yuri2.dir/yuri/try_conversion.cpp.o"
+  "CMakeFiles/yuri2.dir/yuri/try_conversion.cpp.o.d"
+  "CMakeFiles/yuri2.dir/yuri/yuri_listings.cpp.o"
+  "CMakeFiles/yuri2.dir/yuri/yuri_listings.cpp.o.d"
+  "CMakeFiles/yuri2.dir/yuri2.cpp.o"
+  "CMakeFiles/yuri2.dir/yuri2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/simple/SimpleBuilder.cpp" "src/apps/CMakeFiles/yuri_simple.dir/simple/SimpleBuilder.cpp.o" "gcc" "src/apps/CMakeFiles/yuri_simple.dir/simple/SimpleBuilder.cpp.o.d"
+  "/root/repo/src/apps/yuri_simple.cpp" "src/apps/CMakeFiles/yuri_simple.dir/yuri_simple.cpp.o" "gcc" "src/apps/CMakeFiles/yuri_simple.dir/yuri_simple.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
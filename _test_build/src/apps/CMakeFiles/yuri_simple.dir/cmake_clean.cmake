@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_simple"
+  "../../bin/yuri_simple.pdb"
+  "CMakeFiles/yuri_simple.dir/simple/SimpleBuilder.cpp.o"
+  "CMakeFiles/yuri_simple.dir/simple/SimpleBuilder.cpp.o.d"
+  "CMakeFiles/yuri_simple.dir/yuri_simple.cpp.o"
+  "CMakeFiles/yuri_simple.dir/yuri_simple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_test_module"
+  "../../bin/yuri_test_module.pdb"
+  "CMakeFiles/yuri_test_module.dir/test_module.cpp.o"
+  "CMakeFiles/yuri_test_module.dir/test_module.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_test_module.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
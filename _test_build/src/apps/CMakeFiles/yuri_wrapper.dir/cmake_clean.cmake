@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri_wrapper.dir/wrapper.cpp.o"
+  "CMakeFiles/yuri_wrapper.dir/wrapper.cpp.o.d"
+  "CMakeFiles/yuri_wrapper.dir/wrapper/WrapperLoader.cpp.o"
+  "CMakeFiles/yuri_wrapper.dir/wrapper/WrapperLoader.cpp.o.d"
+  "yuri_wrapper.pdb"
+  "yuri_wrapper.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_wrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules
+# Build directory: /root/repo/_test_build/src/modules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("anaglyph")
+subdirs("audio_convert")
+subdirs("audio_noise")
+subdirs("audio_latency")
+subdirs("audio_gen")
+subdirs("audio_visualization")
+subdirs("bayer")
+subdirs("black_white_generator")
+subdirs("blank")
+subdirs("colors")
+subdirs("color_key")
+subdirs("color_picker")
+subdirs("combine")
+subdirs("convert_planes")
+subdirs("crop")
+subdirs("delay")
+subdirs("dicaffeine")
+subdirs("diff")
+subdirs("draw")
+subdirs("dup")
+subdirs("extrapolate_events")
+subdirs("event_info")
+subdirs("fade")
+subdirs("filedump")
+subdirs("flip")
+subdirs("fps_fixer")
+subdirs("frame_info")
+subdirs("gpio")
+subdirs("hap_decoder")
+subdirs("invert")
+subdirs("irc_client")
+subdirs("magnify")
+subdirs("merge_frames")
+subdirs("mix")
+subdirs("mjpeg_to_jpeg")
+subdirs("mosaic")
+subdirs("ndi")
+subdirs("null")
+subdirs("osc")
+subdirs("overlay")
+subdirs("pad")
+subdirs("repack_audio")
+subdirs("rotate")
+subdirs("scale")
+subdirs("select")
+subdirs("shout_source")
+subdirs("split")
+subdirs("split_frames")
+subdirs("split_planes")
+subdirs("sync_frames")
+subdirs("testcard")
+subdirs("yuriconvert")
+subdirs("vncclient")
+subdirs("sockets")
+subdirs("shm")
+subdirs("v4l2")
+subdirs("dvb")
+subdirs("jpeg")
+subdirs("png")
+subdirs("screen_grab")
+subdirs("rawfilesource")
+subdirs("artnet")
+subdirs("linky")
+subdirs("webserver")
+subdirs("file_picker")
+subdirs("json_config")
+subdirs("freetype")
+subdirs("wav")
+subdirs("synchronization")
+subdirs("framebuffer")
+subdirs("simple_rtp")
+subdirs("tests")
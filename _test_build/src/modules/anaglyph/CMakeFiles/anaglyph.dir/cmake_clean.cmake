@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/anaglyph.dir/Anaglyph.cpp.o"
+  "CMakeFiles/anaglyph.dir/Anaglyph.cpp.o.d"
+  "yuri2.8_module_anaglyph.pdb"
+  "yuri2.8_module_anaglyph.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/anaglyph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/anaglyph
+# Build directory: /root/repo/_test_build/src/modules/anaglyph
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
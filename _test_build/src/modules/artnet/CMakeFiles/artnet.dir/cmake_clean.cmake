@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/artnet.dir/ArtNet.cpp.o"
+  "CMakeFiles/artnet.dir/ArtNet.cpp.o.d"
+  "CMakeFiles/artnet.dir/ArtNetPacket.cpp.o"
+  "CMakeFiles/artnet.dir/ArtNetPacket.cpp.o.d"
+  "yuri2.8_module_artnet.pdb"
+  "yuri2.8_module_artnet.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/artnet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
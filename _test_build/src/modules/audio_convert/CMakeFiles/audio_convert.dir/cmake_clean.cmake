@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/audio_convert.dir/AudioConvert.cpp.o"
+  "CMakeFiles/audio_convert.dir/AudioConvert.cpp.o.d"
+  "CMakeFiles/audio_convert.dir/AudioResampler.cpp.o"
+  "CMakeFiles/audio_convert.dir/AudioResampler.cpp.o.d"
+  "CMakeFiles/audio_convert.dir/sample_convert.cpp.o"
+  "CMakeFiles/audio_convert.dir/sample_convert.cpp.o.d"
+  "yuri2.8_module_audio_convert.pdb"
+  "yuri2.8_module_audio_convert.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
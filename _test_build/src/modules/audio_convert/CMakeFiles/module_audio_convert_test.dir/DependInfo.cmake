@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/audio_convert/AudioConvert.cpp" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/AudioConvert.cpp.o" "gcc" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/AudioConvert.cpp.o.d"
+  "/root/repo/src/modules/audio_convert/AudioResampler.cpp" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/AudioResampler.cpp.o" "gcc" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/AudioResampler.cpp.o.d"
+  "/root/repo/src/modules/audio_convert/sample_convert.cpp" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/sample_convert.cpp.o" "gcc" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/sample_convert.cpp.o.d"
+  "/root/repo/src/modules/audio_convert/test_audio_convert.cpp" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/test_audio_convert.cpp.o" "gcc" "src/modules/audio_convert/CMakeFiles/module_audio_convert_test.dir/test_audio_convert.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
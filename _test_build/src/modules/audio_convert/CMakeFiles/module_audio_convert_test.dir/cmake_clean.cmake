@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_audio_convert_test"
+  "../../../bin/module_audio_convert_test.pdb"
+  "CMakeFiles/module_audio_convert_test.dir/AudioConvert.cpp.o"
+  "CMakeFiles/module_audio_convert_test.dir/AudioConvert.cpp.o.d"
+  "CMakeFiles/module_audio_convert_test.dir/AudioResampler.cpp.o"
+  "CMakeFiles/module_audio_convert_test.dir/AudioResampler.cpp.o.d"
+  "CMakeFiles/module_audio_convert_test.dir/sample_convert.cpp.o"
+  "CMakeFiles/module_audio_convert_test.dir/sample_convert.cpp.o.d"
+  "CMakeFiles/module_audio_convert_test.dir/test_audio_convert.cpp.o"
+  "CMakeFiles/module_audio_convert_test.dir/test_audio_convert.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_audio_convert_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/audio_convert
+# Build directory: /root/repo/_test_build/src/modules/audio_convert
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_audio_convert_test "/root/repo/_test_build/bin/module_audio_convert_test")
+set_tests_properties(module_audio_convert_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/audio_convert/CMakeLists.txt;22;add_test;/root/repo/src/modules/audio_convert/CMakeLists.txt;0;")
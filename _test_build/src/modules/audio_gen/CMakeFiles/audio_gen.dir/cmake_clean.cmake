@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/audio_gen.dir/SineGenerator.cpp.o"
+  "CMakeFiles/audio_gen.dir/SineGenerator.cpp.o.d"
+  "CMakeFiles/audio_gen.dir/register.cpp.o"
+  "CMakeFiles/audio_gen.dir/register.cpp.o.d"
+  "yuri2.8_module_audio_gen.pdb"
+  "yuri2.8_module_audio_gen.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_gen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/audio_latency.dir/AudioLatency.cpp.o"
+  "CMakeFiles/audio_latency.dir/AudioLatency.cpp.o.d"
+  "yuri2.8_module_audio_latency.pdb"
+  "yuri2.8_module_audio_latency.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/audio_noise.dir/AudioNoise.cpp.o"
+  "CMakeFiles/audio_noise.dir/AudioNoise.cpp.o.d"
+  "yuri2.8_module_audio_noise.pdb"
+  "yuri2.8_module_audio_noise.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_noise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/audio_visualization.dir/AudioVisualization.cpp.o"
+  "CMakeFiles/audio_visualization.dir/AudioVisualization.cpp.o.d"
+  "yuri2.8_module_audio_visualization.pdb"
+  "yuri2.8_module_audio_visualization.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_visualization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
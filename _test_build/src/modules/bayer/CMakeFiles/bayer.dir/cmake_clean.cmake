@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bayer.dir/BayerVisualize.cpp.o"
+  "CMakeFiles/bayer.dir/BayerVisualize.cpp.o.d"
+  "yuri2.8_module_bayer.pdb"
+  "yuri2.8_module_bayer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bayer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/black_white_generator.dir/BlackWhiteGenerator.cpp.o"
+  "CMakeFiles/black_white_generator.dir/BlackWhiteGenerator.cpp.o.d"
+  "yuri2.8_module_black_white_generator.pdb"
+  "yuri2.8_module_black_white_generator.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/black_white_generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blank.dir/BlankGenerator.cpp.o"
+  "CMakeFiles/blank.dir/BlankGenerator.cpp.o.d"
+  "yuri2.8_module_blank.pdb"
+  "yuri2.8_module_blank.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blank.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
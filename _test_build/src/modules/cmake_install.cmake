@@ -0,0 +1,121 @@
+# Install script for directory: /root/repo/src/modules
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_test_build/src/modules/anaglyph/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/audio_convert/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/audio_noise/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/audio_latency/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/audio_gen/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/audio_visualization/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/bayer/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/black_white_generator/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/blank/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/colors/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/color_key/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/color_picker/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/combine/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/convert_planes/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/crop/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/delay/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/dicaffeine/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/diff/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/draw/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/dup/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/extrapolate_events/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/event_info/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/fade/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/filedump/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/flip/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/fps_fixer/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/frame_info/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/gpio/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/hap_decoder/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/invert/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/irc_client/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/magnify/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/merge_frames/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/mix/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/mjpeg_to_jpeg/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/mosaic/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/ndi/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/null/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/osc/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/overlay/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/pad/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/repack_audio/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/rotate/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/scale/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/select/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/shout_source/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/split/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/split_frames/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/split_planes/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/sync_frames/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/testcard/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/yuriconvert/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/vncclient/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/sockets/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/shm/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/v4l2/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/dvb/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/jpeg/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/png/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/screen_grab/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/rawfilesource/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/artnet/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/linky/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/webserver/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/file_picker/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/json_config/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/freetype/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/wav/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/synchronization/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/framebuffer/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/simple_rtp/cmake_install.cmake")
+  include("/root/repo/_test_build/src/modules/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/color_key.dir/ColorKey.cpp.o"
+  "CMakeFiles/color_key.dir/ColorKey.cpp.o.d"
+  "yuri2.8_module_color_key.pdb"
+  "yuri2.8_module_color_key.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/color_key.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/color_picker.dir/ColorPicker.cpp.o"
+  "CMakeFiles/color_picker.dir/ColorPicker.cpp.o.d"
+  "CMakeFiles/color_picker.dir/common.cpp.o"
+  "CMakeFiles/color_picker.dir/common.cpp.o.d"
+  "yuri2.8_module_color_picker.pdb"
+  "yuri2.8_module_color_picker.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/color_picker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/colors.dir/Contrast.cpp.o"
+  "CMakeFiles/colors.dir/Contrast.cpp.o.d"
+  "CMakeFiles/colors.dir/Saturate.cpp.o"
+  "CMakeFiles/colors.dir/Saturate.cpp.o.d"
+  "CMakeFiles/colors.dir/register.cpp.o"
+  "CMakeFiles/colors.dir/register.cpp.o.d"
+  "yuri2.8_module_colors.pdb"
+  "yuri2.8_module_colors.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/colors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combine.dir/Combine.cpp.o"
+  "CMakeFiles/combine.dir/Combine.cpp.o.d"
+  "yuri2.8_module_combine.pdb"
+  "yuri2.8_module_combine.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convert_planes.dir/ConvertPlanes.cpp.o"
+  "CMakeFiles/convert_planes.dir/ConvertPlanes.cpp.o.d"
+  "yuri2.8_module_convert_planes.pdb"
+  "yuri2.8_module_convert_planes.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convert_planes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
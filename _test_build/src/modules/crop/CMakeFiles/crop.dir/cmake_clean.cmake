@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crop.dir/Crop.cpp.o"
+  "CMakeFiles/crop.dir/Crop.cpp.o.d"
+  "yuri2.8_module_crop.pdb"
+  "yuri2.8_module_crop.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/crop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
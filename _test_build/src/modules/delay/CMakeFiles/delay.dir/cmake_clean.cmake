@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delay.dir/Delay.cpp.o"
+  "CMakeFiles/delay.dir/Delay.cpp.o.d"
+  "yuri2.8_module_delay.pdb"
+  "yuri2.8_module_delay.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
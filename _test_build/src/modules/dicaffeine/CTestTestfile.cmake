@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/dicaffeine
+# Build directory: /root/repo/_test_build/src/modules/dicaffeine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ndi_blank")
+subdirs("ndi_combine")
+subdirs("ndi_scale")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ndi_blank.dir/BlankGenerator.cpp.o"
+  "CMakeFiles/ndi_blank.dir/BlankGenerator.cpp.o.d"
+  "yuri2.8_module_ndi_blank.pdb"
+  "yuri2.8_module_ndi_blank.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ndi_blank.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ndi_scale.dir/Scale.cpp.o"
+  "CMakeFiles/ndi_scale.dir/Scale.cpp.o.d"
+  "yuri2.8_module_ndi_scale.pdb"
+  "yuri2.8_module_ndi_scale.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ndi_scale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diff.dir/Diff.cpp.o"
+  "CMakeFiles/diff.dir/Diff.cpp.o.d"
+  "yuri2.8_module_diff.pdb"
+  "yuri2.8_module_diff.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
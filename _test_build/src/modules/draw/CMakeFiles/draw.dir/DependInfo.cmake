@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/draw/Box.cpp" "src/modules/draw/CMakeFiles/draw.dir/Box.cpp.o" "gcc" "src/modules/draw/CMakeFiles/draw.dir/Box.cpp.o.d"
+  "/root/repo/src/modules/draw/register.cpp" "src/modules/draw/CMakeFiles/draw.dir/register.cpp.o" "gcc" "src/modules/draw/CMakeFiles/draw.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
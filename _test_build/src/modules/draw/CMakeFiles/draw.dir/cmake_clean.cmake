@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/draw.dir/Box.cpp.o"
+  "CMakeFiles/draw.dir/Box.cpp.o.d"
+  "CMakeFiles/draw.dir/register.cpp.o"
+  "CMakeFiles/draw.dir/register.cpp.o.d"
+  "yuri2.8_module_draw.pdb"
+  "yuri2.8_module_draw.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/draw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dup.dir/Dup.cpp.o"
+  "CMakeFiles/dup.dir/Dup.cpp.o.d"
+  "yuri2.8_module_dup.pdb"
+  "yuri2.8_module_dup.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/dup/Dup.cpp" "src/modules/dup/CMakeFiles/module_dup_test.dir/Dup.cpp.o" "gcc" "src/modules/dup/CMakeFiles/module_dup_test.dir/Dup.cpp.o.d"
+  "/root/repo/src/modules/dup/dup_test.cpp" "src/modules/dup/CMakeFiles/module_dup_test.dir/dup_test.cpp.o" "gcc" "src/modules/dup/CMakeFiles/module_dup_test.dir/dup_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_dup_test"
+  "../../../bin/module_dup_test.pdb"
+  "CMakeFiles/module_dup_test.dir/Dup.cpp.o"
+  "CMakeFiles/module_dup_test.dir/Dup.cpp.o.d"
+  "CMakeFiles/module_dup_test.dir/dup_test.cpp.o"
+  "CMakeFiles/module_dup_test.dir/dup_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_dup_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dvb.dir/DVBSource.cpp.o"
+  "CMakeFiles/dvb.dir/DVBSource.cpp.o.d"
+  "yuri2.8_module_dvb.pdb"
+  "yuri2.8_module_dvb.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dvb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
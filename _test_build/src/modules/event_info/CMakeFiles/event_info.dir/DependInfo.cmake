@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/event_info/EventConvolution.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventConvolution.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventConvolution.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventDelay.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventDelay.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventDelay.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventDevice.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventDevice.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventDevice.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventInfo.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventInfo.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventInfo.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventJoystick.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventJoystick.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventJoystick.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventTimer.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventTimer.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventTimer.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventToFrame.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventToFrame.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventToFrame.cpp.o.d"
+  "/root/repo/src/modules/event_info/EventValuePair.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/EventValuePair.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/EventValuePair.cpp.o.d"
+  "/root/repo/src/modules/event_info/PassEvent.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/PassEvent.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/PassEvent.cpp.o.d"
+  "/root/repo/src/modules/event_info/register.cpp" "src/modules/event_info/CMakeFiles/event_info.dir/register.cpp.o" "gcc" "src/modules/event_info/CMakeFiles/event_info.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/event_info.dir/EventConvolution.cpp.o"
+  "CMakeFiles/event_info.dir/EventConvolution.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventDelay.cpp.o"
+  "CMakeFiles/event_info.dir/EventDelay.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventDevice.cpp.o"
+  "CMakeFiles/event_info.dir/EventDevice.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventInfo.cpp.o"
+  "CMakeFiles/event_info.dir/EventInfo.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventJoystick.cpp.o"
+  "CMakeFiles/event_info.dir/EventJoystick.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventTimer.cpp.o"
+  "CMakeFiles/event_info.dir/EventTimer.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventToFrame.cpp.o"
+  "CMakeFiles/event_info.dir/EventToFrame.cpp.o.d"
+  "CMakeFiles/event_info.dir/EventValuePair.cpp.o"
+  "CMakeFiles/event_info.dir/EventValuePair.cpp.o.d"
+  "CMakeFiles/event_info.dir/PassEvent.cpp.o"
+  "CMakeFiles/event_info.dir/PassEvent.cpp.o.d"
+  "CMakeFiles/event_info.dir/register.cpp.o"
+  "CMakeFiles/event_info.dir/register.cpp.o.d"
+  "yuri2.8_module_event_info.pdb"
+  "yuri2.8_module_event_info.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extrapolate_events.dir/EventRate.cpp.o"
+  "CMakeFiles/extrapolate_events.dir/EventRate.cpp.o.d"
+  "CMakeFiles/extrapolate_events.dir/ExtrapolateEvents.cpp.o"
+  "CMakeFiles/extrapolate_events.dir/ExtrapolateEvents.cpp.o.d"
+  "CMakeFiles/extrapolate_events.dir/register.cpp.o"
+  "CMakeFiles/extrapolate_events.dir/register.cpp.o.d"
+  "yuri2.8_module_extrapolate_events.pdb"
+  "yuri2.8_module_extrapolate_events.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extrapolate_events.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fade.dir/Fade.cpp.o"
+  "CMakeFiles/fade.dir/Fade.cpp.o.d"
+  "yuri2.8_module_fade.pdb"
+  "yuri2.8_module_fade.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fade.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/file_picker.dir/FilePicker.cpp.o"
+  "CMakeFiles/file_picker.dir/FilePicker.cpp.o.d"
+  "yuri2.8_module_file_picker.pdb"
+  "yuri2.8_module_file_picker.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/file_picker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
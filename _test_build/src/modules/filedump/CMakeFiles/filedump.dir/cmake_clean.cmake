@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filedump.dir/FileDump.cpp.o"
+  "CMakeFiles/filedump.dir/FileDump.cpp.o.d"
+  "yuri2.8_module_filedump.pdb"
+  "yuri2.8_module_filedump.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filedump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
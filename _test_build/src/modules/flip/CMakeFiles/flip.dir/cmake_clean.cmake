@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/flip.dir/Flip.cpp.o"
+  "CMakeFiles/flip.dir/Flip.cpp.o.d"
+  "yuri2.8_module_flip.pdb"
+  "yuri2.8_module_flip.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fps_fixer.dir/FpsFixer.cpp.o"
+  "CMakeFiles/fps_fixer.dir/FpsFixer.cpp.o.d"
+  "yuri2.8_module_fps_fixer.pdb"
+  "yuri2.8_module_fps_fixer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fps_fixer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frame_info.dir/FrameInfo.cpp.o"
+  "CMakeFiles/frame_info.dir/FrameInfo.cpp.o.d"
+  "yuri2.8_module_frame_info.pdb"
+  "yuri2.8_module_frame_info.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frame_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
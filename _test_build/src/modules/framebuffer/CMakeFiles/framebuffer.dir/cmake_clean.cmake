@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/framebuffer.dir/FrameBuffer.cpp.o"
+  "CMakeFiles/framebuffer.dir/FrameBuffer.cpp.o.d"
+  "yuri2.8_module_framebuffer.pdb"
+  "yuri2.8_module_framebuffer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/framebuffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
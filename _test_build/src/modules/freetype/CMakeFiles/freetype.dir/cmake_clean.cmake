@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/freetype.dir/GlyphCache.cpp.o"
+  "CMakeFiles/freetype.dir/GlyphCache.cpp.o.d"
+  "CMakeFiles/freetype.dir/RenderText.cpp.o"
+  "CMakeFiles/freetype.dir/RenderText.cpp.o.d"
+  "yuri2.8_module_freetype.pdb"
+  "yuri2.8_module_freetype.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/freetype.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_freetype_test"
+  "../../../bin/module_freetype_test.pdb"
+  "CMakeFiles/module_freetype_test.dir/GlyphCache.cpp.o"
+  "CMakeFiles/module_freetype_test.dir/GlyphCache.cpp.o.d"
+  "CMakeFiles/module_freetype_test.dir/test_glyph_cache.cpp.o"
+  "CMakeFiles/module_freetype_test.dir/test_glyph_cache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_freetype_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gpio.dir/GPIO.cpp.o"
+  "CMakeFiles/gpio.dir/GPIO.cpp.o.d"
+  "CMakeFiles/gpio.dir/register.cpp.o"
+  "CMakeFiles/gpio.dir/register.cpp.o.d"
+  "yuri2.8_module_gpio.pdb"
+  "yuri2.8_module_gpio.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gpio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hap_decoder.dir/HapDecoder.cpp.o"
+  "CMakeFiles/hap_decoder.dir/HapDecoder.cpp.o.d"
+  "yuri2.8_module_hap_decoder.pdb"
+  "yuri2.8_module_hap_decoder.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hap_decoder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
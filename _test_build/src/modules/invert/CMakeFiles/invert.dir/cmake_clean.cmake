@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/invert.dir/Invert.cpp.o"
+  "CMakeFiles/invert.dir/Invert.cpp.o.d"
+  "yuri2.8_module_invert.pdb"
+  "yuri2.8_module_invert.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/invert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
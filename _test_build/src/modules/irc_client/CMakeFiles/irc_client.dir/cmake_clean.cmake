@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/irc_client.dir/IrcClient.cpp.o"
+  "CMakeFiles/irc_client.dir/IrcClient.cpp.o.d"
+  "yuri2.8_module_irc_client.pdb"
+  "yuri2.8_module_irc_client.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/irc_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/jpeg/JpegDecoder.cpp" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/JpegDecoder.cpp.o" "gcc" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/JpegDecoder.cpp.o.d"
+  "/root/repo/src/modules/jpeg/JpegEncoder.cpp" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/JpegEncoder.cpp.o" "gcc" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/JpegEncoder.cpp.o.d"
+  "/root/repo/src/modules/jpeg/jpeg_common.cpp" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/jpeg_common.cpp.o" "gcc" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/jpeg_common.cpp.o.d"
+  "/root/repo/src/modules/jpeg/register.cpp" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/register.cpp.o" "gcc" "src/modules/jpeg/CMakeFiles/jpeg_module.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jpeg_module.dir/JpegDecoder.cpp.o"
+  "CMakeFiles/jpeg_module.dir/JpegDecoder.cpp.o.d"
+  "CMakeFiles/jpeg_module.dir/JpegEncoder.cpp.o"
+  "CMakeFiles/jpeg_module.dir/JpegEncoder.cpp.o.d"
+  "CMakeFiles/jpeg_module.dir/jpeg_common.cpp.o"
+  "CMakeFiles/jpeg_module.dir/jpeg_common.cpp.o.d"
+  "CMakeFiles/jpeg_module.dir/register.cpp.o"
+  "CMakeFiles/jpeg_module.dir/register.cpp.o.d"
+  "yuri2.8_module_jpeg_module.pdb"
+  "yuri2.8_module_jpeg_module.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jpeg_module.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
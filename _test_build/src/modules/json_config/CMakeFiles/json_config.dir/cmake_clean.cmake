@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_config.dir/JsonConfig.cpp.o"
+  "CMakeFiles/json_config.dir/JsonConfig.cpp.o.d"
+  "yuri2.8_module_json_config.pdb"
+  "yuri2.8_module_json_config.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
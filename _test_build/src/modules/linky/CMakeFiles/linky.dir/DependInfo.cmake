@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/linky/LinkyInput.cpp" "src/modules/linky/CMakeFiles/linky.dir/LinkyInput.cpp.o" "gcc" "src/modules/linky/CMakeFiles/linky.dir/LinkyInput.cpp.o.d"
+  "/root/repo/src/modules/linky/LinkyOutput.cpp" "src/modules/linky/CMakeFiles/linky.dir/LinkyOutput.cpp.o" "gcc" "src/modules/linky/CMakeFiles/linky.dir/LinkyOutput.cpp.o.d"
+  "/root/repo/src/modules/linky/jsoncpp.cpp" "src/modules/linky/CMakeFiles/linky.dir/jsoncpp.cpp.o" "gcc" "src/modules/linky/CMakeFiles/linky.dir/jsoncpp.cpp.o.d"
+  "/root/repo/src/modules/linky/linky_common.cpp" "src/modules/linky/CMakeFiles/linky.dir/linky_common.cpp.o" "gcc" "src/modules/linky/CMakeFiles/linky.dir/linky_common.cpp.o.d"
+  "/root/repo/src/modules/linky/register.cpp" "src/modules/linky/CMakeFiles/linky.dir/register.cpp.o" "gcc" "src/modules/linky/CMakeFiles/linky.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/linky.dir/LinkyInput.cpp.o"
+  "CMakeFiles/linky.dir/LinkyInput.cpp.o.d"
+  "CMakeFiles/linky.dir/LinkyOutput.cpp.o"
+  "CMakeFiles/linky.dir/LinkyOutput.cpp.o.d"
+  "CMakeFiles/linky.dir/jsoncpp.cpp.o"
+  "CMakeFiles/linky.dir/jsoncpp.cpp.o.d"
+  "CMakeFiles/linky.dir/linky_common.cpp.o"
+  "CMakeFiles/linky.dir/linky_common.cpp.o.d"
+  "CMakeFiles/linky.dir/register.cpp.o"
+  "CMakeFiles/linky.dir/register.cpp.o.d"
+  "yuri2.8_module_linky.pdb"
+  "yuri2.8_module_linky.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linky.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/magnify.dir/Magnify.cpp.o"
+  "CMakeFiles/magnify.dir/Magnify.cpp.o.d"
+  "yuri2.8_module_magnify.pdb"
+  "yuri2.8_module_magnify.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/magnify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
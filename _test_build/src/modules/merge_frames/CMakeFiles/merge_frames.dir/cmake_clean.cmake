@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_frames.dir/MergeFrames.cpp.o"
+  "CMakeFiles/merge_frames.dir/MergeFrames.cpp.o.d"
+  "yuri2.8_module_merge_frames.pdb"
+  "yuri2.8_module_merge_frames.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_frames.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/mix/AudioMixer.cpp" "src/modules/mix/CMakeFiles/mix.dir/AudioMixer.cpp.o" "gcc" "src/modules/mix/CMakeFiles/mix.dir/AudioMixer.cpp.o.d"
+  "/root/repo/src/modules/mix/Mix.cpp" "src/modules/mix/CMakeFiles/mix.dir/Mix.cpp.o" "gcc" "src/modules/mix/CMakeFiles/mix.dir/Mix.cpp.o.d"
+  "/root/repo/src/modules/mix/Mixer.cpp" "src/modules/mix/CMakeFiles/mix.dir/Mixer.cpp.o" "gcc" "src/modules/mix/CMakeFiles/mix.dir/Mixer.cpp.o.d"
+  "/root/repo/src/modules/mix/mix_kernels.cpp" "src/modules/mix/CMakeFiles/mix.dir/mix_kernels.cpp.o" "gcc" "src/modules/mix/CMakeFiles/mix.dir/mix_kernels.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
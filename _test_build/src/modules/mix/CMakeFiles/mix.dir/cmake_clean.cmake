@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mix.dir/AudioMixer.cpp.o"
+  "CMakeFiles/mix.dir/AudioMixer.cpp.o.d"
+  "CMakeFiles/mix.dir/Mix.cpp.o"
+  "CMakeFiles/mix.dir/Mix.cpp.o.d"
+  "CMakeFiles/mix.dir/Mixer.cpp.o"
+  "CMakeFiles/mix.dir/Mixer.cpp.o.d"
+  "CMakeFiles/mix.dir/mix_kernels.cpp.o"
+  "CMakeFiles/mix.dir/mix_kernels.cpp.o.d"
+  "yuri2.8_module_mix.pdb"
+  "yuri2.8_module_mix.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/mix/Mixer.cpp" "src/modules/mix/CMakeFiles/module_mix_test.dir/Mixer.cpp.o" "gcc" "src/modules/mix/CMakeFiles/module_mix_test.dir/Mixer.cpp.o.d"
+  "/root/repo/src/modules/mix/mix_kernels.cpp" "src/modules/mix/CMakeFiles/module_mix_test.dir/mix_kernels.cpp.o" "gcc" "src/modules/mix/CMakeFiles/module_mix_test.dir/mix_kernels.cpp.o.d"
+  "/root/repo/src/modules/mix/test_mixer.cpp" "src/modules/mix/CMakeFiles/module_mix_test.dir/test_mixer.cpp.o" "gcc" "src/modules/mix/CMakeFiles/module_mix_test.dir/test_mixer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
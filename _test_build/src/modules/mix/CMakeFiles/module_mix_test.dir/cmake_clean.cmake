@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_mix_test"
+  "../../../bin/module_mix_test.pdb"
+  "CMakeFiles/module_mix_test.dir/Mixer.cpp.o"
+  "CMakeFiles/module_mix_test.dir/Mixer.cpp.o.d"
+  "CMakeFiles/module_mix_test.dir/mix_kernels.cpp.o"
+  "CMakeFiles/module_mix_test.dir/mix_kernels.cpp.o.d"
+  "CMakeFiles/module_mix_test.dir/test_mixer.cpp.o"
+  "CMakeFiles/module_mix_test.dir/test_mixer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_mix_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/mix
+# Build directory: /root/repo/_test_build/src/modules/mix
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_mix_test "/root/repo/_test_build/bin/module_mix_test")
+set_tests_properties(module_mix_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/mix/CMakeLists.txt;24;add_test;/root/repo/src/modules/mix/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mjpeg_to_jpeg.dir/MjpegToJpeg.cpp.o"
+  "CMakeFiles/mjpeg_to_jpeg.dir/MjpegToJpeg.cpp.o.d"
+  "yuri2.8_module_mjpeg_to_jpeg.pdb"
+  "yuri2.8_module_mjpeg_to_jpeg.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mjpeg_to_jpeg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mosaic.dir/Mosaic.cpp.o"
+  "CMakeFiles/mosaic.dir/Mosaic.cpp.o.d"
+  "yuri2.8_module_mosaic.pdb"
+  "yuri2.8_module_mosaic.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mosaic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
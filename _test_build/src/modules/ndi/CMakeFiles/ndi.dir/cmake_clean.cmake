@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ndi.dir/NDIInput.cpp.o"
+  "CMakeFiles/ndi.dir/NDIInput.cpp.o.d"
+  "CMakeFiles/ndi.dir/NDIOutput.cpp.o"
+  "CMakeFiles/ndi.dir/NDIOutput.cpp.o.d"
+  "CMakeFiles/ndi.dir/register.cpp.o"
+  "CMakeFiles/ndi.dir/register.cpp.o.d"
+  "CMakeFiles/ndi.dir/utils.cpp.o"
+  "CMakeFiles/ndi.dir/utils.cpp.o.d"
+  "yuri2.8_module_ndi.pdb"
+  "yuri2.8_module_ndi.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ndi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/null.dir/Null.cpp.o"
+  "CMakeFiles/null.dir/Null.cpp.o.d"
+  "yuri2.8_module_null.pdb"
+  "yuri2.8_module_null.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/null.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_osc_test"
+  "../../../bin/module_osc_test.pdb"
+  "CMakeFiles/module_osc_test.dir/osc_test.cpp.o"
+  "CMakeFiles/module_osc_test.dir/osc_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_osc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/osc/OSCReceiver.cpp" "src/modules/osc/CMakeFiles/osc_module.dir/OSCReceiver.cpp.o" "gcc" "src/modules/osc/CMakeFiles/osc_module.dir/OSCReceiver.cpp.o.d"
+  "/root/repo/src/modules/osc/OSCSender.cpp" "src/modules/osc/CMakeFiles/osc_module.dir/OSCSender.cpp.o" "gcc" "src/modules/osc/CMakeFiles/osc_module.dir/OSCSender.cpp.o.d"
+  "/root/repo/src/modules/osc/register.cpp" "src/modules/osc/CMakeFiles/osc_module.dir/register.cpp.o" "gcc" "src/modules/osc/CMakeFiles/osc_module.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osc_module.dir/OSCReceiver.cpp.o"
+  "CMakeFiles/osc_module.dir/OSCReceiver.cpp.o.d"
+  "CMakeFiles/osc_module.dir/OSCSender.cpp.o"
+  "CMakeFiles/osc_module.dir/OSCSender.cpp.o.d"
+  "CMakeFiles/osc_module.dir/register.cpp.o"
+  "CMakeFiles/osc_module.dir/register.cpp.o.d"
+  "yuri2.8_module_osc_module.pdb"
+  "yuri2.8_module_osc_module.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osc_module.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/osc
+# Build directory: /root/repo/_test_build/src/modules/osc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_osc_test "/root/repo/_test_build/bin/module_osc_test")
+set_tests_properties(module_osc_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/osc/CMakeLists.txt;23;add_test;/root/repo/src/modules/osc/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_overlay_test"
+  "../../../bin/module_overlay_test.pdb"
+  "CMakeFiles/module_overlay_test.dir/Overlay.cpp.o"
+  "CMakeFiles/module_overlay_test.dir/Overlay.cpp.o.d"
+  "CMakeFiles/module_overlay_test.dir/blend.cpp.o"
+  "CMakeFiles/module_overlay_test.dir/blend.cpp.o.d"
+  "CMakeFiles/module_overlay_test.dir/test_blend.cpp.o"
+  "CMakeFiles/module_overlay_test.dir/test_blend.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_overlay_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
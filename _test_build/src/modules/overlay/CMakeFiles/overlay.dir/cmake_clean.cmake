@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/overlay.dir/Overlay.cpp.o"
+  "CMakeFiles/overlay.dir/Overlay.cpp.o.d"
+  "CMakeFiles/overlay.dir/blend.cpp.o"
+  "CMakeFiles/overlay.dir/blend.cpp.o.d"
+  "yuri2.8_module_overlay.pdb"
+  "yuri2.8_module_overlay.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/overlay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/overlay
+# Build directory: /root/repo/_test_build/src/modules/overlay
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_overlay_test "/root/repo/_test_build/bin/module_overlay_test")
+set_tests_properties(module_overlay_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/overlay/CMakeLists.txt;20;add_test;/root/repo/src/modules/overlay/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pad.dir/Pad.cpp.o"
+  "CMakeFiles/pad.dir/Pad.cpp.o.d"
+  "yuri2.8_module_pad.pdb"
+  "yuri2.8_module_pad.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/png/PngDecoder.cpp" "src/modules/png/CMakeFiles/png_module.dir/PngDecoder.cpp.o" "gcc" "src/modules/png/CMakeFiles/png_module.dir/PngDecoder.cpp.o.d"
+  "/root/repo/src/modules/png/PngEncoder.cpp" "src/modules/png/CMakeFiles/png_module.dir/PngEncoder.cpp.o" "gcc" "src/modules/png/CMakeFiles/png_module.dir/PngEncoder.cpp.o.d"
+  "/root/repo/src/modules/png/register.cpp" "src/modules/png/CMakeFiles/png_module.dir/register.cpp.o" "gcc" "src/modules/png/CMakeFiles/png_module.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
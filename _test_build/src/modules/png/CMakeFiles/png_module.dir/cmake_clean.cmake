@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/png_module.dir/PngDecoder.cpp.o"
+  "CMakeFiles/png_module.dir/PngDecoder.cpp.o.d"
+  "CMakeFiles/png_module.dir/PngEncoder.cpp.o"
+  "CMakeFiles/png_module.dir/PngEncoder.cpp.o.d"
+  "CMakeFiles/png_module.dir/register.cpp.o"
+  "CMakeFiles/png_module.dir/register.cpp.o.d"
+  "yuri2.8_module_png_module.pdb"
+  "yuri2.8_module_png_module.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/png_module.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_rawfilesource_test"
+  "../../../bin/module_rawfilesource_test.pdb"
+  "CMakeFiles/module_rawfilesource_test.dir/ContainerReader.cpp.o"
+  "CMakeFiles/module_rawfilesource_test.dir/ContainerReader.cpp.o.d"
+  "CMakeFiles/module_rawfilesource_test.dir/__/filedump/FileDump.cpp.o"
+  "CMakeFiles/module_rawfilesource_test.dir/__/filedump/FileDump.cpp.o.d"
+  "CMakeFiles/module_rawfilesource_test.dir/test_container_reader.cpp.o"
+  "CMakeFiles/module_rawfilesource_test.dir/test_container_reader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_rawfilesource_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
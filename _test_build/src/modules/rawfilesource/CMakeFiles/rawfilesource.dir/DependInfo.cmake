@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/rawfilesource/BlockReader.cpp" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/BlockReader.cpp.o" "gcc" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/BlockReader.cpp.o.d"
+  "/root/repo/src/modules/rawfilesource/ContainerReader.cpp" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/ContainerReader.cpp.o" "gcc" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/ContainerReader.cpp.o.d"
+  "/root/repo/src/modules/rawfilesource/RawFileSource.cpp" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/RawFileSource.cpp.o" "gcc" "src/modules/rawfilesource/CMakeFiles/rawfilesource.dir/RawFileSource.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
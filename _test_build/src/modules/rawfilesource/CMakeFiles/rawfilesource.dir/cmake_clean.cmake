@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rawfilesource.dir/BlockReader.cpp.o"
+  "CMakeFiles/rawfilesource.dir/BlockReader.cpp.o.d"
+  "CMakeFiles/rawfilesource.dir/ContainerReader.cpp.o"
+  "CMakeFiles/rawfilesource.dir/ContainerReader.cpp.o.d"
+  "CMakeFiles/rawfilesource.dir/RawFileSource.cpp.o"
+  "CMakeFiles/rawfilesource.dir/RawFileSource.cpp.o.d"
+  "yuri2.8_module_rawfilesource.pdb"
+  "yuri2.8_module_rawfilesource.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rawfilesource.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/rawfilesource
+# Build directory: /root/repo/_test_build/src/modules/rawfilesource
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_rawfilesource_test "/root/repo/_test_build/bin/module_rawfilesource_test")
+set_tests_properties(module_rawfilesource_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/rawfilesource/CMakeLists.txt;24;add_test;/root/repo/src/modules/rawfilesource/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/repack_audio.dir/RepackAudio.cpp.o"
+  "CMakeFiles/repack_audio.dir/RepackAudio.cpp.o.d"
+  "yuri2.8_module_repack_audio.pdb"
+  "yuri2.8_module_repack_audio.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/repack_audio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rotate.dir/Rotate.cpp.o"
+  "CMakeFiles/rotate.dir/Rotate.cpp.o.d"
+  "yuri2.8_module_rotate.pdb"
+  "yuri2.8_module_rotate.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rotate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_scale_test"
+  "../../../bin/module_scale_test.pdb"
+  "CMakeFiles/module_scale_test.dir/Scale.cpp.o"
+  "CMakeFiles/module_scale_test.dir/Scale.cpp.o.d"
+  "CMakeFiles/module_scale_test.dir/resample.cpp.o"
+  "CMakeFiles/module_scale_test.dir/resample.cpp.o.d"
+  "CMakeFiles/module_scale_test.dir/test_resample.cpp.o"
+  "CMakeFiles/module_scale_test.dir/test_resample.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_scale_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scale.dir/Scale.cpp.o"
+  "CMakeFiles/scale.dir/Scale.cpp.o.d"
+  "CMakeFiles/scale.dir/resample.cpp.o"
+  "CMakeFiles/scale.dir/resample.cpp.o.d"
+  "yuri2.8_module_scale.pdb"
+  "yuri2.8_module_scale.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/screen_grab.dir/ScreenGrab.cpp.o"
+  "CMakeFiles/screen_grab.dir/ScreenGrab.cpp.o.d"
+  "yuri2.8_module_screen_grab.pdb"
+  "yuri2.8_module_screen_grab.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/screen_grab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/select.dir/Select.cpp.o"
+  "CMakeFiles/select.dir/Select.cpp.o.d"
+  "CMakeFiles/select.dir/Unselect.cpp.o"
+  "CMakeFiles/select.dir/Unselect.cpp.o.d"
+  "CMakeFiles/select.dir/register.cpp.o"
+  "CMakeFiles/select.dir/register.cpp.o.d"
+  "yuri2.8_module_select.pdb"
+  "yuri2.8_module_select.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/select.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_shm_test"
+  "../../../bin/module_shm_test.pdb"
+  "CMakeFiles/module_shm_test.dir/ShmRegion.cpp.o"
+  "CMakeFiles/module_shm_test.dir/ShmRegion.cpp.o.d"
+  "CMakeFiles/module_shm_test.dir/ShmSink.cpp.o"
+  "CMakeFiles/module_shm_test.dir/ShmSink.cpp.o.d"
+  "CMakeFiles/module_shm_test.dir/ShmSource.cpp.o"
+  "CMakeFiles/module_shm_test.dir/ShmSource.cpp.o.d"
+  "CMakeFiles/module_shm_test.dir/register.cpp.o"
+  "CMakeFiles/module_shm_test.dir/register.cpp.o.d"
+  "CMakeFiles/module_shm_test.dir/test_shm.cpp.o"
+  "CMakeFiles/module_shm_test.dir/test_shm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_shm_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
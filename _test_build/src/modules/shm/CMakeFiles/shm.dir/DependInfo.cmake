@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/shm/ShmRegion.cpp" "src/modules/shm/CMakeFiles/shm.dir/ShmRegion.cpp.o" "gcc" "src/modules/shm/CMakeFiles/shm.dir/ShmRegion.cpp.o.d"
+  "/root/repo/src/modules/shm/ShmSink.cpp" "src/modules/shm/CMakeFiles/shm.dir/ShmSink.cpp.o" "gcc" "src/modules/shm/CMakeFiles/shm.dir/ShmSink.cpp.o.d"
+  "/root/repo/src/modules/shm/ShmSource.cpp" "src/modules/shm/CMakeFiles/shm.dir/ShmSource.cpp.o" "gcc" "src/modules/shm/CMakeFiles/shm.dir/ShmSource.cpp.o.d"
+  "/root/repo/src/modules/shm/register.cpp" "src/modules/shm/CMakeFiles/shm.dir/register.cpp.o" "gcc" "src/modules/shm/CMakeFiles/shm.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm.dir/ShmRegion.cpp.o"
+  "CMakeFiles/shm.dir/ShmRegion.cpp.o.d"
+  "CMakeFiles/shm.dir/ShmSink.cpp.o"
+  "CMakeFiles/shm.dir/ShmSink.cpp.o.d"
+  "CMakeFiles/shm.dir/ShmSource.cpp.o"
+  "CMakeFiles/shm.dir/ShmSource.cpp.o.d"
+  "CMakeFiles/shm.dir/register.cpp.o"
+  "CMakeFiles/shm.dir/register.cpp.o.d"
+  "yuri2.8_module_shm.pdb"
+  "yuri2.8_module_shm.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
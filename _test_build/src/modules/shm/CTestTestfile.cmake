@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/shm
+# Build directory: /root/repo/_test_build/src/modules/shm
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_shm_test "/root/repo/_test_build/bin/module_shm_test")
+set_tests_properties(module_shm_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/shm/CMakeLists.txt;21;add_test;/root/repo/src/modules/shm/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shout_source.dir/ShoutSource.cpp.o"
+  "CMakeFiles/shout_source.dir/ShoutSource.cpp.o.d"
+  "yuri2.8_module_shout_source.pdb"
+  "yuri2.8_module_shout_source.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shout_source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/simple_rtp/AccessUnitAssembler.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/AccessUnitAssembler.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/AccessUnitAssembler.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/JitterBuffer.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/JitterBuffer.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/JitterBuffer.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/PacedSender.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/PacedSender.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/PacedSender.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/SimpleH264RtpReceiver.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpReceiver.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpReceiver.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/SimpleH264RtpSender.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpSender.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpSender.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/SimpleH265RtpReceiver.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpReceiver.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpReceiver.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/SimpleH265RtpSender.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpSender.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpSender.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/register.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/register.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/register.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/test_jitter_buffer.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/test_jitter_buffer.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/test_jitter_buffer.cpp.o.d"
+  "/root/repo/src/modules/simple_rtp/test_pacing.cpp" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/test_pacing.cpp.o" "gcc" "src/modules/simple_rtp/CMakeFiles/module_simple_rtp_test.dir/test_pacing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_simple_rtp_test"
+  "../../../bin/module_simple_rtp_test.pdb"
+  "CMakeFiles/module_simple_rtp_test.dir/AccessUnitAssembler.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/AccessUnitAssembler.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/JitterBuffer.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/JitterBuffer.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/PacedSender.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/PacedSender.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpReceiver.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpReceiver.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpSender.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH264RtpSender.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpReceiver.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpReceiver.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpSender.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/SimpleH265RtpSender.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/register.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/register.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/test_jitter_buffer.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/test_jitter_buffer.cpp.o.d"
+  "CMakeFiles/module_simple_rtp_test.dir/test_pacing.cpp.o"
+  "CMakeFiles/module_simple_rtp_test.dir/test_pacing.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_simple_rtp_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
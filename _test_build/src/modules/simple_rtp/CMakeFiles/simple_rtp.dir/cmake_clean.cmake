@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_rtp.dir/AccessUnitAssembler.cpp.o"
+  "CMakeFiles/simple_rtp.dir/AccessUnitAssembler.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/JitterBuffer.cpp.o"
+  "CMakeFiles/simple_rtp.dir/JitterBuffer.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/PacedSender.cpp.o"
+  "CMakeFiles/simple_rtp.dir/PacedSender.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/SimpleH264RtpReceiver.cpp.o"
+  "CMakeFiles/simple_rtp.dir/SimpleH264RtpReceiver.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/SimpleH264RtpSender.cpp.o"
+  "CMakeFiles/simple_rtp.dir/SimpleH264RtpSender.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/SimpleH265RtpReceiver.cpp.o"
+  "CMakeFiles/simple_rtp.dir/SimpleH265RtpReceiver.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/SimpleH265RtpSender.cpp.o"
+  "CMakeFiles/simple_rtp.dir/SimpleH265RtpSender.cpp.o.d"
+  "CMakeFiles/simple_rtp.dir/register.cpp.o"
+  "CMakeFiles/simple_rtp.dir/register.cpp.o.d"
+  "yuri2.8_module_simple_rtp.pdb"
+  "yuri2.8_module_simple_rtp.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_rtp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/simple_rtp
+# Build directory: /root/repo/_test_build/src/modules/simple_rtp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_simple_rtp_test "/root/repo/_test_build/bin/module_simple_rtp_test")
+set_tests_properties(module_simple_rtp_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/simple_rtp/CMakeLists.txt;32;add_test;/root/repo/src/modules/simple_rtp/CMakeLists.txt;0;")
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/sockets/UnixDatagramSocket.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/UnixDatagramSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/UnixDatagramSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/UnixStreamSocket.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/UnixStreamSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/UnixStreamSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriDatagram.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriDatagram.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriDatagram.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriNetSocket.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriNetSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriNetSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriStreamSocket.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriStreamSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriStreamSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriTcp.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriTcp.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriTcp.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriUdp.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriUdp.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriUdp.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriUdp6.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriUdp6.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/YuriUdp6.cpp.o.d"
+  "/root/repo/src/modules/sockets/inet_utils.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/inet_utils.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/inet_utils.cpp.o.d"
+  "/root/repo/src/modules/sockets/register.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/register.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/register.cpp.o.d"
+  "/root/repo/src/modules/sockets/test_batch.cpp" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/test_batch.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/module_yuri_net_test.dir/test_batch.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
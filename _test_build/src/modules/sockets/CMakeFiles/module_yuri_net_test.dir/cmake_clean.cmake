@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_yuri_net_test"
+  "../../../bin/module_yuri_net_test.pdb"
+  "CMakeFiles/module_yuri_net_test.dir/UnixDatagramSocket.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/UnixDatagramSocket.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/UnixStreamSocket.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/UnixStreamSocket.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriDatagram.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriDatagram.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriNetSocket.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriNetSocket.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriStreamSocket.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriStreamSocket.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriTcp.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriTcp.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriUdp.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriUdp.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/YuriUdp6.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/YuriUdp6.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/inet_utils.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/inet_utils.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/register.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/register.cpp.o.d"
+  "CMakeFiles/module_yuri_net_test.dir/test_batch.cpp.o"
+  "CMakeFiles/module_yuri_net_test.dir/test_batch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_yuri_net_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
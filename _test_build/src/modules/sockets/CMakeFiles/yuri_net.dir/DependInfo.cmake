@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/sockets/UnixDatagramSocket.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/UnixDatagramSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/UnixDatagramSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/UnixStreamSocket.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/UnixStreamSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/UnixStreamSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriDatagram.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriDatagram.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriDatagram.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriNetSocket.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriNetSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriNetSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriStreamSocket.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriStreamSocket.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriStreamSocket.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriTcp.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriTcp.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriTcp.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriUdp.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriUdp.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriUdp.cpp.o.d"
+  "/root/repo/src/modules/sockets/YuriUdp6.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriUdp6.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/YuriUdp6.cpp.o.d"
+  "/root/repo/src/modules/sockets/inet_utils.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/inet_utils.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/inet_utils.cpp.o.d"
+  "/root/repo/src/modules/sockets/register.cpp" "src/modules/sockets/CMakeFiles/yuri_net.dir/register.cpp.o" "gcc" "src/modules/sockets/CMakeFiles/yuri_net.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri_net.dir/UnixDatagramSocket.cpp.o"
+  "CMakeFiles/yuri_net.dir/UnixDatagramSocket.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/UnixStreamSocket.cpp.o"
+  "CMakeFiles/yuri_net.dir/UnixStreamSocket.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriDatagram.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriDatagram.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriNetSocket.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriNetSocket.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriStreamSocket.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriStreamSocket.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriTcp.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriTcp.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriUdp.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriUdp.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/YuriUdp6.cpp.o"
+  "CMakeFiles/yuri_net.dir/YuriUdp6.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/inet_utils.cpp.o"
+  "CMakeFiles/yuri_net.dir/inet_utils.cpp.o.d"
+  "CMakeFiles/yuri_net.dir/register.cpp.o"
+  "CMakeFiles/yuri_net.dir/register.cpp.o.d"
+  "yuri2.8_module_yuri_net.pdb"
+  "yuri2.8_module_yuri_net.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_net.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/sockets
+# Build directory: /root/repo/_test_build/src/modules/sockets
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_yuri_net_test "/root/repo/_test_build/bin/module_yuri_net_test")
+set_tests_properties(module_yuri_net_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/sockets/CMakeLists.txt;36;add_test;/root/repo/src/modules/sockets/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/split.dir/Split.cpp.o"
+  "CMakeFiles/split.dir/Split.cpp.o.d"
+  "yuri2.8_module_split.pdb"
+  "yuri2.8_module_split.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/split_frames.dir/SplitFrames.cpp.o"
+  "CMakeFiles/split_frames.dir/SplitFrames.cpp.o.d"
+  "yuri2.8_module_split_frames.pdb"
+  "yuri2.8_module_split_frames.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split_frames.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/split_planes.dir/SplitPlanes.cpp.o"
+  "CMakeFiles/split_planes.dir/SplitPlanes.cpp.o.d"
+  "yuri2.8_module_split_planes.pdb"
+  "yuri2.8_module_split_planes.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split_planes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
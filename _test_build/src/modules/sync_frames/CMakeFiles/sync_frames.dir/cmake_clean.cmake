@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sync_frames.dir/SyncFrames.cpp.o"
+  "CMakeFiles/sync_frames.dir/SyncFrames.cpp.o.d"
+  "yuri2.8_module_sync_frames.pdb"
+  "yuri2.8_module_sync_frames.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sync_frames.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
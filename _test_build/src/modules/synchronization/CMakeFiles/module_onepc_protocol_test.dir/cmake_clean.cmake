@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_onepc_protocol_test"
+  "../../../bin/module_onepc_protocol_test.pdb"
+  "CMakeFiles/module_onepc_protocol_test.dir/OnepcProtocolCohort.cpp.o"
+  "CMakeFiles/module_onepc_protocol_test.dir/OnepcProtocolCohort.cpp.o.d"
+  "CMakeFiles/module_onepc_protocol_test.dir/OnepcProtocolCoordinator.cpp.o"
+  "CMakeFiles/module_onepc_protocol_test.dir/OnepcProtocolCoordinator.cpp.o.d"
+  "CMakeFiles/module_onepc_protocol_test.dir/onepc_protocol_test.cpp.o"
+  "CMakeFiles/module_onepc_protocol_test.dir/onepc_protocol_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_onepc_protocol_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
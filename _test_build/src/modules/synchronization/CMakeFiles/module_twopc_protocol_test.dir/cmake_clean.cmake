@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_twopc_protocol_test"
+  "../../../bin/module_twopc_protocol_test.pdb"
+  "CMakeFiles/module_twopc_protocol_test.dir/twopc_protocol_test.cpp.o"
+  "CMakeFiles/module_twopc_protocol_test.dir/twopc_protocol_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_twopc_protocol_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/synchronization/DelayEstimation.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/DelayEstimation.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/DelayEstimation.cpp.o.d"
+  "/root/repo/src/modules/synchronization/OnepcProtocolCohort.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/OnepcProtocolCohort.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/OnepcProtocolCohort.cpp.o.d"
+  "/root/repo/src/modules/synchronization/OnepcProtocolCoordinator.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/OnepcProtocolCoordinator.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/OnepcProtocolCoordinator.cpp.o.d"
+  "/root/repo/src/modules/synchronization/PlaybackController.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/PlaybackController.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/PlaybackController.cpp.o.d"
+  "/root/repo/src/modules/synchronization/TimestampObserver.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/TimestampObserver.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/TimestampObserver.cpp.o.d"
+  "/root/repo/src/modules/synchronization/TwopcProtocolCohort.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcProtocolCohort.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcProtocolCohort.cpp.o.d"
+  "/root/repo/src/modules/synchronization/TwopcProtocolCoordinator.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcProtocolCoordinator.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcProtocolCoordinator.cpp.o.d"
+  "/root/repo/src/modules/synchronization/TwopcTimeoutProtocolCohort.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCohort.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCohort.cpp.o.d"
+  "/root/repo/src/modules/synchronization/TwopcTimeoutProtocolCoordinator.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCoordinator.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCoordinator.cpp.o.d"
+  "/root/repo/src/modules/synchronization/register.cpp" "src/modules/synchronization/CMakeFiles/synchronization.dir/register.cpp.o" "gcc" "src/modules/synchronization/CMakeFiles/synchronization.dir/register.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/synchronization.dir/DelayEstimation.cpp.o"
+  "CMakeFiles/synchronization.dir/DelayEstimation.cpp.o.d"
+  "CMakeFiles/synchronization.dir/OnepcProtocolCohort.cpp.o"
+  "CMakeFiles/synchronization.dir/OnepcProtocolCohort.cpp.o.d"
+  "CMakeFiles/synchronization.dir/OnepcProtocolCoordinator.cpp.o"
+  "CMakeFiles/synchronization.dir/OnepcProtocolCoordinator.cpp.o.d"
+  "CMakeFiles/synchronization.dir/PlaybackController.cpp.o"
+  "CMakeFiles/synchronization.dir/PlaybackController.cpp.o.d"
+  "CMakeFiles/synchronization.dir/TimestampObserver.cpp.o"
+  "CMakeFiles/synchronization.dir/TimestampObserver.cpp.o.d"
+  "CMakeFiles/synchronization.dir/TwopcProtocolCohort.cpp.o"
+  "CMakeFiles/synchronization.dir/TwopcProtocolCohort.cpp.o.d"
+  "CMakeFiles/synchronization.dir/TwopcProtocolCoordinator.cpp.o"
+  "CMakeFiles/synchronization.dir/TwopcProtocolCoordinator.cpp.o.d"
+  "CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCohort.cpp.o"
+  "CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCohort.cpp.o.d"
+  "CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCoordinator.cpp.o"
+  "CMakeFiles/synchronization.dir/TwopcTimeoutProtocolCoordinator.cpp.o.d"
+  "CMakeFiles/synchronization.dir/register.cpp.o"
+  "CMakeFiles/synchronization.dir/register.cpp.o.d"
+  "yuri2.8_module_synchronization.pdb"
+  "yuri2.8_module_synchronization.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synchronization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
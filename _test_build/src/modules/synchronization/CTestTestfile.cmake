@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/synchronization
+# Build directory: /root/repo/_test_build/src/modules/synchronization
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_onepc_protocol_test "/root/repo/_test_build/bin/module_onepc_protocol_test")
+set_tests_properties(module_onepc_protocol_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/synchronization/CMakeLists.txt;48;add_test;/root/repo/src/modules/synchronization/CMakeLists.txt;0;")
+add_test(module_twopc_protocol_test "/root/repo/_test_build/bin/module_twopc_protocol_test")
+set_tests_properties(module_twopc_protocol_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/synchronization/CMakeLists.txt;52;add_test;/root/repo/src/modules/synchronization/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testcard.dir/TestCard.cpp.o"
+  "CMakeFiles/testcard.dir/TestCard.cpp.o.d"
+  "yuri2.8_module_testcard.pdb"
+  "yuri2.8_module_testcard.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testcard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
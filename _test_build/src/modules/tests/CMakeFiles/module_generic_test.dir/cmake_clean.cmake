@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_generic_test"
+  "../../../bin/module_generic_test.pdb"
+  "CMakeFiles/module_generic_test.dir/test_modules.cpp.o"
+  "CMakeFiles/module_generic_test.dir/test_modules.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_generic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
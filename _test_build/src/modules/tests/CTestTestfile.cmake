@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/tests
+# Build directory: /root/repo/_test_build/src/modules/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_generic_test "/root/repo/_test_build/bin/module_generic_test" "WORKING_DIRECTORY" "/root/repo/_test_build/bin/..")
+set_tests_properties(module_generic_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/tests/CMakeLists.txt;4;add_test;/root/repo/src/modules/tests/CMakeLists.txt;0;")
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/v4l2/V4l2Source.cpp" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/V4l2Source.cpp.o" "gcc" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/V4l2Source.cpp.o.d"
+  "/root/repo/src/modules/v4l2/v4l2_controls.cpp" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/v4l2_controls.cpp.o" "gcc" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/v4l2_controls.cpp.o.d"
+  "/root/repo/src/modules/v4l2/v4l2_device.cpp" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/v4l2_device.cpp.o" "gcc" "src/modules/v4l2/CMakeFiles/v4l2_source.dir/v4l2_device.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
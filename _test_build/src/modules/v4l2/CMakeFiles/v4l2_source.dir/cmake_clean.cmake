@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/v4l2_source.dir/V4l2Source.cpp.o"
+  "CMakeFiles/v4l2_source.dir/V4l2Source.cpp.o.d"
+  "CMakeFiles/v4l2_source.dir/v4l2_controls.cpp.o"
+  "CMakeFiles/v4l2_source.dir/v4l2_controls.cpp.o.d"
+  "CMakeFiles/v4l2_source.dir/v4l2_device.cpp.o"
+  "CMakeFiles/v4l2_source.dir/v4l2_device.cpp.o.d"
+  "yuri2.8_module_v4l2_source.pdb"
+  "yuri2.8_module_v4l2_source.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/v4l2_source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
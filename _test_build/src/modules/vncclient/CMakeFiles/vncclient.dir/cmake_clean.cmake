@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vncclient.dir/VNCClient.cpp.o"
+  "CMakeFiles/vncclient.dir/VNCClient.cpp.o.d"
+  "yuri2.8_module_vncclient.pdb"
+  "yuri2.8_module_vncclient.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vncclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
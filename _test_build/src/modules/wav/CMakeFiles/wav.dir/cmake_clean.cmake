@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wav.dir/WaveDump.cpp.o"
+  "CMakeFiles/wav.dir/WaveDump.cpp.o.d"
+  "yuri2.8_module_wav.pdb"
+  "yuri2.8_module_wav.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wav.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
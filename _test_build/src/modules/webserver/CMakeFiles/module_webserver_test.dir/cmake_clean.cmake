@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_webserver_test"
+  "../../../bin/module_webserver_test.pdb"
+  "CMakeFiles/module_webserver_test.dir/base64.cpp.o"
+  "CMakeFiles/module_webserver_test.dir/base64.cpp.o.d"
+  "CMakeFiles/module_webserver_test.dir/test_encoding.cpp.o"
+  "CMakeFiles/module_webserver_test.dir/test_encoding.cpp.o.d"
+  "CMakeFiles/module_webserver_test.dir/urlencode.cpp.o"
+  "CMakeFiles/module_webserver_test.dir/urlencode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_webserver_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
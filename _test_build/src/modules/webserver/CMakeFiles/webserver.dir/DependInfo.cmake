@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/webserver/WebControlResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebControlResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebControlResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebDataResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebDataResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebDataResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebDirectoryResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebDirectoryResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebDirectoryResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebImageResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebImageResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebImageResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebMetricsResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebMetricsResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebMetricsResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebPageGenerator.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebPageGenerator.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebPageGenerator.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebServer.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebServer.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebServer.cpp.o.d"
+  "/root/repo/src/modules/webserver/WebStaticResource.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/WebStaticResource.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/WebStaticResource.cpp.o.d"
+  "/root/repo/src/modules/webserver/base64.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/base64.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/base64.cpp.o.d"
+  "/root/repo/src/modules/webserver/register.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/register.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/register.cpp.o.d"
+  "/root/repo/src/modules/webserver/urlencode.cpp" "src/modules/webserver/CMakeFiles/webserver.dir/urlencode.cpp.o" "gcc" "src/modules/webserver/CMakeFiles/webserver.dir/urlencode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
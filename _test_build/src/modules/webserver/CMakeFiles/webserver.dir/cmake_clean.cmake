@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/webserver.dir/WebControlResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebControlResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebDataResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebDataResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebDirectoryResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebDirectoryResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebImageResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebImageResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebMetricsResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebMetricsResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebPageGenerator.cpp.o"
+  "CMakeFiles/webserver.dir/WebPageGenerator.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebServer.cpp.o"
+  "CMakeFiles/webserver.dir/WebServer.cpp.o.d"
+  "CMakeFiles/webserver.dir/WebStaticResource.cpp.o"
+  "CMakeFiles/webserver.dir/WebStaticResource.cpp.o.d"
+  "CMakeFiles/webserver.dir/base64.cpp.o"
+  "CMakeFiles/webserver.dir/base64.cpp.o.d"
+  "CMakeFiles/webserver.dir/register.cpp.o"
+  "CMakeFiles/webserver.dir/register.cpp.o.d"
+  "CMakeFiles/webserver.dir/urlencode.cpp.o"
+  "CMakeFiles/webserver.dir/urlencode.cpp.o.d"
+  "yuri2.8_module_webserver.pdb"
+  "yuri2.8_module_webserver.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/webserver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/modules/webserver
+# Build directory: /root/repo/_test_build/src/modules/webserver
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(module_webserver_test "/root/repo/_test_build/bin/module_webserver_test")
+set_tests_properties(module_webserver_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/modules/webserver/CMakeLists.txt;44;add_test;/root/repo/src/modules/webserver/CMakeLists.txt;0;")
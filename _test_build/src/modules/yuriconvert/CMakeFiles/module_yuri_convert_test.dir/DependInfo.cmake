@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/modules/yuriconvert/YuriConvert.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/YuriConvert.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/YuriConvert.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_10bit_rgb.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_10bit_rgb.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_10bit_rgb.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_rgb.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_rgb.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_rgb.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_single.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_single.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_single.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_yuv.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_yuv422.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv422.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv422.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_yuv_rgb.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/convert_yuv_rgb_simd.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb_simd.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb_simd.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/converters_all.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/converters_all.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/converters_all.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/test_fused_convert.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/test_fused_convert.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/test_fused_convert.cpp.o.d"
+  "/root/repo/src/modules/yuriconvert/test_yuv_rgb_simd.cpp" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/test_yuv_rgb_simd.cpp.o" "gcc" "src/modules/yuriconvert/CMakeFiles/module_yuri_convert_test.dir/test_yuv_rgb_simd.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../bin/module_yuri_convert_test"
+  "../../../bin/module_yuri_convert_test.pdb"
+  "CMakeFiles/module_yuri_convert_test.dir/YuriConvert.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/YuriConvert.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_10bit_rgb.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_10bit_rgb.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_rgb.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_rgb.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_single.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_single.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv422.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv422.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb_simd.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/convert_yuv_rgb_simd.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/converters_all.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/converters_all.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/test_fused_convert.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/test_fused_convert.cpp.o.d"
+  "CMakeFiles/module_yuri_convert_test.dir/test_yuv_rgb_simd.cpp.o"
+  "CMakeFiles/module_yuri_convert_test.dir/test_yuv_rgb_simd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module_yuri_convert_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri_convert.dir/YuriConvert.cpp.o"
+  "CMakeFiles/yuri_convert.dir/YuriConvert.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_10bit_rgb.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_10bit_rgb.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_rgb.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_rgb.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_single.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_single.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_yuv.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_yuv.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_yuv422.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_yuv422.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_yuv_rgb.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_yuv_rgb.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/convert_yuv_rgb_simd.cpp.o"
+  "CMakeFiles/yuri_convert.dir/convert_yuv_rgb_simd.cpp.o.d"
+  "CMakeFiles/yuri_convert.dir/converters_all.cpp.o"
+  "CMakeFiles/yuri_convert.dir/converters_all.cpp.o.d"
+  "yuri2.8_module_yuri_convert.pdb"
+  "yuri2.8_module_yuri_convert.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
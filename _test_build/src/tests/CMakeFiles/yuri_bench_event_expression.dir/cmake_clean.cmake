@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_bench_event_expression"
+  "../../bin/yuri_bench_event_expression.pdb"
+  "CMakeFiles/yuri_bench_event_expression.dir/bench_event_expression.cpp.o"
+  "CMakeFiles/yuri_bench_event_expression.dir/bench_event_expression.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_bench_event_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_bench_pipes"
+  "../../bin/yuri_bench_pipes.pdb"
+  "CMakeFiles/yuri_bench_pipes.dir/bench_pipes.cpp.o"
+  "CMakeFiles/yuri_bench_pipes.dir/bench_pipes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_bench_pipes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri_test_main.dir/test_main.cpp.o"
+  "CMakeFiles/yuri_test_main.dir/test_main.cpp.o.d"
+  "libyuri_test_main.a"
+  "libyuri_test_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_test_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
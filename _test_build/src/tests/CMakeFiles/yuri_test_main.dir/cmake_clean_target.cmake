@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libyuri_test_main.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_test_register"
+  "../../bin/yuri_test_register.pdb"
+  "CMakeFiles/yuri_test_register.dir/test_register.cpp.o"
+  "CMakeFiles/yuri_test_register.dir/test_register.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_test_register.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tests/test_any.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_any.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_any.cpp.o.d"
+  "/root/repo/src/tests/test_async_file.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_async_file.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_async_file.cpp.o.d"
+  "/root/repo/src/tests/test_audio_ring.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_audio_ring.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_audio_ring.cpp.o.d"
+  "/root/repo/src/tests/test_base.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_base.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_base.cpp.o.d"
+  "/root/repo/src/tests/test_color.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_color.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_color.cpp.o.d"
+  "/root/repo/src/tests/test_convert_costs.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_convert_costs.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_convert_costs.cpp.o.d"
+  "/root/repo/src/tests/test_cpu_features.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_cpu_features.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_cpu_features.cpp.o.d"
+  "/root/repo/src/tests/test_event_expression.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_event_expression.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_event_expression.cpp.o.d"
+  "/root/repo/src/tests/test_event_queue.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_event_queue.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_event_queue.cpp.o.d"
+  "/root/repo/src/tests/test_filesystem.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_filesystem.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_filesystem.cpp.o.d"
+  "/root/repo/src/tests/test_frame_container.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_frame_container.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_frame_container.cpp.o.d"
+  "/root/repo/src/tests/test_frame_copy.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_frame_copy.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_frame_copy.cpp.o.d"
+  "/root/repo/src/tests/test_irange.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_irange.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_irange.cpp.o.d"
+  "/root/repo/src/tests/test_make_list.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_make_list.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_make_list.cpp.o.d"
+  "/root/repo/src/tests/test_memory_pool.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_memory_pool.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_memory_pool.cpp.o.d"
+  "/root/repo/src/tests/test_metrics.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_metrics.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_metrics.cpp.o.d"
+  "/root/repo/src/tests/test_parameters.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_parameters.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_parameters.cpp.o.d"
+  "/root/repo/src/tests/test_pipes.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_pipes.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_pipes.cpp.o.d"
+  "/root/repo/src/tests/test_scheduler.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_scheduler.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_scheduler.cpp.o.d"
+  "/root/repo/src/tests/test_state_table.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_state_table.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_state_table.cpp.o.d"
+  "/root/repo/src/tests/test_string.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_string.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_string.cpp.o.d"
+  "/root/repo/src/tests/test_string_generator.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_string_generator.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_string_generator.cpp.o.d"
+  "/root/repo/src/tests/test_tracing.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_tracing.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_tracing.cpp.o.d"
+  "/root/repo/src/tests/test_utf8.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_utf8.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_utf8.cpp.o.d"
+  "/root/repo/src/tests/test_utils.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_utils.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_utils.cpp.o.d"
+  "/root/repo/src/tests/test_worker_pool.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/test_worker_pool.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/test_worker_pool.cpp.o.d"
+  "/root/repo/src/tests/time_tests.cpp" "src/tests/CMakeFiles/yuri_test_suite.dir/time_tests.cpp.o" "gcc" "src/tests/CMakeFiles/yuri_test_suite.dir/time_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/tests/CMakeFiles/yuri_test_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
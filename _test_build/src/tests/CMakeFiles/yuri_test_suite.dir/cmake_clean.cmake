@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "../../bin/yuri_test_suite"
+  "../../bin/yuri_test_suite.pdb"
+  "CMakeFiles/yuri_test_suite.dir/test_any.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_any.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_async_file.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_async_file.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_audio_ring.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_audio_ring.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_base.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_base.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_color.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_color.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_convert_costs.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_convert_costs.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_cpu_features.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_cpu_features.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_event_expression.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_event_expression.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_event_queue.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_event_queue.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_filesystem.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_filesystem.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_frame_container.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_frame_container.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_frame_copy.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_frame_copy.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_irange.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_irange.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_make_list.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_make_list.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_memory_pool.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_memory_pool.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_metrics.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_metrics.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_parameters.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_parameters.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_pipes.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_pipes.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_scheduler.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_scheduler.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_state_table.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_state_table.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_string.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_string.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_string_generator.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_string_generator.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_tracing.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_tracing.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_utf8.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_utf8.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_utils.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_utils.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/test_worker_pool.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/test_worker_pool.cpp.o.d"
+  "CMakeFiles/yuri_test_suite.dir/time_tests.cpp.o"
+  "CMakeFiles/yuri_test_suite.dir/time_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_test_suite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
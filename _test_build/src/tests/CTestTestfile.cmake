@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/tests
+# Build directory: /root/repo/_test_build/src/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core_test "/root/repo/_test_build/bin/yuri_test_suite")
+set_tests_properties(core_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;54;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(register_test "/root/repo/_test_build/bin/yuri_test_register")
+set_tests_properties(register_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;55;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
@@ -0,0 +1,101 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/yuri/core/frame/AudioFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/AudioFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/AudioFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/CompressedVideoFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/CompressedVideoFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/CompressedVideoFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/EventFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/EventFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/EventFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/Frame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/Frame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/Frame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/RawAudioFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/RawAudioFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/RawAudioFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/RawVideoFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/RawVideoFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/RawVideoFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/VideoFrame.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/VideoFrame.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/VideoFrame.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/compressed_frame_params.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/compressed_frame_params.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/compressed_frame_params.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/copy_statistics.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/copy_statistics.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/copy_statistics.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/frame_container.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/frame_container.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/frame_container.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/raw_audio_frame_params.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/raw_audio_frame_params.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/raw_audio_frame_params.cpp.o.d"
+  "/root/repo/src/yuri/core/frame/raw_frame_params.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/raw_frame_params.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/frame/raw_frame_params.cpp.o.d"
+  "/root/repo/src/yuri/core/parameter/Parameters.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/parameter/Parameters.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/parameter/Parameters.cpp.o.d"
+  "/root/repo/src/yuri/core/pipe/Pipe.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/Pipe.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/Pipe.cpp.o.d"
+  "/root/repo/src/yuri/core/pipe/PipeGenerator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipeGenerator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipeGenerator.cpp.o.d"
+  "/root/repo/src/yuri/core/pipe/PipeNotification.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipeNotification.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipeNotification.cpp.o.d"
+  "/root/repo/src/yuri/core/pipe/PipePolicies.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipePolicies.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/PipePolicies.cpp.o.d"
+  "/root/repo/src/yuri/core/pipe/SpecialPipes.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/SpecialPipes.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/pipe/SpecialPipes.cpp.o.d"
+  "/root/repo/src/yuri/core/socket/DatagramSocket.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocket.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocket.cpp.o.d"
+  "/root/repo/src/yuri/core/socket/DatagramSocketGenerator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocketGenerator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocketGenerator.cpp.o.d"
+  "/root/repo/src/yuri/core/socket/NullSockets.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/NullSockets.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/NullSockets.cpp.o.d"
+  "/root/repo/src/yuri/core/socket/StreamSocket.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocket.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocket.cpp.o.d"
+  "/root/repo/src/yuri/core/socket/StreamSocketGenerator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocketGenerator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocketGenerator.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/Convert.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/Convert.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/Convert.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ConvertUtils.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConvertUtils.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConvertUtils.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ConverterRegister.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConverterRegister.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConverterRegister.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ConverterThread.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConverterThread.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ConverterThread.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/FixedMemoryAllocator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/FixedMemoryAllocator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/FixedMemoryAllocator.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/GenericBuilder.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/GenericBuilder.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/GenericBuilder.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/IOFilter.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOFilter.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOFilter.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/IOThread.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOThread.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOThread.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/IOThreadGenerator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOThreadGenerator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/IOThreadGenerator.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/InputRegister.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/InputRegister.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/InputRegister.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/InputThread.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/InputThread.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/InputThread.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/MultiIOFilter.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/MultiIOFilter.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/MultiIOFilter.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/PipeConnector.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/PipeConnector.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/PipeConnector.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/Scheduler.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/Scheduler.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/Scheduler.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ThreadBase.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadBase.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadBase.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ThreadChild.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadChild.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadChild.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/ThreadSpawn.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadSpawn.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/ThreadSpawn.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/WorkerPool.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/WorkerPool.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/WorkerPool.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/XmlBuilder.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/XmlBuilder.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/XmlBuilder.cpp.o.d"
+  "/root/repo/src/yuri/core/thread/builder_utils.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/builder_utils.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/thread/builder_utils.cpp.o.d"
+  "/root/repo/src/yuri/core/tinyxml/tinystr.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinystr.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinystr.cpp.o.d"
+  "/root/repo/src/yuri/core/tinyxml/tinyxml.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxml.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxml.cpp.o.d"
+  "/root/repo/src/yuri/core/tinyxml/tinyxmlerror.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlerror.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlerror.cpp.o.d"
+  "/root/repo/src/yuri/core/tinyxml/tinyxmlparser.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlparser.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlparser.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/AsyncFile.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/AsyncFile.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/AsyncFile.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/AudioRing.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/AudioRing.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/AudioRing.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/DirectoryBrowser.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/DirectoryBrowser.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/DirectoryBrowser.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/ModuleLoader.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/ModuleLoader.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/ModuleLoader.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/Timer.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/Timer.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/Timer.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/color.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/color.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/color.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/color_events.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/color_events.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/color_events.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/cpu_features.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/cpu_features.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/cpu_features.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/environment.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/environment.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/environment.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/frame_info.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/frame_info.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/frame_info.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/global_time.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/global_time.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/global_time.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/hostname.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/hostname.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/hostname.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/metrics.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/metrics.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/metrics.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/string_generator.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/string_generator.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/string_generator.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/tracing.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/tracing.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/tracing.cpp.o.d"
+  "/root/repo/src/yuri/core/utils/wall_time.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/wall_time.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/core/utils/wall_time.cpp.o.d"
+  "/root/repo/src/yuri/event/BasicEventConsumer.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventConsumer.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventConsumer.cpp.o.d"
+  "/root/repo/src/yuri/event/BasicEventConversions.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventConversions.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventConversions.cpp.o.d"
+  "/root/repo/src/yuri/event/BasicEventParser.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventParser.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventParser.cpp.o.d"
+  "/root/repo/src/yuri/event/BasicEventProducer.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventProducer.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/BasicEventProducer.cpp.o.d"
+  "/root/repo/src/yuri/event/EventExpression.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/EventExpression.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/EventExpression.cpp.o.d"
+  "/root/repo/src/yuri/event/EventQueue.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/EventQueue.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/EventQueue.cpp.o.d"
+  "/root/repo/src/yuri/event/functions.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/functions.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/event/functions.cpp.o.d"
+  "/root/repo/src/yuri/exception/Exception.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/Exception.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/Exception.cpp.o.d"
+  "/root/repo/src/yuri/exception/InitializationFailed.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/InitializationFailed.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/InitializationFailed.cpp.o.d"
+  "/root/repo/src/yuri/exception/NotImplemented.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/NotImplemented.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/NotImplemented.cpp.o.d"
+  "/root/repo/src/yuri/exception/OutOfRange.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/OutOfRange.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/exception/OutOfRange.cpp.o.d"
+  "/root/repo/src/yuri/log/Log.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/log/Log.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/log/Log.cpp.o.d"
+  "/root/repo/_test_build/src/yuri/version.cpp" "src/yuri/CMakeFiles/yuri2.8_core.dir/version.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_core.dir/version.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/src/yuri/libyuri2.8_core.so" "/root/repo/_test_build/src/yuri/libyuri2.8_core.so.2.8"
+  "/root/repo/_test_build/src/yuri/libyuri2.8_core.so.2.8.0" "/root/repo/_test_build/src/yuri/libyuri2.8_core.so.2.8"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
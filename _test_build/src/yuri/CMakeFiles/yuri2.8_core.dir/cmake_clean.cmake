@@ -0,0 +1,163 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri2.8_core.dir/core/frame/AudioFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/AudioFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/CompressedVideoFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/CompressedVideoFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/EventFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/EventFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/Frame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/Frame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/RawAudioFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/RawAudioFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/RawVideoFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/RawVideoFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/VideoFrame.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/VideoFrame.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/compressed_frame_params.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/compressed_frame_params.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/copy_statistics.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/copy_statistics.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/frame_container.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/frame_container.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/raw_audio_frame_params.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/raw_audio_frame_params.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/raw_frame_params.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/frame/raw_frame_params.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/parameter/Parameters.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/parameter/Parameters.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/Pipe.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/Pipe.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipeGenerator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipeGenerator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipeNotification.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipeNotification.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipePolicies.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/PipePolicies.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/SpecialPipes.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/pipe/SpecialPipes.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocket.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocket.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocketGenerator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/DatagramSocketGenerator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/NullSockets.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/NullSockets.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocket.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocket.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocketGenerator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/socket/StreamSocketGenerator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/Convert.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/Convert.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConvertUtils.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConvertUtils.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConverterRegister.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConverterRegister.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConverterThread.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ConverterThread.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/FixedMemoryAllocator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/FixedMemoryAllocator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/GenericBuilder.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/GenericBuilder.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOFilter.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOFilter.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOThread.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOThread.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOThreadGenerator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/IOThreadGenerator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/InputRegister.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/InputRegister.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/InputThread.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/InputThread.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/MultiIOFilter.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/MultiIOFilter.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/PipeConnector.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/PipeConnector.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/Scheduler.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/Scheduler.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadBase.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadBase.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadChild.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadChild.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadSpawn.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/ThreadSpawn.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/WorkerPool.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/WorkerPool.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/XmlBuilder.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/XmlBuilder.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/builder_utils.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/thread/builder_utils.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinystr.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinystr.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxml.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxml.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlerror.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlerror.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlparser.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/tinyxml/tinyxmlparser.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/AsyncFile.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/AsyncFile.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/AudioRing.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/AudioRing.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/DirectoryBrowser.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/DirectoryBrowser.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/ModuleLoader.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/ModuleLoader.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/Timer.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/Timer.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/color.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/color.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/color_events.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/color_events.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/cpu_features.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/cpu_features.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/environment.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/environment.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/frame_info.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/frame_info.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/global_time.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/global_time.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/hostname.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/hostname.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/metrics.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/metrics.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/string_generator.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/string_generator.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/tracing.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/tracing.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/wall_time.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/core/utils/wall_time.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventConsumer.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventConsumer.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventConversions.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventConversions.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventParser.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventParser.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventProducer.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/BasicEventProducer.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/EventExpression.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/EventExpression.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/EventQueue.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/EventQueue.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/event/functions.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/event/functions.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/exception/Exception.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/exception/Exception.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/exception/InitializationFailed.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/exception/InitializationFailed.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/exception/NotImplemented.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/exception/NotImplemented.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/exception/OutOfRange.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/exception/OutOfRange.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/log/Log.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/log/Log.cpp.o.d"
+  "CMakeFiles/yuri2.8_core.dir/version.cpp.o"
+  "CMakeFiles/yuri2.8_core.dir/version.cpp.o.d"
+  "libyuri2.8_core.pdb"
+  "libyuri2.8_core.so"
+  "libyuri2.8_core.so.2.8"
+  "libyuri2.8_core.so.2.8.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri2.8_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/yuri/gl/FBGrabber.cpp" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/FBGrabber.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/FBGrabber.cpp.o.d"
+  "/root/repo/src/yuri/gl/GL.cpp" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GL.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GL.cpp.o.d"
+  "/root/repo/src/yuri/gl/GLProgram.cpp" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GLProgram.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GLProgram.cpp.o.d"
+  "/root/repo/src/yuri/gl/GLShader.cpp" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GLShader.cpp.o" "gcc" "src/yuri/CMakeFiles/yuri2.8_helper_gl.dir/gl/GLShader.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_test_build/src/yuri/libyuri2.8_helper_gl.so" "/root/repo/_test_build/src/yuri/libyuri2.8_helper_gl.so.2.8"
+  "/root/repo/_test_build/src/yuri/libyuri2.8_helper_gl.so.2.8.0" "/root/repo/_test_build/src/yuri/libyuri2.8_helper_gl.so.2.8"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/yuri/CMakeFiles/yuri2.8_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/FBGrabber.cpp.o"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/FBGrabber.cpp.o.d"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GL.cpp.o"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GL.cpp.o.d"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GLProgram.cpp.o"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GLProgram.cpp.o.d"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GLShader.cpp.o"
+  "CMakeFiles/yuri2.8_helper_gl.dir/gl/GLShader.cpp.o.d"
+  "libyuri2.8_helper_gl.pdb"
+  "libyuri2.8_helper_gl.so"
+  "libyuri2.8_helper_gl.so.2.8"
+  "libyuri2.8_helper_gl.so.2.8.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri2.8_helper_gl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
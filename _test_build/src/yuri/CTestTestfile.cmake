@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/yuri
+# Build directory: /root/repo/_test_build/src/yuri
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("log")
+subdirs("exception")
+subdirs("core")
+subdirs("event")
+subdirs("gl")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/yuri_core_test"
+  "../../../bin/yuri_core_test.pdb"
+  "CMakeFiles/yuri_core_test.dir/test.cpp.o"
+  "CMakeFiles/yuri_core_test.dir/test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/yuri_core_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
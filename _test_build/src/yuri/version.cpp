@@ -0,0 +1,14 @@
+/*!
+ * @file 		version.cpp
+ * @author 		Zdenek Travnicek
+ * @date 		12.2.2013
+ * @date		16.2.2013
+ * @copyright	Institute of Intermedia, CTU in Prague, 2013
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+ 
+#include "yuri/version.h"
+namespace yuri {
+	const char * yuri_version = "-128-NOTFOUND";
+}
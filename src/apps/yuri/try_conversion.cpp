@@ -52,6 +52,7 @@ void try_conversion(yuri::log::Log& l_,format_t format_in, format_t format_out)
 		for (const auto& x: xpath.first) {
 			ll << " -> [" << x.name <<"] -> " << get_format_name_no_throw(x.target_format);
 		}
+		ll << " (cost " << xpath.second << ")";
 	}
 }
 
@@ -21,6 +21,7 @@
 #include "yuri/core/thread/XmlBuilder.h"
 #include "yuri/exception/Exception.h"
 #include "yuri/core/thread/FixedMemoryAllocator.h"
+#include "yuri/core/thread/ConvertUtils.h"
 
 #include "yuri/version.h"
 #include <iostream>
@@ -29,6 +30,7 @@
 
 #include "yuri/core/frame/raw_frame_types.h"
 #include "yuri/core/utils/string_generator.h"
+#include "yuri/core/utils/environment.h"
 #ifdef HAVE_BOOST_PROGRAM_OPTIONS
 #include <boost/program_options.hpp>
 namespace po = boost::program_options;
@@ -78,6 +80,16 @@ void usage(const po::options_description& options)
 #endif
 
 
+void load_converter_costs(const std::string& filename)
+{
+	if (filename.empty()) return;
+	if (yuri::core::load_conversion_costs(filename)) {
+		logger[yuri::log::info] << "Using converter costs from " << filename;
+	} else {
+		logger[yuri::log::warning] << "Failed to load converter costs from " << filename;
+	}
+}
+
 void version()
 {
 	logger[yuri::log::fatal] << "libyuri version " << yuri::yuri_version;
@@ -90,6 +102,7 @@ int main(int argc, char**argv)
 	int verbosity = 0;
 	std::string filename;
 	std::string logfile;
+	std::string costs_file = core::utils::get_environment_variable("YURI_CONVERTER_COSTS");
 	std::ofstream logf;
 	std::vector<std::string> arguments;
 	bool show_info = false;
@@ -108,6 +121,8 @@ int main(int argc, char**argv)
 		("list,l",po::value<std::string>()->implicit_value("classes"),"List registered classes (accepted values: classes, functions, formats, datagram_sockets, stream_sockets, pipes, converters, specifiers)")
 		("class,L",po::value<std::string>(),"List details of a single class")
 		("convert,C",po::value<std::string>(), "Find conversion between format F1 and F2. Use syntax F1:F2.")
+		("calibrate-converters", po::value<std::string>()->implicit_value(core::get_conversion_costs_file()), "Measure speed of all converters and store it to a file used by format conversions")
+		("converter-costs", po::value<std::string>(&costs_file)->implicit_value(core::get_conversion_costs_file()), "Load converter costs measured by --calibrate-converters (defaults to YURI_CONVERTER_COSTS)")
 		("app-info,a","Show info about XML file")
 		("log-file,o", po::value<std::string>(&logfile), "Log to a file")
 		("input,I", po::value<std::string>()->implicit_value("all"), "Enumerate devices")
@@ -158,6 +173,7 @@ int main(int argc, char**argv)
 		version();
 		return 1;
 	}
+	if (!vm.count("calibrate-converters")) load_converter_costs(costs_file);
 	if (vm.count("list") || vm.count("class") || vm.count("input")) {
 		builder = std::make_shared<core::XmlBuilder>(logger, core::pwThreadBase(), filename, arguments, true );
 		log::Log l_(std::cout);
@@ -189,12 +205,25 @@ int main(int argc, char**argv)
 		}
 		return 0;
 	}
+	if (vm.count("calibrate-converters")) {
+		builder = std::make_shared<core::XmlBuilder>(logger, core::pwThreadBase(), filename, arguments, true );
+		const auto cost_file = vm["calibrate-converters"].as<std::string>();
+		logger[log::info] << "Measuring converters, this may take a while";
+		const auto count = core::calibrate_converters(logger);
+		if (!core::save_conversion_costs(cost_file)) {
+			logger[log::error] << "Failed to store results to " << cost_file;
+			return 1;
+		}
+		logger[log::info] << "Stored costs of " << count << " converters to " << cost_file;
+		return 0;
+	}
 	if (vm.count("app-info")) {
 		show_info=true;
 		logger.set_flags(log::fatal);
 		logger.set_quiet(true);
 	}
 #else
+	load_converter_costs(costs_file);
 	for (int i=1;i<argc;++i) {
 		if (argv[i][0]=='-') {
 			if (iequals(std::string(argv[i]+1),"l")) {
@@ -282,6 +311,9 @@ int main(int argc, char**argv)
 	// Otherwise it would be destroyed among global variables and this could lead to segfaults.
 	builder.reset();
 	logger[log::info] << "Application successfully destroyed";
+	const auto stats = yuri::core::FixedMemoryAllocator::get_statistics();
+	logger[log::debug] << "Memory pool: " << stats.local_hits << " local hits, " << stats.global_hits
+			<< " global hits, " << stats.misses << " misses, " << stats.remote_returns << " remote returns";
 	auto mp = yuri::core::FixedMemoryAllocator::clear_all();
 	logger[log::info] << "Memory pool cleared ("<< mp.first << " blocks, " << mp.second << " bytes)";
 	return 0;
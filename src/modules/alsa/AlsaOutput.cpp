@@ -10,7 +10,7 @@
 #include "AlsaOutput.h"
 #include "yuri/core/Module.h"
 #include "yuri/core/frame/raw_audio_frame_types.h"
-#include "yuri/core/utils/irange.h"
+#include <algorithm>
 namespace yuri {
 namespace alsa {
 
@@ -27,6 +27,9 @@ core::Parameters AlsaOutput::configure()
 	p["buffer_size"]["Buffer size, zero means that the size is computed by the periods and period_size"]=0;
     p["period_size"]["Period size"]=6000;
     p["periods"]["Periods"]=4;
+	p["latency"]["Target latency of the internal buffer in ms (in addition to the device buffer)"]=40.0;
+	p["drift_compensation"]["Resample the input slightly to keep the latency when the sound card clock differs from the pipeline"]=true;
+	p["blocking"]["Wait when the internal buffer is full, instead of dropping samples"]=true;
 	return p;
 }
 
@@ -35,14 +38,16 @@ core::Parameters AlsaOutput::configure()
 AlsaOutput::AlsaOutput(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
 core::SpecializedIOFilter<core::RawAudioFrame>(log_,parent, std::string("alsa_output")),
 format_(0),device_name_("default"),channels_(0),sampling_rate_(0),forced_channels_(0),buffer_size_{0},
-period_size_{6000},periods_{4},use_mmap_{false},handle_(0)
+period_size_{6000},periods_{4},use_mmap_{false},target_latency_(40_ms),drift_compensation_(true),
+blocking_(true),use_s16_(false),handle_(0),reported_missing_(0),reported_dropped_(0),writer_running_(false)
 {
 	IOTHREAD_INIT(parameters)
-
+	set_supported_formats({core::raw_audio_format::float_32bit});
 }
 
 AlsaOutput::~AlsaOutput() noexcept
 {
+	stop_writer();
 	if (handle_) error_call(snd_pcm_close (handle_), 	"Failed to close the device");
 }
 
@@ -54,92 +59,122 @@ bool AlsaOutput::is_different_format(const core::pRawAudioFrame& frame)
 			(forced_channels_ && (forced_channels_ != channels_));
 }
 
-namespace {
-const uint8_t* write_data(log::Log& log, const uint8_t* start, const uint8_t* end, snd_pcm_t* handle, int timeout, size_t frame_size, bool use_mmap)
+core::pFrame AlsaOutput::do_special_single_step(core::pRawAudioFrame frame)
 {
-	if (!snd_pcm_wait(handle, timeout)) {
-		log[log::verbose_debug] << "Device busy";
-		return start;
+	if (is_different_format(frame)) {
+		if (!init_alsa(frame)) return {};
 	}
-	const snd_pcm_sframes_t avail_frames = (end - start) / frame_size;
-	const snd_pcm_sframes_t frames_free = snd_pcm_avail(handle);
-	snd_pcm_sframes_t write_frames = std::min(frames_free, avail_frames);
-	if (write_frames > 0) {
-		log[log::verbose_debug] << "Writing " << write_frames << " samples. Available was " << frames_free << ", I received " << avail_frames;
-		if (!use_mmap) {
-            write_frames = snd_pcm_writei(handle, reinterpret_cast<const void *>(start), write_frames);
-        } else {
-            write_frames = snd_pcm_mmap_writei(handle, reinterpret_cast<const void *>(start), write_frames);
-		}
-		log[log::verbose_debug] << "Written " << write_frames << " frames";
+	log[log::verbose_debug] << "Received frame with " << frame->get_sample_count() << " samples";
+	if (!handle_ || !ring_) return {};
+
+	const size_t in_channels = frame->get_channel_count();
+	const size_t frames = frame->get_sample_count();
+	const size_t copy_channels = std::min(in_channels, channels_);
+	const float* in = reinterpret_cast<const float*>(frame->data());
+	samples_.resize(frames * channels_);
+	float* out = samples_.data();
+	for (size_t i = 0; i < frames; ++i) {
+		std::copy(in, in + copy_channels, out);
+		std::fill(out + copy_channels, out + channels_, 0.0f);
+		in += in_channels;
+		out += channels_;
 	}
-	if (write_frames < 0) {
-		int ret = 0;
-		if (write_frames == -EPIPE) {
-			log[log::warning] << "AlsaDevice underrun! Recovering";
-			ret = snd_pcm_recover(handle,write_frames,1);
-		} else {
-			log[log::warning] << "AlsaDevice write error, trying to recover";
-			ret = snd_pcm_recover(handle,write_frames,0);
-		}
-		if (ret<0) {
-			log[log::warning] << "Failed to recover from alsa error!";
-			return end; // This is probably fatal, so no need to care about loosing few frames.
+	if (blocking_) {
+		// Resampling may produce slightly more samples than received
+		const size_t required = std::min(static_cast<size_t>(frames * (1.0 + core::AudioRing::max_drift)) + 2,
+				ring_->get_capacity());
+		while (ring_->space() < required) {
+			if (!still_running()) return {};
+			sleep(get_latency());
 		}
-	} else {
-		return start + (write_frames * frame_size);
 	}
-	return start;
+	ring_->push(samples_.data(), frames);
+	report_ring_state();
+	return {};
+}
 
+void AlsaOutput::report_ring_state()
+{
+	const auto missing = ring_->get_missing_frames();
+	if (missing != reported_missing_ && ring_->available()) {
+		log[log::warning] << "Missing " << (missing - reported_missing_) << " frames, filled with zeros";
+		reported_missing_ = missing;
+	}
+	const auto dropped = ring_->get_dropped_frames();
+	if (dropped != reported_dropped_) {
+		log[log::warning] << "Not enough space in the buffer, dropped " << (dropped - reported_dropped_) << " frames";
+		reported_dropped_ = dropped;
+	}
 }
 
+void AlsaOutput::start_writer()
+{
+	writer_running_ = true;
+	writer_ = std::thread([this]{ run_writer(); });
 }
 
-core::pFrame AlsaOutput::do_special_single_step(core::pRawAudioFrame frame)
+void AlsaOutput::stop_writer()
 {
-	if (is_different_format(frame)) {
-		if (!init_alsa(frame)) return {};
-	}
-	log[log::verbose_debug] << "Received frame with " << frame->get_sample_count() << " samples";
-	if (!handle_) return {};
-
-	const uint8_t* start = nullptr;
-	const auto channel_size = frame->get_sample_size() / frame->get_channel_count() / 8;
-	const auto data_size = channels_ * channel_size * frame->get_sample_count();
-	
-	if (channels_ != frame->get_channel_count()) {
-		channel_buffer_.resize(frame->size() * channels_ / frame->get_channel_count());		
-		uint8_t* buf_pos = &channel_buffer_[0];
-		start = buf_pos;
-		auto frame_pos = frame->data();
-		const auto copy_channels = std::min(frame->get_channel_count(), channels_);
-		const auto skip_channels = frame->get_channel_count() - copy_channels;
-		const auto fill_channels = channels_ - copy_channels;
-		
-		
-		for (auto i: irange(frame->get_sample_count())) {
-			(void)i;
-			for (auto x: irange(copy_channels * channel_size)) {
-				(void)x;
-				*buf_pos++ = *frame_pos++;
-			}
-			frame_pos += skip_channels * channel_size;
-			for (auto x: irange(fill_channels * channel_size)) {
-				(void)x;
-				*buf_pos++ = 0;
+	writer_running_ = false;
+	if (writer_.joinable()) writer_.join();
+}
+
+void AlsaOutput::run_writer()
+{
+	std::vector<float> period(period_size_ * channels_);
+	std::vector<int16_t> period_s16(use_s16_ ? period.size() : 0);
+	while (writer_running_) {
+		// Wakes up when there's space for at least a period (avail_min)
+		const int ret = snd_pcm_wait(handle_, 100);
+		if (ret == 0) continue;
+		if (ret < 0) {
+			log[log::warning] << "AlsaDevice error while waiting, trying to recover";
+			if (snd_pcm_recover(handle_, ret, 0) < 0) {
+				log[log::error] << "Failed to recover from alsa error!";
+				return;
 			}
+			continue;
+		}
+		ring_->read(period.data(), period_size_);
+		if (use_s16_) {
+			std::transform(period.begin(), period.end(), period_s16.begin(), [](float v) {
+				return static_cast<int16_t>(std::min(std::max(v, -1.0f), 1.0f) * 32767.0f);
+			});
+			write_period(period_s16.data());
+		} else {
+			write_period(period.data());
 		}
-	} else {
-		// The simple case when we simple copy the data to sound card
-		start = frame->data();
-	}
-	const uint8_t* end = start + data_size;
-	while (start != end && still_running()) {
-		start = write_data(log, start, end, handle_, static_cast<int>(get_latency().value/1000), channel_size * channels_, use_mmap_);
 	}
-	
+}
 
-	return {};
+void AlsaOutput::write_period(const void* data)
+{
+	const size_t frame_size = channels_ * (use_s16_ ? sizeof(int16_t) : sizeof(float));
+	const uint8_t* start = reinterpret_cast<const uint8_t*>(data);
+	snd_pcm_uframes_t remaining = period_size_;
+	while (remaining && writer_running_) {
+		const snd_pcm_sframes_t written = use_mmap_ ?
+				snd_pcm_mmap_writei(handle_, start, remaining) :
+				snd_pcm_writei(handle_, start, remaining);
+		if (written >= 0) {
+			remaining -= written;
+			start += written * frame_size;
+			continue;
+		}
+		if (written == -EAGAIN) continue;
+		int ret = 0;
+		if (written == -EPIPE) {
+			log[log::warning] << "AlsaDevice underrun! Recovering";
+			ret = snd_pcm_recover(handle_, written, 1);
+		} else {
+			log[log::warning] << "AlsaDevice write error, trying to recover";
+			ret = snd_pcm_recover(handle_, written, 0);
+		}
+		if (ret < 0) {
+			log[log::warning] << "Failed to recover from alsa error!";
+			return; // This is probably fatal, so no need to care about loosing few frames.
+		}
+	}
 }
 
 bool AlsaOutput::error_call(int ret, const std::string& msg)
@@ -157,15 +192,11 @@ bool AlsaOutput::init_alsa(const core::pRawAudioFrame& frame)
 						"Failed to open device for playback")) return false;
 		log[log::info] << "Device " << device_name_ << " opened";
 	}
+	stop_writer();
+	ring_.reset();
+	if (format_) snd_pcm_drop(handle_);
 	format_ = 0;
 
-
-	snd_pcm_format_t fmt = get_alsa_format(frame->get_format());
-	if (fmt == SND_PCM_FORMAT_UNKNOWN) {
-		log[log::warning] << "Received frame in unsupported format";
-		return false;
-	}
-
 	channels_ = forced_channels_?forced_channels_:frame->get_channel_count();
 	sampling_rate_ = frame->get_sampling_frequency();
 
@@ -188,6 +219,13 @@ bool AlsaOutput::init_alsa(const core::pRawAudioFrame& frame)
             return false;
 	}
 
+	// The ring keeps float samples, they're converted in the writer when the device doesn't support them
+	snd_pcm_format_t fmt = get_alsa_format(core::raw_audio_format::float_32bit);
+	use_s16_ = snd_pcm_hw_params_test_format(handle_, hw_params, fmt) != 0;
+	if (use_s16_) {
+		log[log::info] << "Device doesn't support float samples, using 16bit samples";
+		fmt = get_alsa_format(core::raw_audio_format::signed_16bit);
+	}
 	if(!error_call(snd_pcm_hw_params_set_format (handle_, hw_params, fmt),
 				"Failed to set format")) return false;
 
@@ -238,7 +276,7 @@ bool AlsaOutput::init_alsa(const core::pRawAudioFrame& frame)
 			"cannot allocate software parameters structure")) return false;
 	if(!error_call(snd_pcm_sw_params_current (handle_, sw_params),
 			"cannot initialize software parameters structure")) return false;
-	if(!error_call(snd_pcm_sw_params_set_avail_min (handle_, sw_params, 4096)
+	if(!error_call(snd_pcm_sw_params_set_avail_min (handle_, sw_params, period_size_)
 			,"cannot set minimum available count")) return false;
 	if(!error_call(snd_pcm_sw_params_set_start_threshold (handle_, sw_params, 0U),
 				"cannot set start mode")) return false;
@@ -249,6 +287,13 @@ bool AlsaOutput::init_alsa(const core::pRawAudioFrame& frame)
 
 	if (!error_call(snd_pcm_prepare (handle_), "Failed to prepare PCM")) return false;
 
+	const size_t target = static_cast<size_t>(target_latency_.value * sampling_rate_ / 1000000);
+	const size_t capacity = std::max<size_t>({4 * target, 4 * period_size_, sampling_rate_});
+	ring_.reset(new core::AudioRing(channels_, sampling_rate_, capacity, target, drift_compensation_));
+	reported_missing_ = 0;
+	reported_dropped_ = 0;
+	start_writer();
+
 	format_ = frame->get_format();
 	return true;
 }
@@ -260,7 +305,11 @@ bool AlsaOutput::set_param(const core::Parameter& param)
 		(buffer_size_, "buffer_size") //
         (period_size_, "period_size") //
         (periods_, "periods") //
-		(use_mmap_, "mmap")) {
+		(use_mmap_, "mmap") //
+		.parsed<double>
+			(target_latency_, "latency", [](double ms){ return 1_ms * ms; }) //
+		(drift_compensation_, "drift_compensation") //
+		(blocking_, "blocking")) {
 		return true;
 	}
 	return core::SpecializedIOFilter<core::RawAudioFrame>::set_param(param);
@@ -12,7 +12,11 @@
 
 #include "yuri/core/thread/SpecializedIOFilter.h"
 #include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/utils/AudioRing.h"
 #include <alsa/asoundlib.h>
+#include <atomic>
+#include <memory>
+#include <thread>
 
 namespace yuri {
 namespace alsa {
@@ -31,6 +35,13 @@ private:
 	bool is_different_format(const core::pRawAudioFrame& frame);
 
 	bool init_alsa(const core::pRawAudioFrame& frame);
+	void start_writer();
+	void stop_writer();
+	//! Body of the writer thread, moves samples from the ring to the device
+	void run_writer();
+	//! Writes a period to the device, recovering from errors
+	void write_period(const void* data);
+	void report_ring_state();
 
 	bool error_call(int, const std::string&);
 	format_t format_;
@@ -44,9 +55,21 @@ private:
     unsigned int periods_;
 
 	bool use_mmap_;
-	std::vector<uint8_t> channel_buffer_;
+	duration_t target_latency_;
+	bool drift_compensation_;
+	bool blocking_;
+	//! Device uses 16bit samples, when it doesn't support floats
+	bool use_s16_;
 	snd_pcm_t			*handle_;
 
+	//! Converted samples of the last frame, interleaved
+	std::vector<float> samples_;
+	std::unique_ptr<core::AudioRing> ring_;
+	uint64_t reported_missing_;
+	uint64_t reported_dropped_;
+	std::thread writer_;
+	std::atomic<bool> writer_running_;
+
 };
 
 } /* namespace alsa */
@@ -29,6 +29,7 @@ core::Parameters ArtNet::configure()
 	p["socket"]["Socket implementation"]="yuri_udp";
 	p["address"]["Target address"]="127.0.01";
 	p["port"]["Target port"]=6454;
+	p["coalesce"]["Process only the latest of pending events for each channel"]=true;
 	return p;
 }
 
@@ -37,9 +38,10 @@ ArtNet::ArtNet(const log::Log &log_, core::pwThreadBase parent, const core::Para
 core::IOThread(log_,parent,0,0,std::string("artnet")),
 event::BasicEventConsumer(log),
 socket_impl_("yuri_udp"),address_("127.0.0.1"),port_(6454),
-changed_(true)
+changed_(true),coalesce_(true)
 {
 	IOTHREAD_INIT(parameters)
+	set_event_coalescing(coalesce_);
 }
 
 ArtNet::~ArtNet() noexcept
@@ -118,7 +120,8 @@ bool ArtNet::set_param(const core::Parameter& param)
 	if (assign_parameters(param)
 			(socket_impl_, "socket")
 			(address_, "address")
-			(port_, "port"))
+			(port_, "port")
+			(coalesce_, "coalesce"))
 		return true;
 	return core::IOThread::set_param(param);
 }
@@ -34,6 +34,7 @@ private:
 	std::string address_;
 	core::socket::port_t port_;
 	bool changed_;
+	bool coalesce_;
 
 	std::unordered_map<uint16_t, ArtNetPacket> universes_;
 
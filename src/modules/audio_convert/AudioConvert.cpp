@@ -0,0 +1,170 @@
+/*!
+ * @file 		AudioConvert.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AudioConvert.h"
+#include "yuri/core/Module.h"
+#include "yuri/core/frame/raw_audio_frame_params.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+#include "yuri/core/thread/ConverterRegister.h"
+#include "yuri/core/utils/assign_parameters.h"
+
+namespace yuri {
+namespace audio_convert {
+
+namespace {
+
+// Conversions changing only byte order or layout are cheaper, lossy conversions are expensive.
+// Wide formats are converted through doubles, so a target with at least the precision of the source is lossless.
+size_t conversion_cost(format_t source, format_t target)
+{
+	sample_format_t src, dst;
+	get_sample_format(source, src);
+	get_sample_format(target, dst);
+	if (src.type == dst.type && src.bytes == dst.bytes) return 5;
+	return get_precision(dst) < get_precision(src) ? 20 : 10;
+}
+
+void copy_frame_params(const core::RawAudioFrame& source, core::RawAudioFrame& target)
+{
+	target.set_index(source.get_index());
+	target.set_timestamp(source.get_timestamp());
+	target.set_duration(source.get_duration());
+}
+
+}
+
+IOTHREAD_GENERATOR(AudioConvert)
+
+MODULE_REGISTRATION_BEGIN("audio_convert")
+		REGISTER_IOTHREAD("audio_convert",AudioConvert)
+		for (auto source: get_supported_formats()) {
+			for (auto target: get_supported_formats()) {
+				if (source == target) continue;
+				REGISTER_CONVERTER(source, target, "audio_convert", conversion_cost(source, target))
+			}
+		}
+MODULE_REGISTRATION_END()
+
+core::Parameters AudioConvert::configure()
+{
+	core::Parameters p = base_type::configure();
+	p.set_description("Converts audio between sample formats and sampling frequencies");
+	p["format"]["Target format (e.g. s16, f32p, s24_be). Use 'keep' to keep the input format."]="keep";
+	p["sampling_frequency"]["Target sampling frequency. Use 0 to keep the input frequency."]=0;
+	p["quality"]["Resampler quality (low, medium, high, best)"]="high";
+	p["simd"]["Instruction set to use (auto, avx2, sse4, none)"]="auto";
+	return p;
+}
+
+AudioConvert::AudioConvert(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
+base_type(log_,parent,std::string("audio_convert")),format_(core::raw_audio_format::unknown),
+sampling_frequency_(0),quality_(quality_t::high),simd_level_(get_supported_level())
+{
+	IOTHREAD_INIT(parameters)
+}
+
+AudioConvert::~AudioConvert() noexcept
+{
+}
+
+core::pFrame AudioConvert::do_special_single_step(core::pRawAudioFrame frame)
+{
+	const format_t target = format_ ? format_ : frame->get_format();
+	if (sampling_frequency_ && sampling_frequency_ != frame->get_sampling_frequency()) {
+		return resample(frame, target);
+	}
+	if (target == frame->get_format()) return frame;
+	return do_convert_frame(frame, target);
+}
+
+core::pFrame AudioConvert::do_convert_frame(core::pFrame input_frame, format_t target_format)
+{
+	auto frame = std::dynamic_pointer_cast<core::RawAudioFrame>(input_frame);
+	if (!frame) {
+		log[log::warning] << "Got bad frame type!!";
+		return {};
+	}
+	const size_t frames = frame->get_sample_count();
+	const size_t channels = frame->get_channel_count();
+	auto out = core::RawAudioFrame::create_empty(target_format, channels, frame->get_sampling_frequency(), frames);
+	if (!convert_samples(frame->get_format(), target_format, frame->data(), out->data(), frames, channels, simd_level_)) {
+		log[log::warning] << "Unsupported conversion from " << core::raw_audio_format::get_format_name(frame->get_format())
+				<< " to " << core::raw_audio_format::get_format_name(target_format);
+		return {};
+	}
+	copy_frame_params(*frame, *out);
+	return out;
+}
+
+bool AudioConvert::do_converter_is_stateless() const
+{
+	// Conversions between formats are stateless, resampling keeps history of the stream
+	return sampling_frequency_ == 0;
+}
+
+core::pFrame AudioConvert::resample(const core::pRawAudioFrame& frame, format_t target_format)
+{
+	sample_format_t src, dst;
+	if (!get_sample_format(frame->get_format(), src) || !get_sample_format(target_format, dst)) {
+		log[log::warning] << "Unsupported format " << core::raw_audio_format::get_format_name(frame->get_format());
+		return {};
+	}
+	const size_t frames = frame->get_sample_count();
+	const size_t channels = frame->get_channel_count();
+	if (!resampler_ || resampler_->get_input_frequency() != frame->get_sampling_frequency() || resampler_->get_channels() != channels) {
+		resampler_.reset(new AudioResampler(frame->get_sampling_frequency(), sampling_frequency_, channels, quality_, simd_level_));
+		log[log::info] << "Resampling " << channels << " channels from " << frame->get_sampling_frequency()
+				<< " to " << sampling_frequency_ << " Hz, using " << resampler_->get_phases() << " phases with "
+				<< resampler_->get_taps() << " taps";
+	}
+
+	// The resampler works with planar samples
+	std::vector<float> samples(frames * channels);
+	decode_samples(src, frame->data(), samples.data(), samples.size(), simd_level_);
+	if (!src.planar && channels > 1) {
+		std::vector<float> planar(samples.size());
+		deinterleave(samples.data(), planar.data(), frames, channels, simd_level_);
+		samples.swap(planar);
+	}
+	resampler_->process(samples.data(), frames, resampled_);
+	const size_t out_frames = resampled_.empty() ? 0 : resampled_[0].size();
+	if (!out_frames) return {};
+
+	samples.resize(out_frames * channels);
+	for (size_t c = 0; c < channels; ++c) {
+		std::copy(resampled_[c].begin(), resampled_[c].end(), samples.begin() + c * out_frames);
+	}
+	if (!dst.planar && channels > 1) {
+		std::vector<float> interleaved(samples.size());
+		interleave(samples.data(), interleaved.data(), out_frames, channels, simd_level_);
+		samples.swap(interleaved);
+	}
+	auto out = core::RawAudioFrame::create_empty(target_format, channels, sampling_frequency_, out_frames);
+	encode_samples(dst, samples.data(), out->data(), samples.size(), simd_level_);
+	copy_frame_params(*frame, *out);
+	out->set_duration(1_s * (static_cast<double>(out_frames) / sampling_frequency_));
+	return out;
+}
+
+bool AudioConvert::set_param(const core::Parameter& param)
+{
+	if (assign_parameters(param)
+			.parsed<std::string>
+				(format_, "format", [](const std::string& s){ return core::raw_audio_format::parse_format(s); })
+			(sampling_frequency_, "sampling_frequency")
+			.parsed<std::string>
+				(quality_, "quality", parse_quality)
+			.parsed<std::string>
+				(simd_level_, "simd", parse_level))
+		return true;
+	return base_type::set_param(param);
+}
+
+} /* namespace audio_convert */
+} /* namespace yuri */
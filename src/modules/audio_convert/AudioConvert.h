@@ -0,0 +1,50 @@
+/*!
+ * @file 		AudioConvert.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef AUDIOCONVERT_H_
+#define AUDIOCONVERT_H_
+
+#include "yuri/core/thread/SpecializedIOFilter.h"
+#include "yuri/core/thread/ConverterThread.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include "AudioResampler.h"
+#include <memory>
+
+namespace yuri {
+namespace audio_convert {
+
+class AudioConvert: public core::SpecializedIOFilter<core::RawAudioFrame>, public core::ConverterThread
+{
+	using base_type = core::SpecializedIOFilter<core::RawAudioFrame>;
+public:
+	IOTHREAD_GENERATOR_DECLARATION
+	static core::Parameters configure();
+	AudioConvert(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters);
+	virtual ~AudioConvert() noexcept;
+private:
+	virtual core::pFrame do_special_single_step(core::pRawAudioFrame frame) override;
+	virtual core::pFrame do_convert_frame(core::pFrame input_frame, format_t target_format) override;
+	virtual bool do_converter_is_stateless() const override;
+	virtual bool set_param(const core::Parameter& param) override;
+
+	core::pFrame resample(const core::pRawAudioFrame& frame, format_t target_format);
+
+	//! Target format, unknown to keep the input one
+	format_t format_;
+	//! Target sampling frequency, zero to keep the input one
+	size_t sampling_frequency_;
+	quality_t quality_;
+	simd_level_t simd_level_;
+	std::unique_ptr<AudioResampler> resampler_;
+	std::vector<std::vector<float>> resampled_;
+};
+
+} /* namespace audio_convert */
+} /* namespace yuri */
+#endif /* AUDIOCONVERT_H_ */
@@ -0,0 +1,234 @@
+/*!
+ * @file 		AudioResampler.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AudioResampler.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define YURI_SIMD_X86
+#include <immintrin.h>
+#define YURI_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define YURI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace yuri {
+namespace audio_convert {
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+const size_t max_half_taps = 1024;
+
+struct quality_params_t {
+	//! Half of the filter length, when not downsampling
+	size_t half_taps;
+	//! Kaiser window parameter
+	double beta;
+	//! Cutoff relative to the lower Nyquist frequency
+	double rolloff;
+};
+
+quality_params_t get_params(quality_t quality)
+{
+	switch (quality) {
+		case quality_t::low:	return {8, 6.0, 0.85};
+		case quality_t::medium:	return {16, 8.0, 0.90};
+		case quality_t::best:	return {64, 12.0, 0.97};
+		case quality_t::high:
+		default:				return {32, 9.5, 0.94};
+	}
+}
+
+// Modified Bessel function of the first kind, order 0
+double bessel_i0(double x)
+{
+	double sum = 1.0;
+	double term = 1.0;
+	for (int k = 1; k < 64; ++k) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if (term < sum * 1e-12) break;
+	}
+	return sum;
+}
+
+double sinc(double x)
+{
+	if (std::abs(x) < 1e-9) return 1.0;
+	return std::sin(pi * x) / (pi * x);
+}
+
+uint64_t gcd(uint64_t a, uint64_t b)
+{
+	while (b) {
+		const uint64_t t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+float dot_scalar(const float* a, const float* b, size_t count)
+{
+	// Four partial sums, same as in the SIMD versions
+	float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	for (size_t i = 0; i < count; i += 4) {
+		for (size_t j = 0; j < 4; ++j) {
+			sum[j] += a[i + j] * b[i + j];
+		}
+	}
+	return (sum[0] + sum[2]) + (sum[1] + sum[3]);
+}
+
+#ifdef YURI_SIMD_X86
+
+YURI_TARGET_SSE41
+float dot_sse41(const float* a, const float* b, size_t count)
+{
+	__m128 sum = _mm_setzero_ps();
+	for (size_t i = 0; i < count; i += 4) {
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	}
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+	return _mm_cvtss_f32(sum);
+}
+
+YURI_TARGET_AVX2
+float dot_avx2(const float* a, const float* b, size_t count)
+{
+	__m256 sum = _mm256_setzero_ps();
+	for (size_t i = 0; i < count; i += 8) {
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+	}
+	__m128 s = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+	s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+	s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+	return _mm_cvtss_f32(s);
+}
+
+#endif
+
+float dot(simd_level_t level, const float* a, const float* b, size_t count)
+{
+#ifdef YURI_SIMD_X86
+	if (level == simd_level_t::avx2) return dot_avx2(a, b, count);
+	if (level == simd_level_t::sse41) return dot_sse41(a, b, count);
+#else
+	(void)level;
+#endif
+	return dot_scalar(a, b, count);
+}
+
+}
+
+const size_t AudioResampler::max_phases;
+
+quality_t parse_quality(const std::string& name)
+{
+	if (iequals(name, "low")) return quality_t::low;
+	if (iequals(name, "medium")) return quality_t::medium;
+	if (iequals(name, "high")) return quality_t::high;
+	if (iequals(name, "best")) return quality_t::best;
+	throw std::invalid_argument("Unknown resampler quality " + name);
+}
+
+AudioResampler::AudioResampler(size_t input_frequency, size_t output_frequency, size_t channels, quality_t quality, simd_level_t level):
+	input_frequency_(input_frequency), output_frequency_(output_frequency), channels_(channels), level_(level),
+	position_(0), fraction_(0)
+{
+	if (!input_frequency || !output_frequency) throw std::invalid_argument("Invalid sampling frequency");
+	const uint64_t divisor = gcd(input_frequency, output_frequency);
+	up_ = output_frequency / divisor;
+	down_ = input_frequency / divisor;
+	phases_ = std::min<size_t>(up_, max_phases);
+
+	const auto params = get_params(quality);
+	// When downsampling, the filter is stretched to keep the same transition band relative to the output frequency
+	const double ratio = std::min(1.0, static_cast<double>(output_frequency) / input_frequency);
+	const double cutoff = ratio * params.rolloff;
+	size_t half = static_cast<size_t>(std::ceil(params.half_taps / ratio));
+	half = std::min((half + 3) & ~static_cast<size_t>(3), max_half_taps);
+	taps_ = 2 * half;
+
+	const double norm = bessel_i0(params.beta);
+	coefficients_.resize((phases_ + 1) * taps_);
+	for (size_t p = 0; p <= phases_; ++p) {
+		const double offset = static_cast<double>(p) / phases_;
+		float* coefs = &coefficients_[p * taps_];
+		double sum = 0.0;
+		std::vector<double> values(taps_);
+		for (size_t k = 0; k < taps_; ++k) {
+			const double distance = static_cast<double>(k) - (half - 1) - offset;
+			const double x = distance / half;
+			if (std::abs(x) > 1.0) continue;
+			values[k] = cutoff * sinc(cutoff * distance) * bessel_i0(params.beta * std::sqrt(1.0 - x * x)) / norm;
+			sum += values[k];
+		}
+		// Normalized to unit gain at DC
+		for (size_t k = 0; k < taps_; ++k) {
+			coefs[k] = static_cast<float>(values[k] / sum);
+		}
+	}
+	reset();
+}
+
+void AudioResampler::reset()
+{
+	// Output starts at the first input sample
+	history_.assign(channels_, std::vector<float>(taps_ / 2 - 1, 0.0f));
+	position_ = 0;
+	fraction_ = 0;
+}
+
+void AudioResampler::process(const float* input, size_t frames, std::vector<std::vector<float>>& output)
+{
+	output.resize(channels_);
+	for (size_t c = 0; c < channels_; ++c) {
+		history_[c].insert(history_[c].end(), input + c * frames, input + (c + 1) * frames);
+		output[c].clear();
+		output[c].reserve(frames * up_ / down_ + 2);
+	}
+	const size_t available = channels_ ? history_[0].size() : 0;
+	const bool exact = phases_ == up_;
+	while (position_ + taps_ <= available) {
+		if (exact) {
+			const float* coefs = &coefficients_[fraction_ * taps_];
+			for (size_t c = 0; c < channels_; ++c) {
+				output[c].push_back(dot(level_, history_[c].data() + position_, coefs, taps_));
+			}
+		} else {
+			const double phase = static_cast<double>(fraction_) * phases_ / up_;
+			const size_t index = static_cast<size_t>(phase);
+			const float weight = static_cast<float>(phase - index);
+			const float* coefs0 = &coefficients_[index * taps_];
+			const float* coefs1 = coefs0 + taps_;
+			for (size_t c = 0; c < channels_; ++c) {
+				const float* samples = history_[c].data() + position_;
+				const float a = dot(level_, samples, coefs0, taps_);
+				const float b = dot(level_, samples, coefs1, taps_);
+				output[c].push_back(a + (b - a) * weight);
+			}
+		}
+		fraction_ += down_;
+		position_ += fraction_ / up_;
+		fraction_ %= up_;
+	}
+	const size_t consumed = std::min(position_, available);
+	for (auto& h: history_) {
+		h.erase(h.begin(), h.begin() + consumed);
+	}
+	position_ -= consumed;
+}
+
+}
+}
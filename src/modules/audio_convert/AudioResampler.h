@@ -0,0 +1,87 @@
+/*!
+ * @file 		AudioResampler.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef AUDIORESAMPLER_H_
+#define AUDIORESAMPLER_H_
+
+#include "sample_convert.h"
+#include <vector>
+
+namespace yuri {
+namespace audio_convert {
+
+enum class quality_t {
+	low,
+	medium,
+	high,
+	best
+};
+
+/*!
+ * Parses quality name (low, medium, high, best)
+ * @throw std::invalid_argument for unknown names
+ */
+quality_t parse_quality(const std::string& name);
+
+/*!
+ * Polyphase resampler with windowed sinc (Kaiser window) filters.
+ *
+ * The ratio of sampling frequencies is reduced to L/M and the filter is split
+ * to L phases, so every output sample is a single dot product. When L is too large,
+ * coefficients are interpolated from a table with max_phases phases.
+ * Higher quality means longer filters, steeper transition band and stronger stopband attenuation.
+ *
+ * The resampler keeps history of every channel, so it has to be used for a single stream only.
+ * Output is delayed by half of the filter length.
+ */
+class AudioResampler {
+public:
+	static const size_t max_phases = 1024;
+
+	AudioResampler(size_t input_frequency, size_t output_frequency, size_t channels, quality_t quality, simd_level_t level = get_supported_level());
+
+	/*!
+	 * Resamples planar samples
+	 * @param input Samples of all channels, @em frames samples for each channel
+	 * @param output Output samples of each channel, previous content is replaced
+	 */
+	void process(const float* input, size_t frames, std::vector<std::vector<float>>& output);
+
+	//! Clears the history, as if no samples were processed
+	void reset();
+
+	size_t get_input_frequency() const { return input_frequency_; }
+	size_t get_output_frequency() const { return output_frequency_; }
+	size_t get_channels() const { return channels_; }
+	//! Number of coefficients of every phase (a multiple of 8)
+	size_t get_taps() const { return taps_; }
+	size_t get_phases() const { return phases_; }
+private:
+	size_t input_frequency_;
+	size_t output_frequency_;
+	size_t channels_;
+	simd_level_t level_;
+	//! Output step in 1/up_ of input sample
+	uint64_t up_;
+	uint64_t down_;
+	size_t phases_;
+	size_t taps_;
+	//! (phases_ + 1) * taps_ coefficients, the last phase is the first one shifted by a sample
+	std::vector<float> coefficients_;
+	std::vector<std::vector<float>> history_;
+	//! Index of the first input sample of the next output
+	size_t position_;
+	//! Fractional part of the position, in 1/up_ of input sample
+	uint64_t fraction_;
+};
+
+}
+}
+
+#endif /* AUDIORESAMPLER_H_ */
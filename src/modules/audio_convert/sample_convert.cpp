@@ -0,0 +1,594 @@
+/*!
+ * @file 		sample_convert.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "sample_convert.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+
+#ifdef YURI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace yuri {
+namespace audio_convert {
+
+namespace {
+
+using namespace core::raw_audio_format;
+
+const std::map<format_t, sample_format_t> sample_formats = {
+		{unsigned_8bit,			{sample_type_t::unsigned_int, 1, true, false}},
+		{signed_16bit,			{sample_type_t::signed_int, 2, true, false}},
+		{unsigned_16bit,		{sample_type_t::unsigned_int, 2, true, false}},
+		{signed_24bit,			{sample_type_t::signed_int, 3, true, false}},
+		{unsigned_24bit,		{sample_type_t::unsigned_int, 3, true, false}},
+		{signed_32bit,			{sample_type_t::signed_int, 4, true, false}},
+		{unsigned_32bit,		{sample_type_t::unsigned_int, 4, true, false}},
+		{signed_48bit,			{sample_type_t::signed_int, 6, true, false}},
+		{unsigned_48bit,		{sample_type_t::unsigned_int, 6, true, false}},
+		{float_32bit,			{sample_type_t::floating, 4, true, false}},
+		{float_64bit,			{sample_type_t::floating, 8, true, false}},
+
+		{signed_16bit_be,		{sample_type_t::signed_int, 2, false, false}},
+		{unsigned_16bit_be,		{sample_type_t::unsigned_int, 2, false, false}},
+		{signed_24bit_be,		{sample_type_t::signed_int, 3, false, false}},
+		{unsigned_24bit_be,		{sample_type_t::unsigned_int, 3, false, false}},
+		{signed_32bit_be,		{sample_type_t::signed_int, 4, false, false}},
+		{unsigned_32bit_be,		{sample_type_t::unsigned_int, 4, false, false}},
+		{signed_48bit_be,		{sample_type_t::signed_int, 6, false, false}},
+		{unsigned_48bit_be,		{sample_type_t::unsigned_int, 6, false, false}},
+		{float_32bit_be,		{sample_type_t::floating, 4, false, false}},
+		{float_64bit_be,		{sample_type_t::floating, 8, false, false}},
+
+		{unsigned_8bit_planar,	{sample_type_t::unsigned_int, 1, true, true}},
+		{signed_16bit_planar,	{sample_type_t::signed_int, 2, true, true}},
+		{signed_32bit_planar,	{sample_type_t::signed_int, 4, true, true}},
+		{float_32bit_planar,	{sample_type_t::floating, 4, true, true}},
+		{float_64bit_planar,	{sample_type_t::floating, 8, true, true}},
+};
+
+/* ***************************************************************************
+ * 					Scalar code
+ *
+ * 	Values are assembled byte by byte, so the code doesn't depend
+ * 	on byte order of the host. Rounding and clipping matches the SIMD kernels.
+ *************************************************************************** */
+
+template<size_t bytes, bool little_endian>
+inline uint64_t load(const uint8_t* p)
+{
+	uint64_t value = 0;
+	for (size_t i = 0; i < bytes; ++i) {
+		value |= static_cast<uint64_t>(p[i]) << (8 * (little_endian ? i : bytes - 1 - i));
+	}
+	return value;
+}
+
+template<size_t bytes, bool little_endian>
+inline void store(uint8_t* p, uint64_t value)
+{
+	for (size_t i = 0; i < bytes; ++i) {
+		p[i] = static_cast<uint8_t>(value >> (8 * (little_endian ? i : bytes - 1 - i)));
+	}
+}
+
+template<size_t bytes, bool little_endian, bool is_signed, typename T>
+void decode_integer(const uint8_t* in, T* out, size_t count)
+{
+	const int shift = 64 - 8 * bytes;
+	const int64_t half = static_cast<int64_t>(1) << (8 * bytes - 1);
+	const double scale = 1.0 / half;
+	for (size_t i = 0; i < count; ++i, in += bytes) {
+		const uint64_t value = load<bytes, little_endian>(in);
+		const int64_t sample = is_signed ? static_cast<int64_t>(value << shift) >> shift : static_cast<int64_t>(value) - half;
+		out[i] = static_cast<T>(sample * scale);
+	}
+}
+
+template<size_t bytes, bool little_endian, bool is_signed, typename T>
+void encode_integer(const T* in, uint8_t* out, size_t count)
+{
+	const int64_t half = static_cast<int64_t>(1) << (8 * bytes - 1);
+	const double min_value = -static_cast<double>(half);
+	const double max_value = static_cast<double>(half - 1);
+	for (size_t i = 0; i < count; ++i, out += bytes) {
+		const double value = std::min(std::max(static_cast<double>(in[i]) * half, min_value), max_value);
+		const int64_t sample = std::llrint(value);
+		store<bytes, little_endian>(out, static_cast<uint64_t>(is_signed ? sample : sample + half));
+	}
+}
+
+template<bool little_endian, typename T>
+void decode_float32(const uint8_t* in, T* out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, in += 4) {
+		const uint32_t value = static_cast<uint32_t>(load<4, little_endian>(in));
+		float sample;
+		std::memcpy(&sample, &value, 4);
+		out[i] = sample;
+	}
+}
+
+template<bool little_endian, typename T>
+void encode_float32(const T* in, uint8_t* out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, out += 4) {
+		const float sample = static_cast<float>(in[i]);
+		uint32_t value;
+		std::memcpy(&value, &sample, 4);
+		store<4, little_endian>(out, value);
+	}
+}
+
+template<bool little_endian, typename T>
+void decode_float64(const uint8_t* in, T* out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, in += 8) {
+		const uint64_t value = load<8, little_endian>(in);
+		double sample;
+		std::memcpy(&sample, &value, 8);
+		out[i] = static_cast<T>(sample);
+	}
+}
+
+template<bool little_endian, typename T>
+void encode_float64(const T* in, uint8_t* out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, out += 8) {
+		const double sample = in[i];
+		uint64_t value;
+		std::memcpy(&value, &sample, 8);
+		store<8, little_endian>(out, value);
+	}
+}
+
+template<bool little_endian, bool is_signed, typename T>
+void decode_integer(size_t bytes, const uint8_t* in, T* out, size_t count)
+{
+	switch (bytes) {
+		case 1: decode_integer<1, little_endian, is_signed>(in, out, count); break;
+		case 2: decode_integer<2, little_endian, is_signed>(in, out, count); break;
+		case 3: decode_integer<3, little_endian, is_signed>(in, out, count); break;
+		case 4: decode_integer<4, little_endian, is_signed>(in, out, count); break;
+		case 6: decode_integer<6, little_endian, is_signed>(in, out, count); break;
+		default: break;
+	}
+}
+
+template<bool little_endian, bool is_signed, typename T>
+void encode_integer(size_t bytes, const T* in, uint8_t* out, size_t count)
+{
+	switch (bytes) {
+		case 1: encode_integer<1, little_endian, is_signed>(in, out, count); break;
+		case 2: encode_integer<2, little_endian, is_signed>(in, out, count); break;
+		case 3: encode_integer<3, little_endian, is_signed>(in, out, count); break;
+		case 4: encode_integer<4, little_endian, is_signed>(in, out, count); break;
+		case 6: encode_integer<6, little_endian, is_signed>(in, out, count); break;
+		default: break;
+	}
+}
+
+template<bool little_endian, typename T>
+void decode_scalar(const sample_format_t& info, const uint8_t* in, T* out, size_t count)
+{
+	switch (info.type) {
+		case sample_type_t::floating:
+			if (info.bytes == 8) decode_float64<little_endian>(in, out, count);
+			else decode_float32<little_endian>(in, out, count);
+			break;
+		case sample_type_t::signed_int:
+			decode_integer<little_endian, true>(info.bytes, in, out, count);
+			break;
+		case sample_type_t::unsigned_int:
+			decode_integer<little_endian, false>(info.bytes, in, out, count);
+			break;
+	}
+}
+
+template<bool little_endian, typename T>
+void encode_scalar(const sample_format_t& info, const T* in, uint8_t* out, size_t count)
+{
+	switch (info.type) {
+		case sample_type_t::floating:
+			if (info.bytes == 8) encode_float64<little_endian>(in, out, count);
+			else encode_float32<little_endian>(in, out, count);
+			break;
+		case sample_type_t::signed_int:
+			encode_integer<little_endian, true>(info.bytes, in, out, count);
+			break;
+		case sample_type_t::unsigned_int:
+			encode_integer<little_endian, false>(info.bytes, in, out, count);
+			break;
+	}
+}
+
+void swap_bytes_scalar(uint8_t* data, size_t count, size_t bytes)
+{
+	for (size_t i = 0; i < count; ++i, data += bytes) {
+		std::reverse(data, data + bytes);
+	}
+}
+
+// Reorders whole samples between interleaved and planar layout
+void reorder_samples(const uint8_t* in, uint8_t* out, size_t frames, size_t channels, size_t bytes, bool to_planar)
+{
+	for (size_t c = 0; c < channels; ++c) {
+		for (size_t i = 0; i < frames; ++i) {
+			const size_t interleaved = (i * channels + c) * bytes;
+			const size_t planar = (c * frames + i) * bytes;
+			if (to_planar) std::memcpy(out + planar, in + interleaved, bytes);
+			else std::memcpy(out + interleaved, in + planar, bytes);
+		}
+	}
+}
+
+#ifdef YURI_SIMD_X86
+
+// All the SIMD kernels process samples in little endian
+const float s16_scale = 1.0f / 32768.0f;
+const float s32_scale = 1.0f / 2147483648.0f;
+
+YURI_TARGET_SSE41
+size_t decode_s16_sse41(const uint8_t* in, float* out, size_t count)
+{
+	const __m128 scale = _mm_set1_ps(s16_scale);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2));
+		_mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(v)), scale));
+		_mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8))), scale));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t decode_s16_avx2(const uint8_t* in, float* out, size_t count)
+{
+	const __m256 scale = _mm256_set1_ps(s16_scale);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2)));
+		const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2 + 16)));
+		_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+		_mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t encode_s16_sse41(const float* in, uint8_t* out, size_t count)
+{
+	const __m128 scale = _mm_set1_ps(32768.0f);
+	const __m128 min_value = _mm_set1_ps(-32768.0f);
+	const __m128 max_value = _mm_set1_ps(32767.0f);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i), scale), min_value), max_value);
+		const __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i + 4), scale), min_value), max_value);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t encode_s16_avx2(const float* in, uint8_t* out, size_t count)
+{
+	const __m256 scale = _mm256_set1_ps(32768.0f);
+	const __m256 min_value = _mm256_set1_ps(-32768.0f);
+	const __m256 max_value = _mm256_set1_ps(32767.0f);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(in + i), scale), min_value), max_value);
+		const __m256 b = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(in + i + 8), scale), min_value), max_value);
+		// Packing works within 128bit lanes, so the quadwords have to be reordered afterwards
+		const __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2), _mm256_permute4x64_epi64(packed, 0xd8));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t decode_s32_sse41(const uint8_t* in, float* out, size_t count)
+{
+	const __m128 scale = _mm_set1_ps(s32_scale);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+		_mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(v), scale));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t decode_s32_avx2(const uint8_t* in, float* out, size_t count)
+{
+	const __m256 scale = _mm256_set1_ps(s32_scale);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 4));
+		_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale));
+	}
+	return i;
+}
+
+// Values overflowing 2^31 are converted to 0x80000000 by cvtps, so they're flipped to 0x7fffffff
+YURI_TARGET_SSE41
+size_t encode_s32_sse41(const float* in, uint8_t* out, size_t count)
+{
+	const __m128 scale = _mm_set1_ps(2147483648.0f);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 v = _mm_mul_ps(_mm_loadu_ps(in + i), scale);
+		const __m128i overflow = _mm_castps_si128(_mm_cmpge_ps(v, scale));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), _mm_xor_si128(_mm_cvtps_epi32(v), overflow));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t encode_s32_avx2(const float* in, uint8_t* out, size_t count)
+{
+	const __m256 scale = _mm256_set1_ps(2147483648.0f);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 v = _mm256_mul_ps(_mm256_loadu_ps(in + i), scale);
+		const __m256i overflow = _mm256_castps_si256(_mm256_cmp_ps(v, scale, _CMP_GE_OQ));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), _mm256_xor_si256(_mm256_cvtps_epi32(v), overflow));
+	}
+	return i;
+}
+
+__m128i swap_mask(size_t bytes)
+{
+	switch (bytes) {
+		case 2: return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+		case 4: return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+		default: return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+	}
+}
+
+YURI_TARGET_SSE41
+size_t swap_bytes_sse41(uint8_t* data, size_t size, size_t bytes)
+{
+	const __m128i mask = swap_mask(bytes);
+	size_t i = 0;
+	for (; i + 16 <= size; i += 16) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(v, mask));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t swap_bytes_avx2(uint8_t* data, size_t size, size_t bytes)
+{
+	// Samples never cross 128bit lanes, so the same mask is used for both of them
+	const __m256i mask = _mm256_broadcastsi128_si256(swap_mask(bytes));
+	size_t i = 0;
+	for (; i + 32 <= size; i += 32) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_shuffle_epi8(v, mask));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t interleave_stereo_sse41(const float* left, const float* right, float* out, size_t frames)
+{
+	size_t i = 0;
+	for (; i + 4 <= frames; i += 4) {
+		const __m128 l = _mm_loadu_ps(left + i);
+		const __m128 r = _mm_loadu_ps(right + i);
+		_mm_storeu_ps(out + i * 2, _mm_unpacklo_ps(l, r));
+		_mm_storeu_ps(out + i * 2 + 4, _mm_unpackhi_ps(l, r));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t deinterleave_stereo_sse41(const float* in, float* left, float* right, size_t frames)
+{
+	size_t i = 0;
+	for (; i + 4 <= frames; i += 4) {
+		const __m128 a = _mm_loadu_ps(in + i * 2);
+		const __m128 b = _mm_loadu_ps(in + i * 2 + 4);
+		_mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+	return i;
+}
+
+#endif
+
+}
+
+bool get_sample_format(format_t format, sample_format_t& info)
+{
+	auto it = sample_formats.find(format);
+	if (it == sample_formats.end()) return false;
+	info = it->second;
+	return true;
+}
+
+const std::vector<format_t>& get_supported_formats()
+{
+	static const std::vector<format_t> formats = [] {
+		std::vector<format_t> f;
+		for (const auto& it: sample_formats) f.push_back(it.first);
+		return f;
+	}();
+	return formats;
+}
+
+size_t get_precision(const sample_format_t& info)
+{
+	if (info.type == sample_type_t::floating) return info.bytes == 8 ? 53 : 24;
+	return info.bytes * 8;
+}
+
+void decode_samples(const sample_format_t& info, const uint8_t* in, float* out, size_t count, simd_level_t level)
+{
+	size_t done = 0;
+#ifdef YURI_SIMD_X86
+	if (info.little_endian && info.type == sample_type_t::signed_int) {
+		if (info.bytes == 2) {
+			if (level == simd_level_t::avx2) done = decode_s16_avx2(in, out, count);
+			else if (level == simd_level_t::sse41) done = decode_s16_sse41(in, out, count);
+		} else if (info.bytes == 4) {
+			if (level == simd_level_t::avx2) done = decode_s32_avx2(in, out, count);
+			else if (level == simd_level_t::sse41) done = decode_s32_sse41(in, out, count);
+		}
+	}
+#else
+	(void)level;
+#endif
+	in += done * info.bytes;
+	out += done;
+	count -= done;
+	if (info.little_endian) decode_scalar<true>(info, in, out, count);
+	else decode_scalar<false>(info, in, out, count);
+}
+
+void decode_samples(const sample_format_t& info, const uint8_t* in, double* out, size_t count)
+{
+	if (info.little_endian) decode_scalar<true>(info, in, out, count);
+	else decode_scalar<false>(info, in, out, count);
+}
+
+void encode_samples(const sample_format_t& info, const float* in, uint8_t* out, size_t count, simd_level_t level)
+{
+	size_t done = 0;
+#ifdef YURI_SIMD_X86
+	if (info.little_endian && info.type == sample_type_t::signed_int) {
+		if (info.bytes == 2) {
+			if (level == simd_level_t::avx2) done = encode_s16_avx2(in, out, count);
+			else if (level == simd_level_t::sse41) done = encode_s16_sse41(in, out, count);
+		} else if (info.bytes == 4) {
+			if (level == simd_level_t::avx2) done = encode_s32_avx2(in, out, count);
+			else if (level == simd_level_t::sse41) done = encode_s32_sse41(in, out, count);
+		}
+	}
+#else
+	(void)level;
+#endif
+	in += done;
+	out += done * info.bytes;
+	count -= done;
+	if (info.little_endian) encode_scalar<true>(info, in, out, count);
+	else encode_scalar<false>(info, in, out, count);
+}
+
+void encode_samples(const sample_format_t& info, const double* in, uint8_t* out, size_t count)
+{
+	if (info.little_endian) encode_scalar<true>(info, in, out, count);
+	else encode_scalar<false>(info, in, out, count);
+}
+
+void interleave(const float* in, float* out, size_t frames, size_t channels, simd_level_t level)
+{
+#ifdef YURI_SIMD_X86
+	if (channels == 2 && level >= simd_level_t::sse41) {
+		const size_t done = interleave_stereo_sse41(in, in + frames, out, frames);
+		for (size_t i = done; i < frames; ++i) {
+			out[i * 2] = in[i];
+			out[i * 2 + 1] = in[frames + i];
+		}
+		return;
+	}
+#else
+	(void)level;
+#endif
+	for (size_t c = 0; c < channels; ++c) {
+		const float* plane = in + c * frames;
+		for (size_t i = 0; i < frames; ++i) {
+			out[i * channels + c] = plane[i];
+		}
+	}
+}
+
+void deinterleave(const float* in, float* out, size_t frames, size_t channels, simd_level_t level)
+{
+#ifdef YURI_SIMD_X86
+	if (channels == 2 && level >= simd_level_t::sse41) {
+		const size_t done = deinterleave_stereo_sse41(in, out, out + frames, frames);
+		for (size_t i = done; i < frames; ++i) {
+			out[i] = in[i * 2];
+			out[frames + i] = in[i * 2 + 1];
+		}
+		return;
+	}
+#else
+	(void)level;
+#endif
+	for (size_t c = 0; c < channels; ++c) {
+		float* plane = out + c * frames;
+		for (size_t i = 0; i < frames; ++i) {
+			plane[i] = in[i * channels + c];
+		}
+	}
+}
+
+void swap_bytes(uint8_t* data, size_t count, size_t bytes, simd_level_t level)
+{
+	size_t done = 0;
+#ifdef YURI_SIMD_X86
+	if (bytes == 2 || bytes == 4 || bytes == 8) {
+		if (level == simd_level_t::avx2) done = swap_bytes_avx2(data, count * bytes, bytes);
+		else if (level == simd_level_t::sse41) done = swap_bytes_sse41(data, count * bytes, bytes);
+	}
+#else
+	(void)level;
+#endif
+	swap_bytes_scalar(data + done, count - done / bytes, bytes);
+}
+
+bool convert_samples(format_t source, format_t target, const uint8_t* in, uint8_t* out, size_t frames, size_t channels, simd_level_t level)
+{
+	sample_format_t src, dst;
+	if (!get_sample_format(source, src) || !get_sample_format(target, dst)) return false;
+	const size_t count = frames * channels;
+	const bool reorder = src.planar != dst.planar && channels > 1;
+	if (src.type == dst.type && src.bytes == dst.bytes) {
+		// Only byte order or layout differs, so the values are kept intact
+		if (reorder) reorder_samples(in, out, frames, channels, src.bytes, dst.planar);
+		else std::copy(in, in + count * src.bytes, out);
+		if (src.little_endian != dst.little_endian && src.bytes > 1) swap_bytes(out, count, src.bytes, level);
+		return true;
+	}
+	if (get_precision(src) > 24 && get_precision(dst) > 24) {
+		// Float would lose the low bits, so wide formats are converted through doubles
+		std::vector<double> samples(count);
+		decode_samples(src, in, samples.data(), count);
+		if (reorder) {
+			std::vector<double> reordered(count);
+			reorder_samples(reinterpret_cast<const uint8_t*>(samples.data()), reinterpret_cast<uint8_t*>(reordered.data()),
+					frames, channels, sizeof(double), dst.planar);
+			samples.swap(reordered);
+		}
+		encode_samples(dst, samples.data(), out, count);
+		return true;
+	}
+	std::vector<float> samples(count);
+	decode_samples(src, in, samples.data(), count, level);
+	if (reorder) {
+		std::vector<float> reordered(count);
+		if (dst.planar) deinterleave(samples.data(), reordered.data(), frames, channels, level);
+		else interleave(samples.data(), reordered.data(), frames, channels, level);
+		samples.swap(reordered);
+	}
+	encode_samples(dst, samples.data(), out, count, level);
+	return true;
+}
+
+}
+}
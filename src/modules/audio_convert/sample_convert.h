@@ -0,0 +1,99 @@
+/*!
+ * @file 		sample_convert.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Conversion of audio samples between raw audio formats.
+ *
+ * Samples are converted through 32bit float in range <-1, 1), integer values are scaled
+ * by 2^(bits-1) and unsigned formats are offset by half of their range.
+ * When both formats have more than 24 significant bits, 64bit double is used instead,
+ * so the conversions between them are exact when the target isn't narrower.
+ * Formats differing only in byte order or layout (interleaved/planar)
+ * are converted without touching the values.
+ */
+
+#ifndef SAMPLE_CONVERT_H_
+#define SAMPLE_CONVERT_H_
+
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/cpu_features.h"
+#include <string>
+#include <vector>
+
+namespace yuri {
+namespace audio_convert {
+
+using core::cpu::simd_level_t;
+using core::cpu::get_supported_level;
+using core::cpu::parse_level;
+
+enum class sample_type_t {
+	signed_int,
+	unsigned_int,
+	floating
+};
+
+struct sample_format_t {
+	sample_type_t	type;
+	//! Size of a single sample in bytes
+	size_t			bytes;
+	bool			little_endian;
+	bool			planar;
+};
+
+/*!
+ * Describes samples of a raw audio format
+ * @return false if the format is not supported
+ */
+bool get_sample_format(format_t format, sample_format_t& info);
+
+//! Returns all formats supported by the converters
+const std::vector<format_t>& get_supported_formats();
+
+/*!
+ * Number of significant bits of a sample, used to find lossy conversions
+ */
+size_t get_precision(const sample_format_t& info);
+
+/*!
+ * Converts @em count samples to floats. Samples are kept in the same order.
+ */
+void decode_samples(const sample_format_t& info, const uint8_t* in, float* out, size_t count, simd_level_t level);
+
+/*!
+ * Converts @em count floats to samples, clipping values out of the range.
+ */
+void encode_samples(const sample_format_t& info, const float* in, uint8_t* out, size_t count, simd_level_t level);
+
+//! Converts @em count samples to doubles, keeping all bits of formats up to 48 bits
+void decode_samples(const sample_format_t& info, const uint8_t* in, double* out, size_t count);
+
+//! Converts @em count doubles to samples, clipping values out of the range.
+void encode_samples(const sample_format_t& info, const double* in, uint8_t* out, size_t count);
+
+/*!
+ * Converts planar samples (@em frames samples of the first channel, followed by the second channel...)
+ * to interleaved ones.
+ */
+void interleave(const float* in, float* out, size_t frames, size_t channels, simd_level_t level);
+
+//! Converts interleaved samples to planar ones
+void deinterleave(const float* in, float* out, size_t frames, size_t channels, simd_level_t level);
+
+//! Reverses byte order of @em count samples of @em bytes bytes each
+void swap_bytes(uint8_t* data, size_t count, size_t bytes, simd_level_t level);
+
+/*!
+ * Converts @em frames samples of @em channels channels from @em source to @em target format.
+ * @param out Buffer for frames * channels samples of the target format
+ * @return false if any of the formats is not supported
+ */
+bool convert_samples(format_t source, format_t target, const uint8_t* in, uint8_t* out, size_t frames, size_t channels, simd_level_t level);
+
+}
+}
+
+#endif /* SAMPLE_CONVERT_H_ */
@@ -0,0 +1,286 @@
+/*!
+ * @file 		test_audio_convert.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "sample_convert.h"
+#include "AudioResampler.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace yuri {
+namespace audio_convert {
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+
+std::vector<simd_level_t> get_levels()
+{
+	std::vector<simd_level_t> levels = {simd_level_t::none};
+	if (get_supported_level() >= simd_level_t::sse41) levels.push_back(simd_level_t::sse41);
+	if (get_supported_level() >= simd_level_t::avx2) levels.push_back(simd_level_t::avx2);
+	return levels;
+}
+
+std::vector<int16_t> make_samples(size_t count)
+{
+	std::mt19937 gen(count);
+	std::uniform_int_distribution<int> dist(-32768, 32767);
+	std::vector<int16_t> samples(count);
+	for (auto& s: samples) s = static_cast<int16_t>(dist(gen));
+	samples[0] = -32768;
+	samples[1] = 32767;
+	samples[2] = 0;
+	return samples;
+}
+
+std::vector<uint8_t> convert(format_t source, format_t target, const std::vector<uint8_t>& in, size_t frames, size_t channels, simd_level_t level)
+{
+	sample_format_t info;
+	REQUIRE(get_sample_format(target, info));
+	std::vector<uint8_t> out(frames * channels * info.bytes);
+	REQUIRE(convert_samples(source, target, in.data(), out.data(), frames, channels, level));
+	return out;
+}
+
+std::vector<float> make_sine(double frequency, size_t sampling_frequency, size_t count)
+{
+	std::vector<float> samples(count);
+	for (size_t i = 0; i < count; ++i) {
+		samples[i] = static_cast<float>(0.5 * std::sin(2.0 * pi * frequency * i / sampling_frequency));
+	}
+	return samples;
+}
+
+}
+
+TEST_CASE("audio sample formats", "[audio_convert]")
+{
+	using namespace core::raw_audio_format;
+	sample_format_t info;
+	REQUIRE(get_sample_format(signed_24bit_be, info));
+	REQUIRE(info.type == sample_type_t::signed_int);
+	REQUIRE(info.bytes == 3);
+	REQUIRE(!info.little_endian);
+	REQUIRE(!info.planar);
+	REQUIRE(get_sample_format(float_32bit_planar, info));
+	REQUIRE(info.planar);
+	REQUIRE(get_precision(info) == 24);
+	REQUIRE(!get_sample_format(unknown, info));
+	REQUIRE(float_64bit != float_64bit_be);
+	REQUIRE(get_supported_formats().size() == 26);
+}
+
+TEST_CASE("audio known values", "[audio_convert]")
+{
+	using namespace core::raw_audio_format;
+	const std::vector<float> values = {0.0f, 1.0f, -1.0f, 0.5f, 2.0f, -2.0f};
+	const std::vector<uint8_t> in(reinterpret_cast<const uint8_t*>(values.data()), reinterpret_cast<const uint8_t*>(values.data() + values.size()));
+	for (auto level: get_levels()) {
+		auto s16 = convert(float_32bit, signed_16bit, in, values.size(), 1, level);
+		const auto* p16 = reinterpret_cast<const int16_t*>(s16.data());
+		REQUIRE(p16[0] == 0);
+		REQUIRE(p16[1] == 32767);
+		REQUIRE(p16[2] == -32768);
+		REQUIRE(p16[3] == 16384);
+		REQUIRE(p16[4] == 32767);
+		REQUIRE(p16[5] == -32768);
+
+		auto s32 = convert(float_32bit, signed_32bit, in, values.size(), 1, level);
+		const auto* p32 = reinterpret_cast<const int32_t*>(s32.data());
+		REQUIRE(p32[1] == 2147483647);
+		REQUIRE(p32[2] == -2147483647 - 1);
+		REQUIRE(p32[3] == 1073741824);
+		REQUIRE(p32[4] == 2147483647);
+
+		auto u8 = convert(float_32bit, unsigned_8bit, in, values.size(), 1, level);
+		REQUIRE(u8[0] == 128);
+		REQUIRE(u8[1] == 255);
+		REQUIRE(u8[2] == 0);
+
+		auto s24be = convert(float_32bit, signed_24bit_be, in, values.size(), 1, level);
+		REQUIRE(s24be[9] == 0x40);
+		REQUIRE(s24be[10] == 0x00);
+		REQUIRE(s24be[11] == 0x00);
+	}
+}
+
+TEST_CASE("audio lossless conversions", "[audio_convert]")
+{
+	using namespace core::raw_audio_format;
+	const size_t frames = 1031;
+	const size_t channels = 2;
+	const auto samples = make_samples(frames * channels);
+	const std::vector<uint8_t> in(reinterpret_cast<const uint8_t*>(samples.data()), reinterpret_cast<const uint8_t*>(samples.data() + samples.size()));
+	for (auto level: get_levels()) {
+		// Every format with at least 16 bits keeps 16bit samples intact
+		for (auto format: get_supported_formats()) {
+			sample_format_t info;
+			REQUIRE(get_sample_format(format, info));
+			if (get_precision(info) < 16) continue;
+			INFO("format " << std::hex << format);
+			auto converted = convert(signed_16bit, format, in, frames, channels, level);
+			REQUIRE(convert(format, signed_16bit, converted, frames, channels, level) == in);
+		}
+		auto be = convert(signed_16bit, signed_16bit_be, in, frames, channels, level);
+		REQUIRE(be[0] == in[1]);
+		REQUIRE(be[1] == in[0]);
+		auto planar = convert(signed_16bit, signed_16bit_planar, in, frames, channels, level);
+		REQUIRE(planar[frames * 2] == in[2]);
+		REQUIRE(planar[frames * 2 + 1] == in[3]);
+	}
+}
+
+TEST_CASE("audio lossless conversions of wide formats", "[audio_convert]")
+{
+	using namespace core::raw_audio_format;
+	const size_t frames = 517;
+	const size_t channels = 2;
+	std::mt19937 gen(frames);
+	std::uniform_int_distribution<int32_t> dist(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+	std::vector<int32_t> samples(frames * channels);
+	for (auto& s: samples) s = dist(gen);
+	samples[0] = std::numeric_limits<int32_t>::min();
+	samples[1] = std::numeric_limits<int32_t>::max();
+	samples[2] = 1;
+	samples[3] = -1;
+	const std::vector<uint8_t> in(reinterpret_cast<const uint8_t*>(samples.data()), reinterpret_cast<const uint8_t*>(samples.data() + samples.size()));
+	for (auto level: get_levels()) {
+		// Every format with at least 32 bits keeps 32bit samples bit exact
+		for (auto format: get_supported_formats()) {
+			sample_format_t info;
+			REQUIRE(get_sample_format(format, info));
+			if (get_precision(info) < 32) continue;
+			INFO("format " << std::hex << format);
+			auto converted = convert(signed_32bit, format, in, frames, channels, level);
+			REQUIRE(convert(format, signed_32bit, converted, frames, channels, level) == in);
+			// Including conversions between the wide formats
+			auto unsigned_converted = convert(format, unsigned_32bit, converted, frames, channels, level);
+			REQUIRE(convert(unsigned_32bit, signed_32bit_planar, unsigned_converted, frames, channels, level) ==
+					convert(signed_32bit, signed_32bit_planar, in, frames, channels, level));
+		}
+	}
+}
+
+TEST_CASE("audio simd kernels", "[audio_convert]")
+{
+	const size_t count = 1000;
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<float> dist(-1.5f, 1.5f);
+	std::vector<float> values(count);
+	for (auto& v: values) v = dist(gen);
+	values[0] = 1.0f;
+	values[1] = -1.0f;
+
+	for (auto format: {core::raw_audio_format::signed_16bit, core::raw_audio_format::signed_32bit, core::raw_audio_format::float_64bit}) {
+		sample_format_t info;
+		REQUIRE(get_sample_format(format, info));
+		std::vector<uint8_t> reference(count * info.bytes);
+		encode_samples(info, values.data(), reference.data(), count, simd_level_t::none);
+		std::vector<float> decoded_reference(count);
+		decode_samples(info, reference.data(), decoded_reference.data(), count, simd_level_t::none);
+		for (auto level: get_levels()) {
+			std::vector<uint8_t> encoded(count * info.bytes);
+			encode_samples(info, values.data(), encoded.data(), count, level);
+			REQUIRE(encoded == reference);
+			std::vector<float> decoded(count);
+			decode_samples(info, encoded.data(), decoded.data(), count, level);
+			REQUIRE(decoded == decoded_reference);
+		}
+	}
+
+	for (size_t bytes: {2, 3, 4, 8}) {
+		std::vector<uint8_t> data(count * bytes);
+		for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 7);
+		for (auto level: get_levels()) {
+			auto swapped = data;
+			swap_bytes(swapped.data(), count, bytes, level);
+			for (size_t i = 0; i < count; ++i) {
+				REQUIRE(std::equal(data.begin() + i * bytes, data.begin() + (i + 1) * bytes, swapped.rbegin() + (count - i - 1) * bytes));
+			}
+		}
+	}
+
+	for (size_t channels: {1, 2, 3, 6}) {
+		const size_t frames = count / channels;
+		for (auto level: get_levels()) {
+			std::vector<float> planar(frames * channels), interleaved(frames * channels);
+			deinterleave(values.data(), planar.data(), frames, channels, level);
+			REQUIRE(planar[frames * (channels - 1)] == values[channels - 1]);
+			interleave(planar.data(), interleaved.data(), frames, channels, level);
+			REQUIRE(std::equal(interleaved.begin(), interleaved.end(), values.begin()));
+		}
+	}
+}
+
+TEST_CASE("audio resampler", "[audio_convert]")
+{
+	struct test_t {
+		size_t input;
+		size_t output;
+	};
+	const double frequency = 1000.0;
+	for (auto t: {test_t{44100, 48000}, test_t{48000, 44100}, test_t{48000, 16000}, test_t{8000, 48000}, test_t{44100, 47999}}) {
+		for (auto level: get_levels()) {
+			INFO("from " << t.input << " to " << t.output);
+			AudioResampler resampler(t.input, t.output, 2, quality_t::high, level);
+			if (t.output == 47999) REQUIRE(resampler.get_phases() == AudioResampler::max_phases);
+			REQUIRE(resampler.get_taps() % 8 == 0);
+
+			// Processed in blocks of different size, the second channel is silent
+			const auto input = make_sine(frequency, t.input, t.input / 2);
+			std::vector<float> output;
+			std::vector<std::vector<float>> out;
+			size_t offset = 0;
+			for (size_t block = 1; offset < input.size(); block = block * 3 + 7) {
+				const size_t frames = std::min(block, input.size() - offset);
+				std::vector<float> planar(input.begin() + offset, input.begin() + offset + frames);
+				planar.resize(frames * 2, 0.0f);
+				resampler.process(planar.data(), frames, out);
+				REQUIRE(out.size() == 2);
+				REQUIRE(out[0].size() == out[1].size());
+				output.insert(output.end(), out[0].begin(), out[0].end());
+				for (auto v: out[1]) REQUIRE(v == 0.0f);
+				offset += frames;
+			}
+			const size_t expected = input.size() * t.output / t.input;
+			const size_t latency = resampler.get_taps() * t.output / t.input / 2 + 2;
+			REQUIRE(output.size() <= expected + 1);
+			REQUIRE(output.size() + latency >= expected);
+
+			// Output matches the ideal sine (past the start of the filter)
+			const auto ideal = make_sine(frequency, t.output, output.size());
+			double max_error = 0.0;
+			for (size_t i = latency; i < output.size(); ++i) {
+				max_error = std::max(max_error, std::abs(static_cast<double>(output[i]) - ideal[i]));
+			}
+			REQUIRE(max_error < 1e-3);
+		}
+	}
+}
+
+TEST_CASE("audio resampler stopband", "[audio_convert]")
+{
+	// 10kHz is above the Nyquist frequency of the output
+	AudioResampler resampler(48000, 16000, 1, quality_t::high);
+	const auto input = make_sine(10000.0, 48000, 48000);
+	std::vector<std::vector<float>> out;
+	resampler.process(input.data(), input.size(), out);
+	REQUIRE(out.size() == 1);
+	float peak = 0.0f;
+	for (size_t i = resampler.get_taps(); i < out[0].size(); ++i) peak = std::max(peak, std::abs(out[0][i]));
+	REQUIRE(peak < 1e-3f);
+	REQUIRE_THROWS(parse_quality("none"));
+	REQUIRE(parse_quality("Best") == quality_t::best);
+}
+
+}
+}
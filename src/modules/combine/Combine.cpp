@@ -91,7 +91,7 @@ std::vector<core::pFrame> Combine::do_single_step(std::vector<core::pFrame> fram
 	size_t idx = 0;
 	for (size_t idx_y=0;idx_y<y_;++idx_y) {
 		for (size_t idx_x=0;idx_x<x_;++idx_x) {
-			const uint8_t* raw_src = PLANE_RAW_DATA(frames[idx],0);
+			const uint8_t* raw_src = PLANE_CONST_RAW_DATA(frames[idx],0);
 			for (size_t line=0;line<height;++line) {
 				std::copy(raw_src+line*sub_line_width,
 						raw_src+(line+1)*sub_line_width,
@@ -12,6 +12,7 @@
 #include "yuri/core/frame/raw_frame_types.h"
 #include "yuri/core/frame/raw_frame_params.h"
 #include "yuri/core/thread/ConverterRegister.h"
+#include "yuri/core/thread/WorkerPool.h"
 #include "yuri/core/utils/irange.h"
 #include <array>
 namespace yuri {
@@ -20,13 +21,12 @@ namespace convert_planar {
 namespace {
 
 template<format_t in, format_t out, size_t planes>
-core::pRawVideoFrame split_planes(const core::pRawVideoFrame& frame, const std::array<size_t, planes>& offsets)
+core::pRawVideoFrame split_planes(const core::pRawVideoFrame& frame, const std::array<size_t, planes>& offsets, size_t threads)
 {
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
 	std::array<iter_t, planes> iters_start;
-	std::array<iter_t, planes> iters;
 	std::array<size_t, planes> lsizes;
 
 	const size_t linesize = PLANE_DATA(frame, 0).get_line_size();
@@ -38,28 +38,30 @@ core::pRawVideoFrame split_planes(const core::pRawVideoFrame& frame, const std::
 	}
 
 
-	for (auto line: irange(res.height)) {
-		auto iter_in = iter_in_start  + line * linesize;
-		for (auto i: irange(planes)) {
-			iters[i]=iters_start[i] + line * lsizes[i];
-		}
-		for (size_t col = 0; col < res.width; ++col) {
-			for (size_t i = 0; i < planes; ++i) {
-				*iters[i]++=*iter_in++;
+	core::parallel_for_lines(res.height, linesize * 2, threads, [&](size_t start, size_t end) {
+		std::array<iter_t, planes> iters;
+		for (auto line: irange(start, end)) {
+			auto iter_in = iter_in_start  + line * linesize;
+			for (auto i: irange(planes)) {
+				iters[i]=iters_start[i] + line * lsizes[i];
+			}
+			for (size_t col = 0; col < res.width; ++col) {
+				for (size_t i = 0; i < planes; ++i) {
+					*iters[i]++=*iter_in++;
+				}
 			}
 		}
-	}
+	});
 	return frame_out;
 }
 
 template<format_t in, format_t out, size_t planes>
-core::pRawVideoFrame merge_planes(const core::pRawVideoFrame& frame, const std::array<size_t, planes>& offsets)
+core::pRawVideoFrame merge_planes(const core::pRawVideoFrame& frame, const std::array<size_t, planes>& offsets, size_t threads)
 {
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
 	std::array<iter_t, planes> iters_start;
-	std::array<iter_t, planes> iters;
 	std::array<size_t, planes> lsizes;
 	const size_t linesize = PLANE_DATA(frame_out, 0).get_line_size();
 	auto iter_out_start = PLANE_DATA(frame_out, 0).begin();
@@ -67,18 +69,21 @@ core::pRawVideoFrame merge_planes(const core::pRawVideoFrame& frame, const std::
 		iters_start[i]=PLANE_DATA(frame, offsets[i]).begin();
 		lsizes[i] = PLANE_DATA(frame, offsets[i]).get_line_size();
 	}
-	for (auto line: irange(res.height)) {
-		auto iter_out = iter_out_start  + line * linesize;
-		for (auto i: irange(planes)) {
-			iters[i]=iters_start[i] + line * lsizes[i];
-		}
-		for (auto col: irange(res.width)) {
-			(void)col;
+	core::parallel_for_lines(res.height, linesize * 2, threads, [&](size_t start, size_t end) {
+		std::array<iter_t, planes> iters;
+		for (auto line: irange(start, end)) {
+			auto iter_out = iter_out_start  + line * linesize;
 			for (auto i: irange(planes)) {
-				*iter_out++ = *iters[i]++;
+				iters[i]=iters_start[i] + line * lsizes[i];
+			}
+			for (auto col: irange(res.width)) {
+				(void)col;
+				for (auto i: irange(planes)) {
+					*iter_out++ = *iters[i]++;
+				}
 			}
 		}
-	}
+	});
 	return frame_out;
 }
 template<format_t in>
@@ -120,19 +125,24 @@ void store_yuv422<core::raw_format::vyuy422>(uint8_t*& it, uint8_t*& y, uint8_t*
 }
 
 template<format_t in, format_t out>
-core::pRawVideoFrame split_planes_422p(core::pRawVideoFrame frame)
+core::pRawVideoFrame split_planes_422p(core::pRawVideoFrame frame, size_t threads)
 {
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
-	auto iter_in = PLANE_DATA(frame, 0).begin();
-	auto iter_out0 = PLANE_DATA(frame_out, 0).begin();
-	auto iter_out1 = PLANE_DATA(frame_out, 1).begin();
-	auto iter_out2 = PLANE_DATA(frame_out, 2).begin();
-	for (size_t line = 0; line < res.height; line+=1) {
-		for (size_t col = 0; col < res.width; col+=2) {
-			store_yuv422<in>(iter_in, iter_out0, iter_out1, iter_out2);
+	const size_t linesize = PLANE_DATA(frame, 0).get_line_size();
+	const std::array<size_t, 3> lsizes {{PLANE_DATA(frame_out, 0).get_line_size(),
+		PLANE_DATA(frame_out, 1).get_line_size(), PLANE_DATA(frame_out, 2).get_line_size()}};
+	core::parallel_for_lines(res.height, linesize * 2, threads, [&](size_t start, size_t end) {
+		for (auto line: irange(start, end)) {
+			auto iter_in = PLANE_DATA(frame, 0).begin() + line * linesize;
+			auto iter_out0 = PLANE_DATA(frame_out, 0).begin() + line * lsizes[0];
+			auto iter_out1 = PLANE_DATA(frame_out, 1).begin() + line * lsizes[1];
+			auto iter_out2 = PLANE_DATA(frame_out, 2).begin() + line * lsizes[2];
+			for (size_t col = 0; col < res.width; col+=2) {
+				store_yuv422<in>(iter_in, iter_out0, iter_out1, iter_out2);
+			}
 		}
-	}
+	});
 	return frame_out;
 }
 
@@ -219,21 +229,25 @@ void store_yuv420<core::raw_format::vyuy422>(uint8_t*& it0, uint8_t*& it1, uint8
 	*u++=static_cast<uint8_t>(ua/2);
 }
 template<format_t in, format_t out>
-core::pRawVideoFrame split_planes_420p(core::pRawVideoFrame frame)
+core::pRawVideoFrame split_planes_420p(core::pRawVideoFrame frame, size_t threads)
 {
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
-	auto iter_out1 = PLANE_DATA(frame_out, 1).begin();
-	auto iter_out2 = PLANE_DATA(frame_out, 2).begin();
-	for (size_t line = 0; line < res.height; line+=2) {
-		auto iter_in0 = PLANE_DATA(frame, 0).begin() + line*res.width*2;
-		auto iter_in1 = PLANE_DATA(frame, 0).begin() + (line+1)*res.width*2;
-		auto iter_out00 = PLANE_DATA(frame_out, 0).begin() + line*res.width;
-		auto iter_out01 = PLANE_DATA(frame_out, 0).begin() + (line+1)*res.width;
-		for (size_t col = 0; col < res.width; col+=2) {
-			store_yuv420<in>(iter_in0, iter_in1, iter_out00, iter_out01, iter_out1, iter_out2);
+	// Processed by pairs of lines, sharing a line of chroma
+	core::parallel_for_lines(res.height / 2, res.width * 6, threads, [&](size_t start, size_t end) {
+		auto iter_out1 = PLANE_DATA(frame_out, 1).begin() + start * (res.width / 2);
+		auto iter_out2 = PLANE_DATA(frame_out, 2).begin() + start * (res.width / 2);
+		for (auto pair: irange(start, end)) {
+			const size_t line = pair * 2;
+			auto iter_in0 = PLANE_DATA(frame, 0).begin() + line*res.width*2;
+			auto iter_in1 = PLANE_DATA(frame, 0).begin() + (line+1)*res.width*2;
+			auto iter_out00 = PLANE_DATA(frame_out, 0).begin() + line*res.width;
+			auto iter_out01 = PLANE_DATA(frame_out, 0).begin() + (line+1)*res.width;
+			for (size_t col = 0; col < res.width; col+=2) {
+				store_yuv420<in>(iter_in0, iter_in1, iter_out00, iter_out01, iter_out1, iter_out2);
+			}
 		}
-	}
+	});
 	return frame_out;
 }
 
@@ -315,19 +329,24 @@ void store_yuv411<core::raw_format::vyuy422>(uint8_t*& it, uint8_t*& y, uint8_t*
 	*u++=static_cast<uint8_t>(ua/2);
 }
 template<format_t in, format_t out>
-core::pRawVideoFrame split_planes_411p(core::pRawVideoFrame frame)
+core::pRawVideoFrame split_planes_411p(core::pRawVideoFrame frame, size_t threads)
 {
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
-	auto iter_in = PLANE_DATA(frame, 0).begin();
-	auto iter_out0 = PLANE_DATA(frame_out, 0).begin();
-	auto iter_out1 = PLANE_DATA(frame_out, 1).begin();
-	auto iter_out2 = PLANE_DATA(frame_out, 2).begin();
-	for (size_t line = 0; line < res.height; line+=1) {
-		for (size_t col = 0; col < res.width; col+=4) {
-			store_yuv411<in>(iter_in, iter_out0, iter_out1, iter_out2);
+	const size_t linesize = PLANE_DATA(frame, 0).get_line_size();
+	const std::array<size_t, 3> lsizes {{PLANE_DATA(frame_out, 0).get_line_size(),
+		PLANE_DATA(frame_out, 1).get_line_size(), PLANE_DATA(frame_out, 2).get_line_size()}};
+	core::parallel_for_lines(res.height, linesize * 2, threads, [&](size_t start, size_t end) {
+		for (auto line: irange(start, end)) {
+			auto iter_in = PLANE_DATA(frame, 0).begin() + line * linesize;
+			auto iter_out0 = PLANE_DATA(frame_out, 0).begin() + line * lsizes[0];
+			auto iter_out1 = PLANE_DATA(frame_out, 1).begin() + line * lsizes[1];
+			auto iter_out2 = PLANE_DATA(frame_out, 2).begin() + line * lsizes[2];
+			for (size_t col = 0; col < res.width; col+=4) {
+				store_yuv411<in>(iter_in, iter_out0, iter_out1, iter_out2);
+			}
 		}
-	}
+	});
 	return frame_out;
 }
 
@@ -384,110 +403,122 @@ core::pRawVideoFrame merge_planes_sub3_xy(core::pRawVideoFrame frame) {
 //	return frame_out;
 //}
 template<format_t in, format_t out>
-core::pRawVideoFrame merge_planes_420p_yuyv(core::pRawVideoFrame frame) {
+core::pRawVideoFrame merge_planes_420p_yuyv(core::pRawVideoFrame frame, size_t threads) {
 
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
-	iter_t iter_in0 = PLANE_DATA(frame, 0).begin();
-	iter_t iter_in1 = PLANE_DATA(frame, 1).begin();
-	iter_t iter_in2 = PLANE_DATA(frame, 2).begin();
-	iter_t iter_out = PLANE_DATA(frame_out, 0).begin();
-	for (size_t line = 0; line < res.height; line+=2) {
-		for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
-			iter_t it1 = iter_in1;
-			iter_t it2 = iter_in2;
-			for (size_t col = 0; col < res.width; col+=2) {
+	// Processed by pairs of lines, sharing a line of chroma
+	core::parallel_for_lines((res.height + 1) / 2, res.width * 6, threads, [&](size_t start, size_t end) {
+		iter_t iter_in0 = PLANE_DATA(frame, 0).begin() + start * 2 * res.width;
+		iter_t iter_in1 = PLANE_DATA(frame, 1).begin() + start * (res.width / 2);
+		iter_t iter_in2 = PLANE_DATA(frame, 2).begin() + start * (res.width / 2);
+		iter_t iter_out = PLANE_DATA(frame_out, 0).begin() + start * 4 * res.width;
+		for (size_t line = start * 2; line < std::min(res.height, end * 2); line+=2) {
+			for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
+				iter_t it1 = iter_in1;
+				iter_t it2 = iter_in2;
+				for (size_t col = 0; col < res.width; col+=2) {
 					*iter_out++ = *iter_in0++;
 					*iter_out++ = *it1++;
 					*iter_out++ = *iter_in0++;
 					*iter_out++ = *it2++;
+				}
 			}
+			iter_in1+=res.width/2;
+			iter_in2+=res.width/2;
 		}
-		iter_in1+=res.width/2;
-		iter_in2+=res.width/2;
-	}
+	});
 
 	return frame_out;
 }
 template<format_t in, format_t out>
-core::pRawVideoFrame merge_planes_420p_yvyu(core::pRawVideoFrame frame) {
+core::pRawVideoFrame merge_planes_420p_yvyu(core::pRawVideoFrame frame, size_t threads) {
 
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
-	iter_t iter_in0 = PLANE_DATA(frame, 0).begin();
-	iter_t iter_in1 = PLANE_DATA(frame, 1).begin();
-	iter_t iter_in2 = PLANE_DATA(frame, 2).begin();
-	iter_t iter_out = PLANE_DATA(frame_out, 0).begin();
-	for (size_t line = 0; line < res.height; line+=2) {
-		for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
-			iter_t it1 = iter_in1;
-			iter_t it2 = iter_in2;
-			for (size_t col = 0; col < res.width; col+=2) {
+	// Processed by pairs of lines, sharing a line of chroma
+	core::parallel_for_lines((res.height + 1) / 2, res.width * 6, threads, [&](size_t start, size_t end) {
+		iter_t iter_in0 = PLANE_DATA(frame, 0).begin() + start * 2 * res.width;
+		iter_t iter_in1 = PLANE_DATA(frame, 1).begin() + start * (res.width / 2);
+		iter_t iter_in2 = PLANE_DATA(frame, 2).begin() + start * (res.width / 2);
+		iter_t iter_out = PLANE_DATA(frame_out, 0).begin() + start * 4 * res.width;
+		for (size_t line = start * 2; line < std::min(res.height, end * 2); line+=2) {
+			for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
+				iter_t it1 = iter_in1;
+				iter_t it2 = iter_in2;
+				for (size_t col = 0; col < res.width; col+=2) {
 					*iter_out++ = *iter_in0++;
 					*iter_out++ = *it2++;
 					*iter_out++ = *iter_in0++;
 					*iter_out++ = *it1++;
+				}
 			}
+			iter_in1+=res.width/2;
+			iter_in2+=res.width/2;
 		}
-		iter_in1+=res.width/2;
-		iter_in2+=res.width/2;
-	}
+	});
 
 	return frame_out;
 }
 template<format_t in, format_t out>
-core::pRawVideoFrame merge_planes_420p_uyvy(core::pRawVideoFrame frame) {
+core::pRawVideoFrame merge_planes_420p_uyvy(core::pRawVideoFrame frame, size_t threads) {
 
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
-	iter_t iter_in0 = PLANE_DATA(frame, 0).begin();
-	iter_t iter_in1 = PLANE_DATA(frame, 1).begin();
-	iter_t iter_in2 = PLANE_DATA(frame, 2).begin();
-	iter_t iter_out = PLANE_DATA(frame_out, 0).begin();
-	for (size_t line = 0; line < res.height; line+=2) {
-		for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
-			iter_t it1 = iter_in1;
-			iter_t it2 = iter_in2;
-			for (size_t col = 0; col < res.width; col+=2) {
-				*iter_out++ = *it1++;
-				*iter_out++ = *iter_in0++;
-				*iter_out++ = *it2++;
-				*iter_out++ = *iter_in0++;
+	// Processed by pairs of lines, sharing a line of chroma
+	core::parallel_for_lines((res.height + 1) / 2, res.width * 6, threads, [&](size_t start, size_t end) {
+		iter_t iter_in0 = PLANE_DATA(frame, 0).begin() + start * 2 * res.width;
+		iter_t iter_in1 = PLANE_DATA(frame, 1).begin() + start * (res.width / 2);
+		iter_t iter_in2 = PLANE_DATA(frame, 2).begin() + start * (res.width / 2);
+		iter_t iter_out = PLANE_DATA(frame_out, 0).begin() + start * 4 * res.width;
+		for (size_t line = start * 2; line < std::min(res.height, end * 2); line+=2) {
+			for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
+				iter_t it1 = iter_in1;
+				iter_t it2 = iter_in2;
+				for (size_t col = 0; col < res.width; col+=2) {
+					*iter_out++ = *it1++;
+					*iter_out++ = *iter_in0++;
+					*iter_out++ = *it2++;
+					*iter_out++ = *iter_in0++;
+				}
 			}
+			iter_in1+=res.width/2;
+			iter_in2+=res.width/2;
 		}
-		iter_in1+=res.width/2;
-		iter_in2+=res.width/2;
-	}
+	});
 
 	return frame_out;
 }
 template<format_t in, format_t out>
-core::pRawVideoFrame merge_planes_420p_vyuy(core::pRawVideoFrame frame) {
+core::pRawVideoFrame merge_planes_420p_vyuy(core::pRawVideoFrame frame, size_t threads) {
 
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
-	iter_t iter_in0 = PLANE_DATA(frame, 0).begin();
-	iter_t iter_in1 = PLANE_DATA(frame, 1).begin();
-	iter_t iter_in2 = PLANE_DATA(frame, 2).begin();
-	iter_t iter_out = PLANE_DATA(frame_out, 0).begin();
-	for (size_t line = 0; line < res.height; line+=2) {
-		for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
-			iter_t it1 = iter_in1;
-			iter_t it2 = iter_in2;
-			for (size_t col = 0; col < res.width; col+=2) {
-				*iter_out++ = *it2++;
-				*iter_out++ = *iter_in0++;
-				*iter_out++ = *it1++;
-				*iter_out++ = *iter_in0++;
+	// Processed by pairs of lines, sharing a line of chroma
+	core::parallel_for_lines((res.height + 1) / 2, res.width * 6, threads, [&](size_t start, size_t end) {
+		iter_t iter_in0 = PLANE_DATA(frame, 0).begin() + start * 2 * res.width;
+		iter_t iter_in1 = PLANE_DATA(frame, 1).begin() + start * (res.width / 2);
+		iter_t iter_in2 = PLANE_DATA(frame, 2).begin() + start * (res.width / 2);
+		iter_t iter_out = PLANE_DATA(frame_out, 0).begin() + start * 4 * res.width;
+		for (size_t line = start * 2; line < std::min(res.height, end * 2); line+=2) {
+			for (size_t line2 = line; line2 < std::min(res.height,line+2); ++line2) {
+				iter_t it1 = iter_in1;
+				iter_t it2 = iter_in2;
+				for (size_t col = 0; col < res.width; col+=2) {
+					*iter_out++ = *it2++;
+					*iter_out++ = *iter_in0++;
+					*iter_out++ = *it1++;
+					*iter_out++ = *iter_in0++;
+				}
 			}
+			iter_in1+=res.width/2;
+			iter_in2+=res.width/2;
 		}
-		iter_in1+=res.width/2;
-		iter_in2+=res.width/2;
-	}
+	});
 
 	return frame_out;
 }
@@ -533,103 +564,108 @@ void store_yuv422_plane<core::raw_format::vyuy422>(uint8_t*& iter_y, uint8_t*& i
 
 
 template<format_t in, format_t out>
-core::pRawVideoFrame merge_planes_422p_yuyv(core::pRawVideoFrame frame) {
+core::pRawVideoFrame merge_planes_422p_yuyv(core::pRawVideoFrame frame, size_t threads) {
 
 	const resolution_t res = frame->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(out, res);
 	typedef decltype(PLANE_DATA(frame_out,0).begin()) iter_t;
-	iter_t iter_in0 = PLANE_DATA(frame, 0).begin();
-	iter_t iter_in1 = PLANE_DATA(frame, 1).begin();
-	iter_t iter_in2 = PLANE_DATA(frame, 2).begin();
-	iter_t iter_out = PLANE_DATA(frame_out, 0).begin();
-	for (size_t line = 0; line < res.height; ++line) {
+	const size_t linesize = PLANE_DATA(frame_out, 0).get_line_size();
+	const std::array<size_t, 3> lsizes {{PLANE_DATA(frame, 0).get_line_size(),
+		PLANE_DATA(frame, 1).get_line_size(), PLANE_DATA(frame, 2).get_line_size()}};
+	core::parallel_for_lines(res.height, linesize * 2, threads, [&](size_t start, size_t end) {
+		for (auto line: irange(start, end)) {
+			iter_t iter_in0 = PLANE_DATA(frame, 0).begin() + line * lsizes[0];
+			iter_t iter_in1 = PLANE_DATA(frame, 1).begin() + line * lsizes[1];
+			iter_t iter_in2 = PLANE_DATA(frame, 2).begin() + line * lsizes[2];
+			iter_t iter_out = PLANE_DATA(frame_out, 0).begin() + line * linesize;
 			for (size_t col = 0; col < res.width; col+=2) {
 				store_yuv422_plane<out>(iter_in0, iter_in1, iter_in2, iter_out);
 			}
-	}
+		}
+	});
 	return frame_out;
 }
 
 
-core::pFrame dispatch(core::pRawVideoFrame frame, format_t target) {
+core::pFrame dispatch(core::pRawVideoFrame frame, format_t target, size_t threads) {
 	if (!frame) return {};
 	format_t source = frame->get_format();
 	using namespace yuri::core::raw_format;
 	core::pRawVideoFrame frame_out;
 
 	// RGB Conversion
-	if (source == rgb24 && target == rgb24p) frame_out = split_planes<rgb24, rgb24p, 3>(frame, {{0, 1, 2}});
-	if (source == rgb24 && target == bgr24p) frame_out = split_planes<rgb24, bgr24p, 3>(frame, {{2, 1, 0}});
-	if (source == rgb24 && target == gbr24p) frame_out = split_planes<rgb24, gbr24p, 3>(frame, {{1, 2, 0}});
-	if (source == bgr24 && target == rgb24p) frame_out = split_planes<bgr24, rgb24p, 3>(frame, {{2, 1, 0}});
-	if (source == bgr24 && target == bgr24p) frame_out = split_planes<bgr24, bgr24p, 3>(frame, {{0, 1, 2}});
-	if (source == bgr24 && target == gbr24p) frame_out = split_planes<bgr24, gbr24p, 3>(frame, {{1, 0, 2}});
-	if (source == gbr24 && target == rgb24p) frame_out = split_planes<gbr24, rgb24p, 3>(frame, {{2, 0, 1}});
-	if (source == gbr24 && target == bgr24p) frame_out = split_planes<gbr24, bgr24p, 3>(frame, {{1, 0, 2}});
-	if (source == gbr24 && target == gbr24p) frame_out = split_planes<gbr24, gbr24p, 3>(frame, {{0, 1, 2}});
-
-	if (source == rgb24p && target == rgb24) frame_out = merge_planes<rgb24p, rgb24, 3>(frame, {{0, 1, 2}});
-	if (source == rgb24p && target == bgr24) frame_out = merge_planes<rgb24p, bgr24, 3>(frame, {{2, 1, 0}});
-	if (source == rgb24p && target == gbr24) frame_out = merge_planes<rgb24p, gbr24, 3>(frame, {{1, 2, 0}});
-	if (source == bgr24p && target == rgb24) frame_out = merge_planes<bgr24p, rgb24, 3>(frame, {{2, 1, 0}});
-	if (source == bgr24p && target == bgr24) frame_out = merge_planes<bgr24p, bgr24, 3>(frame, {{0, 1, 2}});
-	if (source == bgr24p && target == gbr24) frame_out = merge_planes<bgr24p, gbr24, 3>(frame, {{1, 0, 2}});
-	if (source == gbr24p && target == rgb24) frame_out = merge_planes<gbr24p, rgb24, 3>(frame, {{2, 0, 1}});
-	if (source == gbr24p && target == bgr24) frame_out = merge_planes<gbr24p, bgr24, 3>(frame, {{1, 0, 2}});
-	if (source == gbr24p && target == gbr24) frame_out = merge_planes<gbr24p, gbr24, 3>(frame, {{0, 1, 2}});
+	if (source == rgb24 && target == rgb24p) frame_out = split_planes<rgb24, rgb24p, 3>(frame, {{0, 1, 2}}, threads);
+	if (source == rgb24 && target == bgr24p) frame_out = split_planes<rgb24, bgr24p, 3>(frame, {{2, 1, 0}}, threads);
+	if (source == rgb24 && target == gbr24p) frame_out = split_planes<rgb24, gbr24p, 3>(frame, {{1, 2, 0}}, threads);
+	if (source == bgr24 && target == rgb24p) frame_out = split_planes<bgr24, rgb24p, 3>(frame, {{2, 1, 0}}, threads);
+	if (source == bgr24 && target == bgr24p) frame_out = split_planes<bgr24, bgr24p, 3>(frame, {{0, 1, 2}}, threads);
+	if (source == bgr24 && target == gbr24p) frame_out = split_planes<bgr24, gbr24p, 3>(frame, {{1, 0, 2}}, threads);
+	if (source == gbr24 && target == rgb24p) frame_out = split_planes<gbr24, rgb24p, 3>(frame, {{2, 0, 1}}, threads);
+	if (source == gbr24 && target == bgr24p) frame_out = split_planes<gbr24, bgr24p, 3>(frame, {{1, 0, 2}}, threads);
+	if (source == gbr24 && target == gbr24p) frame_out = split_planes<gbr24, gbr24p, 3>(frame, {{0, 1, 2}}, threads);
+
+	if (source == rgb24p && target == rgb24) frame_out = merge_planes<rgb24p, rgb24, 3>(frame, {{0, 1, 2}}, threads);
+	if (source == rgb24p && target == bgr24) frame_out = merge_planes<rgb24p, bgr24, 3>(frame, {{2, 1, 0}}, threads);
+	if (source == rgb24p && target == gbr24) frame_out = merge_planes<rgb24p, gbr24, 3>(frame, {{1, 2, 0}}, threads);
+	if (source == bgr24p && target == rgb24) frame_out = merge_planes<bgr24p, rgb24, 3>(frame, {{2, 1, 0}}, threads);
+	if (source == bgr24p && target == bgr24) frame_out = merge_planes<bgr24p, bgr24, 3>(frame, {{0, 1, 2}}, threads);
+	if (source == bgr24p && target == gbr24) frame_out = merge_planes<bgr24p, gbr24, 3>(frame, {{1, 0, 2}}, threads);
+	if (source == gbr24p && target == rgb24) frame_out = merge_planes<gbr24p, rgb24, 3>(frame, {{2, 0, 1}}, threads);
+	if (source == gbr24p && target == bgr24) frame_out = merge_planes<gbr24p, bgr24, 3>(frame, {{1, 0, 2}}, threads);
+	if (source == gbr24p && target == gbr24) frame_out = merge_planes<gbr24p, gbr24, 3>(frame, {{0, 1, 2}}, threads);
 
 	// RGBA Conversion
-	if (source == rgba32 && target == rgba32p) frame_out =  split_planes<rgba32, rgba32p, 4>(frame, {{0, 1, 2, 3}});
-	if (source == argb32 && target == rgba32p) frame_out =  split_planes<argb32, rgba32p, 4>(frame, {{1, 2, 3, 0}});
-	if (source == bgra32 && target == rgba32p) frame_out =  split_planes<bgra32, rgba32p, 4>(frame, {{2, 1, 0, 3}});
-	if (source == abgr32 && target == rgba32p) frame_out =  split_planes<abgr32, rgba32p, 4>(frame, {{3, 2, 1, 0}});
-
-	if (source == rgba32 && target == abgr32p) frame_out =  split_planes<rgba32, abgr32p, 4>(frame, {{3, 2, 1, 0}});
-	if (source == argb32 && target == abgr32p) frame_out =  split_planes<argb32, abgr32p, 4>(frame, {{0, 3, 2, 1}});
-	if (source == bgra32 && target == abgr32p) frame_out =  split_planes<bgra32, abgr32p, 4>(frame, {{3, 0, 1, 2}});
-	if (source == abgr32 && target == abgr32p) frame_out =  split_planes<abgr32, abgr32p, 4>(frame, {{0, 1, 2, 3}});
-
-	if (source == rgba32p && target == rgba32) frame_out =  merge_planes<rgba32p, rgba32, 4>(frame, {{0, 1, 2, 3}});
-	if (source == rgba32p && target == abgr32) frame_out =  merge_planes<rgba32p, abgr32, 4>(frame, {{3, 2, 1, 0}});
-	if (source == rgba32p && target == argb32) frame_out =  merge_planes<rgba32p, argb32, 4>(frame, {{3, 0, 1, 2}});
-	if (source == rgba32p && target == bgra32) frame_out =  merge_planes<rgba32p, bgra32, 4>(frame, {{2, 1, 0, 3}});
-
-	if (source == abgr32p && target == rgba32) frame_out =  merge_planes<abgr32p, rgba32, 4>(frame, {{3, 2, 1, 0}});
-	if (source == abgr32p && target == abgr32) frame_out =  merge_planes<abgr32p, abgr32, 4>(frame, {{0, 1, 2, 3}});
-	if (source == abgr32p && target == argb32) frame_out =  merge_planes<abgr32p, argb32, 4>(frame, {{0, 3, 2, 1}});
-	if (source == abgr32p && target == bgra32) frame_out =  merge_planes<abgr32p, bgra32, 4>(frame, {{1, 2, 3, 0}});
+	if (source == rgba32 && target == rgba32p) frame_out =  split_planes<rgba32, rgba32p, 4>(frame, {{0, 1, 2, 3}}, threads);
+	if (source == argb32 && target == rgba32p) frame_out =  split_planes<argb32, rgba32p, 4>(frame, {{1, 2, 3, 0}}, threads);
+	if (source == bgra32 && target == rgba32p) frame_out =  split_planes<bgra32, rgba32p, 4>(frame, {{2, 1, 0, 3}}, threads);
+	if (source == abgr32 && target == rgba32p) frame_out =  split_planes<abgr32, rgba32p, 4>(frame, {{3, 2, 1, 0}}, threads);
+
+	if (source == rgba32 && target == abgr32p) frame_out =  split_planes<rgba32, abgr32p, 4>(frame, {{3, 2, 1, 0}}, threads);
+	if (source == argb32 && target == abgr32p) frame_out =  split_planes<argb32, abgr32p, 4>(frame, {{0, 3, 2, 1}}, threads);
+	if (source == bgra32 && target == abgr32p) frame_out =  split_planes<bgra32, abgr32p, 4>(frame, {{3, 0, 1, 2}}, threads);
+	if (source == abgr32 && target == abgr32p) frame_out =  split_planes<abgr32, abgr32p, 4>(frame, {{0, 1, 2, 3}}, threads);
+
+	if (source == rgba32p && target == rgba32) frame_out =  merge_planes<rgba32p, rgba32, 4>(frame, {{0, 1, 2, 3}}, threads);
+	if (source == rgba32p && target == abgr32) frame_out =  merge_planes<rgba32p, abgr32, 4>(frame, {{3, 2, 1, 0}}, threads);
+	if (source == rgba32p && target == argb32) frame_out =  merge_planes<rgba32p, argb32, 4>(frame, {{3, 0, 1, 2}}, threads);
+	if (source == rgba32p && target == bgra32) frame_out =  merge_planes<rgba32p, bgra32, 4>(frame, {{2, 1, 0, 3}}, threads);
+
+	if (source == abgr32p && target == rgba32) frame_out =  merge_planes<abgr32p, rgba32, 4>(frame, {{3, 2, 1, 0}}, threads);
+	if (source == abgr32p && target == abgr32) frame_out =  merge_planes<abgr32p, abgr32, 4>(frame, {{0, 1, 2, 3}}, threads);
+	if (source == abgr32p && target == argb32) frame_out =  merge_planes<abgr32p, argb32, 4>(frame, {{0, 3, 2, 1}}, threads);
+	if (source == abgr32p && target == bgra32) frame_out =  merge_planes<abgr32p, bgra32, 4>(frame, {{1, 2, 3, 0}}, threads);
 
 	// YUV 444
-	if (source == yuv444p && target == yuv444) frame_out =  merge_planes<yuv444p, yuv444, 3>(frame, {{0, 1, 2}});
-	if (source == yuv444 && target == yuv444p) frame_out =  split_planes<yuv444, yuv444p, 3>(frame, {{0, 1, 2}});
+	if (source == yuv444p && target == yuv444) frame_out =  merge_planes<yuv444p, yuv444, 3>(frame, {{0, 1, 2}}, threads);
+	if (source == yuv444 && target == yuv444p) frame_out =  split_planes<yuv444, yuv444p, 3>(frame, {{0, 1, 2}}, threads);
 
 	// YUV 422/420/411
-	if (source == yuyv422 && target == yuv422p) frame_out =  split_planes_422p<yuyv422, yuv422p>(frame);
-	if (source == uyvy422 && target == yuv422p) frame_out =  split_planes_422p<uyvy422, yuv422p>(frame);
-	if (source == yvyu422 && target == yuv422p) frame_out =  split_planes_422p<yvyu422, yuv422p>(frame);
-	if (source == vyuy422 && target == yuv422p) frame_out =  split_planes_422p<vyuy422, yuv422p>(frame);
+	if (source == yuyv422 && target == yuv422p) frame_out =  split_planes_422p<yuyv422, yuv422p>(frame, threads);
+	if (source == uyvy422 && target == yuv422p) frame_out =  split_planes_422p<uyvy422, yuv422p>(frame, threads);
+	if (source == yvyu422 && target == yuv422p) frame_out =  split_planes_422p<yvyu422, yuv422p>(frame, threads);
+	if (source == vyuy422 && target == yuv422p) frame_out =  split_planes_422p<vyuy422, yuv422p>(frame, threads);
 
-	if (source == yuyv422 && target == yuv420p) frame_out =  split_planes_420p<yuyv422, yuv420p>(frame);
-	if (source == yvyu422 && target == yuv420p) frame_out =  split_planes_420p<yvyu422, yuv420p>(frame);
-	if (source == uyvy422 && target == yuv420p) frame_out =  split_planes_420p<uyvy422, yuv420p>(frame);
-	if (source == vyuy422 && target == yuv420p) frame_out =  split_planes_420p<vyuy422, yuv420p>(frame);
+	if (source == yuyv422 && target == yuv420p) frame_out =  split_planes_420p<yuyv422, yuv420p>(frame, threads);
+	if (source == yvyu422 && target == yuv420p) frame_out =  split_planes_420p<yvyu422, yuv420p>(frame, threads);
+	if (source == uyvy422 && target == yuv420p) frame_out =  split_planes_420p<uyvy422, yuv420p>(frame, threads);
+	if (source == vyuy422 && target == yuv420p) frame_out =  split_planes_420p<vyuy422, yuv420p>(frame, threads);
 
-	if (source == yuyv422 && target == yuv411p) frame_out =  split_planes_411p<yuyv422, yuv411p>(frame);
-	if (source == yvyu422 && target == yuv411p) frame_out =  split_planes_411p<yvyu422, yuv411p>(frame);
-	if (source == uyvy422 && target == yuv411p) frame_out =  split_planes_411p<uyvy422, yuv411p>(frame);
-	if (source == vyuy422 && target == yuv411p) frame_out =  split_planes_411p<vyuy422, yuv411p>(frame);
+	if (source == yuyv422 && target == yuv411p) frame_out =  split_planes_411p<yuyv422, yuv411p>(frame, threads);
+	if (source == yvyu422 && target == yuv411p) frame_out =  split_planes_411p<yvyu422, yuv411p>(frame, threads);
+	if (source == uyvy422 && target == yuv411p) frame_out =  split_planes_411p<uyvy422, yuv411p>(frame, threads);
+	if (source == vyuy422 && target == yuv411p) frame_out =  split_planes_411p<vyuy422, yuv411p>(frame, threads);
 
 	//	if (source == yuv420p && target == yuv444) frame_out =  merge_planes_sub3_xy<yuv420p, yuv444>(frame);
 //	if (source == yuv411p && target == yuyv422) frame_out =  merge_planes_411p_422<yuv420p, yuyv422>(frame);
-	if (source == yuv420p && target == yuyv422) frame_out =  merge_planes_420p_yuyv<yuv420p, yuyv422>(frame);
-	if (source == yuv420p && target == yvyu422) frame_out =  merge_planes_420p_yvyu<yuv420p, yvyu422>(frame);
-	if (source == yuv420p && target == uyvy422) frame_out =  merge_planes_420p_uyvy<yuv420p, uyvy422>(frame);
-	if (source == yuv420p && target == vyuy422) frame_out =  merge_planes_420p_vyuy<yuv420p, vyuy422>(frame);
+	if (source == yuv420p && target == yuyv422) frame_out =  merge_planes_420p_yuyv<yuv420p, yuyv422>(frame, threads);
+	if (source == yuv420p && target == yvyu422) frame_out =  merge_planes_420p_yvyu<yuv420p, yvyu422>(frame, threads);
+	if (source == yuv420p && target == uyvy422) frame_out =  merge_planes_420p_uyvy<yuv420p, uyvy422>(frame, threads);
+	if (source == yuv420p && target == vyuy422) frame_out =  merge_planes_420p_vyuy<yuv420p, vyuy422>(frame, threads);
 
-	if (source == yuv422p && target == yuyv422) frame_out =  merge_planes_422p_yuyv<yuv422p, yuyv422>(frame);
-	if (source == yuv422p && target == yvyu422) frame_out =  merge_planes_422p_yuyv<yuv422p, yvyu422>(frame);
-	if (source == yuv422p && target == uyvy422) frame_out =  merge_planes_422p_yuyv<yuv422p, uyvy422>(frame);
-	if (source == yuv422p && target == vyuy422) frame_out =  merge_planes_422p_yuyv<yuv422p, vyuy422>(frame);
+	if (source == yuv422p && target == yuyv422) frame_out =  merge_planes_422p_yuyv<yuv422p, yuyv422>(frame, threads);
+	if (source == yuv422p && target == yvyu422) frame_out =  merge_planes_422p_yuyv<yuv422p, yvyu422>(frame, threads);
+	if (source == yuv422p && target == uyvy422) frame_out =  merge_planes_422p_yuyv<yuv422p, uyvy422>(frame, threads);
+	if (source == yuv422p && target == vyuy422) frame_out =  merge_planes_422p_yuyv<yuv422p, vyuy422>(frame, threads);
 
 	if (frame_out) {
 		frame_out->copy_video_params(*frame);
@@ -719,12 +755,14 @@ core::Parameters ConvertPlanes::configure()
 	core::Parameters p = core::SpecializedIOFilter<core::RawVideoFrame>::configure();
 	p.set_description("ConvertPlanes");
 	p["format"]["Target format"]="YUV";
+	p["threads"]["Number of threads to use. Use 0 to select it automatically from frame size."]=0;
 	return p;
 }
 
 
 ConvertPlanes::ConvertPlanes(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
-core::SpecializedIOFilter<core::RawVideoFrame>(log_,parent,std::string("convert_planar"))
+core::SpecializedIOFilter<core::RawVideoFrame>(log_,parent,std::string("convert_planar")),
+threads_(0)
 {
 	IOTHREAD_INIT(parameters)
 }
@@ -735,7 +773,7 @@ ConvertPlanes::~ConvertPlanes() noexcept
 
 core::pFrame ConvertPlanes::do_special_single_step(core::pRawVideoFrame frame)
 {
-	return dispatch(frame, format_);
+	return dispatch(frame, format_, threads_);
 }
 
 core::pFrame ConvertPlanes::do_convert_frame(core::pFrame input_frame, format_t target_format)
@@ -745,14 +783,18 @@ core::pFrame ConvertPlanes::do_convert_frame(core::pFrame input_frame, format_t
 		log[log::warning] << "Got bad frame type!!";
 		return {};
 	}
-	return dispatch(frame, target_format);
+	return dispatch(frame, target_format, threads_);
 }
 bool ConvertPlanes::set_param(const core::Parameter& param)
 {
 	if (param.get_name() == "format") {
 		format_ = core::raw_format::parse_format(param.get<std::string>());
+	} else if (param.get_name() == "threads") {
+		threads_ = param.get<size_t>();
+	} else {
+		return core::SpecializedIOFilter<core::RawVideoFrame>::set_param(param);
 	}
-	return core::SpecializedIOFilter<core::RawVideoFrame>::set_param(param);
+	return true;
 }
 
 } /* namespace convert_planar */
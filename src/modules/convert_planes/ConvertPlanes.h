@@ -29,6 +29,7 @@ private:
 	virtual core::pFrame do_convert_frame(core::pFrame input_frame, format_t target_format) override;
 	virtual bool set_param(const core::Parameter& param) override;
 	format_t	format_;
+	size_t		threads_;
 };
 
 } /* namespace convert_planar */
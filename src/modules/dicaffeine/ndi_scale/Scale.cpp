@@ -226,7 +226,7 @@ core::pRawVideoFrame scale_image(const core::pRawVideoFrame& frame, const resolu
     const double   unscale_y    = static_cast<double>(res.height - 1) / (new_resolution.height - 1);
     const auto     linesize_in  = PLANE_DATA(frame, 0).get_line_size();
     const auto     linesize_out = PLANE_DATA(outframe, 0).get_line_size();
-    const uint8_t* it_in        = PLANE_RAW_DATA(frame, 0);
+    const uint8_t* it_in        = PLANE_CONST_RAW_DATA(frame, 0);
     uint8_t*       it           = PLANE_RAW_DATA(outframe, 0);
 
     if (threads < 2) {
@@ -260,8 +260,8 @@ core::pRawVideoFrame scale_image(const core::pRawVideoFrame& frame, const resolu
             t.get();
         }
     }
-    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
-                 PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
+    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
+                 PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
     outframe->copy_video_params(*frame);
     return outframe;
 }
@@ -275,7 +275,7 @@ core::pRawVideoFrame scale_image_fast(const core::pRawVideoFrame& frame, const r
     const uint64_t unscale_y    = 256 * (res.height - 1) / (new_resolution.height - 1);
     const auto     linesize_in  = PLANE_DATA(frame, 0).get_line_size();
     const auto     linesize_out = PLANE_DATA(outframe, 0).get_line_size();
-    const uint8_t* it_in        = PLANE_RAW_DATA(frame, 0);
+    const uint8_t* it_in        = PLANE_CONST_RAW_DATA(frame, 0);
     uint8_t*       it           = PLANE_RAW_DATA(outframe, 0);
 
     if (threads < 2) {
@@ -310,8 +310,8 @@ core::pRawVideoFrame scale_image_fast(const core::pRawVideoFrame& frame, const r
             t.get();
         }
     }
-    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
-                 PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
+    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
+                 PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
     outframe->copy_video_params(*frame);
     return outframe;
 }
@@ -96,6 +96,8 @@ Box::~Box() noexcept {
 core::pFrame Box::do_special_single_step(core::pRawVideoFrame frame) {
 	process_events();
 	if (!thickness_) return frame;
+	// The frame may be shared with other nodes (e.g. after dup)
+	frame = get_frame_unique(frame);
 	switch (frame->get_format()) {
 		case core::raw_format::yuyv422:
 		case core::raw_format::yvyu422:
@@ -18,6 +18,11 @@
 #include "yuri/core/utils/string_generator.h"
 #include "yuri/core/utils/DirectoryBrowser.h"
 #include "yuri/core/utils/assign_events.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 namespace yuri
 {
 namespace dump
@@ -38,11 +43,20 @@ core::Parameters FileDump::configure()
 	p["frame_limit"]["Maximal number of frames to dump. 0 for unlimited"]=0;
 	p["info_string"]["Additional string to emit with each frame (as event 'info')"]="";
 	p["append"]["Append to the end of file"]=false;
+	p["io"]["Method of writing (stream, async or direct). Async writes frames without copying them, "
+			"direct copies them into aligned blocks written past the page cache."]="stream";
+	p["queue_depth"]["Maximal number of writes in flight for async and direct modes"]=4;
+	p["io_backend"]["Backend for async and direct modes (auto, uring or threads)"]="auto";
+	p["container"]["Store frames in a container with metadata and an index (readable by raw_filesource)"]=false;
+	p["preallocate"]["Preallocate space for the file in chunks of this size in MB (async and direct modes only, 0 to disable)"]=0;
 	return p;
 }
 
 namespace {
 
+//! Size of blocks written in direct mode
+const size_t direct_block_size = 4 * 1024 * 1024;
+
 template<class T>
 std::string append_to_filename(const std::string& filename, const T& value, int width = 0)
 {
@@ -70,10 +84,17 @@ FileDump::FileDump(log::Log &log_,core::pwThreadBase parent, const core::Paramet
 	event::BasicEventProducer(log),
 	event::BasicEventConsumer(log),
 	dump_file(),filename(),seq_chars(0),seq_number(0),dumped_frames(0),
-	dump_limit(0),use_regex_(false),single_file_(true),append_(false)
+	dump_limit(0),use_regex_(false),single_file_(true),append_(false),
+	io_mode_(io_mode_t::stream),queue_depth_(4),io_backend_(core::async_backend_t::automatic),
+	preallocate_(0),file_offset_(0),preallocated_(0),staging_fill_(0),staging_offset_(0),
+	container_(false),written_bytes_(0)
 {
 	IOTHREAD_INIT(parameters);
 	if (filename.empty()) throw exception::InitializationFailed("No filename specified");
+	if (container_ && append_) {
+		log[log::warning] << "Appending is not supported for containers, overwriting the file";
+		append_ = false;
+	}
 
 	if (core::utils::is_extended_generator_supported()) {
 		auto s = core::utils::analyze_string_specifiers(filename);
@@ -102,21 +123,183 @@ FileDump::FileDump(log::Log &log_,core::pwThreadBase parent, const core::Paramet
 
 FileDump::~FileDump() noexcept
 {
-	if (dump_file.is_open()) dump_file.close();
+	close_file();
 }
 
 bool FileDump::open_file(const std::string& fname)
 {
 	core::filesystem::ensure_path_directory(fname);
-	auto flags = std::ios::binary | std::ios::out;
-	if (append_) flags|=std::ios::app;
+	close_file();
+	written_bytes_ = 0;
+	if (io_mode_ == io_mode_t::stream) {
+		auto flags = std::ios::binary | std::ios::out;
+		if (append_) flags|=std::ios::app;
+		dump_file.open(fname.c_str(), flags);
+		if (container_) write_container_header();
+		return true;
+	}
+	const int flags = O_WRONLY | O_CREAT | (append_ ? 0 : O_TRUNC) | (io_mode_ == io_mode_t::direct ? O_DIRECT : 0);
+	async_file_ = core::AsyncFile::open(fname, flags, queue_depth_, io_backend_);
+	if (!async_file_) {
+		log[log::error] << "Failed to open " << fname;
+		return false;
+	}
+	if (io_mode_ == io_mode_t::direct && !async_file_->is_direct()) {
+		log[log::warning] << "Direct I/O is not supported for " << fname << ", writing through page cache";
+	}
+	struct stat st;
+	file_offset_ = ::fstat(async_file_->get_fd(), &st) == 0 ? st.st_size : 0;
+	preallocated_ = file_offset_;
+	ensure_preallocated(file_offset_);
+	if (io_mode_ == io_mode_t::direct) {
+		// Appending to a file with unaligned size starts with its last partial block
+		const auto alignment = core::AsyncFile::direct_alignment;
+		staging_offset_ = file_offset_ & ~static_cast<uint64_t>(alignment - 1);
+		new_staging_block();
+		staging_fill_ = file_offset_ - staging_offset_;
+		if (staging_fill_ && ::pread(async_file_->get_fd(), staging_.get(), alignment, staging_offset_) < static_cast<ssize_t>(staging_fill_)) {
+			log[log::error] << "Failed to read end of " << fname;
+			std::fill(staging_.get(), staging_.get() + staging_fill_, 0);
+		}
+	}
+	if (container_) write_container_header();
+	return true;
+}
+
+void FileDump::close_file()
+{
+	if (index_) write_container_index();
 	if (dump_file.is_open()) dump_file.close();
-	dump_file.open(fname.c_str(), flags);
+	if (!async_file_) return;
+	if (staging_fill_) {
+		// The last block is padded to alignment and the file truncated to the real size afterwards
+		const auto alignment = core::AsyncFile::direct_alignment;
+		const size_t size = (staging_fill_ + alignment - 1) & ~(alignment - 1);
+		std::fill(staging_.get() + staging_fill_, staging_.get() + size, 0);
+		submit_write(staging_.get(), size, staging_offset_, staging_);
+	}
+	reap_writes(true);
+	if (io_mode_ == io_mode_t::direct || preallocated_ > file_offset_) {
+		if (::ftruncate(async_file_->get_fd(), file_offset_) != 0) {
+			log[log::warning] << "Failed to truncate file to " << file_offset_ << " bytes";
+		}
+	}
+	staging_.reset();
+	staging_fill_ = 0;
+	async_file_.reset();
+}
+
+void FileDump::new_staging_block()
+{
+	auto block = core::FixedMemoryAllocator::get_block(direct_block_size);
+	auto deleter = block.second;
+	staging_.reset(block.first, [deleter](uint8_t* p){ deleter(p); });
+}
+
+void FileDump::write_data(const uint8_t* data, size_t size, std::shared_ptr<const void> holder)
+{
+	if (!size) return;
+	written_bytes_ += size;
+	if (io_mode_ == io_mode_t::stream) {
+		dump_file.write(reinterpret_cast<const char *>(data), size);
+		return;
+	}
+	if (!async_file_) return;
+	if (io_mode_ == io_mode_t::async) {
+		submit_write(data, size, file_offset_, std::move(holder));
+		file_offset_ += size;
+		return;
+	}
+	while (size) {
+		const size_t count = std::min(size, direct_block_size - staging_fill_);
+		std::copy(data, data + count, staging_.get() + staging_fill_);
+		staging_fill_ += count;
+		data += count;
+		size -= count;
+		file_offset_ += count;
+		if (staging_fill_ == direct_block_size) {
+			submit_write(staging_.get(), direct_block_size, staging_offset_, staging_);
+			staging_offset_ += direct_block_size;
+			staging_fill_ = 0;
+			new_staging_block();
+		}
+	}
+}
+
+void FileDump::submit_write(const uint8_t* data, size_t size, uint64_t offset, std::shared_ptr<const void> holder)
+{
+	ensure_preallocated(offset + size);
+	const auto id = async_file_->write(data, size, offset);
+	pending_writes_.push_back({id, size, std::move(holder)});
+	reap_writes(false);
+}
+
+void FileDump::reap_writes(bool all)
+{
+	while (!pending_writes_.empty() && (all || async_file_->finished(pending_writes_.front().id))) {
+		const auto& w = pending_writes_.front();
+		const auto result = async_file_->wait(w.id);
+		if (result != static_cast<int64_t>(w.size)) {
+			log[log::error] << "Failed to write " << w.size << " bytes (" << (result < 0 ? std::strerror(-result) : "short write") << ")";
+		}
+		pending_writes_.pop_front();
+	}
+}
+
+void FileDump::write_container_header()
+{
+	auto header = std::make_shared<core::container::file_header_t>(core::container::make_file_header());
+	write_data(reinterpret_cast<const uint8_t*>(header.get()), sizeof(*header), header);
+	index_ = std::make_shared<std::vector<core::container::index_entry_t>>();
+}
+
+namespace {
+const uint8_t container_padding[core::container::default_alignment] = {};
+}
+
+bool FileDump::write_container_frame(const core::pFrame& frame)
+{
+	auto header = std::make_shared<core::container::frame_header_t>();
+	if (!index_ || !core::container::make_frame_header(frame, *header)) return false;
+	const auto padding = core::container::align_offset(written_bytes_, core::container::default_alignment) - written_bytes_;
+	write_data(container_padding, padding, {});
+	if (index_->empty()) first_timestamp_ = frame->get_timestamp();
+	header->timestamp = (frame->get_timestamp() - first_timestamp_).value;
+	header->index = index_->size();
+	index_->push_back({written_bytes_, header->timestamp, header->payload_size});
+	write_data(reinterpret_cast<const uint8_t*>(header.get()), sizeof(*header), header);
+	for (const auto& p: core::container::get_frame_payload(frame)) {
+		write_data(p.first, p.second, frame);
+	}
 	return true;
 }
+
+void FileDump::write_container_index()
+{
+	auto index = std::move(index_);
+	const auto padding = core::container::align_offset(written_bytes_, core::container::default_alignment) - written_bytes_;
+	write_data(container_padding, padding, {});
+	auto trailer = std::make_shared<core::container::trailer_t>(core::container::make_trailer(written_bytes_, index->size()));
+	write_data(reinterpret_cast<const uint8_t*>(index->data()), index->size() * sizeof(core::container::index_entry_t), index);
+	write_data(reinterpret_cast<const uint8_t*>(trailer.get()), sizeof(*trailer), trailer);
+}
+
+void FileDump::ensure_preallocated(uint64_t end)
+{
+	if (!preallocate_ || end < preallocated_) return;
+#ifdef FALLOC_FL_KEEP_SIZE
+	const uint64_t new_end = end + preallocate_;
+	if (::fallocate(async_file_->get_fd(), FALLOC_FL_KEEP_SIZE, preallocated_, new_end - preallocated_) != 0) {
+		log[log::warning] << "Failed to preallocate space for the file, disabling preallocation";
+		preallocate_ = 0;
+		return;
+	}
+	preallocated_ = new_end;
+#endif
+}
 std::string FileDump::generate_filename(const core::pFrame& frame)
 {
-	if (!use_regex_ && !single_file_) {
+	if (!use_regex_ && !single_file_) {
 		return append_to_filename(filename, seq_number++, seq_chars);
 	}
 	else {
@@ -138,19 +321,22 @@ core::pFrame FileDump::do_simple_single_step(core::pFrame frame)
 		emit_event("filename",seq_filename);
 	}
 	bool written = true;
-	if (auto f = std::dynamic_pointer_cast<core::RawVideoFrame>(frame)) {
+	if (container_) {
+		written = write_container_frame(frame);
+		if (!written) log[log::warning] << "Frame type can't be stored in a container, skipping it";
+	} else if (auto f = std::dynamic_pointer_cast<core::RawVideoFrame>(frame)) {
 		log[log::debug]<<"Dumping " << f->get_planes_count() << " planes";
 		for (yuri::size_t i=0; i<f->get_planes_count();++i) {
-			dump_file.write(reinterpret_cast<const char *>(PLANE_RAW_DATA(f,0)),PLANE_SIZE(f,0));
+			write_data(PLANE_CONST_RAW_DATA(f,i),PLANE_CONST_DATA(f,i).size(),f);
 		}
 	} else if (auto f2 = std::dynamic_pointer_cast<core::CompressedVideoFrame>(frame)) {
-		dump_file.write(reinterpret_cast<const char *>(f2->begin()),f2->size());
+		write_data(f2->begin(),f2->size(),f2);
 	} else if (auto f3 = std::dynamic_pointer_cast<core::RawAudioFrame>(frame)) {
-		dump_file.write(reinterpret_cast<const char *>(f3->data()),f3->size());
+		write_data(f3->data(),f3->size(),f3);
 	} else if (auto f4 = std::dynamic_pointer_cast<core::EventFrame>(frame)) {
 		try {
-			const auto text = event::lex_cast_value<std::string>(f4->get_event()) +"\n";
-			dump_file.write(text.c_str(),text.size());
+			auto text = std::make_shared<std::string>(event::lex_cast_value<std::string>(f4->get_event()) +"\n");
+			write_data(reinterpret_cast<const uint8_t*>(text->data()),text->size(),text);
 		}
 		catch (std::exception& e) {
 			log[log::warning] << "Failed to store event " << f4->get_name();
@@ -162,8 +348,8 @@ core::pFrame FileDump::do_simple_single_step(core::pFrame frame)
 	if (!info_string_.empty()) {
 		emit_event("info", core::utils::generate_string(info_string_, seq_number, frame));
 	}
-	if (!single_file_) {
-		dump_file.close();
+	if (!single_file_) {
+		close_file();
 	}
 	if (written) {
 		emit_event("frame");
@@ -187,7 +373,16 @@ bool FileDump::set_param(const core::Parameter &param)
 			(seq_chars, 	"sequence")
 			(dump_limit, 	"frame_limit")
 			(info_string_, 	"info_string")
-			(append_,		"append"))
+			(append_,		"append")
+			(queue_depth_,	"queue_depth")
+			(container_,	"container")
+			.parsed<std::string>
+				(io_mode_,	"io", [](const std::string& s) {
+					return s == "async" ? io_mode_t::async : s == "direct" ? io_mode_t::direct : io_mode_t::stream; })
+			.parsed<std::string>
+				(io_backend_, "io_backend", core::parse_async_backend)
+			.parsed<uint64_t>
+				(preallocate_, "preallocate", [](uint64_t mb) { return mb * 1024 * 1024; }))
 		return true;
 	return IOFilter::set_param(param);
 }
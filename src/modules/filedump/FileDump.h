@@ -13,6 +13,9 @@
 #include "yuri/core/thread/IOFilter.h"
 #include "yuri/event/BasicEventProducer.h"
 #include "yuri/event/BasicEventConsumer.h"
+#include "yuri/core/utils/AsyncFile.h"
+#include "yuri/core/frame/frame_container.h"
+#include <deque>
 #include <fstream>
 #include <string>
 
@@ -31,7 +34,32 @@ public:
 	IOTHREAD_GENERATOR_DECLARATION
 	static core::Parameters configure();
 private:
+	enum class io_mode_t {
+		//! Writing through std::ofstream
+		stream,
+		//! Frames are written asynchronously without copying
+		async,
+		//! Data are copied into aligned blocks and written bypassing the page cache
+		direct
+	};
+	struct pending_write_t {
+		core::AsyncFile::request_id_t id;
+		size_t size;
+		//! Keeps the data valid until the write finishes
+		std::shared_ptr<const void> holder;
+	};
+
 	bool open_file(const std::string& fname);
+	void close_file();
+	void write_data(const uint8_t* data, size_t size, std::shared_ptr<const void> holder);
+	void submit_write(const uint8_t* data, size_t size, uint64_t offset, std::shared_ptr<const void> holder);
+	//! Releases finished writes (all writes if @em all is true)
+	void reap_writes(bool all);
+	void ensure_preallocated(uint64_t end);
+	void new_staging_block();
+	void write_container_header();
+	bool write_container_frame(const core::pFrame& frame);
+	void write_container_index();
 	virtual core::pFrame do_simple_single_step(core::pFrame frame) override;
 	virtual bool set_param(const core::Parameter &param) override;
 	std::string generate_filename(const core::pFrame& frame);
@@ -49,6 +77,29 @@ private:
 	bool append_;
 
 	std::string info_string_;
+
+	io_mode_t io_mode_;
+	size_t queue_depth_;
+	core::async_backend_t io_backend_;
+	//! Size of preallocated chunks in bytes
+	uint64_t preallocate_;
+	core::pAsyncFile async_file_;
+	//! Offset of the end of the file, including data not written yet
+	uint64_t file_offset_;
+	uint64_t preallocated_;
+	std::deque<pending_write_t> pending_writes_;
+	//! Block being filled in direct mode, starting at staging_offset_ in the file
+	std::shared_ptr<uint8_t> staging_;
+	size_t staging_fill_;
+	uint64_t staging_offset_;
+
+	//! Write frames into a container (see core::container)
+	bool container_;
+	//! Bytes written into current file
+	uint64_t written_bytes_;
+	//! Index of the current container file, empty when no container is open
+	std::shared_ptr<std::vector<core::container::index_entry_t>> index_;
+	timestamp_t first_timestamp_;
 };
 
 }
@@ -195,7 +195,7 @@ core::pFrame Flip::do_special_single_step(core::pRawVideoFrame frame)
 
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(frame->get_format(), frame->get_resolution());
 
-	const uint8_t * in_ptr =  PLANE_RAW_DATA(frame,0);
+	const uint8_t * in_ptr =  PLANE_CONST_RAW_DATA(frame,0);
 	uint8_t *out_ptr = PLANE_RAW_DATA(frame_out,0);
 
 	flip_dispatch(yuv_y_pos, bpp, flip_x_, flip_y_, line_length, h, in_ptr, out_ptr);
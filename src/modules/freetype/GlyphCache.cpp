@@ -0,0 +1,124 @@
+/*!
+ * @file 		GlyphCache.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "GlyphCache.h"
+#include <algorithm>
+#include <limits>
+
+namespace yuri {
+namespace freetype {
+
+GlyphAtlas::GlyphAtlas(FT_Face face) : face_(face)
+{
+}
+
+const glyph_t& GlyphAtlas::get_glyph(FT_UInt index)
+{
+    auto it = glyphs_.find(index);
+    if (it != glyphs_.end())
+        return it->second;
+
+    glyph_t glyph{ atlas_.size(), 0, 0, 0, 0, 0.0 };
+    if (!FT_Load_Glyph(face_, index, FT_LOAD_RENDER)) {
+        const auto  slot   = face_->glyph;
+        const auto& bitmap = slot->bitmap;
+        glyph.width        = bitmap.width;
+        glyph.rows         = bitmap.rows;
+        glyph.left         = slot->bitmap_left;
+        glyph.top          = slot->bitmap_top;
+        glyph.advance      = ((slot->linearHoriAdvance & 0xFFFF0000) >> 16) + static_cast<double>(slot->linearHoriAdvance & 0xFFFF) / 0xFFFF;
+        atlas_.resize(atlas_.size() + glyph.width * glyph.rows);
+        auto out = atlas_.begin() + glyph.offset;
+        for (dimension_t y = 0; y < glyph.rows; ++y) {
+            const uint8_t* line = bitmap.buffer + static_cast<ptrdiff_t>(bitmap.pitch) * y;
+            if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+                for (dimension_t x = 0; x < glyph.width; ++x) {
+                    *out++ = (line[x >> 3] & (0x80 >> (x & 7))) ? 0xFF : 0;
+                }
+            } else {
+                out = std::copy(line, line + glyph.width, out);
+            }
+        }
+    }
+    return glyphs_.emplace(index, glyph).first->second;
+}
+
+double GlyphAtlas::get_kerning(FT_UInt left, FT_UInt right)
+{
+    const auto key = (static_cast<uint64_t>(left) << 32) | right;
+    auto       it  = kerning_.find(key);
+    if (it != kerning_.end())
+        return it->second;
+    FT_Vector delta{ 0, 0 };
+    FT_Get_Kerning(face_, left, right, FT_KERNING_UNFITTED, &delta);
+    const double kern = (delta.x >> 6) + static_cast<double>(delta.x & 0x3F) / 0x3F;
+    kerning_[key]     = kern;
+    return kern;
+}
+
+void TextBitmapBuilder::add_glyph(const GlyphAtlas& atlas, const glyph_t& glyph, coordinates_t position)
+{
+    if (glyph.width && glyph.rows)
+        glyphs_.push_back({ &atlas, glyph, position });
+}
+
+pTextBitmap TextBitmapBuilder::build() const
+{
+    auto text = std::make_shared<text_bitmap_t>();
+    if (glyphs_.empty()) {
+        *text = text_bitmap_t{ { 0, 0 }, 0, 0, {} };
+        return text;
+    }
+    position_t min_x = std::numeric_limits<position_t>::max();
+    position_t min_y = std::numeric_limits<position_t>::max();
+    position_t max_x = std::numeric_limits<position_t>::min();
+    position_t max_y = std::numeric_limits<position_t>::min();
+    for (const auto& g : glyphs_) {
+        min_x = std::min(min_x, g.position.x);
+        min_y = std::min(min_y, g.position.y);
+        max_x = std::max<position_t>(max_x, g.position.x + g.glyph.width);
+        max_y = std::max<position_t>(max_y, g.position.y + g.glyph.rows);
+    }
+    text->origin = { min_x, min_y };
+    text->width  = max_x - min_x;
+    text->rows   = max_y - min_y;
+    text->data.resize(text->width * text->rows, 0);
+
+    for (const auto& g : glyphs_) {
+        const uint8_t* in = g.atlas->get_bitmap(g.glyph);
+        for (dimension_t y = 0; y < g.glyph.rows; ++y) {
+            uint8_t* out = &text->data[(g.position.y - min_y + y) * text->width + g.position.x - min_x];
+            for (dimension_t x = 0; x < g.glyph.width; ++x, ++in, ++out) {
+                // Coverage of two glyphs blended over each other
+                const unsigned p = *in;
+                if (p)
+                    *out = static_cast<uint8_t>(*out + p - (*out * p) / 255);
+            }
+        }
+    }
+    return text;
+}
+
+pTextBitmap TextCache::get(const std::string& text) const
+{
+    auto it = texts_.find(text);
+    if (it == texts_.end())
+        return {};
+    return it->second;
+}
+
+void TextCache::insert(const std::string& text, pTextBitmap bitmap)
+{
+    if (texts_.size() >= max_entries_)
+        texts_.clear();
+    texts_[text] = std::move(bitmap);
+}
+
+} /* namespace freetype */
+} /* namespace yuri */
@@ -0,0 +1,117 @@
+/*!
+ * @file 		GlyphCache.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Caches for rendered glyphs and laid out text.
+ *
+ * Glyphs are rendered by FreeType only once per face and stored in an atlas
+ * (a single buffer with bitmaps of all rendered glyphs) together with their metrics.
+ * Laid out text is composed from the atlas into a single coverage bitmap,
+ * so unchanged text costs only a blit into the frame.
+ */
+
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+
+#include "yuri/core/utils/new_types.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace yuri {
+namespace freetype {
+
+struct glyph_t {
+    //! Offset of the bitmap in the atlas, the bitmap has no padding (pitch == width)
+    size_t      offset;
+    dimension_t width;
+    dimension_t rows;
+    position_t  left;
+    position_t  top;
+    //! Horizontal advance in pixels
+    double      advance;
+};
+
+/*!
+ * Rendered glyphs of a single face (with the pixel size already set)
+ */
+class GlyphAtlas {
+public:
+    explicit GlyphAtlas(FT_Face face);
+
+    FT_Face get_face() const { return face_; }
+
+    //! Returns the glyph, rendering it on first use
+    const glyph_t& get_glyph(FT_UInt index);
+
+    //! Returns kerning between two glyphs in pixels
+    double get_kerning(FT_UInt left, FT_UInt right);
+
+    const uint8_t* get_bitmap(const glyph_t& glyph) const { return atlas_.data() + glyph.offset; }
+
+private:
+    FT_Face                                 face_;
+    std::vector<uint8_t>                    atlas_;
+    std::unordered_map<FT_UInt, glyph_t>    glyphs_;
+    std::unordered_map<uint64_t, double>    kerning_;
+};
+
+/*!
+ * Coverage of a laid out text, placed at @em origin relative to the text position
+ */
+struct text_bitmap_t {
+    coordinates_t        origin;
+    dimension_t          width;
+    dimension_t          rows;
+    std::vector<uint8_t> data;
+};
+
+using pTextBitmap = std::shared_ptr<const text_bitmap_t>;
+
+/*!
+ * Composes glyphs into a text bitmap.
+ * Overlapping glyphs are combined the same way as if they were blended one after another.
+ */
+class TextBitmapBuilder {
+public:
+    void add_glyph(const GlyphAtlas& atlas, const glyph_t& glyph, coordinates_t position);
+    pTextBitmap build() const;
+
+private:
+    // The atlas may grow while the text is laid out, so bitmaps are resolved only in build()
+    struct placed_glyph_t {
+        const GlyphAtlas* atlas;
+        glyph_t           glyph;
+        coordinates_t     position;
+    };
+    std::vector<placed_glyph_t> glyphs_;
+};
+
+/*!
+ * Laid out texts, keyed by the text.
+ * Parameters affecting the layout (font, size, kerning, ...) can't change
+ * during the lifetime of the cache, so they don't have to be part of the key.
+ */
+class TextCache {
+public:
+    explicit TextCache(size_t max_entries = 64) : max_entries_(max_entries) {}
+
+    pTextBitmap get(const std::string& text) const;
+    //! Stores the bitmap, dropping all cached texts when the cache is full
+    void        insert(const std::string& text, pTextBitmap bitmap);
+
+private:
+    size_t                                       max_entries_;
+    std::unordered_map<std::string, pTextBitmap> texts_;
+};
+
+} /* namespace freetype */
+} /* namespace yuri */
+
+#endif /* GLYPHCACHE_H_ */
@@ -66,6 +66,7 @@ RenderText::RenderText(const log::Log& log_, core::pwThreadBase parent, const co
     }
     log[log::info] << "Loaded font: " << face_->family_name << ", " << face_->style_name;
     FT_Set_Pixel_Sizes(face_, font_size_, 0);
+    atlas_.reset(new GlyphAtlas(face_));
     if (!font_file2_.empty()) {
         if (FT_New_Face(library_, font_file2_.c_str(), 0, &face2_)) {
             log[log::warning] << "Failed to load fallback font";
@@ -73,6 +74,7 @@ RenderText::RenderText(const log::Log& log_, core::pwThreadBase parent, const co
         } else {
             log[log::info] << "Loaded fallback font: " << face2_->family_name << ", " << face2_->style_name;
             FT_Set_Pixel_Sizes(face2_, font_size_, 0);
+            atlas2_.reset(new GlyphAtlas(face2_));
         }
     }
 
@@ -239,7 +241,7 @@ struct draw_kernel<abgr32, blend> {
 };
 
 template <format_t fmt, bool blend>
-void draw_glyph_impl(core::pRawVideoFrame frame, const FT_Bitmap& bmp, coordinates_t position, geometry_t draw_rect, const std::array<uint8_t, 4>& color)
+void draw_glyph_impl(core::pRawVideoFrame frame, const text_bitmap_t& bmp, coordinates_t position, geometry_t draw_rect, const std::array<uint8_t, 4>& color)
 {
     auto       data     = PLANE_RAW_DATA(frame, 0);
     const auto linesize = PLANE_DATA(frame, 0).get_line_size();
@@ -248,7 +250,7 @@ void draw_glyph_impl(core::pRawVideoFrame frame, const FT_Bitmap& bmp, coordinat
         auto           data_out        = data + linesize * y + draw_rect.x * bpp;
         const auto     bmp_line_offset = y - position.y;
         const auto     bmp_col_offset  = draw_rect.x - position.x;
-        const uint8_t* data_in         = &bmp.buffer[bmp.pitch * bmp_line_offset + bmp_col_offset];
+        const uint8_t* data_in         = &bmp.data[bmp.width * bmp_line_offset + bmp_col_offset];
         const auto     data_in_end     = data_in + draw_rect.width;
         draw_kernel<fmt, blend>::draw(data_in, data_in_end, data_out, color, position.x % 2 == 1);
     }
@@ -375,7 +377,7 @@ struct draw_kernel<yuva4444, blend> {
 };
 
 template <format_t fmt>
-void draw_glyph_impl(core::pRawVideoFrame frame, const FT_Bitmap& bmp, coordinates_t position, geometry_t draw_rect, bool blend,
+void draw_glyph_impl(core::pRawVideoFrame frame, const text_bitmap_t& bmp, coordinates_t position, geometry_t draw_rect, bool blend,
                      const std::array<uint8_t, 4>& color)
 {
     if (blend)
@@ -384,10 +386,9 @@ void draw_glyph_impl(core::pRawVideoFrame frame, const FT_Bitmap& bmp, coordinat
         draw_glyph_impl<fmt, false>(frame, bmp, position, draw_rect, color);
 }
 
-bool draw_glyph(FT_GlyphSlot glyph, core::pRawVideoFrame frame, coordinates_t position, bool blend, const core::color_t& color)
+bool draw_bitmap(const text_bitmap_t& bitmap, core::pRawVideoFrame frame, coordinates_t position, bool blend, const core::color_t& color)
 {
-    const auto& bitmap       = glyph->bitmap;
-    const auto  bmp_geometry = geometry_t{ static_cast<dimension_t>(bitmap.width), static_cast<dimension_t>(bitmap.rows), position.x, position.y };
+    const auto bmp_geometry = geometry_t{ static_cast<dimension_t>(bitmap.width), static_cast<dimension_t>(bitmap.rows), position.x, position.y };
 
     const auto frame_resolution = frame->get_resolution();
 
@@ -487,13 +488,24 @@ core::pFrame RenderText::do_special_single_step(core::pRawVideoFrame frame)
 
 void RenderText::draw_text(const std::string& text, core::pRawVideoFrame& frame)
 {
-    coordinates_t position          = position_;
-    double        horiz_pos         = 0.0;
-    char32_t      prev              = 0;
-    bool          do_kerning        = kerning_ && FT_HAS_KERNING(face_);
-    char32_t      unicode_character = 0;
-    int           remaining         = 0;
-    bool          backslash         = false;
+    auto bitmap = text_cache_.get(text);
+    if (!bitmap) {
+        bitmap = layout_text(text);
+        text_cache_.insert(text, bitmap);
+    }
+    draw_bitmap(*bitmap, frame, position_ + bitmap->origin, edge_blend_ && !generate_, color_);
+}
+
+pTextBitmap RenderText::layout_text(const std::string& text)
+{
+    TextBitmapBuilder builder;
+    coordinates_t     position          = { 0, 0 };
+    double            horiz_pos         = 0.0;
+    char32_t          prev              = 0;
+    bool              do_kerning        = kerning_ && FT_HAS_KERNING(face_);
+    char32_t          unicode_character = 0;
+    int               remaining         = 0;
+    bool              backslash         = false;
     for (auto c : text) {
         if (utf8_) {
             std::tie(unicode_character, remaining) = utils::utf8_char(c, unicode_character, remaining);
@@ -524,35 +536,29 @@ void RenderText::draw_text(const std::string& text, core::pRawVideoFrame& frame)
             }
         }
 
-        FT_GlyphSlot glyph = nullptr;
-        auto         idx   = FT_Get_Char_Index(face_, unicode_character);
-        if (idx == 0 && !font_file2_.empty()) {
+        GlyphAtlas* atlas = atlas_.get();
+        auto        idx   = FT_Get_Char_Index(face_, unicode_character);
+        if (idx == 0 && atlas2_) {
             idx = FT_Get_Char_Index(face2_, unicode_character);
             if (idx == 0) {
                 log[log::debug] << "Unsupported character found";
             }
-            FT_Load_Glyph(face2_, idx, FT_LOAD_RENDER);
-            glyph = face2_->glyph;
-        } else {
-            FT_Load_Glyph(face_, idx, FT_LOAD_RENDER);
-            glyph = face_->glyph;
+            atlas = atlas2_.get();
         }
+        const auto& glyph = atlas->get_glyph(idx);
 
         if (do_kerning) {
             uint32_t idx = FT_Get_Char_Index(face_, unicode_character);
             if (prev) {
-                FT_Vector delta;
-                FT_Get_Kerning(face_, prev, idx, FT_KERNING_UNFITTED, &delta);
-                const double kern = (delta.x >> 6) + static_cast<double>(delta.x & 0x3F) / 0x3F;
-                horiz_pos += kern;
+                horiz_pos += atlas_->get_kerning(prev, idx);
             }
             prev = idx;
         }
-        auto coord = coordinates_t{ static_cast<position_t>(horiz_pos) + glyph->bitmap_left, -glyph->bitmap_top } + position;
-        draw_glyph(glyph, frame, coord, edge_blend_ && !generate_, color_);
-        const double advance = ((glyph->linearHoriAdvance & 0xFFFF0000) >> 16) + static_cast<double>(glyph->linearHoriAdvance & 0xFFFF) / 0xFFFF;
-        horiz_pos += advance;
+        auto coord = coordinates_t{ static_cast<position_t>(horiz_pos) + glyph.left, -glyph.top } + position;
+        builder.add_glyph(*atlas, glyph, coord);
+        horiz_pos += glyph.advance;
     }
+    return builder.build();
 }
 
 bool RenderText::set_param(const core::Parameter& param)
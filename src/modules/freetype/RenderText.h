@@ -14,6 +14,7 @@
 #include "yuri/core/frame/RawVideoFrame.h"
 #include "yuri/event/BasicEventConsumer.h"
 #include "yuri/core/utils/color.h"
+#include "GlyphCache.h"
 #include <ft2build.h>
 //#include <freetype/freetype.h>
 #include FT_FREETYPE_H
@@ -37,12 +38,17 @@ private:
     virtual bool set_param(const core::Parameter& param) override;
     virtual bool do_process_event(const std::string& event_name, const event::pBasicEvent& event) override;
     void draw_text(const std::string& text, core::pRawVideoFrame& frame);
+    pTextBitmap layout_text(const std::string& text);
 
 private:
     FT_Library library_;
     FT_Face    face_;
     FT_Face    face2_;
 
+    std::unique_ptr<GlyphAtlas> atlas_;
+    std::unique_ptr<GlyphAtlas> atlas2_;
+    TextCache                   text_cache_;
+
     std::string   font_file_;
     std::string   font_file2_;
     size_t        font_size_;
@@ -0,0 +1,190 @@
+/*!
+ * @file 		test_glyph_cache.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "GlyphCache.h"
+
+namespace yuri {
+namespace freetype {
+
+namespace {
+
+const std::vector<std::string> fonts = {
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/TTF/DejaVuSans.ttf",
+    "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/corefonts/arial.ttf",
+};
+
+const dimension_t canvas_width  = 800;
+const dimension_t canvas_rows   = 200;
+// Baseline of the text in the canvas, so glyphs above it fit in
+const coordinates_t canvas_base = { 20, 100 };
+
+class Font {
+public:
+    Font()
+    {
+        FT_Init_FreeType(&library_);
+        for (const auto& f : fonts) {
+            if (!FT_New_Face(library_, f.c_str(), 0, &face_)) {
+                FT_Set_Pixel_Sizes(face_, 32, 0);
+                return;
+            }
+        }
+        face_ = nullptr;
+    }
+    ~Font() noexcept
+    {
+        if (face_)
+            FT_Done_Face(face_);
+        FT_Done_FreeType(library_);
+    }
+    FT_Face get() const { return face_; }
+
+private:
+    FT_Library library_;
+    FT_Face    face_;
+};
+
+void blend_coverage(std::vector<uint8_t>& canvas, const uint8_t* bitmap, ptrdiff_t pitch, dimension_t width, dimension_t rows, coordinates_t position)
+{
+    for (dimension_t y = 0; y < rows; ++y) {
+        for (dimension_t x = 0; x < width; ++x) {
+            const unsigned p   = bitmap[pitch * y + x];
+            uint8_t&       out = canvas[(position.y + y) * canvas_width + position.x + x];
+            if (p)
+                out = static_cast<uint8_t>(out + p - (out * p) / 255);
+        }
+    }
+}
+
+// Lays out the text the same way as render_text
+template <class F>
+void layout(FT_Face face, const std::string& text, F place_glyph)
+{
+    double  horiz_pos = 0.0;
+    FT_UInt prev      = 0;
+    for (auto c : text) {
+        const auto idx = FT_Get_Char_Index(face, c);
+        horiz_pos += place_glyph(idx, prev, horiz_pos);
+        prev = idx;
+    }
+}
+
+// Renders every glyph by FreeType directly into the canvas
+std::vector<uint8_t> render_uncached(FT_Face face, const std::string& text)
+{
+    std::vector<uint8_t> canvas(canvas_width * canvas_rows, 0);
+    layout(face, text, [&](FT_UInt idx, FT_UInt prev, double& horiz_pos) {
+        if (prev) {
+            FT_Vector delta{ 0, 0 };
+            FT_Get_Kerning(face, prev, idx, FT_KERNING_UNFITTED, &delta);
+            horiz_pos += (delta.x >> 6) + static_cast<double>(delta.x & 0x3F) / 0x3F;
+        }
+        REQUIRE(!FT_Load_Glyph(face, idx, FT_LOAD_RENDER));
+        const auto  slot   = face->glyph;
+        const auto& bitmap = slot->bitmap;
+        REQUIRE(bitmap.pixel_mode == FT_PIXEL_MODE_GRAY);
+        const coordinates_t position = { static_cast<position_t>(horiz_pos) + slot->bitmap_left, -slot->bitmap_top };
+        blend_coverage(canvas, bitmap.buffer, bitmap.pitch, bitmap.width, bitmap.rows, position + canvas_base);
+        return ((slot->linearHoriAdvance & 0xFFFF0000) >> 16) + static_cast<double>(slot->linearHoriAdvance & 0xFFFF) / 0xFFFF;
+    });
+    return canvas;
+}
+
+pTextBitmap layout_cached(GlyphAtlas& atlas, const std::string& text)
+{
+    TextBitmapBuilder builder;
+    layout(atlas.get_face(), text, [&](FT_UInt idx, FT_UInt prev, double& horiz_pos) {
+        if (prev)
+            horiz_pos += atlas.get_kerning(prev, idx);
+        const auto& glyph = atlas.get_glyph(idx);
+        builder.add_glyph(atlas, glyph, coordinates_t{ static_cast<position_t>(horiz_pos) + glyph.left, -glyph.top });
+        return glyph.advance;
+    });
+    return builder.build();
+}
+
+std::vector<uint8_t> render_cached(const text_bitmap_t& text)
+{
+    std::vector<uint8_t> canvas(canvas_width * canvas_rows, 0);
+    blend_coverage(canvas, text.data.data(), text.width, text.width, text.rows, text.origin + canvas_base);
+    return canvas;
+}
+
+}
+
+TEST_CASE("Cached text matches uncached rendering", "[freetype]")
+{
+    Font font;
+    if (!font.get()) {
+        WARN("No font found, skipping the test");
+        return;
+    }
+    GlyphAtlas atlas(font.get());
+    TextCache  cache;
+    // Kerned pairs, repeated glyphs and a text served from the cache the second time
+    const std::vector<std::string> texts = { "Hello world", "AVAWAY To.", "fjord ffi", "0123456789:", "Hello world", "" };
+    for (const auto& text : texts) {
+        auto bitmap = cache.get(text);
+        if (!bitmap) {
+            bitmap = layout_cached(atlas, text);
+            cache.insert(text, bitmap);
+        }
+        REQUIRE(cache.get(text) == bitmap);
+        REQUIRE(bitmap->data.size() == bitmap->width * bitmap->rows);
+        INFO(text);
+        REQUIRE(render_cached(*bitmap) == render_uncached(font.get(), text));
+    }
+    // Glyphs rendered later may grow the atlas, that has to keep the previous ones valid
+    REQUIRE(render_cached(*layout_cached(atlas, "Hello world")) == render_uncached(font.get(), "Hello world"));
+}
+
+TEST_CASE("Overlapping glyphs are blended", "[freetype]")
+{
+    Font font;
+    if (!font.get()) {
+        WARN("No font found, skipping the test");
+        return;
+    }
+    GlyphAtlas        atlas(font.get());
+    const auto        idx   = FT_Get_Char_Index(font.get(), 'O');
+    const auto&       glyph = atlas.get_glyph(idx);
+    TextBitmapBuilder builder;
+    std::vector<uint8_t> expected(canvas_width * canvas_rows, 0);
+    REQUIRE(!FT_Load_Glyph(font.get(), idx, FT_LOAD_RENDER));
+    const auto& bitmap = font.get()->glyph->bitmap;
+    for (position_t x : { 0, 5, 11 }) {
+        const coordinates_t position = { x + glyph.left, -glyph.top };
+        builder.add_glyph(atlas, glyph, position);
+        blend_coverage(expected, bitmap.buffer, bitmap.pitch, bitmap.width, bitmap.rows, position + canvas_base);
+    }
+    REQUIRE(render_cached(*builder.build()) == expected);
+}
+
+TEST_CASE("Text cache", "[freetype]")
+{
+    TextCache cache(2);
+    auto      a = std::make_shared<text_bitmap_t>();
+    auto      b = std::make_shared<text_bitmap_t>();
+    REQUIRE(!cache.get("a"));
+    cache.insert("a", a);
+    cache.insert("b", b);
+    REQUIRE(cache.get("a") == a);
+    REQUIRE(cache.get("b") == b);
+    // Full cache is dropped before inserting
+    cache.insert("c", a);
+    REQUIRE(!cache.get("a"));
+    REQUIRE(!cache.get("b"));
+    REQUIRE(cache.get("c") == a);
+}
+
+} /* namespace freetype */
+} /* namespace yuri */
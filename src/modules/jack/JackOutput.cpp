@@ -26,7 +26,9 @@ namespace yuri {
             p["channels"]["Number of output channels"] = 2;
             p["allow_different_frequencies"]["Ignore sampling frequency from input frames"] = false;
             p["connect_to"]["Specify where to connect the outputs to (e.g. 'system')"] = "";
-            p["buffer_size"]["Size of internal buffer"] = 1048576;
+            p["buffer_size"]["Size of internal buffer (in samples)"] = 1048576;
+            p["latency"]["Target latency of the internal buffer in ms. Playback starts when the buffer is filled up to it."] = 40.0;
+            p["drift_compensation"]["Resample the input slightly to keep the latency when the JACK clock differs from the pipeline"] = true;
             p["client_name"]["Name of the JACK client"] = "yuri";
             p["start_server"]["Start server is it's not running."] = false;
             p["blocking"]["Blocking mode when buffer is full."] = false;
@@ -119,48 +121,37 @@ namespace yuri {
 
 
             template<typename Target, class Source, typename src_fmt>
-            void store_samples(std::vector<buffer_t<Target>> &buffers, const src_fmt *in, size_t nframes,
+            void store_samples(std::vector<Target> &samples, size_t out_channels, const src_fmt *in, size_t nframes,
                                size_t in_channels) {
                 const Source *in_frames = reinterpret_cast<const Source *>(in);
-                const size_t copy_channels = std::min(in_channels, buffers.size());
-                if (copy_channels < buffers.size()) {
-                    for (size_t c = 0; c < (buffers.size() - copy_channels); ++c) {
-                        buffers[c + copy_channels].push_silence(nframes);
-                    }
-                }
+                const size_t copy_channels = std::min(in_channels, out_channels);
+                samples.resize(nframes * out_channels);
+                Target *out = samples.data();
                 for (size_t i = 0; i < nframes; ++i) {
                     for (size_t c = 0; c < copy_channels; ++c) {
-                        buffers[c].push(convert_sample<Target>(*(in_frames + c)));
+                        out[c] = convert_sample<Target>(*(in_frames + c));
                     }
+                    std::fill(out + copy_channels, out + out_channels, 0.0f);
                     in_frames += in_channels;
+                    out += out_channels;
                 }
             }
 
             template<typename Target, class Source, typename src_fmt>
-            void store_samples_with_gain(std::vector<buffer_t<Target>> &buffers, const std::vector<float> &gains,
+            void store_samples_with_gain(std::vector<Target> &samples, size_t out_channels, const std::vector<float> &gains,
                                          const src_fmt *in, size_t nframes, size_t in_channels, bool clamp_values) {
                 const Source *in_frames = reinterpret_cast<const Source *>(in);
-                const size_t copy_channels = std::min(in_channels, buffers.size());
-                if (copy_channels < buffers.size()) {
-                    for (size_t c = 0; c < (buffers.size() - copy_channels); ++c) {
-                        buffers[c + copy_channels].push_silence(nframes);
-                    }
-                }
-                if (clamp_values) {
-                    for (size_t i = 0; i < nframes; ++i) {
-                        for (size_t c = 0; c < copy_channels; ++c) {
-                            buffers[c].push(
-                                    clip_value(convert_sample<Target>(*(in_frames + c)) * gains[c], -1.0f, 1.0f));
-                        }
-                        in_frames += in_channels;
-                    }
-                } else {
-                    for (size_t i = 0; i < nframes; ++i) {
-                        for (size_t c = 0; c < copy_channels; ++c) {
-                            buffers[c].push(convert_sample<Target>(*(in_frames + c)) * gains[c]);
-                        }
-                        in_frames += in_channels;
+                const size_t copy_channels = std::min(in_channels, out_channels);
+                samples.resize(nframes * out_channels);
+                Target *out = samples.data();
+                for (size_t i = 0; i < nframes; ++i) {
+                    for (size_t c = 0; c < copy_channels; ++c) {
+                        const Target value = convert_sample<Target>(*(in_frames + c)) * gains[c];
+                        out[c] = clamp_values ? clip_value(value, -1.0f, 1.0f) : value;
                     }
+                    std::fill(out + copy_channels, out + out_channels, 0.0f);
+                    in_frames += in_channels;
+                    out += out_channels;
                 }
             }
 
@@ -177,7 +168,8 @@ namespace yuri {
         JackOutput::JackOutput(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters) :
                 base_type(log_, parent, std::string("jack_output")), event::BasicEventConsumer(log), handle_(nullptr),
                 client_name_("yuri_jack"), channels_(2), allow_different_frequencies_(false), buffer_size_(1048576),
-                start_server_(false), blocking_(false), report_max_(32768), current_missing_(0) {
+                target_latency_(40_ms), drift_compensation_(true), start_server_(false), blocking_(false),
+                report_max_(32768), reported_missing_(0), reported_dropped_(0) {
             IOTHREAD_INIT(parameters)
             if (channels_ < 1) {
                 throw exception::InitializationFailed("Invalid number of channels");
@@ -216,50 +208,45 @@ namespace yuri {
             const size_t in_channels = frame->get_channel_count();
 
 
-            std::unique_lock<std::mutex> lock(data_mutex_);
-            // Calling process events under the data mutex, it could mess with gains_
+            // Gains are used only in this thread, the process callback reads just the ring
             process_events();
             using namespace core::raw_audio_format;
-            auto empty = buffers_[0].empty();
-            if (empty < nframes) {
-                if (!blocking_) {
-                    log[log::warning] << "Not enough space in the buffer, overwriting " << (nframes - empty)
-                                      << " frames";
-                } else {
-                    while (still_running() && empty < nframes) {
-                        if (!still_running()) {
-                            request_end();
-                            return {};
-                        }
-                        buffer_cv_.wait_for(lock, std::chrono::microseconds(get_latency()));
-                        empty = buffers_[0].empty();
+            if (blocking_) {
+                // Resampling may produce slightly more samples than received
+                const size_t required = std::min(static_cast<size_t>(nframes * (1.0 + core::AudioRing::max_drift)) + 2,
+                                                 ring_->get_capacity());
+                while (ring_->space() < required) {
+                    if (!still_running()) {
+                        request_end();
+                        return {};
                     }
+                    sleep(get_latency());
                 }
             }
             if (gains_.empty()) {
                 switch (frame->get_format()) {
                     case unsigned_8bit:
-                        store_samples<jack_default_audio_sample_t, uint8_t>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, uint8_t>(samples_, channels_, frame->data(), nframes,
                                                                             in_channels);
                         break;
                     case signed_16bit:
-                        store_samples<jack_default_audio_sample_t, int16_t>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, int16_t>(samples_, channels_, frame->data(), nframes,
                                                                             in_channels);
                         break;
                     case unsigned_16bit:
-                        store_samples<jack_default_audio_sample_t, uint16_t>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, uint16_t>(samples_, channels_, frame->data(), nframes,
                                                                              in_channels);
                         break;
                     case signed_32bit:
-                        store_samples<jack_default_audio_sample_t, int32_t>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, int32_t>(samples_, channels_, frame->data(), nframes,
                                                                             in_channels);
                         break;
                     case unsigned_32bit:
-                        store_samples<jack_default_audio_sample_t, uint32_t>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, uint32_t>(samples_, channels_, frame->data(), nframes,
                                                                              in_channels);
                         break;
                     case float_32bit:
-                        store_samples<jack_default_audio_sample_t, float>(buffers_, frame->data(), nframes,
+                        store_samples<jack_default_audio_sample_t, float>(samples_, channels_, frame->data(), nframes,
                                                                           in_channels);
                         break;
                     default:
@@ -274,71 +261,76 @@ namespace yuri {
                 }
                 switch (frame->get_format()) {
                     case unsigned_8bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, uint8_t>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, uint8_t>(samples_, channels_, gains_, frame->data(),
                                                                                       nframes, in_channels, clamp_);
                         break;
                     case signed_16bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, int16_t>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, int16_t>(samples_, channels_, gains_, frame->data(),
                                                                                       nframes, in_channels, clamp_);
                         break;
                     case unsigned_16bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, uint16_t>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, uint16_t>(samples_, channels_, gains_, frame->data(),
                                                                                        nframes, in_channels, clamp_);
                         break;
                     case signed_32bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, int32_t>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, int32_t>(samples_, channels_, gains_, frame->data(),
                                                                                       nframes, in_channels, clamp_);
                         break;
                     case unsigned_32bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, uint32_t>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, uint32_t>(samples_, channels_, gains_, frame->data(),
                                                                                        nframes, in_channels, clamp_);
                         break;
                     case float_32bit:
-                        store_samples_with_gain<jack_default_audio_sample_t, float>(buffers_, gains_, frame->data(),
+                        store_samples_with_gain<jack_default_audio_sample_t, float>(samples_, channels_, gains_, frame->data(),
                                                                                     nframes, in_channels, clamp_);
                         break;
                     default:
                         log[log::warning] << "Unsupported frame format";
-                        break;
+                        return {};
                 }
             }
+            ring_->push(samples_.data(), nframes);
             return {};
         }
 
         int JackOutput::process_audio(jack_nframes_t nframes) {
-            std::unique_lock<std::mutex> lock(data_mutex_);
-            const size_t copy_count =
-                    send_only_full_buffers_ ?
-                    (buffers_[0].size()>= nframes? nframes:0):
-                    std::min<size_t>(buffers_[0].size(), nframes);
-            for (size_t i = 0; i < buffers_.size(); ++i) {
-                if (!ports_[i]) continue;
-                jack_default_audio_sample_t *data = reinterpret_cast<jack_default_audio_sample_t *>(jack_port_get_buffer(
-                        ports_[i].get(), nframes));
-                buffers_[i].pop(data, copy_count);
-                std::fill(data + copy_count, data + nframes, 0.0f);
-                buffer_cv_.notify_all();
-            }
-            const auto missing = nframes - copy_count;
-            if (missing > 0 && missing != nframes) {
-                log[log::warning] << "Missing " << (current_missing_ + missing) << " frames, filled with zeros";
-                current_missing_ = 0;
-            } else {
-                current_missing_ += missing;
-                if (current_missing_ >= report_max_ || (current_missing_ != 0 && missing == 0)) {
-                    log[log::warning] << "Missing " << current_missing_ << " frames, filled with zeros";
-                    current_missing_ = 0;
-                }
+            // Called from the realtime thread, so no locking, allocation nor logging here.
+            // Missing samples are counted by the ring and reported from the pipeline thread.
+            for (size_t i = 0; i < port_buffers_.size(); ++i) {
+                port_buffers_[i] = i < ports_.size() && ports_[i] ? reinterpret_cast<jack_default_audio_sample_t *>(jack_port_get_buffer(
+                        ports_[i].get(), nframes)) : nullptr;
             }
+            ring_->read_planar(port_buffers_.data(), nframes, send_only_full_buffers_);
             return 0;
         }
 
+        void JackOutput::report_ring_state() {
+            if (!ring_) return;
+            const auto missing = ring_->get_missing_frames();
+            const auto pending = missing - reported_missing_;
+            // Long outages are reported once per report_max_ frames, short ones when the data come again
+            if (pending >= report_max_ || (pending && ring_->available())) {
+                log[log::warning] << "Missing " << pending << " frames, filled with zeros ("
+                                  << ring_->get_underruns() << " underruns total)";
+                reported_missing_ = missing;
+            }
+            const auto dropped = ring_->get_dropped_frames();
+            if (dropped != reported_dropped_) {
+                log[log::warning] << "Not enough space in the buffer, dropped " << (dropped - reported_dropped_)
+                                  << " frames";
+                reported_dropped_ = dropped;
+            }
+        }
+
         bool JackOutput::set_param(const core::Parameter &param) {
             if (assign_parameters(param)
                     (channels_, "channels")
                     (allow_different_frequencies_, "allow_different_frequencies")
                     (connect_to_, "connect_to")
                     (buffer_size_, "buffer_size")
+                    .parsed<double>
+                            (target_latency_, "latency", [](double ms) { return 1_ms * ms; })
+                    (drift_compensation_, "drift_compensation")
                     (client_name_, "client_name")
                     (start_server_, "start_server")
                     (blocking_, "blocking")
@@ -451,7 +443,16 @@ namespace yuri {
 
             log[log::info] << "Connected to JACK server";
 
-            buffers_.resize(channels_, buffer_t<jack_default_audio_sample_t>(buffer_size_));
+            const size_t sample_rate = jack_get_sample_rate(handle.get());
+            const size_t period = jack_get_buffer_size(handle.get());
+            // The target has to cover at least two periods, otherwise the first read after prebuffering would underrun
+            const size_t target = std::max<size_t>(target_latency_.value * sample_rate / 1000000, 2 * period);
+            ring_.reset(new core::AudioRing(channels_, sample_rate, std::max(buffer_size_, 2 * target), target,
+                                            drift_compensation_));
+            reported_missing_ = 0;
+            reported_dropped_ = 0;
+            port_buffers_.assign(channels_, nullptr);
+            log[log::info] << "Using latency " << (target * 1000 / sample_rate) << " ms (" << target << " samples)";
 
             if (jack_set_process_callback(handle.get(), process_audio_wrapper, this) != 0) {
                 log[log::error] << "Failed to set process callback!";
@@ -556,6 +557,7 @@ namespace yuri {
                     return true;
                 }
             }
+            report_ring_state();
             return base_type::step();
         }
 
@@ -14,57 +14,12 @@
 #include "yuri/core/frame/RawAudioFrame.h"
 #include <jack/jack.h>
 #include "yuri/event/BasicEventConsumer.h"
+#include "yuri/core/utils/AudioRing.h"
+#include <memory>
 
 namespace yuri {
 namespace jack {
 
-template<typename T>
-struct buffer_t {
-	using data_type = T;
-	std::vector<data_type> data;
-	size_t start;
-	size_t end;
-	buffer_t(size_t size):data(size,0),start(0),end(0) {}
-	~buffer_t() noexcept {}
-	size_t size() const noexcept {
-		if (end < start) {
-			return end + data.size() - start;
-		}
-		return end - start;
-	}
-	size_t empty() const noexcept {
-		return data.size() - size();
-	}
-	inline void push(data_type value) {
-		if (end==data.size()) {
-			data[0]=value;
-			end=1;
-//			if (start==0) start = 1;
-		} else {
-			data[end++]=value;
-			if (end == start) ++start;
-			if (start == data.size()) start = 0;
-		}
-	}
-	inline void push_silence(size_t count) {
-		for (size_t i = 0;i<count;++i) push(0.0);
-	}
-	inline void pop(data_type* dest, size_t count) {
-		if (end == start) return;
-		if (end < start) {
-			size_t copy_count = std::min(data.size() - start, count);
-			std::copy(&data[start], &data[start+copy_count], dest);
-			start += copy_count;
-			if (start >= data.size()) start = 0;
-			if (count == copy_count) return;
-			return pop(dest+copy_count, count - copy_count);
-		}
-		size_t copy_count = std::min(end - start, count);
-		std::copy(&data[start], &data[start+copy_count], dest);
-		start += copy_count;
-	}
-};
-
 class JackOutput: public core::SpecializedIOFilter<core::RawAudioFrame>, public event::BasicEventConsumer
 {
 	using base_type = core::SpecializedIOFilter<core::RawAudioFrame>;
@@ -88,6 +43,7 @@ private:
     bool do_process_event(const std::string &event_name, const event::pBasicEvent &event) override;
     bool step() override;
     bool connect_to_jackd();
+    void report_ring_state();
 
 	handle_t handle_;
 	std::vector<port_t> ports_;
@@ -97,8 +53,14 @@ private:
 	size_t channels_;
 	bool allow_different_frequencies_;
 	size_t buffer_size_;
-	std::vector<buffer_t<jack_default_audio_sample_t>> buffers_;
-	std::mutex	data_mutex_;
+	//! Samples passed to the process callback, the callback never waits for the pipeline
+	std::unique_ptr<core::AudioRing> ring_;
+	//! Converted samples of the last frame, interleaved
+	std::vector<jack_default_audio_sample_t> samples_;
+	//! Port buffers for the process callback, allocated in advance
+	std::vector<jack_default_audio_sample_t*> port_buffers_;
+	duration_t target_latency_;
+	bool drift_compensation_;
 	bool start_server_;
 	bool blocking_;
 	bool auto_connect_;
@@ -108,10 +70,10 @@ private:
     bool allow_unconnected_;
     bool send_only_full_buffers_ = false;
 
-	std::condition_variable buffer_cv_;
 	bool jackd_down_ = false;
 	size_t report_max_;
-	size_t current_missing_;
+	uint64_t reported_missing_;
+	uint64_t reported_dropped_;
     timestamp_t last_reconnect_;
 };
 
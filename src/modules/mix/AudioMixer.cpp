@@ -0,0 +1,253 @@
+/*!
+ * @file 		AudioMixer.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AudioMixer.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include "yuri/core/utils/assign_parameters.h"
+#include "yuri/exception/InitializationFailed.h"
+#include <cmath>
+#include <sstream>
+
+namespace yuri {
+namespace mix {
+
+namespace {
+
+float db_to_gain(float db)
+{
+	return std::pow(10.0f, db / 20.0f);
+}
+
+std::vector<int> parse_channel_map(const std::string& str)
+{
+	std::vector<int> map;
+	std::stringstream ss(str);
+	std::string item;
+	while (std::getline(ss, item, ',')) {
+		if (item.empty()) continue;
+		map.push_back(std::stoi(item));
+	}
+	return map;
+}
+
+size_t to_frames(duration_t duration, size_t sampling_frequency)
+{
+	return static_cast<size_t>(std::max<int64_t>(0, duration.value * static_cast<int64_t>(sampling_frequency) / 1000000));
+}
+
+template<class F>
+bool for_each_value(const event::pBasicEvent& event, F func)
+{
+	if (const auto vec_event = std::dynamic_pointer_cast<event::EventVector>(event)) {
+		size_t index = 0;
+		for (const auto& value: *vec_event) {
+			func(index++, value);
+		}
+		return true;
+	}
+	return false;
+}
+
+}
+
+IOTHREAD_GENERATOR(AudioMixer)
+
+core::Parameters AudioMixer::configure()
+{
+	core::Parameters p = core::IOThread::configure();
+	p.set_description("Mixes audio from all inputs, aligned by their timestamps.");
+	p["channels"]["Number of output channels"]=2;
+	p["sampling_frequency"]["Sampling frequency of inputs and output. Inputs with other frequency are ignored."]=48000;
+	p["samples"]["Number of samples in an output frame"]=1024;
+	p["latency"]["Maximal time (in ms) to wait for late inputs"]=100.0;
+	p["tolerance"]["Maximal timestamp jitter (in ms) considered as continuous stream"]=20.0;
+	p["gain"]["Master gain"]=1.0;
+	p["limiter"]["Enable peak limiter"]=true;
+	p["threshold"]["Limiter threshold in dB"]=-1.0;
+	p["release"]["Limiter release time in ms"]=50.0;
+	p["channel_map"]["Comma separated output channel for each input channel, -1 drops the channel. "
+			"Empty value sends mono inputs to all channels and other inputs to the same channel."]="";
+	p["simd"]["Instruction set to use (auto, avx2, sse4, none)"]="auto";
+	return p;
+}
+
+
+AudioMixer::AudioMixer(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
+core::IOThread(log_,parent,0,1,std::string("audio_mixer")),
+event::BasicEventConsumer(log),channels_(2),sampling_frequency_(48000),block_(1024),
+latency_(100_ms),tolerance_(20_ms),gain_(1.0f),limiter_(true),threshold_(db_to_gain(-1.0f)),
+release_(50_ms),simd_level_(get_supported_level())
+{
+	IOTHREAD_INIT(parameters)
+	if (!channels_ || !sampling_frequency_ || !block_) {
+		throw exception::InitializationFailed("Number of channels, sampling frequency and samples have to be nonzero");
+	}
+	mixer_.reset(new Mixer(channels_, sampling_frequency_, block_,
+			to_frames(latency_, sampling_frequency_), to_frames(tolerance_, sampling_frequency_), simd_level_));
+	mixer_->set_gain(gain_);
+	mixer_->set_limiter(limiter_, threshold_, static_cast<double>(to_frames(release_, sampling_frequency_)));
+	mixer_->set_channel_map(channel_map_);
+	set_latency(1_ms);
+}
+
+AudioMixer::~AudioMixer() noexcept
+{
+}
+
+bool AudioMixer::step()
+{
+	if (!converter_) {
+		converter_.reset(new core::Convert(log, get_this_ptr(), core::Convert::configure()));
+		add_child(converter_);
+	}
+	process_events();
+	bool empty = false;
+	while (!empty) {
+		empty = true;
+		for (position_t i = 0; i < get_no_in_ports(); ++i) {
+			if (core::pFrame frame = pop_frame(i)) {
+				process_frame(i, frame);
+				empty = false;
+			}
+		}
+	}
+	emit_blocks();
+	return true;
+}
+
+void AudioMixer::process_frame(position_t input, core::pFrame frame)
+{
+	auto audio = std::dynamic_pointer_cast<core::RawAudioFrame>(
+			converter_->convert_to_cheapest(frame, {core::raw_audio_format::float_32bit}));
+	if (!audio) {
+		log[log::warning] << "Failed to convert frame from input " << input << " to float samples";
+		return;
+	}
+	if (audio->get_sampling_frequency() != sampling_frequency_) {
+		log[log::warning] << "Ignoring frame from input " << input << " with sampling frequency "
+				<< audio->get_sampling_frequency() << ", expected " << sampling_frequency_;
+		return;
+	}
+	const size_t channels = audio->get_channel_count();
+	const size_t frames = audio->get_sample_count();
+	const float* data = reinterpret_cast<const float*>(audio->data());
+	timestamp_t timestamp = audio->get_timestamp();
+	size_t done = 0;
+	// The frame may be larger than the free space in the FIFO, so blocks are mixed in between
+	while (done < frames) {
+		const size_t consumed = mixer_->push(input, timestamp, data + done * channels, frames - done, channels);
+		done += consumed;
+		timestamp = timestamp + duration_t{static_cast<int64_t>(consumed * 1000000 / sampling_frequency_)};
+		if (done < frames && !mixer_->ready()) {
+			log[log::warning] << "Dropping " << (frames - done) << " samples from input " << input;
+			break;
+		}
+		emit_blocks();
+	}
+}
+
+void AudioMixer::emit_blocks()
+{
+	const size_t size = block_ * channels_ * sizeof(float);
+	while (mixer_->ready()) {
+		auto block = core::FixedMemoryAllocator::get_block(size);
+		timestamp_t timestamp;
+		mixer_->mix(reinterpret_cast<float*>(block.first), timestamp);
+		auto frame = core::RawAudioFrame::create_empty(core::raw_audio_format::float_32bit,
+				channels_, sampling_frequency_, block.first, size, block.second);
+		frame->set_timestamp(timestamp);
+		frame->set_duration(1_s * (static_cast<double>(block_) / sampling_frequency_));
+		push_frame(0, frame);
+	}
+}
+
+void AudioMixer::do_connect_in(position_t pos, core::pPipe pipe)
+{
+	position_t inp = do_get_no_in_ports();
+	if (pos < 0) {
+		resize(inp+1,1);
+		pos = inp;
+	} else if (pos >= inp) {
+		resize(pos+1,1);
+	}
+	mixer_->set_input_count(do_get_no_in_ports());
+	IOThread::do_connect_in(pos, pipe);
+}
+
+bool AudioMixer::set_param(const core::Parameter& param)
+{
+	if (assign_parameters(param)
+			(channels_, "channels")
+			(sampling_frequency_, "sampling_frequency")
+			(block_, "samples")
+			.parsed<double>
+				(latency_, "latency", [](double ms){ return 1_ms * ms; })
+			.parsed<double>
+				(tolerance_, "tolerance", [](double ms){ return 1_ms * ms; })
+			(gain_, "gain")
+			(limiter_, "limiter")
+			.parsed<float>
+				(threshold_, "threshold", db_to_gain)
+			.parsed<double>
+				(release_, "release", [](double ms){ return 1_ms * ms; })
+			.parsed<std::string>
+				(channel_map_, "channel_map", parse_channel_map)
+			.parsed<std::string>
+				(simd_level_, "simd", parse_level))
+		return true;
+	return core::IOThread::set_param(param);
+}
+
+bool AudioMixer::do_process_event(const std::string& event_name, const event::pBasicEvent& event)
+{
+	if (event_name == "gain") {
+		gain_ = event::lex_cast_value<float>(event);
+		mixer_->set_gain(gain_);
+		return true;
+	}
+	if (event_name == "gains" || event_name == "mute") {
+		const bool mute = event_name == "mute";
+		auto set = [this, mute](size_t input, const event::pBasicEvent& value) {
+			if (mute) mixer_->set_input_mute(input, event::lex_cast_value<bool>(value));
+			else mixer_->set_input_gain(input, event::lex_cast_value<float>(value));
+		};
+		if (!for_each_value(event, set)) {
+			// Single value for all the inputs
+			for (size_t i = 0; i < mixer_->get_input_count(); ++i) set(i, event);
+		}
+		return true;
+	}
+	if (event_name == "pan") {
+		if (!for_each_value(event, [this](size_t input, const event::pBasicEvent& value) {
+				mixer_->set_input_pan(input, event::lex_cast_value<float>(value)); })) {
+			log[log::warning] << "pan event has to receive a vector";
+			return false;
+		}
+		return true;
+	}
+	if (event_name == "channel_gains") {
+		if (!for_each_value(event, [this](size_t channel, const event::pBasicEvent& value) {
+				mixer_->set_channel_gain(channel, event::lex_cast_value<float>(value)); })) {
+			log[log::warning] << "channel_gains event has to receive a vector";
+			return false;
+		}
+		return true;
+	}
+	if (event_name == "limiter") {
+		limiter_ = event::lex_cast_value<bool>(event);
+		mixer_->set_limiter(limiter_, threshold_, static_cast<double>(to_frames(release_, sampling_frequency_)));
+		return true;
+	}
+	return false;
+}
+
+} /* namespace mix */
+} /* namespace yuri */
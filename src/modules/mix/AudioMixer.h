@@ -0,0 +1,56 @@
+/*!
+ * @file 		AudioMixer.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef AUDIOMIXER_H_
+#define AUDIOMIXER_H_
+
+#include "yuri/core/thread/IOThread.h"
+#include "yuri/core/thread/Convert.h"
+#include "yuri/event/BasicEventConsumer.h"
+#include "Mixer.h"
+#include <memory>
+
+namespace yuri {
+namespace mix {
+
+class AudioMixer: public core::IOThread, public event::BasicEventConsumer
+{
+public:
+	IOTHREAD_GENERATOR_DECLARATION
+	static core::Parameters configure();
+	AudioMixer(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters);
+	virtual ~AudioMixer() noexcept;
+private:
+	virtual bool step() override;
+	virtual bool set_param(const core::Parameter& param) override;
+	virtual	void do_connect_in(position_t, core::pPipe pipe) override;
+	virtual bool do_process_event(const std::string& event_name, const event::pBasicEvent& event) override;
+
+	void process_frame(position_t input, core::pFrame frame);
+	void emit_blocks();
+
+	size_t channels_;
+	size_t sampling_frequency_;
+	size_t block_;
+	duration_t latency_;
+	duration_t tolerance_;
+	float gain_;
+	bool limiter_;
+	float threshold_;
+	duration_t release_;
+	std::vector<int> channel_map_;
+	simd_level_t simd_level_;
+
+	std::unique_ptr<Mixer> mixer_;
+	core::pConvert converter_;
+};
+
+} /* namespace mix */
+} /* namespace yuri */
+#endif /* AUDIOMIXER_H_ */
@@ -8,6 +8,7 @@
  */
 
 #include "Mix.h"
+#include "AudioMixer.h"
 #include "yuri/core/Module.h"
 
 namespace yuri {
@@ -18,6 +19,7 @@ IOTHREAD_GENERATOR(Mix)
 
 MODULE_REGISTRATION_BEGIN("mix")
 		REGISTER_IOTHREAD("mix",Mix)
+		REGISTER_IOTHREAD("audio_mixer",AudioMixer)
 MODULE_REGISTRATION_END()
 
 core::Parameters Mix::configure()
@@ -0,0 +1,265 @@
+/*!
+ * @file 		Mixer.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "Mixer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace yuri {
+namespace mix {
+
+void SampleFifo::reset(size_t channels, size_t capacity)
+{
+	channels_ = channels;
+	capacity_ = capacity;
+	data_.assign(channels * capacity, 0.0f);
+	clear();
+}
+
+template<class F>
+size_t SampleFifo::store(size_t frames, F f)
+{
+	frames = std::min(frames, space());
+	if (!frames) return 0;
+	size_t tail = (head_ + size_) % capacity_;
+	size_t done = 0;
+	while (done < frames) {
+		const size_t count = std::min(frames - done, capacity_ - tail);
+		f(&data_[tail * channels_], done, count);
+		done += count;
+		tail = (tail + count) % capacity_;
+	}
+	size_ += frames;
+	return frames;
+}
+
+size_t SampleFifo::push(const float* data, size_t frames)
+{
+	return store(frames, [this, data](float* dst, size_t offset, size_t count) {
+		std::copy(data + offset * channels_, data + (offset + count) * channels_, dst);
+	});
+}
+
+size_t SampleFifo::push_silence(size_t frames)
+{
+	return store(frames, [this](float* dst, size_t, size_t count) {
+		std::fill(dst, dst + count * channels_, 0.0f);
+	});
+}
+
+void SampleFifo::read_planar(size_t offset, size_t frames, float* planes, size_t plane_stride) const
+{
+	frames = std::min(frames, size_ > offset ? size_ - offset : 0);
+	if (!frames) return;
+	size_t position = (head_ + offset) % capacity_;
+	size_t done = 0;
+	while (done < frames) {
+		const size_t count = std::min(frames - done, capacity_ - position);
+		const float* src = &data_[position * channels_];
+		for (size_t c = 0; c < channels_; ++c) {
+			float* plane = planes + c * plane_stride + done;
+			for (size_t i = 0; i < count; ++i) {
+				plane[i] = src[i * channels_ + c];
+			}
+		}
+		done += count;
+		position = 0;
+	}
+}
+
+void SampleFifo::drop(size_t frames)
+{
+	frames = std::min(frames, size_);
+	if (!frames) return;
+	head_ = (head_ + frames) % capacity_;
+	size_ -= frames;
+}
+
+
+Mixer::Mixer(size_t channels, size_t sampling_frequency, size_t block, size_t latency, size_t tolerance, simd_level_t level):
+	channels_(channels), sampling_frequency_(sampling_frequency), block_(block), latency_(latency),
+	tolerance_(tolerance), level_(level), channel_gains_(channels, 1.0f),
+	output_planes_(channels * block), limiter_gains_(block)
+{
+}
+
+void Mixer::set_input_count(size_t count)
+{
+	inputs_.resize(count);
+}
+
+void Mixer::set_input_gain(size_t input, float gain)
+{
+	if (input >= inputs_.size()) set_input_count(input + 1);
+	inputs_[input].gain = gain;
+}
+
+void Mixer::set_input_mute(size_t input, bool mute)
+{
+	if (input >= inputs_.size()) set_input_count(input + 1);
+	inputs_[input].mute = mute;
+}
+
+void Mixer::set_input_pan(size_t input, float pan)
+{
+	if (input >= inputs_.size()) set_input_count(input + 1);
+	inputs_[input].pan = std::min(std::max(pan, -1.0f), 1.0f);
+}
+
+void Mixer::set_channel_gain(size_t channel, float gain)
+{
+	if (channel < channel_gains_.size()) channel_gains_[channel] = gain;
+}
+
+void Mixer::set_limiter(bool enabled, float threshold, double release)
+{
+	limiter_ = enabled;
+	threshold_ = threshold;
+	release_ = release > 0.0 ? static_cast<float>(1.0 - std::exp(-1.0 / release)) : 1.0f;
+}
+
+size_t Mixer::push(size_t index, timestamp_t timestamp, const float* data, size_t frames, size_t channels)
+{
+	if (!channels || !frames) return frames;
+	if (index >= inputs_.size()) set_input_count(index + 1);
+	auto& input = inputs_[index];
+	if (!started_) {
+		started_ = true;
+		start_time_ = timestamp;
+		output_position_ = 0;
+	}
+	if (input.fifo.get_channels() != channels) {
+		input.fifo.reset(channels, latency_ + 2 * block_);
+		input.running = false;
+		if (input_planes_.size() < channels * block_) input_planes_.resize(channels * block_);
+	}
+
+	const int64_t position = std::llround((timestamp - start_time_).value * 1e-6 * sampling_frequency_);
+	const int64_t end = input.position + static_cast<int64_t>(input.fifo.size());
+	size_t consumed = 0;
+	if (!input.running) {
+		input.fifo.clear();
+		input.position = position;
+		input.running = true;
+	} else if (std::abs(position - end) > static_cast<int64_t>(tolerance_)) {
+		if (position > end) {
+			// Gap in the input, stored samples are followed by silence
+			const size_t gap = position - end;
+			if (gap > input.fifo.space()) {
+				input.fifo.clear();
+				input.position = position;
+			} else {
+				input.fifo.push_silence(gap);
+			}
+		} else {
+			// Samples overlapping with already stored ones are skipped
+			consumed = std::min<size_t>(end - position, frames);
+		}
+	}
+	int64_t start = input.position + static_cast<int64_t>(input.fifo.size());
+	if (start < output_position_) {
+		// Samples for already mixed blocks
+		consumed += std::min<size_t>(output_position_ - start, frames - consumed);
+		start = output_position_;
+	}
+	if (!input.fifo.size()) input.position = start;
+	if (consumed >= frames) return frames;
+	return consumed + input.fifo.push(data + consumed * channels, frames - consumed);
+}
+
+bool Mixer::ready() const
+{
+	const int64_t block_end = output_position_ + static_cast<int64_t>(block_);
+	bool running = false;
+	bool complete = true;
+	int64_t ahead = 0;
+	for (const auto& input: inputs_) {
+		if (!input.running) continue;
+		running = true;
+		const int64_t end = input.position + static_cast<int64_t>(input.fifo.size());
+		if (end < block_end) complete = false;
+		ahead = std::max(ahead, end - output_position_);
+	}
+	return running && (complete || ahead >= static_cast<int64_t>(block_ + latency_));
+}
+
+bool Mixer::is_mapped(size_t input_channel, size_t input_channels, size_t output) const
+{
+	if (!channel_map_.empty()) {
+		return input_channel < channel_map_.size() && channel_map_[input_channel] == static_cast<int>(output);
+	}
+	return input_channels == 1 || input_channel % channels_ == output;
+}
+
+bool Mixer::mix(float* output, timestamp_t& timestamp)
+{
+	if (!ready()) return false;
+	std::fill(output_planes_.begin(), output_planes_.end(), 0.0f);
+	const int64_t block_end = output_position_ + static_cast<int64_t>(block_);
+	for (auto& input: inputs_) {
+		if (!input.running) continue;
+		const int64_t begin = std::max(input.position, output_position_);
+		const int64_t end = std::min(input.position + static_cast<int64_t>(input.fifo.size()), block_end);
+		if (begin < end && !input.mute) {
+			const size_t count = end - begin;
+			const size_t in_channels = input.fifo.get_channels();
+			input.fifo.read_planar(begin - input.position, count, input_planes_.data(), block_);
+			for (size_t o = 0; o < channels_; ++o) {
+				float gain = gain_ * input.gain * channel_gains_[o];
+				if (channels_ == 2) {
+					gain *= std::min(1.0f, o ? 1.0f + input.pan : 1.0f - input.pan);
+				}
+				if (gain == 0.0f) continue;
+				float* dst = &output_planes_[o * block_ + (begin - output_position_)];
+				for (size_t c = 0; c < in_channels; ++c) {
+					if (is_mapped(c, in_channels, o)) {
+						mix_add(dst, &input_planes_[c * block_], gain, count, level_);
+					}
+				}
+			}
+		}
+		const size_t consumed = static_cast<size_t>(std::min<int64_t>(input.fifo.size(), std::max<int64_t>(0, block_end - input.position)));
+		input.fifo.drop(consumed);
+		input.position += consumed;
+		if (!input.fifo.size() && input.position + static_cast<int64_t>(latency_) < block_end) {
+			// The input stopped, or lags too much behind
+			input.running = false;
+		}
+	}
+	if (limiter_) limit();
+	for (size_t o = 0; o < channels_; ++o) {
+		const float* plane = &output_planes_[o * block_];
+		for (size_t i = 0; i < block_; ++i) {
+			output[i * channels_ + o] = plane[i];
+		}
+	}
+	timestamp = start_time_ + duration_t{output_position_ * 1000000 / static_cast<int64_t>(sampling_frequency_)};
+	output_position_ = block_end;
+	return true;
+}
+
+void Mixer::limit()
+{
+	std::fill(limiter_gains_.begin(), limiter_gains_.end(), 0.0f);
+	for (size_t o = 0; o < channels_; ++o) {
+		max_abs(limiter_gains_.data(), &output_planes_[o * block_], block_, level_);
+	}
+	// Gain drops immediately to keep the peaks under threshold and recovers exponentially
+	for (auto& value: limiter_gains_) {
+		const float target = value > threshold_ ? threshold_ / value : 1.0f;
+		envelope_ = target < envelope_ ? target : envelope_ + (target - envelope_) * release_;
+		value = envelope_;
+	}
+	for (size_t o = 0; o < channels_; ++o) {
+		multiply(&output_planes_[o * block_], limiter_gains_.data(), block_, level_);
+	}
+}
+
+}
+}
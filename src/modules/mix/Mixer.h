@@ -0,0 +1,163 @@
+/*!
+ * @file 		Mixer.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Mixing of several audio streams, aligned by their timestamps.
+ *
+ * Every input has its own FIFO, positioned on a common timeline (in samples,
+ * starting with the first pushed frame). Output is produced in fixed-size blocks,
+ * when all the running inputs cover the whole block, or when any input
+ * gets more than the maximal latency ahead (the missing samples are replaced by silence).
+ * Inputs lagging behind by more than the latency are considered stopped
+ * until they receive new samples.
+ *
+ * All buffers are allocated in advance, mixing a block doesn't allocate any memory.
+ */
+
+#ifndef MIXER_H_
+#define MIXER_H_
+
+#include "mix_kernels.h"
+#include "yuri/core/utils/time_types.h"
+#include <vector>
+
+namespace yuri {
+namespace mix {
+
+/*!
+ * Ring buffer of interleaved float samples
+ */
+class SampleFifo {
+public:
+	void reset(size_t channels, size_t capacity);
+	void clear() { head_ = 0; size_ = 0; }
+	size_t get_channels() const { return channels_; }
+	//! Number of stored frames (samples of all channels)
+	size_t size() const { return size_; }
+	size_t space() const { return capacity_ - size_; }
+	/*!
+	 * Stores interleaved samples
+	 * @return number of frames stored, limited by free space
+	 */
+	size_t push(const float* data, size_t frames);
+	//! Stores silence, @return number of frames stored
+	size_t push_silence(size_t frames);
+	//! Copies @em frames frames starting at @em offset into separate planes
+	void read_planar(size_t offset, size_t frames, float* planes, size_t plane_stride) const;
+	//! Removes frames from the beginning of the buffer
+	void drop(size_t frames);
+private:
+	template<class F>
+	size_t store(size_t frames, F f);
+	std::vector<float> data_;
+	size_t channels_ = 0;
+	size_t capacity_ = 0;
+	size_t head_ = 0;
+	size_t size_ = 0;
+};
+
+class Mixer {
+public:
+	/*!
+	 * @param channels Number of output channels
+	 * @param sampling_frequency Sampling frequency of all the inputs and output
+	 * @param block Number of frames in output block
+	 * @param latency Maximal number of frames an input can be ahead of the output
+	 * @param tolerance Maximal difference (in frames) between a timestamp and expected position
+	 * that's still considered continuous
+	 */
+	Mixer(size_t channels, size_t sampling_frequency, size_t block, size_t latency, size_t tolerance, simd_level_t level = get_supported_level());
+
+	void set_input_count(size_t count);
+	size_t get_input_count() const { return inputs_.size(); }
+
+	/*!
+	 * Stores interleaved samples of an input
+	 * @param channels Number of channels of the input (changing it resets the input)
+	 * @return Number of frames consumed. When lower than @em frames, the remaining samples
+	 * have to be pushed again after mixing available blocks.
+	 */
+	size_t push(size_t input, timestamp_t timestamp, const float* data, size_t frames, size_t channels);
+
+	//! Returns true when next block can be mixed
+	bool ready() const;
+
+	/*!
+	 * Mixes next block, if it's ready.
+	 * @param output Buffer for block * channels interleaved samples
+	 * @param timestamp Timestamp of the first sample of the block
+	 */
+	bool mix(float* output, timestamp_t& timestamp);
+
+	//! Master gain
+	void set_gain(float gain) { gain_ = gain; }
+	void set_input_gain(size_t input, float gain);
+	void set_input_mute(size_t input, bool mute);
+	/*!
+	 * Balance of an input for stereo output, -1.0 is left only, 1.0 right only
+	 */
+	void set_input_pan(size_t input, float pan);
+	void set_channel_gain(size_t channel, float gain);
+	/*!
+	 * Sets output channel for each of input channels, negative values drop the channel.
+	 * Empty map uses automatic mapping: mono inputs go to all channels,
+	 * other inputs map channel i to output i % channels.
+	 */
+	void set_channel_map(std::vector<int> map) { channel_map_ = std::move(map); }
+	/*!
+	 * Enables peak limiter
+	 * @param threshold Maximal output level
+	 * @param release Time (in frames) for the gain to recover by about 63%
+	 */
+	void set_limiter(bool enabled, float threshold, double release);
+
+	size_t get_channels() const { return channels_; }
+	size_t get_block() const { return block_; }
+private:
+	struct input_t {
+		SampleFifo fifo;
+		//! Timeline position of the first sample in the fifo
+		int64_t position = 0;
+		bool running = false;
+		float gain = 1.0f;
+		float pan = 0.0f;
+		bool mute = false;
+	};
+
+	bool is_mapped(size_t input_channel, size_t input_channels, size_t output) const;
+	void limit();
+
+	size_t channels_;
+	size_t sampling_frequency_;
+	size_t block_;
+	size_t latency_;
+	size_t tolerance_;
+	simd_level_t level_;
+	std::vector<input_t> inputs_;
+	bool started_ = false;
+	timestamp_t start_time_;
+	//! Timeline position of the next output block
+	int64_t output_position_ = 0;
+
+	float gain_ = 1.0f;
+	std::vector<float> channel_gains_;
+	std::vector<int> channel_map_;
+
+	bool limiter_ = false;
+	float threshold_ = 1.0f;
+	float release_ = 0.0f;
+	float envelope_ = 1.0f;
+
+	// Preallocated buffers for a single block
+	std::vector<float> input_planes_;
+	std::vector<float> output_planes_;
+	std::vector<float> limiter_gains_;
+};
+
+}
+}
+
+#endif /* MIXER_H_ */
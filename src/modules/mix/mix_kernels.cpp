@@ -0,0 +1,137 @@
+/*!
+ * @file 		mix_kernels.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "mix_kernels.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef YURI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace yuri {
+namespace mix {
+
+namespace {
+
+#ifdef YURI_SIMD_X86
+
+YURI_TARGET_SSE41
+size_t mix_add_sse41(float* dst, const float* src, float gain, size_t count)
+{
+	const __m128 g = _mm_set1_ps(gain);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t mix_add_avx2(float* dst, const float* src, float gain, size_t count)
+{
+	const __m256 g = _mm256_set1_ps(gain);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), g)));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t max_abs_sse41(float* peaks, const float* src, size_t count)
+{
+	const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(peaks + i, _mm_max_ps(_mm_loadu_ps(peaks + i), _mm_and_ps(_mm_loadu_ps(src + i), mask)));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t max_abs_avx2(float* peaks, const float* src, size_t count)
+{
+	const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_ps(peaks + i, _mm256_max_ps(_mm256_loadu_ps(peaks + i), _mm256_and_ps(_mm256_loadu_ps(src + i), mask)));
+	}
+	return i;
+}
+
+YURI_TARGET_SSE41
+size_t multiply_sse41(float* dst, const float* gains, size_t count)
+{
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(gains + i)));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t multiply_avx2(float* dst, const float* gains, size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(gains + i)));
+	}
+	return i;
+}
+
+#endif
+
+}
+
+void mix_add(float* dst, const float* src, float gain, size_t count, simd_level_t level)
+{
+	size_t i = 0;
+#ifdef YURI_SIMD_X86
+	if (level == simd_level_t::avx2) i = mix_add_avx2(dst, src, gain, count);
+	else if (level == simd_level_t::sse41) i = mix_add_sse41(dst, src, gain, count);
+#else
+	(void)level;
+#endif
+	for (; i < count; ++i) {
+		dst[i] += src[i] * gain;
+	}
+}
+
+void max_abs(float* peaks, const float* src, size_t count, simd_level_t level)
+{
+	size_t i = 0;
+#ifdef YURI_SIMD_X86
+	if (level == simd_level_t::avx2) i = max_abs_avx2(peaks, src, count);
+	else if (level == simd_level_t::sse41) i = max_abs_sse41(peaks, src, count);
+#else
+	(void)level;
+#endif
+	for (; i < count; ++i) {
+		peaks[i] = std::max(peaks[i], std::abs(src[i]));
+	}
+}
+
+void multiply(float* dst, const float* gains, size_t count, simd_level_t level)
+{
+	size_t i = 0;
+#ifdef YURI_SIMD_X86
+	if (level == simd_level_t::avx2) i = multiply_avx2(dst, gains, count);
+	else if (level == simd_level_t::sse41) i = multiply_sse41(dst, gains, count);
+#else
+	(void)level;
+#endif
+	for (; i < count; ++i) {
+		dst[i] *= gains[i];
+	}
+}
+
+}
+}
@@ -0,0 +1,36 @@
+/*!
+ * @file 		mix_kernels.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef MIX_KERNELS_H_
+#define MIX_KERNELS_H_
+
+#include "yuri/core/utils/cpu_features.h"
+#include <cstddef>
+#include <string>
+
+namespace yuri {
+namespace mix {
+
+using core::cpu::simd_level_t;
+using core::cpu::get_supported_level;
+using core::cpu::parse_level;
+
+//! dst[i] += src[i] * gain
+void mix_add(float* dst, const float* src, float gain, size_t count, simd_level_t level);
+
+//! peaks[i] = max(peaks[i], |src[i]|)
+void max_abs(float* peaks, const float* src, size_t count, simd_level_t level);
+
+//! dst[i] *= gains[i]
+void multiply(float* dst, const float* gains, size_t count, simd_level_t level);
+
+}
+}
+
+#endif /* MIX_KERNELS_H_ */
@@ -0,0 +1,232 @@
+/*!
+ * @file 		test_mixer.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "Mixer.h"
+#include <cmath>
+#include <random>
+
+namespace yuri {
+namespace mix {
+
+namespace {
+
+std::vector<simd_level_t> get_levels()
+{
+	std::vector<simd_level_t> levels = {simd_level_t::none};
+	if (get_supported_level() >= simd_level_t::sse41) levels.push_back(simd_level_t::sse41);
+	if (get_supported_level() >= simd_level_t::avx2) levels.push_back(simd_level_t::avx2);
+	return levels;
+}
+
+const size_t fs = 1000;
+
+timestamp_t at(timestamp_t start, int64_t frames)
+{
+	return start + duration_t{frames * 1000000 / static_cast<int64_t>(fs)};
+}
+
+}
+
+TEST_CASE("mix kernels") {
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+	const size_t count = 67;
+	std::vector<float> src(count), base(count), gains(count);
+	for (auto& v: src) v = dist(gen);
+	for (auto& v: base) v = dist(gen);
+	for (auto& v: gains) v = dist(gen);
+
+	std::vector<float> ref_add = base, ref_peaks(count, 0.5f), ref_mul = base;
+	mix_add(ref_add.data(), src.data(), 0.3f, count, simd_level_t::none);
+	max_abs(ref_peaks.data(), src.data(), count, simd_level_t::none);
+	multiply(ref_mul.data(), gains.data(), count, simd_level_t::none);
+	for (size_t i = 0; i < count; ++i) {
+		REQUIRE(ref_add[i] == base[i] + src[i] * 0.3f);
+		REQUIRE(ref_peaks[i] == std::max(0.5f, std::abs(src[i])));
+	}
+
+	for (auto level: get_levels()) {
+		std::vector<float> add = base, peaks(count, 0.5f), mul = base;
+		mix_add(add.data(), src.data(), 0.3f, count, level);
+		max_abs(peaks.data(), src.data(), count, level);
+		multiply(mul.data(), gains.data(), count, level);
+		REQUIRE(add == ref_add);
+		REQUIRE(peaks == ref_peaks);
+		REQUIRE(mul == ref_mul);
+	}
+}
+
+TEST_CASE("sample fifo") {
+	SampleFifo fifo;
+	fifo.reset(2, 5);
+	const float a[] = {1, 2, 3, 4, 5, 6};
+	REQUIRE(fifo.push(a, 3) == 3);
+	fifo.drop(2);
+	// Wraps around the end of the buffer
+	REQUIRE(fifo.push(a, 3) == 3);
+	REQUIRE(fifo.push_silence(5) == 1);
+	REQUIRE(fifo.size() == 5);
+	REQUIRE(fifo.space() == 0);
+	std::vector<float> planes(10);
+	fifo.read_planar(0, 5, planes.data(), 5);
+	REQUIRE(planes == std::vector<float>({5, 1, 3, 5, 0, 6, 2, 4, 6, 0}));
+}
+
+TEST_CASE("mixer alignment") {
+	const timestamp_t start;
+	Mixer mixer(1, fs, 4, 8, 1, simd_level_t::none);
+	mixer.set_input_count(2);
+	const std::vector<float> ones(8, 1.0f);
+	std::vector<float> out(4);
+	timestamp_t ts;
+
+	SECTION("blocks wait for all running inputs") {
+		REQUIRE(mixer.push(1, start, ones.data(), 2, 1) == 2);
+		REQUIRE(mixer.push(0, start, ones.data(), 6, 1) == 6);
+		REQUIRE(!mixer.mix(out.data(), ts));
+		REQUIRE(mixer.push(1, at(start, 2), ones.data(), 6, 1) == 6);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(ts == start);
+		REQUIRE(out == std::vector<float>({2, 2, 2, 2}));
+		REQUIRE(!mixer.mix(out.data(), ts));
+	}
+	SECTION("gaps are filled with silence") {
+		REQUIRE(mixer.push(0, start, ones.data(), 2, 1) == 2);
+		REQUIRE(mixer.push(0, at(start, 5), ones.data(), 3, 1) == 3);
+		REQUIRE(mixer.push(1, start, ones.data(), 8, 1) == 8);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out == std::vector<float>({2, 2, 1, 1}));
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(ts == at(start, 4));
+		REQUIRE(out == std::vector<float>({1, 2, 2, 2}));
+	}
+	SECTION("small jitter is considered continuous") {
+		REQUIRE(mixer.push(0, start, ones.data(), 2, 1) == 2);
+		REQUIRE(mixer.push(0, at(start, 3), ones.data(), 2, 1) == 2);
+		REQUIRE(mixer.push(1, start, ones.data(), 4, 1) == 4);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out == std::vector<float>({2, 2, 2, 2}));
+	}
+	SECTION("stalled input is bounded by latency") {
+		REQUIRE(mixer.push(1, start, ones.data(), 1, 1) == 1);
+		REQUIRE(mixer.push(0, start, ones.data(), 8, 1) == 8);
+		REQUIRE(!mixer.mix(out.data(), ts));
+		// Input 0 gets more than latency ahead, blocks are mixed without waiting for input 1
+		REQUIRE(mixer.push(0, at(start, 8), ones.data(), 4, 1) == 4);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out == std::vector<float>({2, 1, 1, 1}));
+		REQUIRE(!mixer.mix(out.data(), ts));
+		REQUIRE(mixer.push(0, at(start, 12), ones.data(), 4, 1) == 4);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(mixer.push(0, at(start, 16), ones.data(), 4, 1) == 4);
+		REQUIRE(mixer.mix(out.data(), ts));
+		// Input 1 lags more than latency now and is no longer waited for
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(ts == at(start, 16));
+		REQUIRE(!mixer.mix(out.data(), ts));
+		// Samples for already mixed blocks are dropped
+		REQUIRE(mixer.push(1, at(start, 4), ones.data(), 8, 1) == 8);
+		REQUIRE(!mixer.mix(out.data(), ts));
+	}
+	SECTION("full fifo limits consumed samples") {
+		std::vector<float> long_input(32, 1.0f);
+		REQUIRE(mixer.push(0, start, long_input.data(), 32, 1) == 16);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(mixer.push(0, at(start, 16), long_input.data(), 16, 1) == 4);
+	}
+}
+
+TEST_CASE("mixer gains") {
+	const timestamp_t start;
+	Mixer mixer(2, fs, 4, 8, 1, simd_level_t::none);
+	mixer.set_input_count(2);
+	const std::vector<float> mono(4, 1.0f);
+	const std::vector<float> stereo = {1, -1, 1, -1, 1, -1, 1, -1};
+	std::vector<float> out(8);
+	timestamp_t ts;
+
+	mixer.set_input_gain(0, 0.5f);
+	mixer.set_channel_gain(1, 2.0f);
+	SECTION("gains") {
+		mixer.push(0, start, mono.data(), 4, 1);
+		mixer.push(1, start, stereo.data(), 4, 2);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out[0] == 1.5f);
+		REQUIRE(out[1] == -1.0f);
+	}
+	SECTION("mute") {
+		mixer.set_input_mute(1, true);
+		mixer.push(0, start, mono.data(), 4, 1);
+		mixer.push(1, start, stereo.data(), 4, 2);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out[0] == 0.5f);
+		REQUIRE(out[1] == 1.0f);
+	}
+	SECTION("pan") {
+		mixer.set_input_pan(0, -1.0f);
+		mixer.set_input_pan(1, 0.5f);
+		mixer.push(0, start, mono.data(), 4, 1);
+		mixer.push(1, start, stereo.data(), 4, 2);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out[0] == 1.0f);
+		REQUIRE(out[1] == -2.0f);
+	}
+}
+
+TEST_CASE("mixer channel map") {
+	const timestamp_t start;
+	Mixer mixer(2, fs, 4, 8, 1, simd_level_t::none);
+	std::vector<float> input(8 * 4);
+	for (size_t i = 0; i < 4; ++i) {
+		for (size_t c = 0; c < 8; ++c) input[i * 8 + c] = static_cast<float>(1 << c);
+	}
+	std::vector<float> out(8);
+	timestamp_t ts;
+
+	SECTION("automatic") {
+		mixer.push(0, start, input.data(), 4, 8);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out[0] == 1 + 4 + 16 + 64);
+		REQUIRE(out[1] == 2 + 8 + 32 + 128);
+	}
+	SECTION("explicit") {
+		mixer.set_channel_map({0, 1, 0, 1, -1, -1, 1, -1});
+		mixer.push(0, start, input.data(), 4, 8);
+		REQUIRE(mixer.mix(out.data(), ts));
+		REQUIRE(out[0] == 1 + 4);
+		REQUIRE(out[1] == 2 + 8 + 64);
+	}
+}
+
+TEST_CASE("mixer limiter") {
+	const timestamp_t start;
+	for (auto level: get_levels()) {
+		Mixer mixer(1, fs, 16, 16, 1, level);
+		mixer.set_limiter(true, 0.5f, 4.0);
+		std::vector<float> input(16, 0.25f);
+		input[4] = 2.0f;
+		input[5] = -1.0f;
+		std::vector<float> out(16);
+		timestamp_t ts;
+		mixer.push(0, start, input.data(), 16, 1);
+		REQUIRE(mixer.mix(out.data(), ts));
+		for (auto v: out) REQUIRE(std::abs(v) <= 0.5f + 1e-6f);
+		REQUIRE(out[0] == 0.25f);
+		REQUIRE(out[4] == Approx(0.5f));
+		// Gain recovers after the peak
+		REQUIRE(out[5] > -0.5f);
+		REQUIRE(out[6] < out[15]);
+		REQUIRE(out[15] > 0.2f);
+	}
+}
+
+}
+}
@@ -12,6 +12,7 @@
 #include "yuri/event/EventHelpers.h"
 //#include "yuri/core/frame/raw_frame_params.h"
 #include "yuri/core/frame/raw_frame_types.h"
+#include <algorithm>
 #include <cassert>
 namespace yuri {
 namespace overlay {
@@ -29,13 +30,15 @@ core::Parameters Overlay::configure()
 //	p->set_max_pipes(1,1);
 	p["x"]["X offset"]=0;
 	p["y"]["Y offset"]=0;
+	p["simd"]["Instruction set to use for blending (auto, avx2, sse2, none)"]="auto";
+	p["threads"]["Number of threads to use for blending. Use 0 to select it automatically from overlay size."]=0;
 	return p;
 }
 
 
 Overlay::Overlay(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
 		SpecializedMultiIOFilter<core::RawVideoFrame, core::RawVideoFrame>(log_,parent,1,std::string("overlay")),
-event::BasicEventConsumer(log)
+event::BasicEventConsumer(log),x_(0),y_(0),simd_level_(get_supported_level()),threads_(0)
 {
 	IOTHREAD_INIT(parameters)
 }
@@ -45,6 +48,9 @@ Overlay::~Overlay() noexcept
 }
 
 namespace {
+// Plans for different positions or base formats kept at once
+const size_t max_cached_plans = 4;
+
 using namespace core::raw_format;
 /*!
  * @tparam	s	- bytes per input (background image) pixel
@@ -483,8 +489,8 @@ core::pRawVideoFrame Overlay::combine(core::pRawVideoFrame frame_0, const core::
 	const ssize_t			x			= x_ - (x_ % step);
 	log[log::verbose_debug] << "Base " << width << "x" << height << " (" << linesize_0 << ") + " << w << "x" <<h << " (" << linesize_1 << ") -> ("<<linesize_out<<")";
 	auto 		outframe 	= get_out_frame<rewrite>(frame_0, kernel::output_format(), res_0);
-	const plane_t::const_iterator src 		= PLANE_DATA(frame_0,0).begin();
-	const plane_t::const_iterator overlay 	= PLANE_DATA(frame_1,0).begin();
+	const plane_t::const_iterator src 		= PLANE_CONST_DATA(frame_0,0).begin();
+	const plane_t::const_iterator overlay 	= PLANE_CONST_DATA(frame_1,0).begin();
 	const plane_t::iterator 	  dest 		= PLANE_DATA(outframe,0).begin();
 	ssize_t line = 0;
 	if (y_ > 0) {
@@ -523,6 +529,55 @@ core::pRawVideoFrame Overlay::combine(core::pRawVideoFrame frame_0, const core::
 	}
 	return outframe;
 }
+/*!
+ * Blends the overlay directly into the base frame, keeping its format.
+ * Returns empty pointer when the formats are not supported, so the generic kernels are used instead.
+ */
+core::pRawVideoFrame Overlay::blend(const core::pRawVideoFrame& frame_0, const core::pRawVideoFrame& frame_1)
+{
+	const format_t format = frame_0->get_format();
+	const resolution_t res = frame_0->get_resolution();
+	auto it = std::find_if(plans_.begin(), plans_.end(), [&](const std::shared_ptr<BlendPlan>& plan) {
+		return plan->matches(frame_1, format, res, x_, y_);
+	});
+	if (it != plans_.end()) {
+		std::rotate(plans_.begin(), it, it + 1);
+	} else {
+		const auto formats = std::make_pair(frame_1->get_format(), format);
+		if (unsupported_formats_.count(formats)) return {};
+		auto plan = create_plan(frame_0, frame_1);
+		if (!plan) {
+			log[log::debug] << "Overlay in " << core::raw_format::get_format_name(formats.first) << " can't be blended directly into "
+					<< core::raw_format::get_format_name(formats.second) << ", using generic kernels";
+			unsupported_formats_.insert(formats);
+			return {};
+		}
+		plans_.insert(plans_.begin(), std::move(plan));
+		if (plans_.size() > max_cached_plans) plans_.pop_back();
+	}
+	auto outframe = get_frame_unique(frame_0);
+	plans_.front()->blend(*outframe, simd_level_, threads_);
+	return outframe;
+}
+
+std::shared_ptr<BlendPlan> Overlay::create_plan(const core::pRawVideoFrame& frame_0, const core::pRawVideoFrame& frame_1)
+{
+	const format_t format = frame_0->get_format();
+	const format_t overlay_format = get_overlay_format(format);
+	if (!overlay_format) return {};
+	const auto& info = core::raw_format::get_format_info(frame_1->get_format());
+	if (info.planes.size() != 1 || info.planes[0].components.find('A') == std::string::npos) return {};
+	core::pRawVideoFrame overlay = frame_1;
+	if (frame_1->get_format() != overlay_format) {
+		if (!converter_) {
+			converter_.reset(new core::Convert(log, get_this_ptr(), core::Convert::configure()));
+			add_child(converter_);
+		}
+		overlay = std::dynamic_pointer_cast<core::RawVideoFrame>(converter_->convert_frame(frame_1, overlay_format));
+	}
+	return BlendPlan::create(frame_1, overlay, format, frame_0->get_resolution(), x_, y_);
+}
+
 std::vector<core::pFrame> Overlay::do_special_step(param_type frames)
 {
 	process_events();
@@ -530,7 +585,8 @@ std::vector<core::pFrame> Overlay::do_special_step(param_type frames)
 	core::pRawVideoFrame f1 = std::move(std::get<1>(frames));
 	std::get<0>(frames).reset();
 	if (!f0 || !f1) return {};
-	core::pRawVideoFrame outframe = dispatch(*this, std::move(f0), f1);
+	core::pRawVideoFrame outframe = blend(f0, f1);
+	if (!outframe) outframe = dispatch(*this, std::move(f0), f1);
 	if (outframe) {
 		return {std::move(outframe)};
 	}
@@ -543,6 +599,10 @@ bool Overlay::set_param(const core::Parameter& param)
 		x_ = param.get<ssize_t>();
 	} else if (iequals(param.get_name(),"y")) {
 		y_ = param.get<ssize_t>();
+	} else if (iequals(param.get_name(),"simd")) {
+		simd_level_ = parse_level(param.get<std::string>());
+	} else if (iequals(param.get_name(),"threads")) {
+		threads_ = param.get<size_t>();
 	} else return core::MultiIOFilter::set_param(param);
 	return true;
 }
@@ -14,6 +14,9 @@
 #include "yuri/core/thread/SpecializedMultiIOFilter.h"
 #include "yuri/event/BasicEventConsumer.h"
 #include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/thread/Convert.h"
+#include "blend.h"
+#include <set>
 namespace yuri {
 namespace overlay {
 
@@ -33,10 +36,19 @@ private:
 	virtual std::vector<core::pFrame> do_special_step(param_type) override;
 	virtual bool set_param(const core::Parameter& param) override;
 	virtual bool do_process_event(const std::string& event_name, const event::pBasicEvent& event) override;
+	core::pRawVideoFrame blend(const core::pRawVideoFrame& frame_0, const core::pRawVideoFrame& frame_1);
+	std::shared_ptr<BlendPlan> create_plan(const core::pRawVideoFrame& frame_0, const core::pRawVideoFrame& frame_1);
 //	core::pBasicFrame frame_0;
 //	core::pBasicFrame frame_1;
 	ssize_t x_;
 	ssize_t y_;
+	simd_level_t simd_level_;
+	size_t threads_;
+	//! Recently used plans, the most recent first
+	std::vector<std::shared_ptr<BlendPlan>> plans_;
+	//! Pairs of overlay and base formats, that can't be blended directly
+	std::set<std::pair<format_t, format_t>> unsupported_formats_;
+	core::pConvert converter_;
 };
 
 } /* namespace overlay */
@@ -0,0 +1,309 @@
+/*!
+ * @file 		blend.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "blend.h"
+#include "yuri/core/frame/raw_frame_params.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/thread/WorkerPool.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef YURI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace yuri {
+namespace overlay {
+
+namespace {
+
+// Transparent gaps shorter than this are blended rather than splitting the span
+const size_t min_span_gap = 32;
+
+const uint8_t* get_source_data(const core::pFrame& source)
+{
+	const auto raw = std::dynamic_pointer_cast<core::RawVideoFrame>(source);
+	if (!raw || !raw->get_planes_count()) return nullptr;
+	return PLANE_CONST_RAW_DATA(raw, 0);
+}
+
+/*
+ * Blending computes dest * inverse_alpha / 255 with rounding as ((t + (t >> 8)) >> 8), where t = dest * inverse_alpha + 128,
+ * which is exact for all 8bit values and fits into 16 bits.
+ * Every SIMD operation has its scalar counterpart, so all implementations give bit exact results.
+ */
+void blend_scalar(uint8_t* dest, const uint8_t* premultiplied, const uint8_t* inverse_alpha, size_t start, size_t count)
+{
+	for (size_t i = start; i < count; ++i) {
+		const unsigned t = dest[i] * inverse_alpha[i] + 128;
+		const unsigned value = ((t + (t >> 8)) >> 8) + premultiplied[i];
+		dest[i] = static_cast<uint8_t>(std::min(value, 255u));
+	}
+}
+
+#ifdef YURI_SIMD_X86
+YURI_TARGET_SSE2
+size_t blend_sse2(uint8_t* dest, const uint8_t* premultiplied, const uint8_t* inverse_alpha, size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i round = _mm_set1_epi16(128);
+	size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dest + i));
+		const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(premultiplied + i));
+		const __m128i ia = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inverse_alpha + i));
+		__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(ia, zero)), round);
+		__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(ia, zero)), round);
+		lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_adds_epu8(_mm_packus_epi16(lo, hi), p));
+	}
+	return i;
+}
+
+YURI_TARGET_AVX2
+size_t blend_avx2(uint8_t* dest, const uint8_t* premultiplied, const uint8_t* inverse_alpha, size_t count)
+{
+	// Unpacking and packing works within 128bit lanes, so the order of bytes is preserved
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i round = _mm256_set1_epi16(128);
+	size_t i = 0;
+	for (; i + 32 <= count; i += 32) {
+		const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dest + i));
+		const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(premultiplied + i));
+		const __m256i ia = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inverse_alpha + i));
+		__m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(ia, zero)), round);
+		__m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(ia, zero)), round);
+		lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+		hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_adds_epu8(_mm256_packus_epi16(lo, hi), p));
+	}
+	return i;
+}
+#endif
+
+ssize_t floor_div(ssize_t a, ssize_t b)
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+ssize_t ceil_div(ssize_t a, ssize_t b)
+{
+	return -floor_div(-a, b);
+}
+
+//! Index of the component in the overlay (rgba32 or yuva4444)
+int component_index(char component)
+{
+	switch (component) {
+		case 'R': case 'Y': return 0;
+		case 'G': case 'U': return 1;
+		case 'B': case 'V': return 2;
+		case 'A': return 3;
+		default: return -1;
+	}
+}
+
+//! Number of pixels in the repeating group of components of a plane, 0 for unsupported planes
+size_t group_pixels(const core::raw_format::plane_info_t& plane)
+{
+	const size_t bits = plane.components.size() * 8;
+	if (plane.components.empty() || plane.component_bit_depths.size() != plane.components.size()) return 0;
+	if (std::any_of(plane.component_bit_depths.begin(), plane.component_bit_depths.end(), [](size_t d){ return d != 8; })) return 0;
+	if (!plane.bit_depth.first || (bits * plane.bit_depth.second) % plane.bit_depth.first) return 0;
+	return bits * plane.bit_depth.second / plane.bit_depth.first;
+}
+
+void find_spans(BlendPlan::plane_t& plane)
+{
+	plane.spans.resize(plane.lines);
+	for (size_t line = 0; line < plane.lines; ++line) {
+		const uint8_t* ia = &plane.inverse_alpha[line * plane.line_bytes];
+		auto& spans = plane.spans[line];
+		for (size_t i = 0; i < plane.line_bytes; ++i) {
+			if (ia[i] == 255) continue;
+			if (!spans.empty() && i - spans.back().end < min_span_gap) {
+				spans.back().end = i + 1;
+			} else {
+				spans.push_back({i, i + 1});
+			}
+		}
+	}
+}
+
+}
+
+void blend_bytes(simd_level_t level, uint8_t* dest, const uint8_t* premultiplied, const uint8_t* inverse_alpha, size_t count)
+{
+	size_t done = 0;
+#ifdef YURI_SIMD_X86
+	if (level == simd_level_t::avx2) {
+		done = blend_avx2(dest, premultiplied, inverse_alpha, count);
+	} else if (level >= simd_level_t::sse2) {
+		done = blend_sse2(dest, premultiplied, inverse_alpha, count);
+	}
+#else
+	(void)level;
+#endif
+	blend_scalar(dest, premultiplied, inverse_alpha, done, count);
+}
+
+format_t get_overlay_format(format_t base_format)
+{
+	try {
+		const auto& info = core::raw_format::get_format_info(base_format);
+		if (info.planes.empty()) return 0;
+		bool rgb = true, yuv = true;
+		for (const auto& p: info.planes) {
+			if (!group_pixels(p)) return 0;
+			for (auto c: p.components) {
+				rgb = rgb && (c == 'R' || c == 'G' || c == 'B' || c == 'A');
+				yuv = yuv && (c == 'Y' || c == 'U' || c == 'V' || c == 'A');
+			}
+		}
+		if (rgb) return core::raw_format::rgba32;
+		if (yuv) return core::raw_format::yuva4444;
+	}
+	catch (std::runtime_error&) {}
+	return 0;
+}
+
+BlendPlan::BlendPlan(const core::pFrame& source, format_t base_format, resolution_t base_res, ssize_t x, ssize_t y)
+:source_(source),source_data_(get_source_data(source)),base_format_(base_format),base_res_(base_res),x_(x),y_(y)
+{
+}
+
+bool BlendPlan::matches(const core::pFrame& source, format_t base_format, resolution_t base_res, ssize_t x, ssize_t y) const
+{
+	if (base_format != base_format_ || base_res != base_res_ || x != x_ || y != y_ || !source) return false;
+	if (source == source_) return true;
+	return source_data_ && source->get_format() == source_->get_format()
+			&& get_source_data(source) == source_data_;
+}
+
+std::shared_ptr<BlendPlan> BlendPlan::create(const core::pFrame& source, const core::pRawVideoFrame& overlay,
+		format_t base_format, resolution_t base_res, ssize_t x, ssize_t y)
+{
+	if (!overlay || overlay->get_format() != get_overlay_format(base_format)) return {};
+	const auto& info = core::raw_format::get_format_info(base_format);
+	std::shared_ptr<BlendPlan> plan(new BlendPlan(source, base_format, base_res, x, y));
+
+	// Cells of subsampled planes at the edges may be covered only partially
+	const ssize_t ox = x;
+	const ssize_t oy = y;
+
+	// Premultiplied overlay, 4 bytes per pixel
+	const resolution_t ores = overlay->get_resolution();
+	const ssize_t ow = ores.width;
+	const ssize_t oh = ores.height;
+	const size_t olinesize = PLANE_DATA(overlay, 0).get_line_size();
+	const uint8_t* odata = PLANE_CONST_RAW_DATA(overlay, 0);
+	std::vector<uint8_t> pre(ow * oh * 4);
+	for (ssize_t line = 0; line < oh; ++line) {
+		const uint8_t* in = odata + line * olinesize;
+		uint8_t* out = &pre[line * ow * 4];
+		for (ssize_t i = 0; i < ow; ++i, in += 4, out += 4) {
+			const unsigned a = in[3];
+			out[0] = static_cast<uint8_t>((in[0] * a + 127) / 255);
+			out[1] = static_cast<uint8_t>((in[1] * a + 127) / 255);
+			out[2] = static_cast<uint8_t>((in[2] * a + 127) / 255);
+			out[3] = static_cast<uint8_t>(a);
+		}
+	}
+
+	for (const auto& p: info.planes) {
+		// Every plane consists of cells of cell_w x cell_h pixels, represented by group_bytes bytes
+		const ssize_t gp = group_pixels(p);
+		const size_t group_bytes = p.components.size();
+		const ssize_t sub_x = p.sub_x;
+		const ssize_t cell_w = gp * sub_x;
+		const ssize_t cell_h = p.sub_y;
+		const resolution_t plane_res = std::get<2>(core::RawVideoFrame::get_plane_params(p, base_res));
+		const ssize_t cells_x = (static_cast<ssize_t>(plane_res.width) + gp - 1) / gp;
+		const ssize_t cells_y = plane_res.height;
+		const ssize_t cx0 = std::max<ssize_t>(0, floor_div(ox, cell_w));
+		const ssize_t cx1 = std::min<ssize_t>(cells_x, ceil_div(ox + ow, cell_w));
+		const ssize_t cy0 = std::max<ssize_t>(0, floor_div(oy, cell_h));
+		const ssize_t cy1 = std::min<ssize_t>(cells_y, ceil_div(oy + oh, cell_h));
+
+		plane_t plane;
+		plane.x_bytes = cx0 * group_bytes;
+		plane.first_line = cy0;
+		plane.line_bytes = cx1 > cx0 ? (cx1 - cx0) * group_bytes : 0;
+		plane.lines = cy1 > cy0 && plane.line_bytes ? cy1 - cy0 : 0;
+		plane.premultiplied.resize(plane.line_bytes * plane.lines);
+		plane.inverse_alpha.resize(plane.line_bytes * plane.lines);
+
+		// For every byte of the group: component index and the columns of the cell it covers.
+		// Components present once per pixel belong to a single column, others cover whole cell.
+		struct byte_info_t { int index; ssize_t col_begin; ssize_t col_end; };
+		std::vector<byte_info_t> bytes;
+		for (size_t b = 0; b < group_bytes; ++b) {
+			const char c = p.components[b];
+			const ssize_t count = std::count(p.components.begin(), p.components.end(), c);
+			const ssize_t occurrence = std::count(p.components.begin(), p.components.begin() + b, c);
+			if (component_index(c) < 0) return {};
+			if (count == gp) bytes.push_back({component_index(c), occurrence * sub_x, (occurrence + 1) * sub_x});
+			else bytes.push_back({component_index(c), 0, cell_w});
+		}
+
+		for (size_t line = 0; line < plane.lines; ++line) {
+			const ssize_t cy = cy0 + line;
+			uint8_t* pm = &plane.premultiplied[line * plane.line_bytes];
+			uint8_t* ia = &plane.inverse_alpha[line * plane.line_bytes];
+			for (ssize_t cx = cx0; cx < cx1; ++cx) {
+				for (const auto& b: bytes) {
+					unsigned sum_value = 0, sum_alpha = 0;
+					const unsigned n = (b.col_end - b.col_begin) * cell_h;
+					for (ssize_t row = 0; row < cell_h; ++row) {
+						const ssize_t py = cy * cell_h + row - oy;
+						if (py < 0 || py >= oh) continue;
+						for (ssize_t col = b.col_begin; col < b.col_end; ++col) {
+							const ssize_t px = cx * cell_w + col - ox;
+							if (px < 0 || px >= ow) continue;
+							const uint8_t* pix = &pre[(py * ow + px) * 4];
+							sum_value += pix[b.index];
+							sum_alpha += pix[3];
+						}
+					}
+					*pm++ = static_cast<uint8_t>((sum_value + n / 2) / n);
+					*ia++ = static_cast<uint8_t>(255 - (sum_alpha + n / 2) / n);
+				}
+			}
+		}
+		find_spans(plane);
+		plan->planes_.push_back(std::move(plane));
+	}
+	return plan;
+}
+
+void BlendPlan::blend(core::RawVideoFrame& frame, simd_level_t level, size_t threads) const
+{
+	for (size_t i = 0; i < planes_.size(); ++i) {
+		const auto& plane = planes_[i];
+		if (!plane.lines) continue;
+		auto& data = frame[i];
+		const size_t linesize = data.get_line_size();
+		uint8_t* dest = &data[0];
+		core::parallel_for_lines(plane.lines, plane.line_bytes * 3, threads, [&](size_t begin, size_t end) {
+			for (size_t line = begin; line < end; ++line) {
+				uint8_t* row = dest + (plane.first_line + line) * linesize + plane.x_bytes;
+				const size_t offset = line * plane.line_bytes;
+				for (const auto& span: plane.spans[line]) {
+					blend_bytes(level, row + span.begin, &plane.premultiplied[offset + span.begin],
+							&plane.inverse_alpha[offset + span.begin], span.end - span.begin);
+				}
+			}
+		});
+	}
+}
+
+}
+}
@@ -0,0 +1,105 @@
+/*!
+ * @file 		blend.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Alpha blending of an overlay into frames in place.
+ *
+ * Overlay is premultiplied and rearranged into the layout of the base frame once
+ * (for every plane a line of premultiplied values and a line of inverse alpha for
+ * every byte), so blending itself is the same operation for every byte of any 8bit format:
+ * dest = premultiplied + dest * (255 - alpha) / 255. Subsampled components of the base
+ * (chroma in YUV 4:2:2 or 4:2:0) are blended with the overlay averaged over the subsampled area.
+ * Transparent parts of the overlay are skipped using a list of non-transparent spans for every line.
+ */
+
+#ifndef BLEND_H_
+#define BLEND_H_
+
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/utils/cpu_features.h"
+#include <vector>
+
+namespace yuri {
+namespace overlay {
+
+using core::cpu::simd_level_t;
+using core::cpu::get_supported_level;
+using core::cpu::parse_level;
+
+/*!
+ * Blends @em count bytes of @em dest with premultiplied values and inverse alpha
+ */
+void blend_bytes(simd_level_t level, uint8_t* dest, const uint8_t* premultiplied, const uint8_t* inverse_alpha, size_t count);
+
+/*!
+ * Returns format with alpha the overlay has to be converted to before blending into @em base_format.
+ * (rgba32 for RGB formats, yuva4444 for YUV formats) or 0 if the base format is not supported.
+ */
+format_t get_overlay_format(format_t base_format);
+
+/*!
+ * Overlay prepared for blending into frames with specified format, resolution and position.
+ */
+class BlendPlan {
+public:
+	/*!
+	 * Prepares the overlay.
+	 * The position doesn't have to be aligned to the subsampling of the base format.
+	 * Luma is always placed exactly, chroma samples covered by the overlay only partially
+	 * are blended with alpha averaged over the whole sample (the uncovered part is transparent).
+	 * @param source Original overlay frame, used only to identify the overlay in matches()
+	 * @param overlay Overlay in format returned by get_overlay_format()
+	 * @return Prepared overlay, or empty pointer if the formats are not supported
+	 */
+	static std::shared_ptr<BlendPlan> create(const core::pFrame& source, const core::pRawVideoFrame& overlay,
+			format_t base_format, resolution_t base_res, ssize_t x, ssize_t y);
+
+	/*!
+	 * Returns true if the plan was created for the overlay, base frame and position.
+	 * Overlays sharing data with the original one (e.g. its copies) match as well.
+	 */
+	bool matches(const core::pFrame& source, format_t base_format, resolution_t base_res, ssize_t x, ssize_t y) const;
+
+	/*!
+	 * Blends the overlay into @em frame. The frame has to be writable.
+	 */
+	void blend(core::RawVideoFrame& frame, simd_level_t level, size_t threads) const;
+
+	//! Byte range of a line, that is not fully transparent
+	struct span_t {
+		size_t begin;
+		size_t end;
+	};
+
+	struct plane_t {
+		//! Offset of the overlay in the plane, in bytes
+		size_t					x_bytes;
+		//! First line of the plane covered by the overlay
+		size_t					first_line;
+		size_t					line_bytes;
+		size_t					lines;
+		std::vector<uint8_t>	premultiplied;
+		std::vector<uint8_t>	inverse_alpha;
+		std::vector<std::vector<span_t>> spans;
+	};
+
+private:
+	BlendPlan(const core::pFrame& source, format_t base_format, resolution_t base_res, ssize_t x, ssize_t y);
+
+	core::pFrame			source_;
+	//! Data of the source, the source is kept alive, so no other frame can get the same buffer
+	const uint8_t*			source_data_;
+	format_t				base_format_;
+	resolution_t			base_res_;
+	ssize_t					x_;
+	ssize_t					y_;
+	std::vector<plane_t>	planes_;
+};
+
+}
+}
+
+#endif /* BLEND_H_ */
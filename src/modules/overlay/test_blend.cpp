@@ -0,0 +1,249 @@
+/*!
+ * @file 		test_blend.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "blend.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <cmath>
+#include <random>
+
+namespace yuri {
+namespace overlay {
+
+namespace {
+
+std::vector<simd_level_t> get_levels()
+{
+	std::vector<simd_level_t> levels = { simd_level_t::none, simd_level_t::sse2, simd_level_t::avx2 };
+	while (levels.back() > get_supported_level()) levels.pop_back();
+	return levels;
+}
+
+core::pRawVideoFrame make_random_frame(format_t format, resolution_t res, unsigned seed)
+{
+	std::mt19937 gen(seed);
+	std::uniform_int_distribution<int> dist(0, 255);
+	auto frame = core::RawVideoFrame::create_empty(format, res);
+	for (auto& plane: *frame) {
+		for (auto& v: plane) {
+			v = static_cast<uint8_t>(dist(gen));
+		}
+	}
+	return frame;
+}
+
+core::pRawVideoFrame make_flat_frame(format_t format, resolution_t res, std::vector<uint8_t> values)
+{
+	auto frame = core::RawVideoFrame::create_empty(format, res);
+	for (auto& plane: *frame) {
+		for (size_t i = 0; i < plane.size(); ++i) {
+			plane[i] = values[i % values.size()];
+		}
+	}
+	return frame;
+}
+
+bool frames_equal(const core::pRawVideoFrame& a, const core::pRawVideoFrame& b)
+{
+	for (size_t i = 0; i < a->get_planes_count(); ++i) {
+		const auto& pa = PLANE_DATA(a, i);
+		const auto& pb = PLANE_DATA(b, i);
+		if (pa.size() != pb.size() || !std::equal(pa.begin(), pa.end(), pb.begin())) return false;
+	}
+	return true;
+}
+
+core::pRawVideoFrame blend_copy(const BlendPlan& plan, const core::pRawVideoFrame& frame, simd_level_t level, size_t threads)
+{
+	auto out = std::dynamic_pointer_cast<core::RawVideoFrame>(frame->get_copy());
+	out->make_writable();
+	plan.blend(*out, level, threads);
+	return out;
+}
+
+}
+
+TEST_CASE("Blending bytes", "[overlay]")
+{
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> dist(0, 255);
+	const size_t count = 1000;
+	std::vector<uint8_t> dest(count), premultiplied(count), inverse_alpha(count);
+	for (size_t i = 0; i < count; ++i) {
+		dest[i] = dist(gen);
+		inverse_alpha[i] = dist(gen);
+		premultiplied[i] = std::uniform_int_distribution<int>(0, 255 - inverse_alpha[i])(gen);
+	}
+	std::vector<uint8_t> expected = dest;
+	blend_bytes(simd_level_t::none, expected.data(), premultiplied.data(), inverse_alpha.data(), count);
+	for (size_t i = 0; i < count; ++i) {
+		const double reference = premultiplied[i] + dest[i] * inverse_alpha[i] / 255.0;
+		REQUIRE(std::abs(expected[i] - reference) <= 0.5);
+	}
+	for (auto level: get_levels()) {
+		// Odd count and offset to exercise the scalar tail and unaligned access
+		std::vector<uint8_t> result = dest;
+		blend_bytes(level, result.data() + 1, premultiplied.data() + 1, inverse_alpha.data() + 1, count - 2);
+		REQUIRE(std::equal(result.begin() + 1, result.end() - 1, expected.begin() + 1));
+		REQUIRE(result.front() == dest.front());
+		REQUIRE(result.back() == dest.back());
+	}
+}
+
+TEST_CASE("Overlay formats", "[overlay]")
+{
+	using namespace core::raw_format;
+	REQUIRE(get_overlay_format(rgb24) == rgba32);
+	REQUIRE(get_overlay_format(abgr32) == rgba32);
+	REQUIRE(get_overlay_format(yuyv422) == yuva4444);
+	REQUIRE(get_overlay_format(yuv420p) == yuva4444);
+	REQUIRE(get_overlay_format(rgb_r10k_le) == 0);
+}
+
+TEST_CASE("Blending RGBA matches floating point reference", "[overlay]")
+{
+	using namespace core::raw_format;
+	const auto base = make_random_frame(rgba32, {64, 32}, 1);
+	const auto overlay = make_random_frame(rgba32, {20, 10}, 2);
+	const ssize_t x = 50, y = 25;
+	const auto plan = BlendPlan::create(overlay, overlay, rgba32, base->get_resolution(), x, y);
+	REQUIRE(plan);
+	const auto out = blend_copy(*plan, base, simd_level_t::none, 1);
+	const auto& b = PLANE_DATA(base, 0);
+	const auto& o = PLANE_DATA(overlay, 0);
+	const auto& r = PLANE_DATA(out, 0);
+	for (ssize_t line = 0; line < 32; ++line) {
+		for (ssize_t col = 0; col < 64; ++col) {
+			for (ssize_t c = 0; c < 4; ++c) {
+				const size_t idx = (line * 64 + col) * 4 + c;
+				if (line < y || col < x) {
+					REQUIRE(r[idx] == b[idx]);
+					continue;
+				}
+				const size_t oidx = ((line - y) * 20 + col - x) * 4;
+				const double alpha = o[oidx + 3] / 255.0;
+				const double reference = (c == 3 ? 255 : o[oidx + c]) * alpha + b[idx] * (1.0 - alpha);
+				INFO("line " << line << ", column " << col << ", component " << c);
+				REQUIRE(std::abs(r[idx] - reference) <= 1.5);
+			}
+		}
+	}
+}
+
+TEST_CASE("Transparent overlay keeps the frame", "[overlay]")
+{
+	using namespace core::raw_format;
+	const auto overlay = make_flat_frame(rgba32, {16, 16}, {10, 20, 30, 0});
+	for (auto format: {rgb24, bgr24, yuyv422, yuv420p}) {
+		const auto conv_format = get_overlay_format(format);
+		const auto ovr = conv_format == rgba32 ? overlay : make_flat_frame(yuva4444, {16, 16}, {10, 20, 30, 0});
+		const auto base = make_random_frame(format, {40, 30}, 3);
+		const auto plan = BlendPlan::create(ovr, ovr, format, base->get_resolution(), 4, 4);
+		REQUIRE(plan);
+		REQUIRE(frames_equal(base, blend_copy(*plan, base, get_supported_level(), 0)));
+	}
+}
+
+TEST_CASE("Opaque overlay replaces subsampled formats", "[overlay]")
+{
+	using namespace core::raw_format;
+	const auto overlay = make_flat_frame(yuva4444, {8, 4}, {100, 50, 200, 255});
+	SECTION("yuyv") {
+		const auto base = make_flat_frame(yuyv422, {16, 8}, {1, 2, 3, 4});
+		const auto plan = BlendPlan::create(overlay, overlay, yuyv422, base->get_resolution(), 4, 2);
+		REQUIRE(plan);
+		const auto out = blend_copy(*plan, base, get_supported_level(), 1);
+		const auto& data = PLANE_DATA(out, 0);
+		for (size_t line = 0; line < 8; ++line) {
+			for (size_t col = 0; col < 16; col += 2) {
+				const uint8_t* pix = &data[line * 32 + col * 2];
+				const bool inside = line >= 2 && line < 6 && col >= 4 && col < 12;
+				REQUIRE(pix[0] == (inside ? 100 : 1));
+				REQUIRE(pix[1] == (inside ? 50 : 2));
+				REQUIRE(pix[2] == (inside ? 100 : 3));
+				REQUIRE(pix[3] == (inside ? 200 : 4));
+			}
+		}
+	}
+	SECTION("yuv420p") {
+		const auto base = make_flat_frame(yuv420p, {16, 8}, {1});
+		const auto plan = BlendPlan::create(overlay, overlay, yuv420p, base->get_resolution(), 4, 2);
+		REQUIRE(plan);
+		const auto out = blend_copy(*plan, base, get_supported_level(), 1);
+		const uint8_t expected[] = {100, 50, 200};
+		for (size_t i = 0; i < 3; ++i) {
+			const auto& plane = PLANE_DATA(out, i);
+			const size_t sub = i ? 2 : 1;
+			const size_t width = 16 / sub;
+			for (size_t line = 0; line < 8 / sub; ++line) {
+				for (size_t col = 0; col < width; ++col) {
+					const bool inside = line * sub >= 2 && line * sub < 6 && col * sub >= 4 && col * sub < 12;
+					REQUIRE(plane[line * width + col] == (inside ? expected[i] : 1));
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("Overlay at odd position keeps luma exact", "[overlay]")
+{
+	using namespace core::raw_format;
+	const auto overlay = make_flat_frame(yuva4444, {8, 4}, {100, 50, 200, 255});
+	const auto base = make_flat_frame(yuyv422, {16, 8}, {1, 2, 3, 4});
+	const auto plan = BlendPlan::create(overlay, overlay, yuyv422, base->get_resolution(), 5, 3);
+	REQUIRE(plan);
+	const auto out = blend_copy(*plan, base, get_supported_level(), 1);
+	const auto& data = PLANE_DATA(out, 0);
+	for (size_t line = 0; line < 8; ++line) {
+		for (size_t col = 0; col < 16; ++col) {
+			const bool inside = line >= 3 && line < 7 && col >= 5 && col < 13;
+			REQUIRE(data[line * 32 + col * 2] == (inside ? 100 : (col % 2 ? 3 : 1)));
+		}
+		// Chroma of pixels 4-5 and 12-13 is covered by half, so it's half of 50 and half of 2
+		const bool covered = line >= 3 && line < 7;
+		REQUIRE(data[line * 32 + 4 * 2 + 1] == (covered ? 26 : 2));
+		REQUIRE(data[line * 32 + 12 * 2 + 1] == (covered ? 26 : 2));
+		REQUIRE(data[line * 32 + 6 * 2 + 1] == (covered ? 50 : 2));
+	}
+}
+
+TEST_CASE("Plans match copies of the overlay", "[overlay]")
+{
+	using namespace core::raw_format;
+	const auto overlay = make_flat_frame(rgba32, {8, 4}, {100, 50, 200, 255});
+	const auto plan = BlendPlan::create(overlay, overlay, rgba32, {16, 8}, 1, 1);
+	REQUIRE(plan);
+	REQUIRE(plan->matches(overlay->get_copy(), rgba32, {16, 8}, 1, 1));
+	REQUIRE(!plan->matches(overlay->get_copy(), rgba32, {16, 8}, 2, 1));
+	REQUIRE(!plan->matches(make_flat_frame(rgba32, {8, 4}, {100, 50, 200, 255}), rgba32, {16, 8}, 1, 1));
+}
+
+TEST_CASE("Blending is bit exact across instruction sets and thread counts", "[overlay]")
+{
+	using namespace core::raw_format;
+	for (auto format: {rgb24, rgba32, abgr32, yuyv422, uyvy422, yuv444p, yuv420p}) {
+		const auto base = make_random_frame(format, {98, 54}, 4);
+		const auto overlay = make_random_frame(get_overlay_format(format), {70, 40}, 5);
+		for (auto pos: {std::make_pair(-7, -3), std::make_pair(13, 9), std::make_pair(60, 30)}) {
+			INFO(get_format_name(format) << " at " << pos.first << ", " << pos.second);
+			const auto plan = BlendPlan::create(overlay, overlay, format, base->get_resolution(), pos.first, pos.second);
+			REQUIRE(plan);
+			REQUIRE(plan->matches(overlay, format, base->get_resolution(), pos.first, pos.second));
+			const auto expected = blend_copy(*plan, base, simd_level_t::none, 1);
+			REQUIRE(!frames_equal(base, expected));
+			for (auto level: get_levels()) {
+				REQUIRE(frames_equal(expected, blend_copy(*plan, base, level, 1)));
+				REQUIRE(frames_equal(expected, blend_copy(*plan, base, level, 3)));
+			}
+		}
+	}
+}
+
+}
+}
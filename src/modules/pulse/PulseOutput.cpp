@@ -10,8 +10,8 @@
 #include "PulseOutput.h"
 #include "yuri/core/Module.h"
 #include "yuri/core/frame/raw_audio_frame_types.h"
-#include "yuri/core/utils/irange.h"
 
+#include <algorithm>
 #include <string.h>
 #include <unistd.h>
 
@@ -26,20 +26,35 @@ core::Parameters PulseOutput::configure() {
 	p.set_description("PulseOutput");
 	p["device"]["Pulse device to use"]="";
 	p["force_channels"]["Force number of channels for the output (set to 0 to automatic channel count)"]=0;
+	p["latency"]["Target latency of the internal buffer in ms"]=40.0;
+	p["drift_compensation"]["Resample the input slightly to keep the latency when the sound card clock differs from the pipeline"]=true;
+	p["blocking"]["Wait when the internal buffer is full, instead of dropping samples"]=true;
 	return p;
 }
 
 #include "pulse_common.cpp"
 
+namespace {
+
+void cb_stream_write(pa_stream*, size_t bytes, void* userdata) {
+	reinterpret_cast<PulseOutput*>(userdata)->write_stream(bytes);
+}
+
+}
+
 PulseOutput::PulseOutput(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
 core::SpecializedIOFilter<core::RawAudioFrame>(log_,parent, std::string("pulse_output")),
-device_name_(""),format_(0),channels_(0),forced_channels_(0),sample_rate_(0),pulse_ready_(0)
+device_name_(""),format_(0),channels_(0),forced_channels_(0),sample_rate_(0),target_latency_(40_ms),
+drift_compensation_(true),blocking_(true),reported_missing_(0),reported_dropped_(0),
+ctx_(nullptr),pulse_loop_(nullptr),stream_(nullptr),pulse_ready_(0)
 {
 	IOTHREAD_INIT(parameters)
+	set_supported_formats({core::raw_audio_format::float_32bit});
 	init_pulse();
 }
 
 PulseOutput::~PulseOutput() noexcept {
+	close_stream();
 	destroy_pulse();
 }
 
@@ -96,42 +111,64 @@ core::pFrame PulseOutput::do_special_single_step(core::pRawAudioFrame frame) {
 	if (is_different_format(frame))
 		if (!set_format(frame)) return {};
 
-	const uint8_t* start = nullptr;
-	const auto channel_size = frame->get_sample_size() / frame->get_channel_count() / 8;
-	const auto data_size = channels_ * channel_size * frame->get_sample_count();
-	if (channels_ != frame->get_channel_count()) {
-		channel_buffer_.resize(frame->size() * channels_ / frame->get_channel_count());		
-		uint8_t* buf_pos = &channel_buffer_[0];
-		start = buf_pos;
-		auto frame_pos = frame->data();
-		const auto copy_channels = std::min(frame->get_channel_count(), channels_);
-		const auto skip_channels = frame->get_channel_count() - copy_channels;
-		const auto fill_channels = channels_ - copy_channels;
-		
-		for (auto i: irange(frame->get_sample_count())) {
-			(void)i;
-			for (auto x: irange(copy_channels * channel_size)) {
-				(void)x;
-				*buf_pos++ = *frame_pos++;
-			}
-			frame_pos += skip_channels * channel_size;
-			for (auto x: irange(fill_channels * channel_size)) {
-				(void)x;
-				*buf_pos++ = 0;
-			}
-		}
-	} else {
-		// The simple case when we simple copy the data to sound card
-		start = frame->data();	
+	const size_t in_channels = frame->get_channel_count();
+	const size_t frames = frame->get_sample_count();
+	const size_t copy_channels = std::min(in_channels, channels_);
+	const float* in = reinterpret_cast<const float*>(frame->data());
+	samples_.resize(frames * channels_);
+	float* out = samples_.data();
+	for (size_t i = 0; i < frames; ++i) {
+		std::copy(in, in + copy_channels, out);
+		std::fill(out + copy_channels, out + channels_, 0.0f);
+		in += in_channels;
+		out += channels_;
 	}
-	pa_threaded_mainloop_lock(pulse_loop_);
-	if (pa_stream_write(stream_, start, data_size, nullptr, 0, PA_SEEK_RELATIVE) < 0) {
-		log[log::warning] << "Not able to write data to pulse audio.";
+	if (blocking_) {
+		// Resampling may produce slightly more samples than received
+		const size_t required = std::min(static_cast<size_t>(frames * (1.0 + core::AudioRing::max_drift)) + 2,
+				ring_->get_capacity());
+		while (ring_->space() < required) {
+			if (!still_running()) return {};
+			sleep(get_latency());
+		}
 	}
-	pa_threaded_mainloop_unlock(pulse_loop_);
+	ring_->push(samples_.data(), frames);
+	report_ring_state();
 	return {};
 }
 
+void PulseOutput::write_stream(size_t bytes) {
+	// Called from the mainloop thread, with the mainloop locked
+	if (!ring_ || !stream_) return;
+	const size_t frame_size = channels_ * sizeof(float);
+	while (bytes >= frame_size) {
+		void* data = nullptr;
+		size_t size = bytes;
+		if (pa_stream_begin_write(stream_, &data, &size) < 0 || !data) return;
+		const size_t frames = std::min(size, bytes) / frame_size;
+		if (!frames) {
+			pa_stream_cancel_write(stream_);
+			return;
+		}
+		ring_->read(reinterpret_cast<float*>(data), frames);
+		if (pa_stream_write(stream_, data, frames * frame_size, nullptr, 0, PA_SEEK_RELATIVE) < 0) return;
+		bytes -= frames * frame_size;
+	}
+}
+
+void PulseOutput::report_ring_state() {
+	const auto missing = ring_->get_missing_frames();
+	if (missing != reported_missing_ && ring_->available()) {
+		log[log::warning] << "Missing " << (missing - reported_missing_) << " frames, filled with zeros";
+		reported_missing_ = missing;
+	}
+	const auto dropped = ring_->get_dropped_frames();
+	if (dropped != reported_dropped_) {
+		log[log::warning] << "Not enough space in the buffer, dropped " << (dropped - reported_dropped_) << " frames";
+		reported_dropped_ = dropped;
+	}
+}
+
 bool PulseOutput::is_different_format(const core::pRawAudioFrame& frame) {
 	return ((frame->get_format() != format_) ||
 			(frame->get_sampling_frequency() != sample_rate_) ||
@@ -140,12 +177,6 @@ bool PulseOutput::is_different_format(const core::pRawAudioFrame& frame) {
 }
 
 bool PulseOutput::set_format(const core::pRawAudioFrame& frame) {
-	auto pulse_format = get_pulse_format(frame->get_format());
-	if (pulse_format == PA_SAMPLE_INVALID) {
-		log[log::error] << "Received frame in unsupported format";
-		return false;
-	}
-
 	format_ = frame->get_format();
 	channels_ = forced_channels_ ? forced_channels_ : frame->get_channel_count();
 	if (channels_ > pulse_max_output_channels) {
@@ -155,7 +186,7 @@ bool PulseOutput::set_format(const core::pRawAudioFrame& frame) {
 	sample_rate_ = frame->get_sampling_frequency();
 
     pa_sample_spec ss = {
-        pulse_format,					// .format
+        get_pulse_format(format_),		// .format
         sample_rate_,					// .rate
         static_cast<uint8_t>(channels_)	// .channels
     };
@@ -190,13 +221,32 @@ bool PulseOutput::set_format(const core::pRawAudioFrame& frame) {
 		return false;
 	}
 
+	close_stream();
+	const size_t target = static_cast<size_t>(target_latency_.value * sample_rate_ / 1000000);
+	ring_.reset(new core::AudioRing(channels_, sample_rate_, std::max<size_t>(4 * target, sample_rate_), target,
+			drift_compensation_));
+	reported_missing_ = 0;
+	reported_dropped_ = 0;
+
+	// The server asks for samples in short chunks, the rest of the latency is kept in the ring
+	pa_buffer_attr attr;
+	attr.maxlength = static_cast<uint32_t>(-1);
+	attr.tlength = static_cast<uint32_t>(pa_usec_to_bytes(10000, &ss));
+	attr.prebuf = static_cast<uint32_t>(-1);
+	attr.minreq = static_cast<uint32_t>(-1);
+	attr.fragsize = static_cast<uint32_t>(-1);
+
 	pa_threaded_mainloop_lock(pulse_loop_);
 	if (!(stream_ = pa_stream_new(ctx_, "audio playback", &ss, &map))) {
+		pa_threaded_mainloop_unlock(pulse_loop_);
 		log[log::error] << "Error while creating new pulse audio playback.";
 		return false;
 	}
+	pa_stream_set_write_callback(stream_, cb_stream_write, this);
 
-   	if (pa_stream_connect_playback(stream_, (device_name_.empty() ? nullptr : device_name_.c_str()), nullptr, PA_STREAM_START_UNMUTED, nullptr, nullptr) < 0) {
+   	if (pa_stream_connect_playback(stream_, (device_name_.empty() ? nullptr : device_name_.c_str()), &attr,
+   			static_cast<pa_stream_flags_t>(PA_STREAM_START_UNMUTED | PA_STREAM_ADJUST_LATENCY), nullptr, nullptr) < 0) {
+		pa_threaded_mainloop_unlock(pulse_loop_);
         log[log::error] << "Error while connecting stream to pulse playback.";
 		return false;
     }
@@ -226,6 +276,16 @@ bool PulseOutput::init_pulse() {
 	return true;
 }
 
+void PulseOutput::close_stream() {
+	if (!stream_) return;
+	pa_threaded_mainloop_lock(pulse_loop_);
+	pa_stream_set_write_callback(stream_, nullptr, nullptr);
+	pa_stream_disconnect(stream_);
+	pa_stream_unref(stream_);
+	stream_ = nullptr;
+	pa_threaded_mainloop_unlock(pulse_loop_);
+}
+
 void PulseOutput::destroy_pulse() {
 	if (pulse_loop_) close_pulse(pulse_loop_);
 }
@@ -234,7 +294,11 @@ bool PulseOutput::set_param(const core::Parameter& param)
 {
 	if (assign_parameters(param) //
 		(device_name_, "device") //
-		(forced_channels_, "force_channels")) {
+		(forced_channels_, "force_channels") //
+		.parsed<double>
+			(target_latency_, "latency", [](double ms){ return 1_ms * ms; }) //
+		(drift_compensation_, "drift_compensation") //
+		(blocking_, "blocking")) {
 		return true;
 	}
 	return core::SpecializedIOFilter<core::RawAudioFrame>::set_param(param);
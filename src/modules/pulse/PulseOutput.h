@@ -13,6 +13,8 @@
 #include "yuri/core/thread/SpecializedIOFilter.h"
 #include "yuri/core/thread/InputThread.h"
 #include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/utils/AudioRing.h"
+#include <memory>
 #include <pulse/pulseaudio.h>
 
 namespace yuri {
@@ -28,6 +30,7 @@ public:
 	virtual ~PulseOutput() noexcept;
 	static core::Parameters configure();
 	static std::vector<core::InputDeviceInfo> enumerate();
+	void write_stream(size_t bytes);
 private:
 	
 	virtual core::pFrame do_special_single_step(core::pRawAudioFrame frame) override;
@@ -37,14 +40,24 @@ private:
 	bool set_format(const core::pRawAudioFrame& frame);
 	bool init_pulse();
 	void destroy_pulse();
+	void close_stream();
+	void report_ring_state();
 
 	std::string device_name_;
 	format_t format_;
 	size_t channels_;
 	size_t forced_channels_;
 	unsigned int sample_rate_;
+	duration_t target_latency_;
+	bool drift_compensation_;
+	bool blocking_;
 
-	std::vector<uint8_t> channel_buffer_;
+	//! Converted samples of the last frame, interleaved
+	std::vector<float> samples_;
+	//! Samples for the stream, read in the write callback of the mainloop thread
+	std::unique_ptr<core::AudioRing> ring_;
+	uint64_t reported_missing_;
+	uint64_t reported_dropped_;
 
 
 	pa_context *ctx_;
@@ -0,0 +1,89 @@
+/*!
+ * @file 		PacketReader.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "PacketReader.h"
+#include <algorithm>
+#include <chrono>
+
+namespace yuri {
+namespace rawavfile {
+
+PacketReader::PacketReader(size_t depth) : depth_(std::max<size_t>(depth, 1)), finished_(false), stop_(false)
+{
+}
+
+PacketReader::~PacketReader() noexcept
+{
+    stop();
+}
+
+void PacketReader::start(AVFormatContext* ctx)
+{
+    stop();
+    lock_t _(mutex_);
+    finished_ = false;
+    stop_     = false;
+    thread_   = std::thread([this, ctx] { read_packets(ctx); });
+}
+
+void PacketReader::stop()
+{
+    {
+        lock_t _(mutex_);
+        stop_ = true;
+    }
+    not_full_.notify_all();
+    if (thread_.joinable())
+        thread_.join();
+    lock_t _(mutex_);
+    packets_.clear();
+}
+
+int PacketReader::read(AVPacket& packet, duration_t timeout)
+{
+    lock_t lock(mutex_);
+    if (!not_empty_.wait_for(lock, std::chrono::microseconds(timeout), [this] { return !packets_.empty() || finished_; }))
+        return AVERROR(EAGAIN);
+    if (packets_.empty())
+        return AVERROR_EOF;
+    av_packet_move_ref(&packet, packets_.front().get());
+    packets_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return 0;
+}
+
+bool PacketReader::finished() const
+{
+    lock_t _(mutex_);
+    return finished_;
+}
+
+void PacketReader::read_packets(AVFormatContext* ctx)
+{
+    while (true) {
+        packet_ptr packet(av_packet_alloc());
+        const bool ok = packet && av_read_frame(ctx, packet.get()) >= 0;
+        lock_t     lock(mutex_);
+        if (!ok) {
+            finished_ = true;
+            break;
+        }
+        not_full_.wait(lock, [this] { return packets_.size() < depth_ || stop_; });
+        if (stop_)
+            break;
+        packets_.push_back(std::move(packet));
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+    not_empty_.notify_all();
+}
+
+} /* namespace rawavfile */
+} /* namespace yuri */
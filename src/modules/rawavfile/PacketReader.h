@@ -0,0 +1,72 @@
+/*!
+ * @file 		PacketReader.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef PACKETREADER_H_
+#define PACKETREADER_H_
+
+#include "avcommon.h"
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/time_types.h"
+extern "C" {
+#include <libavformat/avformat.h>
+}
+#include <deque>
+#include <memory>
+#include <thread>
+
+namespace yuri {
+namespace rawavfile {
+
+/*!
+ * Reads packets from a format context in a separate thread into a bounded queue,
+ * so the decoding doesn't have to wait for I/O.
+ *
+ * The format context must not be used for reading or seeking while the reader is running.
+ */
+class PacketReader {
+public:
+    explicit PacketReader(size_t depth);
+    ~PacketReader() noexcept;
+
+    PacketReader(const PacketReader&) = delete;
+    PacketReader& operator=(const PacketReader&) = delete;
+
+    void start(AVFormatContext* ctx);
+    //! Stops the reading thread and drops all queued packets
+    void stop();
+
+    /*!
+     * Moves next packet into @em packet.
+     * @return 0 on success, AVERROR_EOF at the end of the file (or on read error)
+     * and AVERROR(EAGAIN) if no packet was read in @em timeout.
+     */
+    int read(AVPacket& packet, duration_t timeout);
+
+    //! Returns true when the whole file was read, although some packets may still be queued
+    bool finished() const;
+
+private:
+    void read_packets(AVFormatContext* ctx);
+
+    using packet_ptr = std::unique_ptr<AVPacket, AVPacketDeleter>;
+
+    const size_t            depth_;
+    std::thread             thread_;
+    mutable mutex           mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<packet_ptr>  packets_;
+    bool                    finished_;
+    bool                    stop_;
+};
+
+} /* namespace rawavfile */
+} /* namespace yuri */
+
+#endif /* PACKETREADER_H_ */
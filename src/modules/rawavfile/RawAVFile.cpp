@@ -52,6 +52,21 @@ const std::string& get_format_name_no_throw(format_t fmt)
     }
     return unknown_format;
 }
+
+AVFormatContext* open_input(const std::string& filename)
+{
+    // ffmpeg needs locking of open/close functions...
+    auto             lock = libav::get_libav_lock();
+    AVFormatContext* ctx  = nullptr;
+    if (avformat_open_input(&ctx, filename.c_str(), nullptr, nullptr) < 0 || !ctx) {
+        return nullptr;
+    }
+    if (avformat_find_stream_info(ctx, nullptr) < 0) {
+        avformat_close_input(&ctx);
+        return nullptr;
+    }
+    return ctx;
+}
 }
 
 struct RawAVFile::stream_detail_t {
@@ -138,6 +153,7 @@ core::Parameters RawAVFile::configure()
     p["thread_type"]["Type of threaded decoding - slice, frame or any"]                            = "any";
     p["keep_open"]["Keep player running after ending file in no-loop mode, waiting for next filename"] = false;
     p["black_on_end"]["Send a black frame after finishing playback"] = false;
+    p["prefetch"]["Number of packets to read ahead in a separate thread. Set to 0 to read packets in the decoding thread."] = 32;
     return p;
 }
 
@@ -165,7 +181,8 @@ RawAVFile::RawAVFile(const log::Log& _log, core::pwThreadBase parent, const core
       emit_params_interval_{ 1 },
       last_params_emitted_{ -1 },
       separate_extra_data_{false},
-      paused_(false)
+      paused_(false),
+      prefetch_(32)
 {
     IOTHREAD_INIT(parameters)
     set_latency(10_us);
@@ -178,6 +195,9 @@ RawAVFile::RawAVFile(const log::Log& _log, core::pwThreadBase parent, const core
 #endif
     IOThread::resize(0, max_video_streams_ + max_audio_streams_);
     libav::init_libav();
+    if (prefetch_ > 0) {
+        reader_ = make_unique<PacketReader>(prefetch_);
+    }
 
     if (filename_.empty()) {
         if (!allow_empty_)
@@ -194,9 +214,12 @@ RawAVFile::RawAVFile(const log::Log& _log, core::pwThreadBase parent, const core
 
 bool RawAVFile::open_file(const std::string& filename)
 {
+    stop_reading();
     video_streams_.clear();
     audio_streams_.clear();
     frames_.clear();
+    // Has to be called before locking, as the file is opened in the background with the lock held
+    auto preopened = take_preopened(filename);
     // ffmpeg needs locking of open/close functions...
     auto lock = libav::get_libav_lock();
     if (fmtctx_) {
@@ -204,15 +227,20 @@ bool RawAVFile::open_file(const std::string& filename)
     }
     fmtctx_.reset();
 
-    avformat_open_input(&fmtctx_.get_ptr_ref(), filename.c_str(), nullptr, nullptr);
-    if (!fmtctx_) {
-        log[log::error] << "Failed to allocate Format context";
-        return false;
-    }
+    if (preopened) {
+        log[log::debug] << "Using prepared context for " << filename;
+        fmtctx_.reset(preopened);
+    } else {
+        avformat_open_input(&fmtctx_.get_ptr_ref(), filename.c_str(), nullptr, nullptr);
+        if (!fmtctx_) {
+            log[log::error] << "Failed to allocate Format context";
+            return false;
+        }
 
-    if (avformat_find_stream_info(fmtctx_, nullptr) < 0) {
-        log[log::fatal] << "Failed to retrieve stream info!";
-        return false;
+        if (avformat_find_stream_info(fmtctx_, nullptr) < 0) {
+            log[log::fatal] << "Failed to retrieve stream info!";
+            return false;
+        }
     }
 
     for (size_t i = 0; i < fmtctx_->nb_streams; ++i) {
@@ -329,9 +357,63 @@ bool RawAVFile::open_file(const std::string& filename)
 
     next_times_.resize(video_streams_.size(), timestamp_t{});
     emit_event("filename", filename_);
+    start_reading();
     return true;
 }
 
+int RawAVFile::read_packet(AVPacket& packet)
+{
+    if (!reader_) {
+        return av_read_frame(fmtctx_, &packet);
+    }
+    return reader_->read(packet, get_latency() > 1_ms ? get_latency() : 1_ms);
+}
+
+void RawAVFile::start_reading()
+{
+    if (reader_ && fmtctx_) {
+        reader_->start(fmtctx_);
+    }
+}
+
+void RawAVFile::stop_reading()
+{
+    if (reader_) {
+        reader_->stop();
+    }
+}
+
+/*!
+ * Opens next file in the background once the current one has been read completely,
+ * so the playback can continue without waiting for the file to be opened and probed.
+ */
+void RawAVFile::preopen_next_file()
+{
+    if (preopened_.valid() || !reader_ || !reader_->finished() || !has_next_filename() || !(loop_ || keep_open_)) {
+        return;
+    }
+    preopened_filename_ = peek_next_filename();
+    if (preopened_filename_.empty()) {
+        return;
+    }
+    log[log::debug] << "Preparing " << preopened_filename_;
+    preopened_ = std::async(std::launch::async, open_input, preopened_filename_);
+}
+
+AVFormatContext* RawAVFile::take_preopened(const std::string& filename)
+{
+    if (!preopened_.valid()) {
+        return nullptr;
+    }
+    auto ctx = preopened_.get();
+    if (ctx && filename != preopened_filename_) {
+        auto lock = libav::get_libav_lock();
+        avformat_close_input(&ctx);
+    }
+    preopened_filename_.clear();
+    return ctx;
+}
+
 bool RawAVFile::push_ready_frames()
 {
     bool ready = false;
@@ -367,7 +449,9 @@ bool RawAVFile::process_file_end()
 
     if (loop_ && !has_next_filename() && fmtctx_) {
         log[log::debug] << "Seeking to the beginning";
+        stop_reading();
         av_seek_frame(fmtctx_, 0, 0, AVSEEK_FLAG_BACKWARD);
+        start_reading();
         if (decode_) {
             for (auto& s : video_streams_) {
                 avcodec_flush_buffers(s.ctx.get());
@@ -382,6 +466,7 @@ bool RawAVFile::process_file_end()
         log[log::info] << "Opening: " << filename_;
         return open_file(filename_);
     } else if (black_on_end_ || keep_open_) {
+        stop_reading();
         fmtctx_.reset();
         if (black_on_end_) {
             if (!blank_converter_) {
@@ -513,7 +598,7 @@ bool RawAVFile::decode_video_frame(index_t idx, AVPacket& packet, AVFrame* av_fr
         return false;
     }
 
-    auto f = libav::yuri_frame_from_av(*av_frame);
+    auto f = libav::yuri_frame_from_av_ref(*av_frame);
     if (!f) {
         log[log::warning] << "Failed to convert avframe, probably unsupported pixelformat";
         return false;
@@ -652,9 +737,14 @@ void RawAVFile::run()
             continue;
         }
 
+        preopen_next_file();
         if (!keep_packet) {
             av_packet_unref(&packet);
-            if (av_read_frame(fmtctx_, &packet) < 0) {
+            const auto ret = read_packet(packet);
+            if (ret == AVERROR(EAGAIN)) {
+                continue;
+            }
+            if (ret < 0) {
                 finishing = true;
             }
         }
@@ -727,6 +817,7 @@ bool RawAVFile::set_param(const core::Parameter& parameter)
         (threads_, "threads")                                                     //
         (keep_open_, "keep_open")                                                 //
         (black_on_end_, "black_on_end")                                           //
+        (prefetch_, "prefetch")                                                   //
         .parsed<std::string>(thread_type_, "thread_type", libav::parse_thread_type)//
         )
         return true;
@@ -790,7 +881,16 @@ std::string RawAVFile::get_next_filename() {
     return n;
 }
 
-RawAVFile::~RawAVFile() noexcept = default;
+std::string RawAVFile::peek_next_filename() {
+    return next_filename_;
+}
+
+RawAVFile::~RawAVFile() noexcept
+{
+    stop_reading();
+    // Closes the context prepared for next file, if there's any
+    take_preopened({});
+}
 
 } /* namespace video */
 } /* namespace yuri */
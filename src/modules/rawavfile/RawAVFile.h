@@ -17,10 +17,12 @@
 #include "yuri/event/BasicEventProducer.h"
 #include "yuri/core/utils/managed_resource.h"
 #include "yuri/core/thread/Convert.h"
+#include "PacketReader.h"
 extern "C" {
 #include <libavformat/avformat.h>
 }
 
+#include <future>
 #include <vector>
 
 namespace yuri {
@@ -41,6 +43,11 @@ protected:
     bool do_process_event(const std::string& event_name, const event::pBasicEvent& event) override;
 
     bool open_file(const std::string& filename);
+    int read_packet(AVPacket& packet);
+    void start_reading();
+    void stop_reading();
+    void preopen_next_file();
+    AVFormatContext* take_preopened(const std::string& filename);
     bool push_ready_frames();
     bool process_file_end();
 
@@ -54,6 +61,8 @@ protected:
 
     virtual bool has_next_filename();
     virtual std::string get_next_filename();
+    //! Returns filename that will be returned by next call to get_next_filename()
+    virtual std::string peek_next_filename();
 protected:
     bool step() override;
 
@@ -93,6 +102,11 @@ private:
     timestamp_t pause_start_;
 
     std::unique_ptr<core::Convert> blank_converter_;
+
+    size_t                          prefetch_;
+    std::unique_ptr<PacketReader>   reader_;
+    std::string                     preopened_filename_;
+    std::future<AVFormatContext*>   preopened_;
 };
 
 } /* namespace video */
@@ -31,6 +31,8 @@ namespace yuri {
 
             virtual std::string get_next_filename() override;
 
+            virtual std::string peek_next_filename() override;
+
             std::vector<std::string> playlist_;
             int playlist_index_;
         };
@@ -0,0 +1,148 @@
+/*!
+ * @file 		BlockReader.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "BlockReader.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yuri {
+namespace rawfilesource {
+
+io_mode_t parse_io_mode(const std::string& name)
+{
+	if (name == "mmap") return io_mode_t::mmap;
+	if (name == "async") return io_mode_t::async;
+	if (name == "direct") return io_mode_t::direct;
+	return io_mode_t::stream;
+}
+
+BlockReader::BlockReader(uint64_t size, uint64_t offset, size_t block_size, bool loop):
+	size_(size), offset_(offset),
+	block_size_(block_size || offset >= size ? block_size : size - offset),
+	loop_(loop), next_(offset), finished_(false)
+{
+}
+
+bool BlockReader::advance(uint64_t& position, bool& last)
+{
+	if (finished_ || !block_size_ || next_ + block_size_ > size_) {
+		finished_ = true;
+		return false;
+	}
+	position = next_;
+	next_ += block_size_;
+	last = next_ + block_size_ > size_;
+	if (last) {
+		if (loop_) next_ = offset_;
+		else finished_ = true;
+	}
+	return true;
+}
+
+MappedBlockReader::MappedBlockReader(int fd, uint64_t size, uint64_t offset, size_t block_size, bool loop):
+	BlockReader(size, offset, block_size, loop)
+{
+	void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) throw std::runtime_error("Failed to map the file");
+	::madvise(data, size, MADV_SEQUENTIAL);
+	mapping_.reset(static_cast<uint8_t*>(data), [size](uint8_t* p){ ::munmap(p, size); });
+}
+
+block_t MappedBlockReader::next()
+{
+	uint64_t position = 0;
+	bool last = false;
+	if (!advance(position, last)) return {nullptr, {}, false, false};
+	// Ask for the following block to be read in while this one is processed
+	const uint64_t following = last ? offset_ : position + block_size_;
+	if (following + block_size_ <= size_) {
+		const uint64_t page_start = following & ~static_cast<uint64_t>(::sysconf(_SC_PAGESIZE) - 1);
+		::madvise(mapping_.get() + page_start, following + block_size_ - page_start, MADV_WILLNEED);
+	}
+	return {mapping_.get() + position, mapping_, last, true};
+}
+
+AsyncBlockReader::AsyncBlockReader(core::pAsyncFile file, uint64_t size, uint64_t offset, size_t block_size, bool loop):
+	BlockReader(size, offset, block_size, loop), file_(std::move(file))
+{
+	fill_queue();
+}
+
+AsyncBlockReader::~AsyncBlockReader() noexcept
+{
+	// The buffers have to stay valid until all reads finish
+	file_->wait_all();
+}
+
+void AsyncBlockReader::fill_queue()
+{
+	const uint64_t alignment = core::AsyncFile::direct_alignment;
+	while (requests_.size() < file_->get_queue_depth()) {
+		uint64_t position = 0;
+		bool last = false;
+		if (!advance(position, last)) break;
+		uint64_t start = position;
+		size_t length = block_size_;
+		if (file_->is_direct()) {
+			start = position & ~(alignment - 1);
+			length = (position - start + block_size_ + alignment - 1) & ~(alignment - 1);
+		}
+		auto block = core::FixedMemoryAllocator::get_block(length);
+		auto deleter = block.second;
+		std::shared_ptr<uint8_t> buffer(block.first, [deleter](uint8_t* p){ deleter(p); });
+		const auto id = file_->read(buffer.get(), length, start);
+		requests_.push_back({id, std::move(buffer), static_cast<size_t>(position - start), length, last});
+	}
+}
+
+block_t AsyncBlockReader::next()
+{
+	if (requests_.empty()) return {nullptr, {}, false, false};
+	auto request = std::move(requests_.front());
+	requests_.pop_front();
+	const auto result = file_->wait(request.id);
+	// Reading at the end of the file may be shorter, when extended for direct I/O
+	if (result < static_cast<int64_t>(request.skip + block_size_)) {
+		throw std::runtime_error("Failed to read block from the file");
+	}
+	fill_queue();
+	return {request.buffer.get() + request.skip, std::move(request.buffer), request.last, false};
+}
+
+std::unique_ptr<BlockReader> open_block_reader(const std::string& path, io_mode_t mode, uint64_t offset,
+		size_t block_size, bool loop, size_t queue_depth, core::async_backend_t backend)
+{
+	struct stat st;
+	if (::stat(path.c_str(), &st) != 0) return {};
+	const uint64_t size = st.st_size;
+	if (offset >= size || offset + block_size > size) return {};
+
+	if (mode == io_mode_t::mmap) {
+		const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return {};
+		std::unique_ptr<BlockReader> reader;
+		try {
+			reader.reset(new MappedBlockReader(fd, size, offset, block_size, loop));
+		}
+		catch (std::runtime_error&) {}
+		// The mapping stays valid after closing the file
+		::close(fd);
+		return reader;
+	}
+	const int flags = O_RDONLY | (mode == io_mode_t::direct ? O_DIRECT : 0);
+	auto file = core::AsyncFile::open(path, flags, queue_depth, backend);
+	if (!file) return {};
+	return std::unique_ptr<BlockReader>(new AsyncBlockReader(std::move(file), size, offset, block_size, loop));
+}
+
+}
+}
@@ -0,0 +1,121 @@
+/*!
+ * @file 		BlockReader.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Readers of equally sized blocks (frames) from a file,
+ * that provide the data without copying them into frames.
+ */
+
+#ifndef BLOCKREADER_H_
+#define BLOCKREADER_H_
+
+#include "yuri/core/utils/AsyncFile.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace yuri {
+namespace rawfilesource {
+
+enum class io_mode_t {
+	//! Reading through std::ifstream
+	stream,
+	//! Frames wrap pages of the file mapped into memory
+	mmap,
+	//! Frames are read ahead asynchronously into pooled buffers
+	async,
+	//! Same as async, but bypassing the page cache
+	direct
+};
+
+io_mode_t parse_io_mode(const std::string& name);
+
+struct block_t {
+	const uint8_t* data;
+	//! Keeps the data valid, should be held by every frame using them
+	std::shared_ptr<void> owner;
+	//! This is the last block before the reader starts again from the beginning
+	bool last;
+	//! Data can't be written (e.g. mapped file), frames have to copy them before modification
+	bool read_only;
+};
+
+class BlockReader {
+public:
+	/*!
+	 * @param size Size of the file
+	 * @param offset Offset of the first block
+	 * @param block_size Size of blocks, 0 for the rest of the file after @em offset
+	 * @param loop Start again at @em offset after reading the last block
+	 */
+	BlockReader(uint64_t size, uint64_t offset, size_t block_size, bool loop);
+	virtual ~BlockReader() noexcept {}
+	/*!
+	 * Returns next block, data are nullptr when there are no more blocks
+	 * @throw std::runtime_error on read error
+	 */
+	virtual block_t next() = 0;
+	size_t get_block_size() const { return block_size_; }
+protected:
+	//! Returns offset of the next block and advances to the following one
+	bool advance(uint64_t& position, bool& last);
+	const uint64_t	size_;
+	const uint64_t	offset_;
+	const size_t	block_size_;
+	const bool		loop_;
+private:
+	uint64_t		next_;
+	bool			finished_;
+};
+
+/*!
+ * Maps the whole file into memory (read-only) and provides blocks directly from the mapping.
+ */
+class MappedBlockReader: public BlockReader {
+public:
+	MappedBlockReader(int fd, uint64_t size, uint64_t offset, size_t block_size, bool loop);
+	block_t next() override;
+private:
+	std::shared_ptr<uint8_t> mapping_;
+};
+
+/*!
+ * Keeps up to queue depth blocks being read ahead into buffers from FixedMemoryAllocator.
+ * With direct I/O, the reads are extended to aligned offsets and sizes.
+ */
+class AsyncBlockReader: public BlockReader {
+public:
+	AsyncBlockReader(core::pAsyncFile file, uint64_t size, uint64_t offset, size_t block_size, bool loop);
+	~AsyncBlockReader() noexcept;
+	block_t next() override;
+private:
+	struct request_t {
+		core::AsyncFile::request_id_t id;
+		std::shared_ptr<uint8_t> buffer;
+		//! Offset of the block in the buffer
+		size_t skip;
+		//! Size of the request
+		size_t length;
+		bool last;
+	};
+	void fill_queue();
+
+	core::pAsyncFile		file_;
+	std::deque<request_t>	requests_;
+};
+
+/*!
+ * Opens a reader for @em path
+ * @return The reader, or empty pointer if the file couldn't be opened or is too short
+ */
+std::unique_ptr<BlockReader> open_block_reader(const std::string& path, io_mode_t mode, uint64_t offset,
+		size_t block_size, bool loop, size_t queue_depth, core::async_backend_t backend);
+
+}
+}
+
+#endif /* BLOCKREADER_H_ */
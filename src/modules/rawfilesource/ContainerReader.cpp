@@ -0,0 +1,126 @@
+/*!
+ * @file 		ContainerReader.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "ContainerReader.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace yuri {
+namespace rawfilesource {
+
+namespace container = core::container;
+
+std::unique_ptr<ContainerReader> ContainerReader::open(const std::string& path, log::Log& log)
+{
+	const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) return {};
+	struct stat st;
+	container::file_header_t header;
+	if (::fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(header) ||
+			::pread(fd, &header, sizeof(header), 0) != sizeof(header) || !container::is_valid(header)) {
+		::close(fd);
+		return {};
+	}
+	const uint64_t size = st.st_size;
+	// Frames copy the data before modifying them, so the mapping can be read-only
+	void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (data == MAP_FAILED) {
+		log[log::warning] << "Failed to map " << path;
+		return {};
+	}
+	std::shared_ptr<uint8_t> mapping(static_cast<uint8_t*>(data), [size](uint8_t* p){ ::munmap(p, size); });
+	std::unique_ptr<ContainerReader> reader(new ContainerReader(std::move(mapping), size));
+	reader->alignment_ = header.alignment;
+	if (!reader->load_index()) {
+		log[log::warning] << "No valid index found in " << path << ", scanning the file";
+		reader->scan_frames();
+	}
+	log[log::info] << "Opened container " << path << " with " << reader->get_frame_count() << " frames";
+	return reader;
+}
+
+ContainerReader::ContainerReader(std::shared_ptr<uint8_t> mapping, uint64_t size):
+	mapping_(std::move(mapping)), size_(size), alignment_(container::default_alignment),
+	index_(nullptr), count_(0)
+{
+}
+
+bool ContainerReader::load_index()
+{
+	container::trailer_t trailer;
+	if (size_ < sizeof(container::file_header_t) + sizeof(trailer)) return false;
+	const uint64_t trailer_offset = size_ - sizeof(trailer);
+	std::memcpy(&trailer, mapping_.get() + trailer_offset, sizeof(trailer));
+	if (!container::is_valid(trailer) || trailer.index_offset > trailer_offset ||
+			(trailer_offset - trailer.index_offset) / sizeof(container::index_entry_t) < trailer.frame_count) {
+		return false;
+	}
+	const uint8_t* index = mapping_.get() + trailer.index_offset;
+	count_ = trailer.frame_count;
+	if (reinterpret_cast<uintptr_t>(index) % alignof(container::index_entry_t) == 0) {
+		index_ = reinterpret_cast<const container::index_entry_t*>(index);
+	} else {
+		copied_index_.resize(count_);
+		std::memcpy(copied_index_.data(), index, count_ * sizeof(container::index_entry_t));
+		index_ = copied_index_.data();
+	}
+	return true;
+}
+
+void ContainerReader::scan_frames()
+{
+	copied_index_.clear();
+	uint64_t offset = container::align_offset(sizeof(container::file_header_t), alignment_);
+	container::frame_header_t header;
+	while (offset + sizeof(header) <= size_) {
+		std::memcpy(&header, mapping_.get() + offset, sizeof(header));
+		if (!container::is_valid(header) || header.payload_size > size_ - offset - sizeof(header)) break;
+		copied_index_.push_back({offset, header.timestamp, header.payload_size});
+		offset = container::align_offset(offset + sizeof(header) + header.payload_size, alignment_);
+	}
+	index_ = copied_index_.data();
+	count_ = copied_index_.size();
+}
+
+core::pFrame ContainerReader::read_frame(size_t index) const
+{
+	if (index >= count_) return {};
+	const auto& entry = index_[index];
+	container::frame_header_t header;
+	if (entry.offset > size_ || size_ - entry.offset < sizeof(header)) return {};
+	std::memcpy(&header, mapping_.get() + entry.offset, sizeof(header));
+	const uint64_t payload_offset = entry.offset + sizeof(header);
+	if (!container::is_valid(header) || header.payload_size > size_ - payload_offset) return {};
+
+	// Ask for the following frame to be read in while this one is processed
+	if (index + 1 < count_) {
+		const auto& next = index_[index + 1];
+		const uint64_t page_size = ::sysconf(_SC_PAGESIZE);
+		const uint64_t start = next.offset & ~(page_size - 1);
+		const uint64_t end = std::min(size_, next.offset + sizeof(header) + next.payload_size);
+		if (start < end) ::madvise(mapping_.get() + start, end - start, MADV_WILLNEED);
+	}
+	return container::create_frame(header, mapping_.get() + payload_offset, mapping_);
+}
+
+size_t ContainerReader::find_frame(duration_t time) const
+{
+	if (!count_) return 0;
+	const auto it = std::upper_bound(index_, index_ + count_, time.value,
+			[](int64_t t, const container::index_entry_t& e){ return t < e.timestamp; });
+	return it == index_ ? 0 : static_cast<size_t>(it - index_ - 1);
+}
+
+}
+}
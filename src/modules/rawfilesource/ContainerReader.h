@@ -0,0 +1,64 @@
+/*!
+ * @file 		ContainerReader.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef CONTAINERREADER_H_
+#define CONTAINERREADER_H_
+
+#include "yuri/core/frame/frame_container.h"
+#include "yuri/log/Log.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yuri {
+namespace rawfilesource {
+
+/*!
+ * Reads frames from a file with core::container format.
+ *
+ * The file is mapped into memory and frames are wrapping its pages,
+ * so opening even large files only reads the header and the index.
+ */
+class ContainerReader {
+public:
+	/*!
+	 * Opens a container
+	 * @return The reader, or empty pointer when the file is not a valid container
+	 */
+	static std::unique_ptr<ContainerReader> open(const std::string& path, log::Log& log);
+
+	size_t get_frame_count() const { return count_; }
+	/*!
+	 * Returns frame at @em index, or empty pointer when the frame is damaged
+	 */
+	core::pFrame read_frame(size_t index) const;
+	//! Returns index of the frame shown at @em time (relative to the first frame)
+	size_t find_frame(duration_t time) const;
+	//! Returns timestamp of the frame at @em index, relative to the first frame
+	duration_t get_timestamp(size_t index) const { return duration_t{index_[index].timestamp}; }
+
+private:
+	ContainerReader(std::shared_ptr<uint8_t> mapping, uint64_t size);
+	bool load_index();
+	//! Rebuilds the index from frame headers, when the file has no valid index
+	void scan_frames();
+
+	std::shared_ptr<uint8_t>	mapping_;
+	const uint64_t				size_;
+	uint32_t					alignment_;
+	//! Index in the mapping, or in copied_index_
+	const core::container::index_entry_t* index_;
+	size_t						count_;
+	std::vector<core::container::index_entry_t> copied_index_;
+};
+
+}
+}
+
+#endif /* CONTAINERREADER_H_ */
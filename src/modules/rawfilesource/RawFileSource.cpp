@@ -14,6 +14,7 @@
 #include "yuri/core/frame/CompressedVideoFrame.h"
 #include "yuri/core/frame/raw_frame_params.h"
 #include "yuri/core/frame/compressed_frame_params.h"
+#include "yuri/core/utils/assign_events.h"
 #include <fstream>
 #include <boost/regex.hpp>
 #include <iomanip>
@@ -42,19 +43,40 @@ core::Parameters RawFileSource::configure()
 	p["loop"]["Start again from beginning of the file after reaching end"]=true;
 	p["offset"]["skip offset bytes from beginning"]=0;
 	p["block"]["Threat output pipes as blocking. Specify as max number of frames in output pipe."]=0;
+	p["io"]["Method of reading the file (stream, mmap, async or direct). "
+			"Other methods than stream work only for single files with known frame size (raw video with width and height, or with chunk size set)."]="stream";
+	p["queue_depth"]["Number of frames read ahead in async and direct modes"]=4;
+	p["io_backend"]["Backend for async and direct modes (auto, uring or threads)"]="auto";
+	p["timestamps"]["Time frames from container files (written by filedump with container=true) by their stored timestamps instead of fps. "
+			"Durations and then fps are used for frames without increasing timestamps."]=true;
+	p["paused"]["Start paused, frames are then sent only after seeking (container files only)"]=false;
 	return p;
 }
 
 
 RawFileSource::RawFileSource(log::Log &_log, core::pwThreadBase parent,const core::Parameters &parameters):
-			core::IOThread(_log,parent,1,1,"RawFileSource"), position(0),
+			core::IOThread(_log,parent,1,1,"RawFileSource"),
+			event::BasicEventConsumer(log), position(0),
 			chunk_size(0), width(0), height(0),output_format(0),
 			fps(25.0),keep_alive(true),loop(true),
 			failed_read(false),sequence(false),block(0),loop_number(0),sequence_pos(0),
-			frame_type_(frame_type_t::raw_video)
+			frame_type_(frame_type_t::raw_video),io_mode_(io_mode_t::stream),
+			queue_depth_(4),io_backend_(core::async_backend_t::automatic),
+			container_index_(0),use_timestamps_(true),container_delta_(0),paused_(false),show_next_(false)
 {
 	IOTHREAD_INIT(parameters)
 	set_latency(1_ms);
+	if (!sequence) {
+		container_ = ContainerReader::open(path, log);
+	}
+	if (io_mode_ != io_mode_t::stream && !container_) {
+		const bool known_size = (frame_type_ == frame_type_t::raw_video && width && height) ||
+				(frame_type_ == frame_type_t::compressed_viceo);
+		if (sequence || !known_size) {
+			log[log::warning] << "Frame size is not known or reading a sequence, falling back to stream reading";
+			io_mode_ = io_mode_t::stream;
+		}
+	}
 }
 
 RawFileSource::~RawFileSource() noexcept {
@@ -65,20 +87,29 @@ void RawFileSource::run()
 //	IOTHREAD_PRE_RUN
 	while (still_running()) {
 		ThreadBase::sleep(get_latency());
+		process_events();
+		if (paused_ && !show_next_) continue;
 		if (!frame) if (!read_chunk()) break;
 		if (failed_read) break;
 		if (!frame) continue;
 //		if (block && out_[0] && out[0]->get_count() >= block) continue;
 
 		duration_t delta;
-		if (fps!=0.0)
+		if (container_ && use_timestamps_)
+			delta = container_delta_;
+		else if (fps!=0.0)
 			delta = 1_s/fps;
 		else delta = 0_s;
 
-		if ((timestamp_t{} - last_send) < delta) continue;
-		last_send+=delta;
+		if (show_next_) {
+			show_next_ = false;
+			last_send = timestamp_t{};
+		} else {
+			if ((timestamp_t{} - last_send) < delta) continue;
+			last_send+=delta;
+		}
 		push_frame(0,frame);
-		if (chunk_size) frame.reset();
+		if (chunk_size || container_) frame.reset();
 		else if (sequence && !chunk_size) frame.reset();
 		if (!loop && loop_number) break;
 	}
@@ -91,6 +122,8 @@ void RawFileSource::run()
 
 bool RawFileSource::read_chunk()
 {
+	if (container_) return read_container_frame();
+	if (io_mode_ != io_mode_t::stream) return read_block();
 	try {
 		frame.reset();
 		bool first_read = false;
@@ -209,6 +242,120 @@ bool RawFileSource::read_chunk()
 	}
 	return true;
 }
+bool RawFileSource::read_block()
+{
+	frame.reset();
+	try {
+		if (!reader_) {
+			size_t block_size = chunk_size;
+			if (frame_type_ == frame_type_t::raw_video) {
+				const auto& fi = core::raw_format::get_format_info(output_format);
+				block_size = 0;
+				for (size_t i = 0; i < fi.planes.size(); ++i) {
+					block_size += std::get<1>(core::RawVideoFrame::get_plane_params(fi, i, {width, height}));
+				}
+			}
+			reader_ = open_block_reader(path, io_mode_, position, block_size, loop, queue_depth_, io_backend_);
+			if (!reader_) {
+				log[log::warning] << "Failed to open " << path << " (or the file is shorter than a single frame)";
+				failed_read = true;
+				return false;
+			}
+		}
+		const auto block = reader_->next();
+		if (!block.data) return false;
+		if (block.last) ++loop_number;
+		const auto owner = block.owner;
+		if (frame_type_ == frame_type_t::raw_video) {
+			const auto& fi = core::raw_format::get_format_info(output_format);
+			const resolution_t resolution = {width, height};
+			auto rframe = std::make_shared<core::RawVideoFrame>(output_format, resolution, 0);
+			const uint8_t* data = block.data;
+			for (size_t i = 0; i < fi.planes.size(); ++i) {
+				size_t line_size, plane_size;
+				resolution_t plane_res;
+				std::tie(line_size, plane_size, plane_res) = core::RawVideoFrame::get_plane_params(fi, i, resolution);
+				rframe->emplace_back(data, plane_size, plane_res, line_size, [owner](void*)noexcept{});
+				if (block.read_only) (*rframe)[i].set_read_only();
+				data += plane_size;
+			}
+			frame = rframe;
+		} else if (block.read_only) {
+			// Compressed frames can't copy the data on write, so they get a copy right away
+			frame = core::CompressedVideoFrame::create_empty(output_format, resolution_t{width, height},
+					block.data, reader_->get_block_size());
+		} else {
+			frame = core::CompressedVideoFrame::create_empty(output_format, resolution_t{width, height},
+					block.data, reader_->get_block_size(), [owner](void*)noexcept{});
+		}
+		frame->set_duration(1_s/fps);
+	}
+	catch (std::exception &e) {
+		frame.reset();
+		log[log::error] << "Failed to read file " << path << " (" << e.what() << ")";
+		failed_read = true;
+		return false;
+	}
+	return true;
+}
+
+bool RawFileSource::read_container_frame()
+{
+	const auto count = container_->get_frame_count();
+	if (!count) {
+		log[log::warning] << "No frames in " << path;
+		failed_read = true;
+		return false;
+	}
+	if (container_index_ >= count) {
+		container_index_ = 0;
+	}
+	frame = container_->read_frame(container_index_++);
+	if (container_index_ >= count) ++loop_number;
+	if (!frame) {
+		log[log::warning] << "Frame " << container_index_ - 1 << " is damaged, skipping it";
+		return true;
+	}
+	if (!use_timestamps_) {
+		frame->set_duration(1_s/fps);
+		return true;
+	}
+	// Most sources don't set durations, so the timestamps are preferred
+	const auto index = container_index_ - 1;
+	container_delta_ = 0_s;
+	if (index > 0) {
+		const auto delta = container_->get_timestamp(index) - container_->get_timestamp(index - 1);
+		if (delta > 0_s) container_delta_ = delta;
+	}
+	if (container_delta_ == 0_s) container_delta_ = frame->get_duration();
+	if (container_delta_ <= 0_s && fps != 0.0) container_delta_ = 1_s/fps;
+	return true;
+}
+
+bool RawFileSource::do_process_event(const std::string& event_name, const event::pBasicEvent& event)
+{
+	const bool paused = paused_;
+	if (assign_events(event_name, event)
+			(paused_, "pause")) {
+		// Frames are paced from the moment of resuming, so the pause isn't caught up
+		if (paused != paused_) last_send = timestamp_t{};
+		return true;
+	}
+	if (!container_) return false;
+	size_t index = 0;
+	double seconds = 0.0;
+	if (assign_events(event_name, event)
+			(index, "seek")) {
+		container_index_ = std::min(index, container_->get_frame_count() - 1);
+	} else if (assign_events(event_name, event)
+			(seconds, "seek_time")) {
+		container_index_ = container_->find_frame(1_s * seconds);
+	} else return false;
+	frame.reset();
+	show_next_ = true;
+	return true;
+}
+
 bool RawFileSource::set_param(const core::Parameter &parameter)
 {
 	if (parameter.get_name() == "chunk") {
@@ -243,6 +390,16 @@ bool RawFileSource::set_param(const core::Parameter &parameter)
 		loop=parameter.get<bool>();
 	} else if (parameter.get_name() == "block") {
 		block=parameter.get<size_t>();
+	} else if (parameter.get_name() == "io") {
+		io_mode_=parse_io_mode(parameter.get<std::string>());
+	} else if (parameter.get_name() == "queue_depth") {
+		queue_depth_=parameter.get<size_t>();
+	} else if (parameter.get_name() == "io_backend") {
+		io_backend_=core::parse_async_backend(parameter.get<std::string>());
+	} else if (parameter.get_name() == "timestamps") {
+		use_timestamps_=parameter.get<bool>();
+	} else if (parameter.get_name() == "paused") {
+		paused_=parameter.get<bool>();
 	} else return base_type::set_param(parameter);
 	return true;
 }
@@ -12,6 +12,9 @@
 #define RAWFILESOURCE_H_
 
 #include "yuri/core/thread/IOThread.h"
+#include "yuri/event/BasicEventConsumer.h"
+#include "BlockReader.h"
+#include "ContainerReader.h"
 //#include <boost/date_time/posix_time/posix_time.hpp>
 
 namespace yuri {
@@ -26,7 +29,7 @@ enum class frame_type_t {
 	raw_audio
 };
 
-class RawFileSource: public core::IOThread
+class RawFileSource: public core::IOThread, public event::BasicEventConsumer
 {
 	using base_type = core::IOThread;
 public:
@@ -38,6 +41,11 @@ public:
 protected:
 	virtual bool set_param(const core::Parameter &parameter);
 	bool read_chunk();
+	//! Reads next frame using reader_ (for other modes than io_mode_t::stream)
+	bool read_block();
+	//! Reads next frame from container_
+	bool read_container_frame();
+	virtual bool do_process_event(const std::string& event_name, const event::pBasicEvent& event) override;
 	std::string next_file();
 	core::pFrame frame;
 	yuri::size_t position, chunk_size, width, height;
@@ -52,6 +60,19 @@ protected:
 	size_t sequence_pos;
 
 	frame_type_t frame_type_;
+	io_mode_t io_mode_;
+	size_t queue_depth_;
+	core::async_backend_t io_backend_;
+	std::unique_ptr<BlockReader> reader_;
+	std::unique_ptr<ContainerReader> container_;
+	size_t container_index_;
+	//! Pace frames from a container according to their stored timestamps
+	bool use_timestamps_;
+	//! Time between the current container frame and the previous one
+	duration_t container_delta_;
+	bool paused_;
+	//! Next frame should be sent immediately (after seeking)
+	bool show_next_;
 };
 
 }
@@ -0,0 +1,171 @@
+/*!
+ * @file 		test_container_reader.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "ContainerReader.h"
+#include "modules/filedump/FileDump.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/frame/compressed_frame_types.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace yuri {
+namespace rawfilesource {
+
+namespace {
+
+std::string temp_file_name(const std::string& name)
+{
+	return "/tmp/yuri_test_" + name + "_" + std::to_string(::getpid());
+}
+
+const std::vector<uint8_t> bitstream = {0, 0, 0, 1, 0x65, 1, 2, 3, 4};
+
+std::vector<core::pFrame> make_frames()
+{
+	std::vector<core::pFrame> frames;
+	auto video = core::RawVideoFrame::create_empty(core::raw_format::yuv420p, {64, 32});
+	for (size_t i = 0; i < video->get_planes_count(); ++i) {
+		std::fill(PLANE_DATA(video, i).begin(), PLANE_DATA(video, i).end(), static_cast<uint8_t>(i + 1));
+	}
+	frames.push_back(video);
+	frames.push_back(core::CompressedVideoFrame::create_empty(core::compressed_frame::h264, resolution_t{1920, 1080},
+			bitstream.data(), bitstream.size()));
+	// Odd sized payloads make the following frames start unaligned, unless padded
+	frames.push_back(core::RawAudioFrame::create_empty(core::raw_audio_format::signed_16bit, 2, 48000, 7));
+	auto rgb = core::RawVideoFrame::create_empty(core::raw_format::rgb24, {5, 3});
+	std::fill(PLANE_DATA(rgb, 0).begin(), PLANE_DATA(rgb, 0).end(), 42);
+	frames.push_back(rgb);
+
+	const timestamp_t start;
+	for (size_t i = 0; i < frames.size(); ++i) {
+		frames[i]->set_timestamp(start + i * 40_ms);
+		frames[i]->set_duration(40_ms);
+	}
+	return frames;
+}
+
+void write_container(const std::string& path, const std::vector<core::pFrame>& frames)
+{
+	log::Log log(std::clog);
+	auto params = dump::FileDump::configure();
+	params["filename"] = path;
+	params["container"] = true;
+	auto dump = std::dynamic_pointer_cast<core::IOFilter>(dump::FileDump::generate(log, core::pwThreadBase{}, params));
+	REQUIRE(dump);
+	for (const auto& f: frames) {
+		dump->simple_single_step(f);
+	}
+	// The index is written when the file is closed
+}
+
+std::vector<char> read_file(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void check_frames(const ContainerReader& reader, size_t count)
+{
+	REQUIRE(reader.get_frame_count() == count);
+	for (size_t i = 0; i < count; ++i) {
+		REQUIRE(reader.get_timestamp(i) == i * 40_ms);
+	}
+
+	auto video = std::dynamic_pointer_cast<core::RawVideoFrame>(reader.read_frame(0));
+	REQUIRE(video);
+	REQUIRE(video->get_format() == core::raw_format::yuv420p);
+	REQUIRE(video->get_resolution() == resolution_t{64, 32});
+	REQUIRE(video->get_duration() == 40_ms);
+	for (size_t i = 0; i < video->get_planes_count(); ++i) {
+		REQUIRE(PLANE_CONST_RAW_DATA(video, i)[0] == i + 1);
+	}
+	// Payload of raw frames is used in place from the mapping, aligned by the writer
+	REQUIRE(reinterpret_cast<uintptr_t>(PLANE_CONST_RAW_DATA(video, 0)) % core::container::default_alignment == 0);
+
+	auto compressed = std::dynamic_pointer_cast<core::CompressedVideoFrame>(reader.read_frame(1));
+	REQUIRE(compressed);
+	REQUIRE(compressed->get_format() == core::compressed_frame::h264);
+	REQUIRE(std::equal(compressed->begin(), compressed->end(), bitstream.begin()));
+
+	auto audio = std::dynamic_pointer_cast<core::RawAudioFrame>(reader.read_frame(2));
+	REQUIRE(audio);
+	REQUIRE(audio->get_channel_count() == 2);
+	REQUIRE(audio->get_sample_count() == 7);
+
+	if (count < 4) return;
+	auto rgb = std::dynamic_pointer_cast<core::RawVideoFrame>(reader.read_frame(3));
+	REQUIRE(rgb);
+	REQUIRE(rgb->get_resolution() == resolution_t{5, 3});
+	REQUIRE(reinterpret_cast<uintptr_t>(PLANE_CONST_RAW_DATA(rgb, 0)) % core::container::default_alignment == 0);
+	REQUIRE(PLANE_CONST_RAW_DATA(rgb, 0)[0] == 42);
+	REQUIRE(!reader.read_frame(4));
+}
+
+}
+
+TEST_CASE("Container written by filedump", "[container]")
+{
+	log::Log log(std::clog);
+	const auto path = temp_file_name("container");
+	const auto frames = make_frames();
+	write_container(path, frames);
+
+	SECTION("with index") {
+		auto reader = ContainerReader::open(path, log);
+		REQUIRE(reader);
+		check_frames(*reader, frames.size());
+
+		REQUIRE(reader->find_frame(0_s) == 0);
+		REQUIRE(reader->find_frame(-1_s) == 0);
+		REQUIRE(reader->find_frame(39_ms) == 0);
+		REQUIRE(reader->find_frame(40_ms) == 1);
+		REQUIRE(reader->find_frame(100_ms) == 2);
+		REQUIRE(reader->find_frame(10_s) == 3);
+	}
+	SECTION("truncated without index") {
+		// Cut the trailer, the index and the end of the last frame
+		auto data = read_file(path);
+		core::container::trailer_t trailer;
+		std::copy(data.end() - sizeof(trailer), data.end(), reinterpret_cast<char*>(&trailer));
+		REQUIRE(core::container::is_valid(trailer));
+		REQUIRE(trailer.frame_count == frames.size());
+		core::container::index_entry_t last;
+		const auto last_offset = trailer.index_offset + (trailer.frame_count - 1) * sizeof(last);
+		std::copy(&data[last_offset], &data[last_offset] + sizeof(last), reinterpret_cast<char*>(&last));
+		data.resize(last.offset + sizeof(core::container::frame_header_t) + last.payload_size - 1);
+		const auto truncated = temp_file_name("container_truncated");
+		std::ofstream(truncated, std::ios::binary).write(data.data(), data.size());
+
+		auto reader = ContainerReader::open(truncated, log);
+		REQUIRE(reader);
+		check_frames(*reader, frames.size() - 1);
+		REQUIRE(reader->find_frame(10_s) == 2);
+		reader.reset();
+		::unlink(truncated.c_str());
+	}
+	::unlink(path.c_str());
+}
+
+TEST_CASE("Invalid container", "[container]")
+{
+	log::Log log(std::clog);
+	const auto path = temp_file_name("container_invalid");
+	std::ofstream(path, std::ios::binary) << std::string(1024, 'x');
+	REQUIRE(!ContainerReader::open(path, log));
+	::unlink(path.c_str());
+}
+
+}
+}
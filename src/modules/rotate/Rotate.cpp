@@ -50,7 +50,7 @@ core::pRawVideoFrame rotate(const core::pRawVideoFrame& frame, size_t angle) {
 	if (angle == 90 || angle==270) output = core::RawVideoFrame::create_empty(frame->get_format(), {height, width}, true);
 	else if (angle == 180) output = core::RawVideoFrame::create_empty(frame->get_format(), res, true);
 	else return output;
-	const uint8_t * src = PLANE_RAW_DATA(frame,0);
+	const uint8_t * src = PLANE_CONST_RAW_DATA(frame,0);
 	uint8_t * dest = PLANE_RAW_DATA(output,0);
 	if (angle == 90) {
 		for (size_t y = 0; y < height; ++y) {
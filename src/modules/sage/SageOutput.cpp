@@ -167,7 +167,7 @@ core::pFrame SageOutput::do_simple_single_step(core::pFrame frame)
 			}
 //			log[log::info] << "input_line_width: " << input_line_width << ", sage_line_width: " << sage_line_width << " copy_lines: " <<copy_lines;
 			for (yuri::size_t line = 0; line < copy_lines; ++line) {
-				const uint8_t* data_start = PLANE_RAW_DATA(raw_frame,0) + line*input_line_width;
+				const uint8_t* data_start = PLANE_CONST_RAW_DATA(raw_frame,0) + line*input_line_width;
 				std::copy(data_start,data_start+copy_width,sail_buffer+line*sage_line_width);
 			}
 		}
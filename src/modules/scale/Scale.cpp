@@ -11,8 +11,7 @@
 #include "yuri/core/Module.h"
 #include "yuri/core/frame/raw_frame_types.h"
 #include "yuri/core/utils/assign_events.h"
-#include "yuri/core/utils/irange.h"
-#include <future>
+#include "yuri/core/thread/WorkerPool.h"
 
 namespace yuri {
 namespace scale {
@@ -28,17 +27,23 @@ core::Parameters Scale::configure()
     core::Parameters p = base_type::configure();
     p.set_description("Scale");
     p["resolution"]["Resolution to scale to"]                           = resolution_t{ 800, 600 };
-    p["fast"]["Enable fast scaling"]                                    = true;
-    p["threads"]["Number of threads to use for scaling (EXPERIMENTAL)"] = 1;
+    p["filter"]["Scaling filter (auto, bilinear, bicubic, lanczos, area, legacy). 'auto' uses area filter when shrinking and bilinear when enlarging, "
+                "'legacy' uses the original bilinear scaler (for packed formats only)."]
+        = "auto";
+    p["fast"]["Enable fast scaling (for the legacy filter)"]            = true;
+    p["simd"]["Instruction set to use (auto, avx2, sse4, none)"]        = "auto";
+    p["threads"]["Number of threads to use for scaling. Use 0 to select it automatically from frame size."] = 0;
     return p;
 }
 
 Scale::Scale(const log::Log& log_, core::pwThreadBase parent, const core::Parameters& parameters)
-    : base_type(log_, parent, std::string("scale")), event::BasicEventConsumer(log), resolution_(resolution_t{ 800, 600 }), fast_(true), threads_{ 1 }
+    : base_type(log_, parent, std::string("scale")), event::BasicEventConsumer(log), resolution_(resolution_t{ 800, 600 }), fast_(true), threads_{ 0 },
+      legacy_(false), filter_(filter_t::automatic), simd_level_(get_supported_level())
 {
     IOTHREAD_INIT(parameters)
     using namespace core::raw_format;
-    set_supported_formats({ rgb24, bgr24, rgba32, argb32, bgra32, abgr32, yuv444, yuyv422, yvyu422, uyvy422, vyuy422, yuva4444 });
+    set_supported_formats({ rgb24, bgr24, rgba32, argb32, bgra32, abgr32, yuv444, yuyv422, yvyu422, uyvy422, vyuy422, yuva4444, yuv444p, yuv422p,
+                            yuv420p, yuv411p });
     //	set_latency(1_ms);
 }
 
@@ -48,6 +53,20 @@ Scale::~Scale() noexcept
 
 namespace {
 
+bool is_legacy_format(format_t format)
+{
+    using namespace core::raw_format;
+    switch (format) {
+    case yuv444p:
+    case yuv422p:
+    case yuv420p:
+    case yuv411p:
+        return false;
+    default:
+        return true;
+    }
+}
+
 template <size_t pixel_size>
 struct scale_line_bilinear {
     inline static void eval(uint8_t* it, const uint8_t* top, const uint8_t* bottom, const dimension_t new_width, const dimension_t old_width,
@@ -226,42 +245,21 @@ core::pRawVideoFrame scale_image(const core::pRawVideoFrame& frame, const resolu
     const double   unscale_y    = static_cast<double>(res.height - 1) / (new_resolution.height - 1);
     const auto     linesize_in  = PLANE_DATA(frame, 0).get_line_size();
     const auto     linesize_out = PLANE_DATA(outframe, 0).get_line_size();
-    const uint8_t* it_in        = PLANE_RAW_DATA(frame, 0);
+    const uint8_t* it_in        = PLANE_CONST_RAW_DATA(frame, 0);
     uint8_t*       it           = PLANE_RAW_DATA(outframe, 0);
 
-    if (threads < 2) {
-        for (dimension_t line = 0; line < new_resolution.height - 1; ++line) {
+    core::parallel_for_lines(new_resolution.height - 1, linesize_in + linesize_out, threads, [&](size_t start, size_t end) {
+        auto it2 = it + start * linesize_out;
+        for (dimension_t line = start; line < end; ++line) {
             const dimension_t top     = static_cast<dimension_t>(line * unscale_y);
             const dimension_t bottom  = top + 1;
             const double      y_ratio = line * unscale_y - top;
-            kernel::eval(it, it_in + top * linesize_in, it_in + bottom * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
-
-            it += linesize_out;
-        }
-    } else {
-        const size_t                   task_lines = new_resolution.height / threads;
-        std::vector<std::future<void>> results(threads);
-        size_t                         start_line = 0;
-        auto f                                    = [&](size_t start, size_t end) {
-            auto it2 = it + start * linesize_out;
-            for (dimension_t line = start; line < end; ++line) {
-                const dimension_t top     = static_cast<dimension_t>(line * unscale_y);
-                const dimension_t bottom  = top + 1;
-                const double      y_ratio = line * unscale_y - top;
-                kernel::eval(it2, it_in + top * linesize_in, it_in + bottom * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
-                it2 += linesize_out;
-            }
-        };
-        for (auto i : irange(threads)) {
-            results[i] = std::async(std::launch::async, f, start_line, std::min(start_line + task_lines, new_resolution.height - 1));
-            start_line += task_lines;
-        }
-        for (auto& t : results) {
-            t.get();
+            kernel::eval(it2, it_in + top * linesize_in, it_in + bottom * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
+            it2 += linesize_out;
         }
-    }
-    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
-                 PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
+    });
+    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
+                 PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
     outframe->copy_video_params(*frame);
     return outframe;
 }
@@ -275,43 +273,21 @@ core::pRawVideoFrame scale_image_fast(const core::pRawVideoFrame& frame, const r
     const uint64_t unscale_y    = 256 * (res.height - 1) / (new_resolution.height - 1);
     const auto     linesize_in  = PLANE_DATA(frame, 0).get_line_size();
     const auto     linesize_out = PLANE_DATA(outframe, 0).get_line_size();
-    const uint8_t* it_in        = PLANE_RAW_DATA(frame, 0);
+    const uint8_t* it_in        = PLANE_CONST_RAW_DATA(frame, 0);
     uint8_t*       it           = PLANE_RAW_DATA(outframe, 0);
 
-    if (threads < 2) {
-        for (dimension_t line = 0; line < new_resolution.height - 1; ++line) {
+    core::parallel_for_lines(new_resolution.height - 1, linesize_in + linesize_out, threads, [&](size_t start, size_t end) {
+        auto it2 = it + start * linesize_out;
+        for (dimension_t line = start; line < end; ++line) {
             const dimension_t top     = line * unscale_y;
             const dimension_t bottom  = top + 256;
             const uint64_t    y_ratio = line * unscale_y - top;
-            kernel::eval(it, it_in + top / 256 * linesize_in, it_in + bottom / 256 * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
-
-            it += linesize_out;
-        }
-    } else {
-        const size_t                   task_lines = new_resolution.height / threads;
-        std::vector<std::future<void>> results(threads);
-        size_t                         start_line = 0;
-        auto f                                    = [&](size_t start, size_t end) {
-            auto it2 = it + start * linesize_out;
-            for (dimension_t line = start; line < end; ++line) {
-                const dimension_t top     = line * unscale_y;
-                const dimension_t bottom  = top + 256;
-                const uint64_t    y_ratio = line * unscale_y - top;
-                kernel::eval(it2, it_in + top / 256 * linesize_in, it_in + bottom / 256 * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
-
-                it2 += linesize_out;
-            }
-        };
-        for (auto i : irange(threads)) {
-            results[i] = std::async(std::launch::async, f, start_line, std::min(start_line + task_lines, new_resolution.height - 1));
-            start_line += task_lines;
-        }
-        for (auto& t : results) {
-            t.get();
+            kernel::eval(it2, it_in + top / 256 * linesize_in, it_in + bottom / 256 * linesize_in, new_resolution.width, res.width, unscale_x, y_ratio);
+            it2 += linesize_out;
         }
-    }
-    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
-                 PLANE_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
+    });
+    kernel::eval(PLANE_RAW_DATA(outframe, 0) + (new_resolution.height - 1) * linesize_out, PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in,
+                 PLANE_CONST_RAW_DATA(frame, 0) + (res.height - 1) * linesize_in, new_resolution.width, res.width, unscale_x, 0.0);
     outframe->copy_video_params(*frame);
     return outframe;
 }
@@ -327,6 +303,17 @@ core::pFrame Scale::do_special_single_step(core::pRawVideoFrame frame)
     // Simple sanity check
     if (resolution_.width > 1e5 || resolution_.height > 1e5)
         return {};
+    if (!legacy_ || !is_legacy_format(frame->get_format())) {
+        const auto format = frame->get_format();
+        const auto filter = legacy_ ? filter_t::bilinear : filter_;
+        if (!resampler_ || !resampler_->matches(format, frame->get_resolution(), resolution_, filter)) {
+            resampler_ = Resampler::create(format, frame->get_resolution(), resolution_, filter);
+        }
+        if (resampler_) {
+            return resampler_->scale(frame, simd_level_, threads_);
+        }
+        // Formats not handled by the resampler (e.g. yuyv with odd width) fall back to legacy code
+    }
     using namespace core::raw_format;
     if (fast_) {
         switch (frame->get_format()) {
@@ -373,10 +360,18 @@ core::pFrame Scale::do_special_single_step(core::pRawVideoFrame frame)
 }
 bool Scale::set_param(const core::Parameter& param)
 {
-    if (assign_parameters(param)    //
-        (resolution_, "resolution") //
-        (fast_, "fast")             //
-        (threads_, "threads")       //
+    if (param.get_name() == "filter") {
+        const auto name = param.get<std::string>();
+        legacy_         = iequals(name, "legacy");
+        if (!legacy_)
+            filter_ = parse_filter(name);
+        return true;
+    }
+    if (assign_parameters(param)                                //
+        (resolution_, "resolution")                             //
+        (fast_, "fast")                                         //
+        (threads_, "threads")                                   //
+        .parsed<std::string>(simd_level_, "simd", parse_level)  //
         )
         return true;
     return base_type::set_param(param);
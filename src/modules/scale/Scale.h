@@ -13,6 +13,7 @@
 #include "yuri/core/thread/SpecializedIOFilter.h"
 #include "yuri/core/frame/RawVideoFrame.h"
 #include "yuri/event/BasicEventConsumer.h"
+#include "resample.h"
 
 namespace yuri {
 namespace scale {
@@ -34,6 +35,11 @@ private:
     resolution_t resolution_;
     bool         fast_;
     size_t       threads_;
+    bool         legacy_;
+    filter_t     filter_;
+    simd_level_t simd_level_;
+
+    std::shared_ptr<Resampler> resampler_;
 };
 
 } /* namespace scale */
@@ -0,0 +1,453 @@
+/*!
+ * @file 		resample.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "resample.h"
+#include "yuri/core/frame/raw_frame_params.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/thread/WorkerPool.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef YURI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace yuri {
+namespace scale {
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+
+// Intermediate values after vertical pass have 6 fractional bits,
+// leaving enough headroom in int16_t for overshoots of bicubic and lanczos filters.
+const int vertical_shift   = filter_bits - 6;
+const int horizontal_shift = filter_bits + 6;
+// Padding of the intermediate line, so horizontal pass can read past the last sample
+const size_t line_padding = 16;
+
+double filter_radius(filter_t filter)
+{
+    switch (filter) {
+    case filter_t::bicubic:
+        return 2.0;
+    case filter_t::lanczos:
+        return 3.0;
+    default:
+        return 1.0;
+    }
+}
+
+double filter_value(filter_t filter, double x)
+{
+    x = std::abs(x);
+    switch (filter) {
+    case filter_t::bicubic: {
+        // Catmull-Rom (a = -0.5)
+        const double a = -0.5;
+        if (x < 1.0)
+            return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+        if (x < 2.0)
+            return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+        return 0.0;
+    }
+    case filter_t::lanczos:
+        if (x < 1e-8)
+            return 1.0;
+        if (x < 3.0)
+            return 3.0 * std::sin(pi * x) * std::sin(pi * x / 3.0) / (pi * pi * x * x);
+        return 0.0;
+    default:
+        return std::max(0.0, 1.0 - x);
+    }
+}
+
+inline int16_t saturate_int16(int value)
+{
+    return static_cast<int16_t>(std::min(std::max(value, -32768), 32767));
+}
+
+inline uint8_t saturate_uint8(int value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+/* ***************************************************************************
+ * 					Scalar code
+ *
+ * 	Operations match the SIMD kernels exactly (products and sums fit into int32_t),
+ * 	so all the implementations give bit exact results.
+ *************************************************************************** */
+
+void vertical_scalar(const uint8_t* const* rows, const int16_t* coefs, size_t taps, int16_t* out, size_t start, size_t count)
+{
+    for (size_t x = start; x < count; ++x) {
+        int acc = 0;
+        for (size_t k = 0; k < taps; ++k) {
+            acc += rows[k][x] * coefs[k];
+        }
+        out[x] = saturate_int16((acc + (1 << (vertical_shift - 1))) >> vertical_shift);
+    }
+}
+
+void horizontal_scalar(const int16_t* line, const filter_table_t& table, size_t offset, size_t stride, uint8_t* out)
+{
+    const size_t   taps  = table.taps;
+    const int16_t* coefs = table.coefficients.data();
+    for (size_t i = 0; i < table.offsets.size(); ++i, coefs += taps) {
+        const int16_t* in  = line + table.offsets[i] * stride + offset;
+        int            acc = 0;
+        for (size_t k = 0; k < taps; ++k) {
+            acc += in[k * stride] * coefs[k];
+        }
+        out[i * stride + offset] = saturate_uint8((acc + (1 << (horizontal_shift - 1))) >> horizontal_shift);
+    }
+}
+
+#ifdef YURI_SIMD_X86
+
+inline int coefficient_pair(const int16_t* coefs)
+{
+    return static_cast<int>(static_cast<uint32_t>(static_cast<uint16_t>(coefs[0])) | (static_cast<uint32_t>(static_cast<uint16_t>(coefs[1])) << 16));
+}
+
+YURI_TARGET_SSE41
+size_t vertical_sse41(const uint8_t* const* rows, const int16_t* coefs, size_t taps, int16_t* out, size_t count)
+{
+    const __m128i round = _mm_set1_epi32(1 << (vertical_shift - 1));
+    size_t        x     = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m128i lo = _mm_setzero_si128();
+        __m128i hi = _mm_setzero_si128();
+        for (size_t k = 0; k < taps; k += 2) {
+            const __m128i c = _mm_set1_epi32(coefficient_pair(coefs + k));
+            const __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k] + x)));
+            const __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k + 1] + x)));
+            lo              = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+            hi              = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+        }
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), vertical_shift);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), vertical_shift);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packs_epi32(lo, hi));
+    }
+    return x;
+}
+
+YURI_TARGET_AVX2
+size_t vertical_avx2(const uint8_t* const* rows, const int16_t* coefs, size_t taps, int16_t* out, size_t count)
+{
+    const __m256i round = _mm256_set1_epi32(1 << (vertical_shift - 1));
+    size_t        x     = 0;
+    for (; x + 16 <= count; x += 16) {
+        // Unpacking and packing stays within 128bit lanes, so the order of values is preserved
+        __m256i lo = _mm256_setzero_si256();
+        __m256i hi = _mm256_setzero_si256();
+        for (size_t k = 0; k < taps; k += 2) {
+            const __m256i c = _mm256_set1_epi32(coefficient_pair(coefs + k));
+            const __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k] + x)));
+            const __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k + 1] + x)));
+            lo              = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c));
+            hi              = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c));
+        }
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), vertical_shift);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), vertical_shift);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x), _mm256_packs_epi32(lo, hi));
+    }
+    return x;
+}
+
+// Horizontal pass for 4 components per pixel, processing whole pixel at once
+YURI_TARGET_SSE41
+void horizontal4_sse41(const int16_t* line, const filter_table_t& table, uint8_t* out)
+{
+    const __m128i  round = _mm_set1_epi32(1 << (horizontal_shift - 1));
+    const size_t   taps  = table.taps;
+    const int16_t* coefs = table.coefficients.data();
+    for (size_t i = 0; i < table.offsets.size(); ++i, coefs += taps) {
+        const int16_t* in  = line + table.offsets[i] * 4;
+        __m128i        acc = _mm_setzero_si128();
+        for (size_t k = 0; k < taps; k += 2) {
+            // Two neighbouring pixels, interleaved to pairs of the same component
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k * 4));
+            acc             = _mm_add_epi32(acc, _mm_madd_epi16(_mm_unpacklo_epi16(v, _mm_srli_si128(v, 8)), _mm_set1_epi32(coefficient_pair(coefs + k))));
+        }
+        acc                 = _mm_srai_epi32(_mm_add_epi32(acc, round), horizontal_shift);
+        const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(acc, acc), acc);
+        const int32_t pixel  = _mm_cvtsi128_si32(packed);
+        std::memcpy(out + i * 4, &pixel, 4);
+    }
+}
+
+#endif
+
+void vertical_pass(simd_level_t level, const uint8_t* const* rows, const int16_t* coefs, size_t taps, int16_t* out, size_t count)
+{
+    size_t done = 0;
+#ifdef YURI_SIMD_X86
+    if (level == simd_level_t::avx2) {
+        done = vertical_avx2(rows, coefs, taps, out, count);
+    } else if (level == simd_level_t::sse41) {
+        done = vertical_sse41(rows, coefs, taps, out, count);
+    }
+#else
+    (void)level;
+#endif
+    vertical_scalar(rows, coefs, taps, out, done, count);
+}
+
+void horizontal_pass(simd_level_t level, const Resampler::plane_t& plane, const int16_t* line, uint8_t* out)
+{
+#ifdef YURI_SIMD_X86
+    if (plane.packed4 && level >= simd_level_t::sse41) {
+        horizontal4_sse41(line, plane.horizontal[0], out);
+        return;
+    }
+#else
+    (void)level;
+#endif
+    for (const auto& comp : plane.components) {
+        horizontal_scalar(line, plane.horizontal[comp.table], comp.offset, comp.stride, out);
+    }
+}
+
+filter_t resolve_filter(filter_t filter, dimension_t src_size, dimension_t dst_size)
+{
+    if (filter != filter_t::automatic)
+        return filter;
+    return dst_size < src_size ? filter_t::area : filter_t::bilinear;
+}
+
+bool is_planar_8bit(const core::raw_format::raw_format_t& info)
+{
+    if (info.planes.empty())
+        return false;
+    for (const auto& p : info.planes) {
+        if (p.components.size() != 1 || p.bit_depth.first != 8 || p.bit_depth.second != 1)
+            return false;
+    }
+    return true;
+}
+}
+
+filter_t parse_filter(const std::string& name)
+{
+    if (iequals(name, "auto"))
+        return filter_t::automatic;
+    if (iequals(name, "bilinear"))
+        return filter_t::bilinear;
+    if (iequals(name, "bicubic"))
+        return filter_t::bicubic;
+    if (iequals(name, "lanczos"))
+        return filter_t::lanczos;
+    if (iequals(name, "area"))
+        return filter_t::area;
+    throw std::invalid_argument("Unknown filter " + name);
+}
+
+filter_table_t make_filter_table(dimension_t src_size, dimension_t dst_size, filter_t filter)
+{
+    filter = resolve_filter(filter, src_size, dst_size);
+    const double scale = static_cast<double>(src_size) / dst_size;
+    // When shrinking, filters are stretched over the area of the output sample
+    const double stretch = std::max(scale, 1.0);
+    const double support = filter == filter_t::area ? scale / 2.0 + 0.5 : filter_radius(filter) * stretch;
+    const int    last    = static_cast<int>(src_size) - 1;
+
+    std::vector<int>                 starts(dst_size);
+    std::vector<std::vector<double>> weights(dst_size);
+    size_t                           taps = 1;
+    for (dimension_t i = 0; i < dst_size; ++i) {
+        const double center = (i + 0.5) * scale - 0.5;
+        const int    left   = static_cast<int>(std::floor(center - support));
+        const int    right  = static_cast<int>(std::ceil(center + support));
+        // Samples outside of the image are replaced by the edge samples
+        int                 lo = std::min(std::max(left, 0), last);
+        int                 hi = std::min(std::max(right, 0), last);
+        std::vector<double> w(hi - lo + 1, 0.0);
+        for (int j = left; j <= right; ++j) {
+            double value;
+            if (filter == filter_t::area) {
+                value = std::max(0.0, std::min(j + 0.5, center + scale / 2.0) - std::max(j - 0.5, center - scale / 2.0));
+            } else {
+                value = filter_value(filter, (j - center) / stretch);
+            }
+            w[std::min(std::max(j, 0), last) - lo] += value;
+        }
+        // Trim zero weights
+        size_t first = 0, end = w.size();
+        while (first < end - 1 && std::abs(w[first]) < 1e-9)
+            ++first;
+        while (end > first + 1 && std::abs(w[end - 1]) < 1e-9)
+            --end;
+        starts[i]  = lo + static_cast<int>(first);
+        weights[i] = std::vector<double>(w.begin() + first, w.begin() + end);
+        taps       = std::max(taps, weights[i].size());
+    }
+
+    filter_table_t table;
+    table.taps = taps + (taps & 1);
+    table.offsets.resize(dst_size);
+    table.coefficients.assign(dst_size * table.taps, 0);
+    for (dimension_t i = 0; i < dst_size; ++i) {
+        // Keep the window inside the image (except for the padding)
+        const int start = std::max(std::min(starts[i], static_cast<int>(src_size) - static_cast<int>(taps)), 0);
+        const int shift = starts[i] - start;
+        table.offsets[i] = start;
+
+        const auto& w   = weights[i];
+        double      sum = 0.0;
+        for (const auto v : w)
+            sum += v;
+        int16_t* coefs   = &table.coefficients[i * table.taps + shift];
+        int      total   = 0;
+        size_t   largest = 0;
+        for (size_t k = 0; k < w.size(); ++k) {
+            coefs[k] = static_cast<int16_t>(std::lround(w[k] / sum * (1 << filter_bits)));
+            total += coefs[k];
+            if (std::abs(w[k]) > std::abs(w[largest]))
+                largest = k;
+        }
+        // Coefficients have to sum exactly to 1.0, otherwise flat areas would change
+        coefs[largest] = static_cast<int16_t>(coefs[largest] + (1 << filter_bits) - total);
+    }
+    return table;
+}
+
+Resampler::Resampler(format_t format, resolution_t src_res, resolution_t dst_res, filter_t filter)
+    : format_(format), src_res_(src_res), dst_res_(dst_res), filter_(filter)
+{
+    using namespace core::raw_format;
+    auto packed_plane = [&](size_t bpp) {
+        plane_t plane;
+        plane.src_line_bytes = src_res.width * bpp;
+        plane.src_height     = src_res.height;
+        plane.dst_height     = dst_res.height;
+        plane.vertical       = make_filter_table(src_res.height, dst_res.height, filter);
+        plane.packed4        = false;
+        return plane;
+    };
+    auto yuv422_plane = [&](size_t y, size_t u, size_t v) {
+        if (src_res.width < 2 || (src_res.width & 1) || (dst_res.width & 1))
+            return;
+        auto plane       = packed_plane(2);
+        plane.horizontal = { make_filter_table(src_res.width, dst_res.width, filter), make_filter_table(src_res.width / 2, dst_res.width / 2, filter) };
+        plane.components = { { y, 2, 0 }, { u, 4, 1 }, { v, 4, 1 } };
+        planes_.push_back(std::move(plane));
+    };
+    switch (format) {
+    case rgb24:
+    case bgr24:
+    case yuv444: {
+        auto plane       = packed_plane(3);
+        plane.horizontal = { make_filter_table(src_res.width, dst_res.width, filter) };
+        plane.components = { { 0, 3, 0 }, { 1, 3, 0 }, { 2, 3, 0 } };
+        planes_.push_back(std::move(plane));
+    } break;
+    case rgba32:
+    case argb32:
+    case bgra32:
+    case abgr32:
+    case yuva4444: {
+        auto plane       = packed_plane(4);
+        plane.horizontal = { make_filter_table(src_res.width, dst_res.width, filter) };
+        plane.components = { { 0, 4, 0 }, { 1, 4, 0 }, { 2, 4, 0 }, { 3, 4, 0 } };
+        plane.packed4    = true;
+        planes_.push_back(std::move(plane));
+    } break;
+    case yuyv422:
+    case yvyu422:
+        yuv422_plane(0, 1, 3);
+        break;
+    case uyvy422:
+    case vyuy422:
+        yuv422_plane(1, 0, 2);
+        break;
+    default:
+        try {
+            const auto& info = get_format_info(format);
+            if (!is_planar_8bit(info))
+                break;
+            for (const auto& p : info.planes) {
+                const auto src_params = core::RawVideoFrame::get_plane_params(p, src_res);
+                const auto dst_params = core::RawVideoFrame::get_plane_params(p, dst_res);
+                const auto src_plane  = std::get<2>(src_params);
+                const auto dst_plane  = std::get<2>(dst_params);
+                if (!src_plane || !dst_plane) {
+                    planes_.clear();
+                    break;
+                }
+                plane_t plane;
+                plane.src_line_bytes = src_plane.width;
+                plane.src_height     = src_plane.height;
+                plane.dst_height     = dst_plane.height;
+                plane.vertical       = make_filter_table(src_plane.height, dst_plane.height, filter);
+                plane.horizontal     = { make_filter_table(src_plane.width, dst_plane.width, filter) };
+                plane.components     = { { 0, 1, 0 } };
+                plane.packed4        = false;
+                planes_.push_back(std::move(plane));
+            }
+        }
+        catch (std::runtime_error&) {
+        }
+        break;
+    }
+}
+
+std::shared_ptr<Resampler> Resampler::create(format_t format, resolution_t src_res, resolution_t dst_res, filter_t filter)
+{
+    if (!src_res || !dst_res)
+        return {};
+    std::shared_ptr<Resampler> resampler(new Resampler(format, src_res, dst_res, filter));
+    if (resampler->planes_.empty())
+        return {};
+    return resampler;
+}
+
+core::pRawVideoFrame Resampler::scale(const core::pRawVideoFrame& frame, simd_level_t level, size_t threads) const
+{
+    if (frame->get_planes_count() != planes_.size())
+        return {};
+    auto outframe = core::RawVideoFrame::create_empty(format_, dst_res_);
+    if (!outframe)
+        return {};
+    for (size_t i = 0; i < planes_.size(); ++i) {
+        const auto& src = PLANE_CONST_DATA(frame, i);
+        auto&       dst = PLANE_DATA(outframe, i);
+        if (src.get_line_size() < planes_[i].src_line_bytes)
+            return {};
+        scale_plane(planes_[i], PLANE_CONST_RAW_DATA(frame, i), src.get_line_size(), PLANE_RAW_DATA(outframe, i), dst.get_line_size(), level, threads);
+    }
+    outframe->copy_video_params(*frame);
+    return outframe;
+}
+
+void Resampler::scale_plane(const plane_t& plane, const uint8_t* src, size_t src_linesize, uint8_t* dst, size_t dst_linesize, simd_level_t level,
+                            size_t threads) const
+{
+    const auto& vertical = plane.vertical;
+    core::parallel_for_lines(plane.dst_height, plane.src_line_bytes * vertical.taps + dst_linesize, threads, [&](size_t begin, size_t end) {
+        std::vector<int16_t>        line(plane.src_line_bytes + line_padding, 0);
+        std::vector<const uint8_t*> rows(vertical.taps);
+        for (size_t y = begin; y < end; ++y) {
+            const size_t first = vertical.offsets[y];
+            for (size_t k = 0; k < vertical.taps; ++k) {
+                // The padding tap may point past the last line, it has zero coefficient
+                rows[k] = src + std::min<size_t>(first + k, plane.src_height - 1) * src_linesize;
+            }
+            vertical_pass(level, rows.data(), &vertical.coefficients[y * vertical.taps], vertical.taps, line.data(), plane.src_line_bytes);
+            horizontal_pass(level, plane, line.data(), dst + y * dst_linesize);
+        }
+    });
+}
+
+} /* namespace scale */
+} /* namespace yuri */
@@ -0,0 +1,118 @@
+/*!
+ * @file 		resample.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Separable image resampling with precomputed fixed point filter tables.
+ *
+ * Every output line is computed by a vertical pass (over all bytes of the line, regardless of format)
+ * into a line of 16bit intermediate values, followed by a horizontal pass for every
+ * component of the format. All the arithmetics is in integers, so the result doesn't depend
+ * on number of threads or on the instruction set used.
+ */
+
+#ifndef RESAMPLE_H_
+#define RESAMPLE_H_
+
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/utils/cpu_features.h"
+#include <vector>
+
+namespace yuri {
+namespace scale {
+
+enum class filter_t {
+    //! Bilinear when enlarging, area when shrinking
+    automatic,
+    bilinear,
+    //! Catmull-Rom spline
+    bicubic,
+    //! Lanczos with 3 lobes
+    lanczos,
+    //! Box filter averaging the area covered by output pixel
+    area,
+};
+
+/*!
+ * Parses filter name (auto, bilinear, bicubic, lanczos, area)
+ * @throw std::invalid_argument for unknown names
+ */
+filter_t parse_filter(const std::string& name);
+
+using core::cpu::simd_level_t;
+using core::cpu::get_supported_level;
+using core::cpu::parse_level;
+
+//! Number of fractional bits of the filter coefficients
+const int filter_bits = 14;
+
+/*!
+ * Filter coefficients for resampling a single dimension.
+ * Output sample @em i is computed from input samples offsets[i] .. offsets[i] + taps - 1
+ * with coefficients coefficients[i * taps] .. coefficients[i * taps + taps - 1].
+ *
+ * Number of taps is always even, padded by zero coefficients if needed,
+ * so the last input sample may lie one sample past the input.
+ */
+struct filter_table_t {
+    size_t               taps;
+    std::vector<int32_t> offsets;
+    std::vector<int16_t> coefficients;
+};
+
+filter_table_t make_filter_table(dimension_t src_size, dimension_t dst_size, filter_t filter);
+
+/*!
+ * Precomputed scaling of frames with given format and resolution.
+ */
+class Resampler {
+public:
+    /*!
+     * Prepares resampling
+     * @return Resampler or an empty pointer if the format is not supported
+     */
+    static std::shared_ptr<Resampler> create(format_t format, resolution_t src_res, resolution_t dst_res, filter_t filter);
+
+    bool matches(format_t format, resolution_t src_res, resolution_t dst_res, filter_t filter) const
+    {
+        return format == format_ && src_res == src_res_ && dst_res == dst_res_ && filter == filter_;
+    }
+
+    core::pRawVideoFrame scale(const core::pRawVideoFrame& frame, simd_level_t level, size_t threads) const;
+
+    //! Single component of a line, samples are at @em offset + i * @em stride (in both input and output)
+    struct component_t {
+        size_t offset;
+        size_t stride;
+        size_t table;
+    };
+
+    struct plane_t {
+        size_t                      src_line_bytes;
+        dimension_t                 src_height;
+        dimension_t                 dst_height;
+        filter_table_t              vertical;
+        std::vector<filter_table_t> horizontal;
+        std::vector<component_t>    components;
+        //! All components share a single table and form 4 byte pixels, so they can be processed together
+        bool                        packed4;
+    };
+
+private:
+    Resampler(format_t format, resolution_t src_res, resolution_t dst_res, filter_t filter);
+    void scale_plane(const plane_t& plane, const uint8_t* src, size_t src_linesize, uint8_t* dst, size_t dst_linesize, simd_level_t level,
+                     size_t threads) const;
+
+    format_t             format_;
+    resolution_t         src_res_;
+    resolution_t         dst_res_;
+    filter_t             filter_;
+    std::vector<plane_t> planes_;
+};
+
+} /* namespace scale */
+} /* namespace yuri */
+
+#endif /* RESAMPLE_H_ */
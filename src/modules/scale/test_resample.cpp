@@ -0,0 +1,159 @@
+/*!
+ * @file 		test_resample.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "resample.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <random>
+
+namespace yuri {
+namespace scale {
+
+namespace {
+const std::vector<filter_t> filters = { filter_t::automatic, filter_t::bilinear, filter_t::bicubic, filter_t::lanczos, filter_t::area };
+
+const std::vector<format_t> formats
+    = { core::raw_format::rgb24, core::raw_format::rgba32, core::raw_format::yuyv422, core::raw_format::uyvy422, core::raw_format::yuv420p,
+        core::raw_format::yuv422p };
+
+core::pRawVideoFrame make_random_frame(format_t format, resolution_t res)
+{
+    std::mt19937                       gen(format + res.width);
+    std::uniform_int_distribution<int> dist(0, 255);
+    auto                               frame = core::RawVideoFrame::create_empty(format, res);
+    for (auto& plane : *frame) {
+        for (auto& v : plane) {
+            v = static_cast<uint8_t>(dist(gen));
+        }
+    }
+    return frame;
+}
+
+bool frames_equal(const core::pRawVideoFrame& a, const core::pRawVideoFrame& b)
+{
+    if (a->get_planes_count() != b->get_planes_count())
+        return false;
+    for (size_t i = 0; i < a->get_planes_count(); ++i) {
+        const auto& pa = PLANE_DATA(a, i);
+        const auto& pb = PLANE_DATA(b, i);
+        if (pa.size() != pb.size() || !std::equal(pa.begin(), pa.end(), pb.begin()))
+            return false;
+    }
+    return true;
+}
+}
+
+TEST_CASE("Filter tables", "[scale]")
+{
+    for (auto filter : filters) {
+        for (auto sizes : { std::make_pair(1920, 1280), std::make_pair(640, 1920), std::make_pair(5, 3), std::make_pair(2, 7), std::make_pair(100, 100) }) {
+            INFO("filter " << static_cast<int>(filter) << ", " << sizes.first << " -> " << sizes.second);
+            const auto table = make_filter_table(sizes.first, sizes.second, filter);
+            REQUIRE(table.taps % 2 == 0);
+            REQUIRE(table.offsets.size() == static_cast<size_t>(sizes.second));
+            REQUIRE(table.coefficients.size() == table.taps * sizes.second);
+            for (int i = 0; i < sizes.second; ++i) {
+                int sum = 0;
+                for (size_t k = 0; k < table.taps; ++k) {
+                    const auto c = table.coefficients[i * table.taps + k];
+                    sum += c;
+                    // Only the padding may point past the input
+                    if (c != 0)
+                        REQUIRE(table.offsets[i] + k < static_cast<size_t>(sizes.first));
+                }
+                REQUIRE(sum == (1 << filter_bits));
+                REQUIRE(table.offsets[i] >= 0);
+            }
+        }
+    }
+    SECTION("Same size with bilinear filter is identity")
+    {
+        const auto table = make_filter_table(10, 10, filter_t::bilinear);
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(table.offsets[i] <= i);
+            REQUIRE(table.coefficients[i * table.taps + i - table.offsets[i]] == (1 << filter_bits));
+        }
+    }
+}
+
+TEST_CASE("Area downscale averages pixels", "[scale]")
+{
+    auto frame = core::RawVideoFrame::create_empty(core::raw_format::rgb24, { 4, 2 });
+    auto& data = PLANE_DATA(frame, 0);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 10);
+    }
+    const auto resampler = Resampler::create(core::raw_format::rgb24, { 4, 2 }, { 2, 1 }, filter_t::area);
+    REQUIRE(resampler);
+    const auto out = resampler->scale(frame, simd_level_t::none, 1);
+    REQUIRE(out);
+    REQUIRE(out->get_resolution() == resolution_t{ 2, 1 });
+    const auto& res = PLANE_DATA(out, 0);
+    // Average of components at offsets 0, 3, 12 and 15 is 75
+    REQUIRE(res[0] == 75);
+    REQUIRE(res[1] == 85);
+    REQUIRE(res[3] == 135);
+}
+
+TEST_CASE("Flat images stay flat", "[scale]")
+{
+    for (auto format : formats) {
+        for (auto filter : filters) {
+            auto frame = core::RawVideoFrame::create_empty(format, { 64, 32 });
+            for (auto& plane : *frame) {
+                std::fill(plane.begin(), plane.end(), 200);
+            }
+            for (auto res : { resolution_t{ 30, 14 }, resolution_t{ 150, 70 } }) {
+                INFO(core::raw_format::get_format_name(format) << ", filter " << static_cast<int>(filter) << ", width " << res.width);
+                const auto out = Resampler::create(format, frame->get_resolution(), res, filter)->scale(frame, get_supported_level(), 0);
+                REQUIRE(out);
+                for (const auto& plane : *out) {
+                    REQUIRE(std::all_of(plane.begin(), plane.end(), [](uint8_t v) { return v == 200; }));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Scaling is bit exact across instruction sets and thread counts", "[scale]")
+{
+    std::vector<simd_level_t> levels = { simd_level_t::sse41, simd_level_t::avx2 };
+    if (get_supported_level() < simd_level_t::avx2)
+        levels.pop_back();
+    if (get_supported_level() < simd_level_t::sse41)
+        levels.clear();
+
+    for (auto format : formats) {
+        const auto frame = make_random_frame(format, { 98, 54 });
+        for (auto filter : filters) {
+            for (auto res : { resolution_t{ 40, 20 }, resolution_t{ 202, 100 }, resolution_t{ 98, 30 } }) {
+                INFO(core::raw_format::get_format_name(format) << ", filter " << static_cast<int>(filter) << ", width " << res.width);
+                const auto resampler = Resampler::create(format, frame->get_resolution(), res, filter);
+                REQUIRE(resampler);
+                const auto expected = resampler->scale(frame, simd_level_t::none, 1);
+                REQUIRE(expected);
+                REQUIRE(expected->get_resolution() == res);
+                REQUIRE(frames_equal(expected, resampler->scale(frame, simd_level_t::none, 4)));
+                for (auto level : levels) {
+                    REQUIRE(frames_equal(expected, resampler->scale(frame, level, 1)));
+                    REQUIRE(frames_equal(expected, resampler->scale(frame, level, 3)));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Unsupported formats", "[scale]")
+{
+    REQUIRE(!Resampler::create(core::raw_format::rgb_r10k_le, { 64, 32 }, { 32, 16 }, filter_t::bilinear));
+    // Packed 4:2:2 needs even widths
+    REQUIRE(!Resampler::create(core::raw_format::yuyv422, { 64, 32 }, { 33, 16 }, filter_t::bilinear));
+}
+}
+}
@@ -185,7 +185,7 @@ void update_texture(const Texture& texture_, const core::pRawVideoFrame& f)
 					reinterpret_cast<void**>(&pixels),
 					&pitch);
 
-	const auto data = PLANE_RAW_DATA(f, 0);
+	const auto data = PLANE_CONST_RAW_DATA(f, 0);
 	const int linesize = (*f)[0].get_line_size();
 	const auto copy_bytes = std::min(linesize, pitch);
 	for (auto line: irange(res.height)) {
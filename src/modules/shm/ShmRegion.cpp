@@ -0,0 +1,202 @@
+/*!
+ * @file 		ShmRegion.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "ShmRegion.h"
+#include "yuri/exception/InitializationFailed.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#include <ctime>
+#endif
+
+namespace yuri {
+namespace shm {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex requires a plain 32bit word");
+
+namespace {
+
+const uint32_t shm_magic = 0x4D485359; // "YSHM"
+const uint32_t shm_version = 2;
+// Data of the slots have to be page aligned, so readers can protect them
+const size_t page_size = std::max<size_t>(4096, sysconf(_SC_PAGESIZE));
+
+const uint64_t lease_readers_mask = 0xFFFFFFFF;
+
+size_t align_to(size_t value, size_t alignment)
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+std::string get_shm_name(const std::string& name)
+{
+	return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+}
+
+bool is_valid(const shm_frame_t& frame, size_t slot_size)
+{
+	if (frame.plane_count < 1 || frame.plane_count > max_shm_planes) return false;
+	for (size_t i = 0; i < frame.plane_count; ++i) {
+		const auto& p = frame.planes[i];
+		if (p.offset > slot_size || p.size > slot_size - p.offset) return false;
+		if (frame.type == shm_frame_type_t::raw_video && static_cast<uint64_t>(p.line_size) * p.height > p.size) return false;
+	}
+	return true;
+}
+
+ShmRegion::ShmRegion(std::string name, uint8_t* base, size_t size, bool owner):
+name_(std::move(name)),base_(base),size_(size),owner_(owner),
+header_(reinterpret_cast<shm_header_t*>(base)),
+slots_(reinterpret_cast<shm_slot_t*>(base + align_to(sizeof(shm_header_t), 64)))
+{
+}
+
+ShmRegion::~ShmRegion() noexcept
+{
+	munmap(base_, size_);
+	if (owner_) {
+		shm_unlink(name_.c_str());
+	}
+}
+
+pShmRegion ShmRegion::create(const std::string& name, size_t slot_count, size_t slot_size)
+{
+	const auto shm_name = get_shm_name(name);
+	slot_count = std::max<size_t>(slot_count, 2);
+	slot_size = align_to(slot_size, page_size);
+	const size_t data_offset = align_to(align_to(sizeof(shm_header_t), 64) + slot_count * sizeof(shm_slot_t), page_size);
+	const size_t size = data_offset + slot_count * slot_size;
+
+	// Readers of a previous region keep their mapping, but will see a new session
+	shm_unlink(shm_name.c_str());
+	const int fd = shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd < 0) throw exception::InitializationFailed("Failed to create shared memory " + shm_name);
+	if (ftruncate(fd, size) != 0) {
+		close(fd);
+		shm_unlink(shm_name.c_str());
+		throw exception::InitializationFailed("Failed to allocate shared memory " + shm_name);
+	}
+	auto base = static_cast<uint8_t*>(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+	close(fd);
+	if (base == MAP_FAILED) {
+		shm_unlink(shm_name.c_str());
+		throw exception::InitializationFailed("Failed to map shared memory " + shm_name);
+	}
+	pShmRegion region(new ShmRegion(shm_name, base, size, true));
+	auto& header = region->header();
+	header.version = shm_version;
+	header.session = std::random_device{}() | (static_cast<uint64_t>(std::random_device{}()) << 32);
+	header.slot_count = slot_count;
+	header.slot_size = slot_size;
+	header.data_offset = data_offset;
+	new (&header.sequence) std::atomic<uint64_t>(0);
+	new (&header.notify) std::atomic<uint32_t>(0);
+	for (size_t i = 0; i < slot_count; ++i) {
+		auto& slot = region->slot(i);
+		new (&slot.sequence) std::atomic<uint64_t>(0);
+		new (&slot.lease) std::atomic<uint64_t>(0);
+	}
+	// Magic is set last, so readers never see a partially initialized header
+	std::atomic_thread_fence(std::memory_order_release);
+	header.magic = shm_magic;
+	return region;
+}
+
+pShmRegion ShmRegion::open(const std::string& name)
+{
+	const auto shm_name = get_shm_name(name);
+	const int fd = shm_open(shm_name.c_str(), O_RDWR, 0);
+	if (fd < 0) return {};
+	struct stat st;
+	if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(shm_header_t)) {
+		close(fd);
+		return {};
+	}
+	const size_t size = st.st_size;
+	auto base = static_cast<uint8_t*>(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+	close(fd);
+	if (base == MAP_FAILED) return {};
+	pShmRegion region(new ShmRegion(shm_name, base, size, false));
+	const auto& header = region->header();
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (header.magic != shm_magic || header.version != shm_version ||
+			header.data_offset + header.slot_count * header.slot_size > size) {
+		return {};
+	}
+	// Only header and slot descriptors have to be writable for readers
+	if (mprotect(base + header.data_offset, size - header.data_offset, PROT_READ) != 0) return {};
+	return region;
+}
+
+void ShmRegion::publish(uint64_t sequence)
+{
+	header_->sequence.store(sequence, std::memory_order_release);
+	header_->notify.fetch_add(1, std::memory_order_release);
+#ifdef __linux__
+	syscall(SYS_futex, &header_->notify, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+bool ShmRegion::wait(uint64_t sequence, duration_t timeout)
+{
+	const auto notify = header_->notify.load(std::memory_order_acquire);
+	if (header_->sequence.load(std::memory_order_acquire) != sequence) return true;
+#ifdef __linux__
+	const timespec ts = {static_cast<time_t>(timeout.value / 1000000), static_cast<long>(timeout.value % 1000000) * 1000};
+	syscall(SYS_futex, &header_->notify, FUTEX_WAIT, notify, &ts, nullptr, 0);
+#else
+	(void)notify;
+	std::this_thread::sleep_for(std::chrono::microseconds(std::min<int64_t>(timeout.value, 1000)));
+#endif
+	return header_->sequence.load(std::memory_order_acquire) != sequence;
+}
+bool ShmRegion::acquire(size_t index, uint64_t sequence, uint32_t& generation)
+{
+	auto& slot = slots_[index];
+	generation = static_cast<uint32_t>(slot.lease.fetch_add(1) >> 32);
+	if (slot.sequence.load() != sequence) {
+		release(index, generation);
+		return false;
+	}
+	return true;
+}
+
+void ShmRegion::release(size_t index, uint32_t generation)
+{
+	auto& lease = slots_[index].lease;
+	auto value = lease.load();
+	do {
+		if ((value >> 32) != generation || !(value & lease_readers_mask)) return;
+	} while (!lease.compare_exchange_weak(value, value - 1));
+}
+
+uint32_t ShmRegion::get_readers(size_t index)
+{
+	return static_cast<uint32_t>(slots_[index].lease.load() & lease_readers_mask);
+}
+
+void ShmRegion::reclaim(size_t index)
+{
+	auto& lease = slots_[index].lease;
+	auto value = lease.load();
+	while (!lease.compare_exchange_weak(value, ((value >> 32) + 1) << 32)) {}
+}
+
+}
+}
@@ -0,0 +1,164 @@
+/*!
+ * @file 		ShmRegion.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Layout of the shared memory and the protocol used to pass frames.
+ *
+ * The region starts with shm_header_t, followed by an array of slot descriptors
+ * and page aligned data of the slots. There's a single writer (shm_sink)
+ * and any number of readers (shm_source), every reader receives all frames
+ * unless it falls behind by more than the number of slots.
+ *
+ * Frame N (counted from 1) is written to slot N % slot_count:
+ *  - the writer clears the slot sequence and waits until the slot has no readers,
+ *  - writes data and description, stores N into the slot sequence and the header sequence
+ *    and wakes up the readers (futex on header notify counter),
+ *  - a reader increments slot readers and only then verifies the slot sequence,
+ *    so either the writer sees the reader, or the reader sees the slot was invalidated.
+ *
+ * Readers keep the slot referenced as long as the frame (wrapping the slot memory) lives.
+ * The reader count shares the lease word with a generation of the slot. When readers
+ * don't release the slot in time (probably crashed), the writer reclaims it by starting
+ * a new generation, and releases from the old generation are ignored.
+ *
+ * Readers map the slot data read-only.
+ */
+
+#ifndef SHMREGION_H_
+#define SHMREGION_H_
+
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/time_types.h"
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace yuri {
+namespace shm {
+
+enum class shm_frame_type_t: uint32_t {
+	none = 0,
+	raw_video,
+	compressed_video,
+	raw_audio,
+};
+
+const size_t max_shm_planes = 4;
+
+struct shm_plane_t {
+	uint64_t	offset;
+	uint64_t	size;
+	uint32_t	width;
+	uint32_t	height;
+	uint32_t	line_size;
+};
+
+struct shm_frame_t {
+	shm_frame_type_t	type;
+	format_t			format;
+	uint32_t			width;
+	uint32_t			height;
+	uint32_t			interlace;
+	uint32_t			field_order;
+	uint32_t			channels;
+	uint32_t			sampling_frequency;
+	//! Nanoseconds since the clock epoch, so timestamps are comparable across processes
+	int64_t				timestamp;
+	//! Duration in microseconds
+	int64_t				duration;
+	uint64_t			index;
+	uint32_t			plane_count;
+	shm_plane_t			planes[max_shm_planes];
+};
+
+struct shm_slot_t {
+	std::atomic<uint64_t>	sequence;
+	//! Generation of the slot in upper 32 bits, number of readers in lower 32 bits
+	std::atomic<uint64_t>	lease;
+	shm_frame_t				frame;
+};
+
+struct shm_header_t {
+	uint32_t				magic;
+	uint32_t				version;
+	//! Random identifier of the region, changes when the writer recreates it
+	uint64_t				session;
+	uint64_t				slot_count;
+	uint64_t				slot_size;
+	uint64_t				data_offset;
+	//! Sequence number of the last published frame
+	std::atomic<uint64_t>	sequence;
+	//! Futex word, incremented on every published frame
+	std::atomic<uint32_t>	notify;
+};
+
+/*!
+ * Checks a frame description written by another process.
+ * @return true if all planes lie within a slot of @em slot_size bytes
+ * 			and planes of raw video are large enough for their lines
+ */
+bool is_valid(const shm_frame_t& frame, size_t slot_size);
+
+class ShmRegion;
+using pShmRegion = std::shared_ptr<ShmRegion>;
+
+class ShmRegion {
+public:
+	/*!
+	 * Creates (or replaces) a named region
+	 * @throw exception::InitializationFailed when the region can't be created
+	 */
+	static pShmRegion create(const std::string& name, size_t slot_count, size_t slot_size);
+	//! Opens an existing region for reading, returns empty pointer if it doesn't exist (yet)
+	static pShmRegion open(const std::string& name);
+
+	~ShmRegion() noexcept;
+	ShmRegion(const ShmRegion&) = delete;
+	ShmRegion& operator=(const ShmRegion&) = delete;
+
+	shm_header_t&	header() { return *header_; }
+	shm_slot_t&		slot(size_t index) { return slots_[index]; }
+	//! Data of a slot, read-only for regions opened by open()
+	uint8_t*		slot_data(size_t index) { return base_ + header_->data_offset + index * header_->slot_size; }
+	size_t			get_slot_count() const { return header_->slot_count; }
+	size_t			get_slot_size() const { return header_->slot_size; }
+
+	//! Publishes frame @em sequence, that has already been written to its slot
+	void			publish(uint64_t sequence);
+	/*!
+	 * Waits until a frame newer than @em sequence is published
+	 * @return true if there's a new frame
+	 */
+	bool			wait(uint64_t sequence, duration_t timeout);
+
+	/*!
+	 * Registers a reader of frame @em sequence in slot @em index
+	 * @param generation receives the generation of the slot, needed to release it
+	 * @return false if the slot doesn't contain the frame anymore
+	 */
+	bool			acquire(size_t index, uint64_t sequence, uint32_t& generation);
+	//! Unregisters a reader, ignored if the slot was reclaimed since it was acquired
+	void			release(size_t index, uint32_t generation);
+	//! Number of readers of a slot
+	uint32_t		get_readers(size_t index);
+	//! Drops all readers of a slot, their releases will be ignored
+	void			reclaim(size_t index);
+
+private:
+	ShmRegion(std::string name, uint8_t* base, size_t size, bool owner);
+
+	std::string		name_;
+	uint8_t*		base_;
+	size_t			size_;
+	bool			owner_;
+	shm_header_t*	header_;
+	shm_slot_t*		slots_;
+};
+
+}
+}
+
+#endif /* SHMREGION_H_ */
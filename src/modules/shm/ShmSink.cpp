@@ -0,0 +1,170 @@
+/*!
+ * @file 		ShmSink.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "ShmSink.h"
+#include "yuri/core/Module.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include <thread>
+
+namespace yuri {
+namespace shm {
+
+IOTHREAD_GENERATOR(ShmSink)
+
+core::Parameters ShmSink::configure()
+{
+	core::Parameters p = core::IOFilter::configure();
+	p.set_description("Passes frames to other processes through shared memory. Frames are read by shm_source with the same name.");
+	p["name"]["Name of the shared memory"]="yuri";
+	p["slots"]["Number of frames in the shared memory"]=4;
+	p["slot_size"]["Maximal size of a frame in bytes"]=16*1024*1024;
+	p["timeout"]["Maximal time to wait for readers to release a slot (in ms)"]=1000;
+	return p;
+}
+
+ShmSink::ShmSink(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
+core::IOFilter(log_,parent,std::string("shm_sink")),name_("yuri"),slot_count_(4),
+slot_size_(16*1024*1024),timeout_(1_s),sequence_(0),dropped_(0)
+{
+	IOTHREAD_INIT(parameters)
+	region_ = ShmRegion::create(name_, slot_count_, slot_size_);
+	log[log::info] << "Created shared memory '" << name_ << "' with " << region_->get_slot_count()
+			<< " slots of " << region_->get_slot_size() << " bytes";
+}
+
+ShmSink::~ShmSink() noexcept
+{
+}
+
+core::pFrame ShmSink::do_simple_single_step(core::pFrame frame)
+{
+	if (!write_frame(frame)) {
+		++dropped_;
+		log[log::warning] << "Failed to pass frame to shared memory, " << dropped_ << " frames dropped so far";
+	}
+	return frame;
+}
+
+namespace {
+
+struct plane_source_t {
+	const uint8_t*	data;
+	shm_plane_t		plane;
+};
+
+int64_t to_nanoseconds(timestamp_t timestamp)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.value.time_since_epoch()).count();
+}
+
+}
+
+void ShmSink::wait_for_readers(size_t index)
+{
+	if (!region_->get_readers(index)) return;
+	const timestamp_t start;
+	while (region_->get_readers(index)) {
+		if (timestamp_t{} - start > timeout_) {
+			// The reader probably crashed, it wouldn't keep the frame for so long otherwise.
+			// Releases of the current readers will be ignored.
+			log[log::warning] << "Slot not released by readers in time, reclaiming it";
+			region_->reclaim(index);
+			return;
+		}
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+}
+
+bool ShmSink::write_frame(const core::pFrame& frame)
+{
+	shm_frame_t desc{};
+	std::vector<plane_source_t> planes;
+	if (auto raw = std::dynamic_pointer_cast<core::RawVideoFrame>(frame)) {
+		desc.type = shm_frame_type_t::raw_video;
+		desc.width = raw->get_width();
+		desc.height = raw->get_height();
+		desc.interlace = static_cast<uint32_t>(raw->get_interlacing());
+		desc.field_order = static_cast<uint32_t>(raw->get_field_order());
+		const auto& r = *raw;
+		for (const auto& plane: r) {
+			const auto res = plane.get_resolution();
+			planes.push_back({plane.data(), {0, plane.size(), static_cast<uint32_t>(res.width),
+					static_cast<uint32_t>(res.height), static_cast<uint32_t>(plane.get_line_size())}});
+		}
+	} else if (auto compressed = std::dynamic_pointer_cast<core::CompressedVideoFrame>(frame)) {
+		desc.type = shm_frame_type_t::compressed_video;
+		desc.width = compressed->get_width();
+		desc.height = compressed->get_height();
+		const auto& c = *compressed;
+		planes.push_back({c.data(), {0, c.size(), 0, 0, 0}});
+	} else if (auto audio = std::dynamic_pointer_cast<core::RawAudioFrame>(frame)) {
+		desc.type = shm_frame_type_t::raw_audio;
+		desc.channels = audio->get_channel_count();
+		desc.sampling_frequency = audio->get_sampling_frequency();
+		const auto& a = *audio;
+		planes.push_back({a.data(), {0, a.size(), 0, 0, 0}});
+	} else {
+		log[log::warning] << "Unsupported frame type";
+		return false;
+	}
+	if (planes.size() > max_shm_planes) return false;
+
+	size_t offset = 0;
+	for (auto& p: planes) {
+		p.plane.offset = offset;
+		// Keep planes 64B aligned
+		offset += (p.plane.size + 63) & ~size_t{63};
+	}
+	if (offset > region_->get_slot_size()) {
+		log[log::warning] << "Frame with " << offset << " bytes doesn't fit into a slot of " << region_->get_slot_size() << " bytes";
+		return false;
+	}
+
+	desc.format = frame->get_format();
+	desc.timestamp = to_nanoseconds(frame->get_timestamp());
+	desc.duration = frame->get_duration().value;
+	desc.index = frame->get_index();
+	desc.plane_count = planes.size();
+	for (size_t i = 0; i < planes.size(); ++i) {
+		desc.planes[i] = planes[i].plane;
+	}
+
+	const auto sequence = sequence_ + 1;
+	const auto index = sequence % region_->get_slot_count();
+	auto& slot = region_->slot(index);
+	// Invalidate the slot before checking readers (see ShmRegion.h for details)
+	slot.sequence.store(0);
+	wait_for_readers(index);
+	auto data = region_->slot_data(index);
+	for (const auto& p: planes) {
+		std::copy(p.data, p.data + p.plane.size, data + p.plane.offset);
+	}
+	slot.frame = desc;
+	slot.sequence.store(sequence, std::memory_order_release);
+	region_->publish(sequence);
+	sequence_ = sequence;
+	return true;
+}
+
+bool ShmSink::set_param(const core::Parameter &param)
+{
+	if (assign_parameters(param)
+			(name_, "name")
+			(slot_count_, "slots")
+			(slot_size_, "slot_size")
+			.parsed<int64_t>
+			(timeout_, "timeout", [](int64_t v){return 1_ms * v;}))
+		return true;
+	return core::IOFilter::set_param(param);
+}
+
+}
+}
@@ -0,0 +1,45 @@
+/*!
+ * @file 		ShmSink.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SHMSINK_H_
+#define SHMSINK_H_
+
+#include "ShmRegion.h"
+#include "yuri/core/thread/IOFilter.h"
+
+namespace yuri {
+namespace shm {
+
+class ShmSink: public core::IOFilter
+{
+public:
+	IOTHREAD_GENERATOR_DECLARATION
+	static core::Parameters configure();
+	ShmSink(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters);
+	virtual ~ShmSink() noexcept;
+private:
+	virtual core::pFrame do_simple_single_step(core::pFrame frame) override;
+	virtual bool set_param(const core::Parameter &param) override;
+	bool write_frame(const core::pFrame& frame);
+	//! Waits until readers release the slot, reclaiming it after a timeout
+	void wait_for_readers(size_t index);
+
+	std::string		name_;
+	size_t			slot_count_;
+	size_t			slot_size_;
+	duration_t		timeout_;
+	pShmRegion		region_;
+	uint64_t		sequence_;
+	uint64_t		dropped_;
+};
+
+}
+}
+
+#endif /* SHMSINK_H_ */
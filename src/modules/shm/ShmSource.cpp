@@ -0,0 +1,169 @@
+/*!
+ * @file 		ShmSource.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "ShmSource.h"
+#include "yuri/core/Module.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+
+namespace yuri {
+namespace shm {
+
+IOTHREAD_GENERATOR(ShmSource)
+
+core::Parameters ShmSource::configure()
+{
+	core::Parameters p = core::IOThread::configure();
+	p.set_description("Reads frames passed through shared memory by shm_sink. Raw video frames reference the shared memory without copying.");
+	p["name"]["Name of the shared memory"]="yuri";
+	return p;
+}
+
+ShmSource::ShmSource(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
+core::IOThread(log_,parent,0,1,std::string("shm_source")),name_("yuri"),sequence_(0),dropped_(0)
+{
+	IOTHREAD_INIT(parameters)
+}
+
+ShmSource::~ShmSource() noexcept
+{
+}
+
+namespace {
+
+/*!
+ * Reference to a slot, kept by all planes of a frame.
+ * Keeps the mapping alive and releases the slot for the writer when the frame is destroyed.
+ */
+struct slot_reference_t {
+	slot_reference_t(pShmRegion region, size_t index, uint32_t generation):
+		region(std::move(region)),index(index),generation(generation) {}
+	~slot_reference_t() noexcept { region->release(index, generation); }
+	pShmRegion	region;
+	size_t		index;
+	uint32_t	generation;
+};
+
+timestamp_t from_nanoseconds(int64_t value)
+{
+	return timestamp_t{detail::time_point{std::chrono::duration_cast<detail::time_point::duration>(std::chrono::nanoseconds(value))}};
+}
+
+}
+
+bool ShmSource::open_region()
+{
+	auto region = ShmRegion::open(name_);
+	if (!region) return false;
+	if (region_ && region->header().session == region_->header().session) return false;
+	log[log::info] << "Opened shared memory '" << name_ << "'";
+	region_ = std::move(region);
+	// Start with the last published frame
+	const auto sequence = region_->header().sequence.load();
+	sequence_ = sequence ? sequence - 1 : 0;
+	return true;
+}
+
+void ShmSource::run()
+{
+	while (still_running()) {
+		if (!region_ && !open_region()) {
+			sleep(get_latency());
+			continue;
+		}
+		if (region_->wait(sequence_, get_latency())) {
+			read_frames();
+		} else {
+			// No new frames, check whether the writer wasn't restarted
+			open_region();
+		}
+	}
+	region_.reset();
+}
+
+void ShmSource::read_frames()
+{
+	const auto published = region_->header().sequence.load(std::memory_order_acquire);
+	const auto slot_count = region_->get_slot_count();
+	auto next = sequence_ + 1;
+	// Writer may be already rewriting the slot following the last published one
+	if (published + 2 > slot_count + next) {
+		const auto oldest = published + 2 - slot_count;
+		dropped_ += oldest - next;
+		log[log::warning] << "Reading too slow, skipped " << (oldest - next) << " frames";
+		next = oldest;
+	}
+	for (; next <= published && still_running(); ++next) {
+		if (auto frame = make_frame(next % slot_count, next)) {
+			push_frame(0, std::move(frame));
+		} else {
+			++dropped_;
+		}
+	}
+	sequence_ = published;
+}
+
+core::pFrame ShmSource::make_frame(size_t index, uint64_t sequence)
+{
+	uint32_t generation = 0;
+	if (!region_->acquire(index, sequence, generation)) return {};
+	auto reference = std::make_shared<slot_reference_t>(region_, index, generation);
+	auto deleter = [reference](void*) noexcept {};
+	// Local copy, so the writer can't change the description after it's checked
+	const shm_frame_t desc = region_->slot(index).frame;
+	const auto data = region_->slot_data(index);
+	if (!is_valid(desc, region_->get_slot_size())) {
+		log[log::warning] << "Invalid frame description in shared memory, dropping the frame";
+		return {};
+	}
+
+	core::pFrame frame;
+	switch (desc.type) {
+		case shm_frame_type_t::raw_video: {
+			auto raw = std::make_shared<core::RawVideoFrame>(desc.format, resolution_t{desc.width, desc.height}, 0);
+			for (size_t i = 0; i < desc.plane_count; ++i) {
+				const auto& p = desc.planes[i];
+				raw->emplace_back(data + p.offset, p.size, resolution_t{p.width, p.height}, p.line_size, deleter);
+			}
+			raw->set_interlacing(static_cast<interlace_t>(desc.interlace));
+			raw->set_field_order(static_cast<field_order_t>(desc.field_order));
+			// The slot is mapped read-only, so every modification has to copy the planes
+			for (auto& plane: *raw) plane.set_read_only();
+			frame = raw;
+		} break;
+		// Compressed and audio frames can't copy their data on write, so they're copied right away
+		case shm_frame_type_t::compressed_video:
+			frame = core::CompressedVideoFrame::create_empty(desc.format, resolution_t{desc.width, desc.height},
+					data + desc.planes[0].offset, desc.planes[0].size);
+			break;
+		case shm_frame_type_t::raw_audio:
+			frame = core::RawAudioFrame::create_empty(desc.format, desc.channels, desc.sampling_frequency,
+					data + desc.planes[0].offset, desc.planes[0].size);
+			break;
+		default:
+			log[log::warning] << "Unsupported frame type in shared memory";
+			return {};
+	}
+	frame->set_timestamp(from_nanoseconds(desc.timestamp));
+	frame->set_duration(duration_t{desc.duration});
+	frame->set_index(desc.index);
+	return frame;
+}
+
+bool ShmSource::set_param(const core::Parameter &param)
+{
+	if (assign_parameters(param)
+			(name_, "name"))
+		return true;
+	return core::IOThread::set_param(param);
+}
+
+}
+}
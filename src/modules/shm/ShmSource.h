@@ -0,0 +1,44 @@
+/*!
+ * @file 		ShmSource.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SHMSOURCE_H_
+#define SHMSOURCE_H_
+
+#include "ShmRegion.h"
+#include "yuri/core/thread/IOThread.h"
+
+namespace yuri {
+namespace shm {
+
+class ShmSource: public core::IOThread
+{
+public:
+	IOTHREAD_GENERATOR_DECLARATION
+	static core::Parameters configure();
+	ShmSource(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters);
+	virtual ~ShmSource() noexcept;
+private:
+	virtual void run() override;
+	virtual bool set_param(const core::Parameter &param) override;
+	//! Opens the region, or replaces it if the writer created a new one
+	bool open_region();
+	//! Outputs all published frames that weren't read yet
+	void read_frames();
+	core::pFrame make_frame(size_t index, uint64_t sequence);
+
+	std::string		name_;
+	pShmRegion		region_;
+	uint64_t		sequence_;
+	uint64_t		dropped_;
+};
+
+}
+}
+
+#endif /* SHMSOURCE_H_ */
@@ -0,0 +1,23 @@
+/*!
+ * @file 		register.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "ShmSink.h"
+#include "ShmSource.h"
+#include "yuri/core/Module.h"
+
+namespace yuri {
+namespace shm {
+
+MODULE_REGISTRATION_BEGIN("shm")
+	REGISTER_IOTHREAD("shm_sink",ShmSink)
+	REGISTER_IOTHREAD("shm_source",ShmSource)
+MODULE_REGISTRATION_END()
+
+}
+}
@@ -0,0 +1,119 @@
+/*!
+ * @file 		test_shm.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "ShmRegion.h"
+#include <thread>
+#include <unistd.h>
+
+namespace yuri {
+namespace shm {
+
+TEST_CASE("Shared memory frame description", "[shm]")
+{
+	shm_frame_t frame{};
+	frame.type = shm_frame_type_t::raw_video;
+	REQUIRE(!is_valid(frame, 4096));
+	frame.plane_count = 2;
+	frame.planes[0] = {0, 2048, 32, 32, 64};
+	frame.planes[1] = {2048, 2048, 32, 32, 64};
+	REQUIRE(is_valid(frame, 4096));
+	REQUIRE(!is_valid(frame, 4095));
+	frame.planes[1].line_size = 65;
+	REQUIRE(!is_valid(frame, 4096));
+	frame.planes[1] = {~0ull, 16, 4, 4, 4};
+	REQUIRE(!is_valid(frame, 4096));
+	frame.planes[1] = {16, ~0ull - 8, 4, 4, 4};
+	REQUIRE(!is_valid(frame, 4096));
+	// Line sizes are not used by other frame types
+	frame.type = shm_frame_type_t::compressed_video;
+	frame.plane_count = 1;
+	frame.planes[0] = {0, 100, 0, 1000, 1000};
+	REQUIRE(is_valid(frame, 4096));
+	frame.plane_count = max_shm_planes + 1;
+	REQUIRE(!is_valid(frame, 4096));
+}
+
+TEST_CASE("Shared memory region", "[shm]")
+{
+	const std::string name = "yuri_shm_test_" + std::to_string(getpid());
+	REQUIRE(!ShmRegion::open(name));
+	auto writer = ShmRegion::create(name, 3, 1000);
+	REQUIRE(writer);
+	REQUIRE(writer->get_slot_count() == 3);
+	REQUIRE(writer->get_slot_size() == 4096);
+
+	auto reader = ShmRegion::open(name);
+	REQUIRE(reader);
+	REQUIRE(reader->header().session == writer->header().session);
+	REQUIRE(reader->get_slot_count() == 3);
+
+	SECTION("data are shared") {
+		writer->slot_data(2)[10] = 42;
+		REQUIRE(reader->slot_data(2)[10] == 42);
+		REQUIRE(reader->slot_data(2) - reader->slot_data(0) == 2 * 4096);
+	}
+	SECTION("readers are woken up by publish") {
+		REQUIRE(!reader->wait(0, 1_ms));
+		std::thread t([&writer]{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			writer->slot(1).sequence.store(1);
+			writer->publish(1);
+		});
+		const timestamp_t start;
+		REQUIRE(reader->wait(0, 5_s));
+		REQUIRE(timestamp_t{} - start < 5_s);
+		t.join();
+		REQUIRE(reader->header().sequence.load() == 1);
+		REQUIRE(reader->slot(1).sequence.load() == 1);
+		REQUIRE(reader->wait(0, 1_ms));
+		REQUIRE(!reader->wait(1, 1_ms));
+	}
+	SECTION("slots are leased by readers") {
+		writer->slot(1).sequence.store(4);
+		uint32_t generation = 0;
+		REQUIRE(!reader->acquire(1, 3, generation));
+		REQUIRE(writer->get_readers(1) == 0);
+		REQUIRE(reader->acquire(1, 4, generation));
+		uint32_t generation2 = 0;
+		REQUIRE(reader->acquire(1, 4, generation2));
+		REQUIRE(generation2 == generation);
+		REQUIRE(writer->get_readers(1) == 2);
+		reader->release(1, generation);
+		REQUIRE(writer->get_readers(1) == 1);
+
+		// Slot reclaimed by the writer ignores releases of the old readers
+		writer->reclaim(1);
+		REQUIRE(writer->get_readers(1) == 0);
+		uint32_t generation3 = 0;
+		REQUIRE(reader->acquire(1, 4, generation3));
+		REQUIRE(generation3 != generation);
+		reader->release(1, generation2);
+		reader->release(1, generation2);
+		REQUIRE(writer->get_readers(1) == 1);
+		reader->release(1, generation3);
+		REQUIRE(writer->get_readers(1) == 0);
+		reader->release(1, generation3);
+		REQUIRE(writer->get_readers(1) == 0);
+	}
+	SECTION("recreated region gets a new session") {
+		const auto session = writer->header().session;
+		writer.reset();
+		REQUIRE(!ShmRegion::open(name));
+		auto writer2 = ShmRegion::create(name, 3, 1000);
+		auto reader2 = ShmRegion::open(name);
+		REQUIRE(reader2);
+		REQUIRE(reader2->header().session != session);
+		// The old mapping is still usable
+		REQUIRE(reader->header().session == session);
+	}
+}
+
+}
+}
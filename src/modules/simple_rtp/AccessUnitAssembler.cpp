@@ -0,0 +1,70 @@
+/*!
+ * @file 		AccessUnitAssembler.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AccessUnitAssembler.h"
+#include <algorithm>
+
+namespace yuri {
+namespace simple_rtp {
+
+AccessUnitAssembler::AccessUnitAssembler(size_t initial_capacity)
+    : block_(get_block(initial_capacity)), capacity_(initial_capacity), size_(0), timestamp_(0), corrupted_(false)
+{
+}
+
+AccessUnitAssembler::block_ptr AccessUnitAssembler::get_block(size_t size)
+{
+    auto block = core::FixedMemoryAllocator::get_block(size);
+    return block_ptr(block.first, block.second);
+}
+
+void AccessUnitAssembler::reserve(size_t size)
+{
+    if (size <= capacity_)
+        return;
+    // Keep the larger size for following access units as well
+    capacity_  = std::max(size, 2 * capacity_);
+    auto block = get_block(capacity_);
+    std::copy(block_.get(), block_.get() + size_, block.get());
+    block_ = std::move(block);
+}
+
+void AccessUnitAssembler::append(const uint8_t* begin, const uint8_t* end)
+{
+    const auto count = static_cast<size_t>(end - begin);
+    reserve(size_ + count);
+    std::copy(begin, end, block_.get() + size_);
+    size_ += count;
+}
+
+void AccessUnitAssembler::append(uint8_t value)
+{
+    reserve(size_ + 1);
+    block_.get()[size_++] = value;
+}
+
+core::pCompressedVideoFrame AccessUnitAssembler::finish(format_t format, resolution_t resolution)
+{
+    auto deleter = block_.get_deleter();
+    auto data    = block_.release();
+    auto frame   = core::CompressedVideoFrame::create_empty(format, resolution, data, size_, deleter);
+    block_       = get_block(capacity_);
+    size_        = 0;
+    corrupted_   = false;
+    return frame;
+}
+
+void AccessUnitAssembler::drop()
+{
+    size_      = 0;
+    corrupted_ = false;
+}
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
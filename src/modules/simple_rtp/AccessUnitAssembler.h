@@ -0,0 +1,62 @@
+/*!
+ * @file 		AccessUnitAssembler.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SRC_MODULES_SIMPLE_RTP_ACCESSUNITASSEMBLER_H_
+#define SRC_MODULES_SIMPLE_RTP_ACCESSUNITASSEMBLER_H_
+
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <memory>
+
+namespace yuri {
+namespace simple_rtp {
+
+/*!
+ * Collects depacketized data of a single access unit.
+ *
+ * Data are written directly into a block from FixedMemoryAllocator,
+ * that is handed over to the output frame, so there are no reallocations
+ * or copies once the block is large enough for the stream.
+ */
+class AccessUnitAssembler {
+public:
+    explicit AccessUnitAssembler(size_t initial_capacity = 256 * 1024);
+
+    bool     empty() const { return size_ == 0; }
+    size_t   size() const { return size_; }
+    uint32_t get_timestamp() const { return timestamp_; }
+    void     set_timestamp(uint32_t timestamp) { timestamp_ = timestamp; }
+    bool     is_corrupted() const { return corrupted_; }
+    void     mark_corrupted() { corrupted_ = true; }
+
+    void append(const uint8_t* begin, const uint8_t* end);
+    void append(uint8_t value);
+
+    //! Returns a frame with the collected data and starts a new access unit
+    core::pCompressedVideoFrame finish(format_t format, resolution_t resolution);
+    //! Drops collected data and starts a new access unit
+    void drop();
+
+private:
+    using block_ptr = std::unique_ptr<uint8_t, core::FixedMemoryAllocator::Deleter>;
+
+    void      reserve(size_t size);
+    block_ptr get_block(size_t size);
+
+    block_ptr block_;
+    size_t    capacity_;
+    size_t    size_;
+    uint32_t  timestamp_;
+    bool      corrupted_;
+};
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
+
+#endif /* SRC_MODULES_SIMPLE_RTP_ACCESSUNITASSEMBLER_H_ */
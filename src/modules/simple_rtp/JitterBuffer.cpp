@@ -0,0 +1,148 @@
+/*!
+ * @file 		JitterBuffer.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "JitterBuffer.h"
+
+namespace yuri {
+namespace simple_rtp {
+
+namespace {
+size_t round_to_power_of_two(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+}
+
+JitterBuffer::JitterBuffer(size_t capacity, duration_t latency, callback_t callback)
+    : slots_(round_to_power_of_two(std::max<size_t>(capacity, 2)), slot_t{ RTPPacket(0, 0, 0, 0, 0), 0, timestamp_t{}, false })
+    , mask_(slots_.size() - 1)
+    , latency_(latency)
+    , callback_(std::move(callback))
+    , stats_{ 0, 0, 0, 0, 0 }
+{
+    reset();
+}
+
+void JitterBuffer::reset()
+{
+    for (auto& slot : slots_) {
+        slot.valid = false;
+    }
+    next_          = 0;
+    highest_       = 0;
+    buffered_      = 0;
+    started_       = false;
+    discontinuity_ = false;
+}
+
+void JitterBuffer::push(const uint8_t* data, size_t size, timestamp_t now)
+{
+    if (size < RTPPacket::header_size)
+        return;
+    const uint16_t sequence = (static_cast<uint16_t>(data[2]) << 8) | data[3];
+    if (!started_) {
+        started_ = true;
+        next_    = sequence;
+        highest_ = sequence;
+    }
+    // Nearest sequence number (in the 16bit space) to the highest one received
+    const int64_t ext      = highest_ + static_cast<int16_t>(sequence - static_cast<uint16_t>(highest_));
+    const auto    capacity = static_cast<int64_t>(slots_.size());
+    if (ext < next_) {
+        if (next_ - ext <= capacity) {
+            ++stats_.late;
+            return;
+        }
+        // Too old to be a late packet, the sender has probably restarted
+        flush();
+        reset();
+        discontinuity_ = true;
+        push(data, size, now);
+        return;
+    }
+    auto& slot = slots_[ext & mask_];
+    if (slot.valid && slot.sequence == ext) {
+        ++stats_.duplicate;
+        return;
+    }
+    ++stats_.received;
+    if (ext < highest_) {
+        ++stats_.reordered;
+    } else {
+        highest_ = ext;
+    }
+
+    if (ext - next_ >= capacity) {
+        if (!buffered_) {
+            // Nothing to release, just skip the missing packets
+            const auto skip = ext - next_ - capacity + 1;
+            stats_.lost += skip;
+            next_ += skip;
+            discontinuity_ = true;
+        }
+        while (ext - next_ >= capacity) {
+            release_next(true);
+        }
+    }
+    slot.packet.data.assign(data, data + size);
+    slot.sequence = ext;
+    slot.arrival  = now;
+    slot.valid    = true;
+    ++buffered_;
+}
+
+bool JitterBuffer::release_next(bool force)
+{
+    auto& slot = slots_[next_ & mask_];
+    if (slot.valid) {
+        slot.valid = false;
+        --buffered_;
+        ++next_;
+        const bool discontinuity = discontinuity_;
+        discontinuity_           = false;
+        callback_(slot.packet, discontinuity);
+        return true;
+    }
+    if (!force)
+        return false;
+    ++stats_.lost;
+    ++next_;
+    discontinuity_ = true;
+    return true;
+}
+
+void JitterBuffer::poll(timestamp_t now)
+{
+    while (buffered_) {
+        if (release_next(false))
+            continue;
+        // The first packet is missing, find out how long the packets after it are waiting
+        auto first = next_ + 1;
+        while (!slots_[first & mask_].valid)
+            ++first;
+        if (now - slots_[first & mask_].arrival < latency_)
+            break;
+        stats_.lost += first - next_;
+        next_          = first;
+        discontinuity_ = true;
+    }
+}
+
+void JitterBuffer::flush()
+{
+    while (buffered_) {
+        release_next(true);
+    }
+}
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
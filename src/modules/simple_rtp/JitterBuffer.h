@@ -0,0 +1,97 @@
+/*!
+ * @file 		JitterBuffer.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SRC_MODULES_SIMPLE_RTP_JITTERBUFFER_H_
+#define SRC_MODULES_SIMPLE_RTP_JITTERBUFFER_H_
+
+#include "rtp_packet.h"
+#include "yuri/core/utils/time_types.h"
+#include <functional>
+#include <vector>
+
+namespace yuri {
+namespace simple_rtp {
+
+struct jitter_stats_t {
+    //! Valid packets received
+    uint64_t received;
+    //! Packets that never arrived (or arrived too late)
+    uint64_t lost;
+    //! Packets that arrived after a packet with higher sequence number
+    uint64_t reordered;
+    //! Packets that arrived after their place in the stream was already released
+    uint64_t late;
+    uint64_t duplicate;
+};
+
+/*!
+ * Reorders RTP packets according to their sequence numbers.
+ *
+ * Packets are released (in order) as soon as all preceding packets are released,
+ * so in order streams don't get any additional latency. When a packet is missing,
+ * the following packets are held for at most @em latency, waiting for the missing one
+ * to arrive. After that the missing packets are counted as lost and the next released
+ * packet is marked as discontinuity.
+ *
+ * Packets are stored in preallocated slots (indexed by the sequence number),
+ * that are reused for the whole lifetime of the buffer.
+ */
+class JitterBuffer {
+public:
+    using callback_t = std::function<void(const RTPPacket& packet, bool discontinuity)>;
+
+    /*!
+     * @param capacity maximal number of packets in the buffer, rounded up to a power of two
+     * @param latency how long to wait for a missing packet
+     * @param callback function called for every released packet
+     */
+    JitterBuffer(size_t capacity, duration_t latency, callback_t callback);
+
+    //! Stores a received datagram, releasing packets only if the buffer is full
+    void push(const uint8_t* data, size_t size, timestamp_t now = timestamp_t{});
+
+    //! Releases all packets that are in order or whose missing predecessors waited long enough
+    void poll(timestamp_t now = timestamp_t{});
+
+    //! Releases all buffered packets, skipping the missing ones
+    void flush();
+
+    const jitter_stats_t& get_stats() const { return stats_; }
+    size_t                buffered() const { return buffered_; }
+
+private:
+    struct slot_t {
+        RTPPacket   packet;
+        int64_t     sequence;
+        timestamp_t arrival;
+        bool        valid;
+    };
+
+    //! Releases the first packet, or skips it if it's missing and @em force is set.
+    bool release_next(bool force);
+    void reset();
+
+    std::vector<slot_t> slots_;
+    size_t              mask_;
+    duration_t          latency_;
+    callback_t          callback_;
+    jitter_stats_t      stats_;
+    //! Extended (without wrap around) sequence number of the next packet to release
+    int64_t             next_;
+    //! Highest extended sequence number received
+    int64_t             highest_;
+    size_t              buffered_;
+    bool                started_;
+    bool                discontinuity_;
+};
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
+
+#endif /* SRC_MODULES_SIMPLE_RTP_JITTERBUFFER_H_ */
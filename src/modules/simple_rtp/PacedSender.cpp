@@ -0,0 +1,173 @@
+/*!
+ * @file 		PacedSender.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "PacedSender.h"
+#include <algorithm>
+#include <limits>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+namespace yuri {
+namespace simple_rtp {
+
+bool send_rtp_packets(log::Log& log, core::socket::DatagramSocket& socket, const RTPPacket* packets, size_t count)
+{
+    std::vector<core::socket::datagram_t> datagrams;
+    datagrams.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        datagrams.push_back({ packets[i].data.data(), packets[i].data.size() });
+    }
+    size_t sent    = 0;
+    int    retries = 0;
+    while (sent < datagrams.size()) {
+        const auto s = socket.send_datagrams(datagrams.data() + sent, datagrams.size() - sent);
+        if (s) {
+            sent += s;
+            retries = 0;
+        } else if (++retries >= 5) {
+            log[log::error] << "Failed to send " << (datagrams.size() - sent) << " of " << datagrams.size() << " packets";
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace {
+// Part of the frame interval the packets are spread over, leaving some headroom for jitter of the input
+const double interval_utilization = 0.9;
+}
+
+PacedSender::PacedSender(log::Log& log_, std::shared_ptr<core::socket::DatagramSocket> socket, double bitrate, size_t bucket_size, size_t queue_size)
+    : log(log_)
+    , socket_(std::move(socket))
+    , byte_rate_(bitrate / 8.0)
+    , bucket_size_(static_cast<double>(std::max<size_t>(bucket_size, 1)))
+    , queue_size_(std::max<size_t>(queue_size, 1))
+    , tokens_(bucket_size_)
+    , stop_(false)
+    , stats_{ 0, 0, {}, 0, 0, 0 }
+{
+    thread_ = std::thread([this] { run(); });
+}
+
+PacedSender::~PacedSender() noexcept
+{
+    {
+        lock_t _(mutex_);
+        stop_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void PacedSender::push(std::vector<RTPPacket>&& packets, duration_t interval)
+{
+    lock_t l(mutex_);
+    not_full_.wait(l, [this] { return stop_ || queue_.size() < queue_size_; });
+    if (stop_)
+        return;
+    queue_.push_back({ std::move(packets), interval });
+    l.unlock();
+    not_empty_.notify_one();
+}
+
+pacing_stats_t PacedSender::get_stats()
+{
+    lock_t            _(mutex_);
+    const timestamp_t now;
+    auto              stats = stats_;
+    stats.period            = now - stats_start_;
+    stats_                  = pacing_stats_t{ 0, 0, {}, 0, 0, 0 };
+    stats_start_            = now;
+    return stats;
+}
+
+void PacedSender::run()
+{
+#ifdef __linux__
+    // Default timer slack (50us) would make the pacing too coarse for high bitrates
+    prctl(PR_SET_TIMERSLACK, 1000, 0, 0, 0);
+#endif
+    while (true) {
+        access_unit_t unit;
+        {
+            lock_t l(mutex_);
+            not_empty_.wait(l, [this] { return stop_ || !queue_.empty(); });
+            if (stop_)
+                return;
+            unit = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        not_full_.notify_one();
+        send_access_unit(unit);
+    }
+}
+
+void PacedSender::refill(timestamp_t now, double rate)
+{
+    tokens_      = std::min(bucket_size_, tokens_ + (now - last_refill_).value * rate / 1.0e6);
+    last_refill_ = now;
+}
+
+void PacedSender::send_access_unit(const access_unit_t& unit)
+{
+    const auto& packets = unit.packets;
+    size_t      bytes   = 0;
+    for (const auto& p : packets) {
+        bytes += p.data.size();
+    }
+    double rate = byte_rate_;
+    if (unit.interval.value > 0)
+        rate = std::max(rate, bytes * 1.0e6 / (unit.interval.value * interval_utilization));
+    if (rate <= 0.0)
+        rate = std::numeric_limits<double>::infinity();
+
+    const timestamp_t start;
+    for (size_t i = 0; i < packets.size();) {
+        refill(timestamp_t{}, rate);
+        size_t count = 0;
+        size_t burst = 0;
+        while (i + count < packets.size() && burst + packets[i + count].data.size() <= tokens_) {
+            burst += packets[i + count].data.size();
+            ++count;
+        }
+        if (!count) {
+            const double missing = packets[i].data.size() - tokens_;
+            if (missing > 0 && tokens_ < bucket_size_) {
+                const auto wait = std::max<int64_t>(1, static_cast<int64_t>(missing * 1.0e6 / rate));
+                std::this_thread::sleep_for(std::chrono::microseconds(wait));
+                continue;
+            }
+            // Packet larger than the bucket, send it anyway
+            count = 1;
+            burst = packets[i].data.size();
+        }
+        send_rtp_packets(log, *socket_, &packets[i], count);
+        tokens_ -= burst;
+        i += count;
+
+        lock_t _(mutex_);
+        if (stop_)
+            return;
+        stats_.packets += count;
+        stats_.bytes += burst;
+        stats_.max_burst_packets = std::max(stats_.max_burst_packets, count);
+        stats_.max_burst_bytes   = std::max(stats_.max_burst_bytes, burst);
+    }
+    if (unit.interval.value > 0 && timestamp_t{} - start > unit.interval) {
+        lock_t _(mutex_);
+        ++stats_.overruns;
+    }
+}
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
@@ -0,0 +1,104 @@
+/*!
+ * @file 		PacedSender.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SRC_MODULES_SIMPLE_RTP_PACEDSENDER_H_
+#define SRC_MODULES_SIMPLE_RTP_PACEDSENDER_H_
+
+#include "rtp_packet.h"
+#include "yuri/core/socket/DatagramSocket.h"
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/time_types.h"
+#include "yuri/log/Log.h"
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace yuri {
+namespace simple_rtp {
+
+/*!
+ * Sends all packets, in as few system calls as possible
+ * @return true if all packets were sent
+ */
+bool send_rtp_packets(log::Log& log, core::socket::DatagramSocket& socket, const RTPPacket* packets, size_t count);
+
+struct pacing_stats_t {
+    uint64_t   packets;
+    uint64_t   bytes;
+    //! Time the statistics were collected over
+    duration_t period;
+    //! Largest number of packets (and bytes) sent at once
+    size_t     max_burst_packets;
+    size_t     max_burst_bytes;
+    //! Access units that couldn't be sent within their frame interval
+    uint64_t   overruns;
+
+    double get_rate() const { return period.value > 0 ? bytes * 8.0e6 / period.value : 0.0; }
+};
+
+/*!
+ * Sends access units from a dedicated thread, spreading the packets across the frame interval.
+ *
+ * Packets are sent according to a token bucket, refilled at the configured bitrate.
+ * The rate is raised for an access unit that wouldn't fit into its interval otherwise,
+ * so the queue can't grow without bounds. Packets fitting into the bucket are sent
+ * as a single batch, so the bucket size limits the bursts on the wire.
+ */
+class PacedSender {
+public:
+    /*!
+     * @param bitrate minimal rate in bits per second, 0 to derive it from the size of every access unit
+     * @param bucket_size size of the token bucket in bytes
+     * @param queue_size maximal number of access units waiting to be sent
+     */
+    PacedSender(log::Log& log, std::shared_ptr<core::socket::DatagramSocket> socket, double bitrate, size_t bucket_size, size_t queue_size = 4);
+    ~PacedSender() noexcept;
+
+    PacedSender(const PacedSender&) = delete;
+    PacedSender& operator=(const PacedSender&) = delete;
+
+    //! Queues an access unit, waiting while the queue is full
+    void push(std::vector<RTPPacket>&& packets, duration_t interval);
+
+    //! Returns statistics collected since the previous call
+    pacing_stats_t get_stats();
+
+private:
+    struct access_unit_t {
+        std::vector<RTPPacket> packets;
+        duration_t             interval;
+    };
+
+    void run();
+    void send_access_unit(const access_unit_t& unit);
+    //! Adds tokens for the time since last refill
+    void refill(timestamp_t now, double rate);
+
+    log::Log&                                     log;
+    std::shared_ptr<core::socket::DatagramSocket> socket_;
+    const double                                  byte_rate_;
+    const double                                  bucket_size_;
+    const size_t                                  queue_size_;
+    double                                        tokens_;
+    timestamp_t                                   last_refill_;
+
+    mutex                     mutex_;
+    std::condition_variable   not_empty_;
+    std::condition_variable   not_full_;
+    std::deque<access_unit_t> queue_;
+    bool                      stop_;
+    pacing_stats_t            stats_;
+    timestamp_t               stats_start_;
+    std::thread               thread_;
+};
+
+} /* namespace simple_rtp */
+} /* namespace yuri */
+
+#endif /* SRC_MODULES_SIMPLE_RTP_PACEDSENDER_H_ */
@@ -13,6 +13,7 @@
 #include "yuri/core/socket/DatagramSocketGenerator.h"
 #include "yuri/core/frame/CompressedVideoFrame.h"
 #include "rtp_packet.h"
+#include <array>
 
 namespace yuri {
 namespace simple_rtp {
@@ -26,11 +27,24 @@ core::Parameters SimpleH264RtpReceiver::configure()
     p["address"]["Remote address"] = "127.0.0.1";
     p["socket_type"]               = "yuri_udp";
     p["port"]                      = 57120;
+    p["jitter_latency"]["Maximal time to wait for a missing packet (in ms)"] = 20;
+    p["jitter_packets"]["Maximal number of packets held in the jitter buffer"] = 1024;
+    p["drop_corrupted"]["Drop frames with missing packets. When disabled, corrupted frames are passed to the output"] = true;
     return p;
 }
 
 SimpleH264RtpReceiver::SimpleH264RtpReceiver(const log::Log& log_, core::pwThreadBase parent, const core::Parameters& parameters)
-    : core::IOThread(log_, parent, 0, 1, std::string("simple_rtp")), sequence_{ 0 }, address_{ "127.0.0.1" }, port_{ 0x1256 }, socket_type_{ "yuri_udp" }
+    : core::IOThread(log_, parent, 0, 1, std::string("simple_rtp"))
+    , event::BasicEventProducer(log)
+    , address_{ "127.0.0.1" }
+    , port_{ 0x1256 }
+    , socket_type_{ "yuri_udp" }
+    , jitter_latency_{ 20_ms }
+    , jitter_packets_{ 1024 }
+    , drop_corrupted_{ true }
+    , corrupted_{ 0 }
+    , last_stats_{ 0, 0, 0, 0, 0 }
+    , last_corrupted_{ 0 }
 {
     IOTHREAD_INIT(parameters)
 }
@@ -41,14 +55,10 @@ SimpleH264RtpReceiver::~SimpleH264RtpReceiver() noexcept
 
 namespace {
 
-void add_data(std::vector<uint8_t>& buffer, size_t read_bytes, RTPPacket& packet)
-{
-    buffer.reserve(buffer.size() + read_bytes - RTPPacket::header_size - 1);
-    buffer.insert(buffer.end(), packet.data_begin() + 2, packet.data_begin() + read_bytes - RTPPacket::header_size);
+const resolution_t           unknown_resolution = { 0, 0 };
+const std::array<uint8_t, 4> h264_start_code = { 0, 0, 0, 1 };
 }
 
-std::array<uint8_t, 4> h264_start_code = { 0, 0, 0, 1 };
-}
 void SimpleH264RtpReceiver::run()
 {
     log[log::info] << "Initializing socket of type '" << socket_type_ << "'";
@@ -61,69 +71,126 @@ void SimpleH264RtpReceiver::run()
     }
     log[log::info] << "Socket initialized";
 
-    std::vector<uint8_t> buffer;
+    jitter_buffer_.reset(new JitterBuffer(jitter_packets_, jitter_latency_,
+                                          [this](const RTPPacket& packet, bool discontinuity) { process_packet(packet, discontinuity); }));
 
-    // Allocate large packet
-    RTPPacket    packet(65535, 0, 0, 0, 0);
-    resolution_t res{ 0, 0 };
-    uint32_t     last_timestamp_ = 0;
+    // Allocate large packets, received in batches
+    const size_t                                 batch_size = 32;
+    std::vector<std::vector<uint8_t>>            packets(batch_size, std::vector<uint8_t>(65535 + RTPPacket::header_size));
+    std::vector<core::socket::datagram_buffer_t> buffers;
+    std::vector<size_t>                          sizes(batch_size);
+    for (auto& packet : packets) {
+        buffers.push_back({ packet.data(), packet.size() });
+    }
+    const auto wait_time = std::min(get_latency(), jitter_latency_);
     while (still_running()) {
-        if (socket_->wait_for_data(get_latency())) {
-            log[log::verbose_debug] << "reading data";
-            const auto read_bytes = socket_->receive_datagram(&packet.data[0], packet.data.size());
-            if (sequence_ != packet.get_sequence()) {
-                log[log::warning] << "Missing packet(s)! Expected sequence " << sequence_ << ", got " << packet.get_sequence();
+        if (socket_->wait_for_data(wait_time)) {
+            const auto count = socket_->receive_datagrams(buffers.data(), sizes.data(), batch_size);
+            log[log::verbose_debug] << "read " << count << " packets";
+            const timestamp_t now;
+            for (size_t i = 0; i < count; ++i) {
+                jitter_buffer_->push(buffers[i].data, sizes[i], now);
             }
-            sequence_ = (packet.get_sequence() + 1) % 65536;
-            if (last_timestamp_ != packet.get_timestamp()) {
-                // We assume that frames with the same timestamp should be merged together
-                if (!buffer.empty()) {
-                    auto frame = core::CompressedVideoFrame::create_empty(core::compressed_frame::h264, res, buffer.data(), buffer.size());
-                    log[log::verbose_debug] << "Sending (single) frame with " << frame->size();
-                    push_frame(0, std::move(frame));
-                    buffer.clear();
+        }
+        jitter_buffer_->poll();
+        emit_statistics();
+    }
+    jitter_buffer_->flush();
+    finish_access_unit();
+    emit_statistics();
+}
+
+void SimpleH264RtpReceiver::process_packet(const RTPPacket& packet, bool discontinuity)
+{
+    const auto timestamp = packet.get_timestamp();
+    if (!assembler_.empty() && assembler_.get_timestamp() != timestamp) {
+        // We assume that packets with the same timestamp should be merged together.
+        // Missing packets between two access units could belong to any of them.
+        if (discontinuity)
+            assembler_.mark_corrupted();
+        finish_access_unit();
+    }
+    if (assembler_.empty())
+        assembler_.set_timestamp(timestamp);
+    if (discontinuity) {
+        log[log::debug] << "Missing packet(s) before sequence " << packet.get_sequence();
+        assembler_.mark_corrupted();
+    }
+
+    const auto read_bytes = packet.data.size();
+    if (read_bytes > RTPPacket::header_size) {
+        // TODO: verify RTP headers and stuff ...
+        const auto data        = &(*packet.data_begin());
+        const auto data_end    = data + read_bytes - RTPPacket::header_size;
+        const auto packet_type = data[0] & 0x1F;
+        if (packet_type > 0 && packet_type < 24) {
+            // Single NALU packet
+            assembler_.append(h264_start_code.begin(), h264_start_code.end());
+            assembler_.append(data, data_end);
+        } else
+            switch (packet_type) {
+            case 28: {
+                // Fragmentation Unit A
+                if (data[1] & 0x80) {
+                    // Start of fragmented frame
+                    assembler_.append(h264_start_code.begin(), h264_start_code.end());
+                    assembler_.append((data[1] & 0x1F) | (data[0] & 0xE0));
                 }
-                last_timestamp_ = packet.get_timestamp();
-            }
-            if (read_bytes > RTPPacket::header_size) {
-                // TODO: verify RTP headers and stuff ...
-                auto data        = &(*packet.data_begin());
-                auto packet_type = data[0] & 0x1F;
-                if (packet_type > 0 && packet_type < 24) {
-                    // Single NALU packet
-
-                    buffer.insert(buffer.end(), h264_start_code.begin(), h264_start_code.end());
-                    buffer.insert(buffer.end(), data, data + read_bytes - RTPPacket::header_size);
-                } else
-                    switch (packet_type) {
-                    case 28: {
-                        // Fragmentation Unit A
-                        if (data[1] & 0x80) {
-                            // Start of fragmented frame
-                            buffer.insert(buffer.end(), h264_start_code.begin(), h264_start_code.end());
-                            buffer.push_back((data[1] & 0x1F) | (data[0] & 0xE0));
-                        }
-
-                        add_data(buffer, read_bytes, packet);
-                        if (data[1] & 0x40) {
-                            // End of fragmented frame
-                            // No special processing here at the moment
-                        }
-                    }; break;
-                    default:
-                        log[log::warning] << "Unsupported packet type";
-                    }
+                assembler_.append(data + 2, data_end);
+            }; break;
+            default:
+                log[log::warning] << "Unsupported packet type";
             }
+    }
+}
+
+void SimpleH264RtpReceiver::finish_access_unit()
+{
+    if (assembler_.empty())
+        return;
+    if (assembler_.is_corrupted()) {
+        ++corrupted_;
+        if (drop_corrupted_) {
+            log[log::debug] << "Dropping incomplete frame with " << assembler_.size() << " bytes";
+            assembler_.drop();
+            return;
         }
+        log[log::debug] << "Passing incomplete frame with " << assembler_.size() << " bytes";
+    }
+    auto frame = assembler_.finish(core::compressed_frame::h264, unknown_resolution);
+    log[log::verbose_debug] << "Sending frame with " << frame->size();
+    push_frame(0, std::move(frame));
+}
+
+void SimpleH264RtpReceiver::emit_statistics()
+{
+    const auto& stats = jitter_buffer_->get_stats();
+    if (stats.lost != last_stats_.lost) {
+        log[log::warning] << "Lost " << (stats.lost - last_stats_.lost) << " packet(s)";
+        emit_event("lost", stats.lost);
     }
+    if (stats.reordered != last_stats_.reordered)
+        emit_event("reordered", stats.reordered);
+    if (stats.late != last_stats_.late)
+        emit_event("late", stats.late);
+    if (stats.duplicate != last_stats_.duplicate)
+        emit_event("duplicate", stats.duplicate);
+    if (corrupted_ != last_corrupted_)
+        emit_event("corrupted", corrupted_);
+    last_stats_     = stats;
+    last_corrupted_ = corrupted_;
 }
 
 bool SimpleH264RtpReceiver::set_param(const core::Parameter& param)
 {
-    if (assign_parameters(param)       //
-        (address_, "address")          //
-        (port_, "port")                //
-        (socket_type_, "socket_type")) //
+    if (assign_parameters(param)             //
+        (address_, "address")                //
+        (port_, "port")                      //
+        (socket_type_, "socket_type")        //
+        (jitter_packets_, "jitter_packets")  //
+        (drop_corrupted_, "drop_corrupted")  //
+        .parsed<float>                       //
+        (jitter_latency_, "jitter_latency", [](float f) { return 1_ms * f; }))
         return true;
 
     return core::IOThread::set_param(param);
@@ -27,17 +27,24 @@ core::Parameters SimpleH264RtpSender::configure()
     p["address"]["Remote address"] = "127.0.0.1";
     p["socket_type"]               = "yuri_udp";
     p["port"]                      = 57120;
+    p["pacing"]["Spread packets of every frame across the frame interval"] = false;
+    p["bitrate"]["Minimal bitrate for pacing in Mbit/s. With 0, the rate is derived from the size of each frame"] = 0.0;
+    p["burst"]["Maximal number of bytes sent back to back when pacing"] = 16384;
     return p;
 }
 
 SimpleH264RtpSender::SimpleH264RtpSender(const log::Log& log_, core::pwThreadBase parent, const core::Parameters& parameters)
     : base_type(log_, parent, std::string("simple_rtp")),
+      event::BasicEventProducer(log),
       mtu_(1500),
       ssrc_(0x1234),
       sequence_{ 0 },
       address_{ "127.0.0.1" },
       port_{ 0x1256 },
-      socket_type_{ "yuri_udp" }
+      socket_type_{ "yuri_udp" },
+      pacing_{ false },
+      bitrate_{ 0.0 },
+      burst_{ 16384 }
 {
     IOTHREAD_INIT(parameters)
 }
@@ -57,7 +64,12 @@ void SimpleH264RtpSender::run()
         return;
     }
     log[log::info] << "Socket initialized";
+    if (pacing_) {
+        log[log::info] << "Pacing packets with burst size " << burst_ << "B" << (bitrate_ > 0.0 ? " at least at " + std::to_string(bitrate_ / 1e6) + " Mbit/s" : std::string{});
+        pacer_.reset(new PacedSender(log, socket_, bitrate_, burst_));
+    }
     base_type::run();
+    pacer_.reset();
 }
 
 namespace {
@@ -133,6 +145,7 @@ core::pFrame SimpleH264RtpSender::do_special_single_step(core::pCompressedVideoF
     data_view dv        = { &(*frame)[0], frame->size(), 0 };
     auto      d         = find_nal(dv, avc_size);
     auto      timestamp = 9 * (frame->get_timestamp() - core::utils::get_global_start_time()).value / 100;
+    std::vector<RTPPacket> packets;
     while (d.size > 0) {
         log[log::verbose_debug] << "Found nal (" << static_cast<int>(d.ptr[0] & 0x1F) << ") of size " << d.size << " in data block of " << dv.size << "B";
 
@@ -142,7 +155,7 @@ core::pFrame SimpleH264RtpSender::do_special_single_step(core::pCompressedVideoF
             RTPPacket packet(d.size, 99, sequence_++, timestamp, ssrc_);
             std::copy(d.ptr, d.ptr + d.size, packet.data_begin());
             packet.set_marker_bit();
-            send_rtp_packet(packet);
+            packets.push_back(std::move(packet));
             log[log::verbose_debug] << "Sent small packet " << sequence_;
         } else {
             // Fragment into multiple packets
@@ -162,7 +175,7 @@ core::pFrame SimpleH264RtpSender::do_special_single_step(core::pCompressedVideoF
                 data[1]  = nal_head;
                 nal_head = nal_head & 0x1F; // Unset S and R bits
                 std::copy(d.ptr + offset, d.ptr + offset + size, packet.data_begin() + 2);
-                send_rtp_packet(packet);
+                packets.push_back(std::move(packet));
                 remaining -= size;
                 offset += size;
                 log[log::verbose_debug] << "Sent FU packet " << sequence_ << " (" << size << ")";
@@ -174,20 +187,39 @@ core::pFrame SimpleH264RtpSender::do_special_single_step(core::pCompressedVideoF
 
         d = find_nal(dv, avc_size);
     }
+    send_access_unit(std::move(packets), frame);
     return {};
 }
 
-bool SimpleH264RtpSender::send_rtp_packet(const RTPPacket& packet)
+void SimpleH264RtpSender::send_access_unit(std::vector<RTPPacket>&& packets, const core::pCompressedVideoFrame& frame)
 {
-    int i = 0;
-    while (i++ < 5) {
-        auto s = socket_->send_datagram(packet.data);
-        if (s == packet.data.size()) {
-            return true;
-        }
+    if (!pacer_) {
+        send_rtp_packets(log, *socket_, packets.data(), packets.size());
+        return;
     }
-    log[log::error] << "Failed to send packet with " << packet.data.size() << " bytes";
-    return false;
+    // Frames without duration are paced according to the time between frames
+    auto interval = frame->get_duration();
+    const timestamp_t now;
+    if (interval.value <= 0 && last_frame_time_ < now)
+        interval = std::min(now - last_frame_time_, duration_t(1_s));
+    last_frame_time_ = now;
+    pacer_->push(std::move(packets), interval);
+    emit_pacing_statistics();
+}
+
+void SimpleH264RtpSender::emit_pacing_statistics()
+{
+    const timestamp_t now;
+    if (now - last_report_ < 1_s)
+        return;
+    last_report_     = now;
+    const auto stats = pacer_->get_stats();
+    log[log::debug] << "Sent " << stats.packets << " packets at " << stats.get_rate() / 1e6 << " Mbit/s, largest burst " << stats.max_burst_packets
+                    << " packets (" << stats.max_burst_bytes << "B), " << stats.overruns << " overruns";
+    emit_event("rate", stats.get_rate());
+    emit_event("burst", stats.max_burst_bytes);
+    if (stats.overruns)
+        emit_event("overruns", stats.overruns);
 }
 
 bool SimpleH264RtpSender::set_param(const core::Parameter& param)
@@ -195,9 +227,13 @@ bool SimpleH264RtpSender::set_param(const core::Parameter& param)
     if (assign_parameters(param)       //
         (mtu_, "mtu")                  //
         (ssrc_, "ssrc")                //
+        (pacing_, "pacing")            //
+        (burst_, "burst")              //
         (address_, "address")          //
         (port_, "port")                //
-        (socket_type_, "socket_type")) //
+        (socket_type_, "socket_type")  //
+        .parsed<double>                //
+        (bitrate_, "bitrate", [](double d) { return d * 1e6; }))
         return true;
     return base_type::set_param(param);
 }
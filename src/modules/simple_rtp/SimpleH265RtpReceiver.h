@@ -12,11 +12,14 @@
 
 #include "yuri/core/thread/IOThread.h"
 #include "yuri/core/socket/DatagramSocket.h"
+#include "yuri/event/BasicEventProducer.h"
+#include "JitterBuffer.h"
+#include "AccessUnitAssembler.h"
 
 namespace yuri {
 namespace simple_rtp {
 
-class SimpleH265RtpReceiver : public core::IOThread {
+class SimpleH265RtpReceiver : public core::IOThread, public event::BasicEventProducer {
 public:
     IOTHREAD_GENERATOR_DECLARATION
     static core::Parameters configure();
@@ -27,11 +30,23 @@ private:
     virtual void run() override;
     virtual bool set_param(const core::Parameter& param) override;
 
-    uint16_t                                      sequence_;
+    void process_packet(const RTPPacket& packet, bool discontinuity);
+    void finish_access_unit();
+    //! Emits counters that changed since the last call
+    void emit_statistics();
+
     std::shared_ptr<core::socket::DatagramSocket> socket_;
     std::string                                   address_;
     uint16_t                                      port_;
     std::string                                   socket_type_;
+    duration_t                                    jitter_latency_;
+    size_t                                        jitter_packets_;
+    bool                                          drop_corrupted_;
+    std::unique_ptr<JitterBuffer>                 jitter_buffer_;
+    AccessUnitAssembler                           assembler_;
+    uint64_t                                      corrupted_;
+    jitter_stats_t                                last_stats_;
+    uint64_t                                      last_corrupted_;
 };
 
 } /* namespace simple_rtp */
@@ -15,10 +15,12 @@
 #include "yuri/core/frame/CompressedVideoFrame.h"
 #include "yuri/core/socket/DatagramSocket.h"
 #include "yuri/core/thread/SpecializedIOFilter.h"
+#include "yuri/event/BasicEventProducer.h"
+#include "PacedSender.h"
 namespace yuri {
 namespace simple_rtp {
 
-class SimpleH265RtpSender : public core::SpecializedIOFilter<core::CompressedVideoFrame> {
+class SimpleH265RtpSender : public core::SpecializedIOFilter<core::CompressedVideoFrame>, public event::BasicEventProducer {
     using base_type = core::SpecializedIOFilter<core::CompressedVideoFrame>;
 
 public:
@@ -32,7 +34,9 @@ private:
     void         run() override;
     virtual bool set_param(const core::Parameter& param) override;
 
-    bool send_rtp_packet(const RTPPacket& packet);
+    //! Sends all packets of an access unit, either directly or through the pacer
+    void send_access_unit(std::vector<RTPPacket>&& packets, const core::pCompressedVideoFrame& frame);
+    void emit_pacing_statistics();
     size_t                                        mtu_;
     uint32_t                                      ssrc_;
     uint16_t                                      sequence_;
@@ -40,6 +44,12 @@ private:
     std::string                                   address_;
     uint16_t                                      port_;
     std::string                                   socket_type_;
+    bool                                          pacing_;
+    double                                        bitrate_;
+    size_t                                        burst_;
+    std::unique_ptr<PacedSender>                  pacer_;
+    timestamp_t                                   last_frame_time_;
+    timestamp_t                                   last_report_;
 };
 
 } /* namespace simple_rtp */
@@ -38,6 +38,7 @@ struct RTPPacket {
     }
 
     std::vector<uint8_t>::iterator       data_begin() { return data.begin() + header_size; }
+    std::vector<uint8_t>::const_iterator data_begin() const { return data.begin() + header_size; }
     std::vector<uint8_t>::const_iterator data_end() const { return data.end(); }
     size_type                            data_size() const { return data.size() - header_size; }
 
@@ -0,0 +1,166 @@
+/*!
+ * @file 		test_jitter_buffer.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "JitterBuffer.h"
+#include "AccessUnitAssembler.h"
+#include "yuri/core/frame/compressed_frame_types.h"
+
+namespace yuri {
+namespace simple_rtp {
+
+namespace {
+
+struct released_t {
+    uint16_t sequence;
+    bool     discontinuity;
+};
+
+struct Fixture {
+    Fixture(size_t capacity = 16)
+        : buffer(capacity, 10_ms, [this](const RTPPacket& packet, bool discontinuity) {
+            released.push_back({ packet.get_sequence(), discontinuity });
+        })
+    {
+    }
+
+    void push(uint16_t sequence, timestamp_t time)
+    {
+        RTPPacket packet(1, 99, sequence, 0, 0);
+        buffer.push(packet.data.data(), packet.data.size(), time);
+    }
+
+    std::vector<uint16_t> sequences() const
+    {
+        std::vector<uint16_t> seq;
+        for (const auto& r : released)
+            seq.push_back(r.sequence);
+        return seq;
+    }
+
+    std::vector<released_t> released;
+    JitterBuffer            buffer;
+};
+}
+
+TEST_CASE("Jitter buffer", "[simple_rtp]")
+{
+    Fixture           f;
+    const timestamp_t start;
+
+    SECTION("in order packets are released immediately")
+    {
+        for (uint16_t i = 0; i < 40; ++i) {
+            f.push(i, start);
+            f.buffer.poll(start);
+        }
+        REQUIRE(f.released.size() == 40);
+        REQUIRE(f.buffer.buffered() == 0);
+        REQUIRE(f.buffer.get_stats().lost == 0);
+        REQUIRE(f.buffer.get_stats().reordered == 0);
+    }
+    SECTION("reordered packets")
+    {
+        f.push(0, start);
+        f.push(2, start);
+        f.push(3, start);
+        f.buffer.poll(start);
+        REQUIRE(f.sequences() == std::vector<uint16_t>{ 0 });
+        f.push(1, start + 5_ms);
+        f.buffer.poll(start + 5_ms);
+        REQUIRE(f.sequences() == (std::vector<uint16_t>{ 0, 1, 2, 3 }));
+        for (const auto& r : f.released)
+            REQUIRE(!r.discontinuity);
+        REQUIRE(f.buffer.get_stats().reordered == 1);
+        REQUIRE(f.buffer.get_stats().lost == 0);
+    }
+    SECTION("missing packets are skipped after latency")
+    {
+        f.push(0, start);
+        f.push(3, start + 1_ms);
+        f.buffer.poll(start + 5_ms);
+        REQUIRE(f.released.size() == 1);
+        f.buffer.poll(start + 11_ms);
+        REQUIRE(f.sequences() == (std::vector<uint16_t>{ 0, 3 }));
+        REQUIRE(f.released[1].discontinuity);
+        REQUIRE(f.buffer.get_stats().lost == 2);
+
+        // Too late to be used
+        f.push(1, start + 12_ms);
+        f.push(4, start + 12_ms);
+        f.push(4, start + 12_ms);
+        f.buffer.poll(start + 12_ms);
+        REQUIRE(f.sequences() == (std::vector<uint16_t>{ 0, 3, 4 }));
+        REQUIRE(!f.released[2].discontinuity);
+        REQUIRE(f.buffer.get_stats().late == 1);
+        REQUIRE(f.buffer.get_stats().duplicate == 1);
+    }
+    SECTION("sequence numbers wrap around")
+    {
+        f.push(65534, start);
+        f.push(0, start);
+        f.push(65535, start);
+        f.push(1, start);
+        f.buffer.poll(start);
+        REQUIRE(f.sequences() == (std::vector<uint16_t>{ 65534, 65535, 0, 1 }));
+        REQUIRE(f.buffer.get_stats().lost == 0);
+    }
+    SECTION("full buffer releases packets without waiting")
+    {
+        f.push(0, start);
+        for (uint16_t i = 2; i < 20; ++i) {
+            f.push(i, start);
+        }
+        REQUIRE(f.buffer.buffered() <= 16);
+        REQUIRE(f.released.size() == 3);
+        REQUIRE(f.released[1].sequence == 2);
+        REQUIRE(f.released[1].discontinuity);
+        f.buffer.flush();
+        REQUIRE(f.released.size() == 19);
+        REQUIRE(f.buffer.get_stats().lost == 1);
+    }
+    SECTION("restarted stream")
+    {
+        f.push(30000, start);
+        f.push(30001, start);
+        f.push(5, start);
+        f.push(6, start);
+        f.buffer.poll(start);
+        REQUIRE(f.sequences() == (std::vector<uint16_t>{ 30000, 30001, 5, 6 }));
+        REQUIRE(f.released[2].discontinuity);
+    }
+}
+
+TEST_CASE("Access unit assembler", "[simple_rtp]")
+{
+    AccessUnitAssembler  assembler(16);
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 100; ++i) {
+        const uint8_t data[] = { static_cast<uint8_t>(i), static_cast<uint8_t>(i + 1), static_cast<uint8_t>(i + 2) };
+        assembler.append(std::begin(data), std::end(data));
+        assembler.append(0xFF);
+        expected.insert(expected.end(), std::begin(data), std::end(data));
+        expected.push_back(0xFF);
+    }
+    assembler.mark_corrupted();
+    REQUIRE(assembler.size() == expected.size());
+    const auto frame = assembler.finish(core::compressed_frame::h264, resolution_t{ 0, 0 });
+    REQUIRE(frame);
+    REQUIRE(frame->size() == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), frame->begin()));
+    REQUIRE(assembler.empty());
+    REQUIRE(!assembler.is_corrupted());
+
+    assembler.append(1);
+    assembler.drop();
+    REQUIRE(assembler.empty());
+}
+
+}
+}
@@ -0,0 +1,105 @@
+/*!
+ * @file 		test_pacing.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "PacedSender.h"
+
+namespace yuri {
+namespace simple_rtp {
+
+namespace {
+
+class RecordingSocket : public core::socket::DatagramSocket {
+public:
+    RecordingSocket(const log::Log& log) : DatagramSocket(log) {}
+
+    std::vector<timestamp_t> times;
+    mutex                    mutex_;
+
+private:
+    size_t do_send_datagram(const uint8_t*, size_t size) override
+    {
+        lock_t _(mutex_);
+        times.push_back(timestamp_t{});
+        return size;
+    }
+    size_t do_receive_datagram(uint8_t*, size_t) override { return 0; }
+    bool   do_bind(const std::string&, core::socket::port_t) override { return true; }
+    bool   do_connect(const std::string&, core::socket::port_t) override { return true; }
+    bool   do_data_available() override { return false; }
+    bool   do_ready_to_send() override { return true; }
+    bool   do_wait_for_data(duration_t) override { return false; }
+};
+
+std::vector<RTPPacket> make_packets(size_t count, size_t size)
+{
+    std::vector<RTPPacket> packets;
+    for (size_t i = 0; i < count; ++i) {
+        packets.emplace_back(size - RTPPacket::header_size, 99, static_cast<uint16_t>(i), 0, 0);
+    }
+    return packets;
+}
+}
+
+TEST_CASE("Paced sender spreads packets across the interval", "[simple_rtp]")
+{
+    log::Log log(std::clog);
+    log.set_quiet(true);
+    auto socket = std::make_shared<RecordingSocket>(log);
+    {
+        PacedSender sender(log, socket, 0.0, 4000);
+        sender.get_stats();
+        sender.push(make_packets(40, 1000), 20_ms);
+        // Wait for the packets to be sent (with large enough margin for slow machines)
+        for (int i = 0; i < 200; ++i) {
+            lock_t _(socket->mutex_);
+            if (socket->times.size() == 40)
+                break;
+            _.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const auto stats = sender.get_stats();
+        REQUIRE(stats.packets == 40);
+        REQUIRE(stats.bytes == 40000);
+        REQUIRE(stats.max_burst_bytes <= 4000);
+    }
+    REQUIRE(socket->times.size() == 40);
+    // 36kB after the initial burst at 40kB / 18ms
+    const auto spread = socket->times.back() - socket->times.front();
+    REQUIRE(spread > 10_ms);
+    REQUIRE(spread < 200_ms);
+}
+
+TEST_CASE("Paced sender respects the bitrate", "[simple_rtp]")
+{
+    log::Log log(std::clog);
+    log.set_quiet(true);
+    auto socket = std::make_shared<RecordingSocket>(log);
+    {
+        // 8 Mbit/s = 1 kB/ms, without known frame interval
+        PacedSender sender(log, socket, 8.0e6, 1000);
+        sender.get_stats();
+        sender.push(make_packets(21, 1000), duration_t{});
+        for (int i = 0; i < 500; ++i) {
+            lock_t _(socket->mutex_);
+            if (socket->times.size() == 21)
+                break;
+            _.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const auto stats = sender.get_stats();
+        REQUIRE(stats.max_burst_packets == 1);
+        REQUIRE(stats.overruns == 0);
+    }
+    REQUIRE(socket->times.size() == 21);
+    REQUIRE(socket->times.back() - socket->times.front() >= 19_ms);
+}
+
+}
+}
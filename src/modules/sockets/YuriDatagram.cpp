@@ -13,6 +13,16 @@
 #include <sys/un.h>
 #include <poll.h>
 #include <unistd.h>
+#include <netinet/in.h>
+#include <cerrno>
+#include <cstring>
+
+#ifdef YURI_HAVE_MMSG
+#include <netinet/udp.h>
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
 
 
 
@@ -20,8 +30,25 @@ namespace yuri {
 namespace network {
 
 
+#ifdef YURI_HAVE_MMSG
+struct YuriDatagram::control_t {
+	alignas(cmsghdr) char buffer[CMSG_SPACE(sizeof(uint16_t))];
+};
+
+namespace {
+// Limits of the kernel for a single message with segmentation offload
+const size_t max_gso_segments = 64;
+const size_t max_gso_bytes = 65000;
+// Maximal number of messages in a single sendmmsg/recvmmsg call
+const size_t max_messages = 1024;
+}
+#endif
+
 YuriDatagram::YuriDatagram(const log::Log &log_, const std::string&, int domain):
 core::socket::DatagramSocket(log_),socket_(domain, SOCK_DGRAM, 0)
+#ifdef YURI_HAVE_MMSG
+,use_gso_(domain == AF_INET || domain == AF_INET6)
+#endif
 {
  int optval = 1;
  if(setsockopt(get_socket(), SOL_SOCKET, SO_REUSEADDR,(void *) &optval, sizeof(optval)) <0){
@@ -67,5 +94,99 @@ bool YuriDatagram::do_ready_to_send() {
 	return socket_.ready_to_send();
 }
 
+#ifdef YURI_HAVE_MMSG
+/*!
+ * Fills messages_ for datagrams. With segmentation offload, consecutive datagrams
+ * of the same size (the last one may be shorter) are sent as a single message
+ * and split by the kernel (or NIC).
+ * @return number of messages prepared
+ */
+size_t YuriDatagram::prepare_messages(const core::socket::datagram_t* datagrams, size_t count)
+{
+	count = std::min(count, max_messages);
+	messages_.resize(count);
+	iovecs_.resize(count);
+	controls_.resize(count);
+	segments_.resize(count);
+	size_t msg = 0;
+	for (size_t i = 0; i < count; ++msg) {
+		size_t segments = 1;
+		size_t bytes = datagrams[i].size;
+		if (use_gso_) {
+			const size_t segment_size = datagrams[i].size;
+			while (i + segments < count && segments < max_gso_segments && bytes + datagrams[i + segments].size <= max_gso_bytes
+					&& datagrams[i + segments].size <= segment_size && datagrams[i + segments - 1].size == segment_size) {
+				bytes += datagrams[i + segments].size;
+				++segments;
+			}
+		}
+		for (size_t s = 0; s < segments; ++s) {
+			iovecs_[i + s].iov_base = const_cast<uint8_t*>(datagrams[i + s].data);
+			iovecs_[i + s].iov_len = datagrams[i + s].size;
+		}
+		auto& hdr = messages_[msg].msg_hdr;
+		std::memset(&hdr, 0, sizeof(hdr));
+		hdr.msg_iov = &iovecs_[i];
+		hdr.msg_iovlen = segments;
+		if (segments > 1) {
+			hdr.msg_control = controls_[msg].buffer;
+			hdr.msg_controllen = sizeof(controls_[msg].buffer);
+			auto cmsg = CMSG_FIRSTHDR(&hdr);
+			cmsg->cmsg_level = SOL_UDP;
+			cmsg->cmsg_type = UDP_SEGMENT;
+			cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+			const uint16_t segment_size = static_cast<uint16_t>(datagrams[i].size);
+			std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+		}
+		segments_[msg] = segments;
+		i += segments;
+	}
+	return msg;
+}
+
+size_t YuriDatagram::do_send_datagrams(const core::socket::datagram_t* datagrams, size_t count)
+{
+	size_t sent = 0;
+	while (sent < count) {
+		const size_t msg_count = prepare_messages(datagrams + sent, count - sent);
+		const int ret = ::sendmmsg(get_socket(), messages_.data(), msg_count, 0);
+		if (ret <= 0) {
+			if (use_gso_ && (errno == EINVAL || errno == EIO || errno == ENOPROTOOPT)) {
+				log[log::info] << "UDP segmentation offload not available, sending datagrams separately";
+				use_gso_ = false;
+				continue;
+			}
+			break;
+		}
+		for (int i = 0; i < ret; ++i) {
+			sent += segments_[i];
+		}
+		if (static_cast<size_t>(ret) < msg_count) break;
+	}
+	return sent;
+}
+
+size_t YuriDatagram::do_receive_datagrams(const core::socket::datagram_buffer_t* buffers, size_t* sizes, size_t count)
+{
+	count = std::min(count, max_messages);
+	messages_.resize(count);
+	iovecs_.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		iovecs_[i].iov_base = buffers[i].data;
+		iovecs_[i].iov_len = buffers[i].size;
+		auto& hdr = messages_[i].msg_hdr;
+		std::memset(&hdr, 0, sizeof(hdr));
+		hdr.msg_iov = &iovecs_[i];
+		hdr.msg_iovlen = 1;
+	}
+	const int ret = ::recvmmsg(get_socket(), messages_.data(), count, MSG_DONTWAIT, nullptr);
+	if (ret <= 0) return 0;
+	for (int i = 0; i < ret; ++i) {
+		sizes[i] = messages_[i].msg_len;
+	}
+	return ret;
+}
+#endif
+
 } /* namespace yuri_tcp */
 } /* namespace yuri */
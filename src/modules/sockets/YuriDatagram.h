@@ -12,6 +12,12 @@
 
 #include "yuri/core/socket/DatagramSocket.h"
 #include "YuriNetSocket.h"
+#include <vector>
+
+#if defined(__linux__)
+#define YURI_HAVE_MMSG 1
+#include <sys/socket.h>
+#endif
 
 namespace yuri {
 namespace network {
@@ -31,8 +37,24 @@ private:
 
 	virtual bool do_data_available() override;
 	virtual bool do_wait_for_data(duration_t duration) override;
+#ifdef YURI_HAVE_MMSG
+	virtual size_t do_send_datagrams(const core::socket::datagram_t* datagrams, size_t count) override;
+	virtual size_t do_receive_datagrams(const core::socket::datagram_buffer_t* buffers, size_t* sizes, size_t count) override;
+	size_t prepare_messages(const core::socket::datagram_t* datagrams, size_t count);
+#endif
 protected:
 	YuriNetSocket socket_;
+private:
+#ifdef YURI_HAVE_MMSG
+	struct control_t;
+	//! Segmentation offload (UDP_SEGMENT) is used for UDP sockets, until it fails for the first time
+	bool						use_gso_;
+	std::vector<mmsghdr>		messages_;
+	std::vector<iovec>			iovecs_;
+	std::vector<control_t>		controls_;
+	//! Number of datagrams sent by each message
+	std::vector<size_t>			segments_;
+#endif
 };
 
 }
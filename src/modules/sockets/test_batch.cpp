@@ -0,0 +1,92 @@
+/*!
+ * @file 		test_batch.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tests/catch.hpp"
+#include "YuriUdp.h"
+#include <vector>
+
+namespace yuri {
+namespace network {
+
+namespace {
+
+std::vector<std::vector<uint8_t>> make_datagrams(const std::vector<size_t>& sizes)
+{
+	std::vector<std::vector<uint8_t>> datagrams;
+	for (size_t i = 0; i < sizes.size(); ++i) {
+		std::vector<uint8_t> data(sizes[i]);
+		for (size_t j = 0; j < data.size(); ++j) {
+			data[j] = static_cast<uint8_t>(i + j);
+		}
+		datagrams.push_back(std::move(data));
+	}
+	return datagrams;
+}
+
+void send_and_receive(const std::vector<size_t>& sizes)
+{
+	log::Log log(std::clog);
+	log.set_quiet(true);
+	const uint16_t port = 57341;
+	YuriUdp receiver(log, "");
+	YuriUdp sender(log, "");
+	REQUIRE(receiver.bind("127.0.0.1", port));
+	REQUIRE(sender.connect("127.0.0.1", port));
+
+	const auto datagrams = make_datagrams(sizes);
+	std::vector<core::socket::datagram_t> views;
+	for (const auto& d: datagrams) {
+		views.push_back({d.data(), d.size()});
+	}
+	REQUIRE(sender.send_datagrams(views) == datagrams.size());
+
+	std::vector<std::vector<uint8_t>> buffers(8, std::vector<uint8_t>(65536));
+	std::vector<core::socket::datagram_buffer_t> buffer_views;
+	for (auto& b: buffers) {
+		buffer_views.push_back({b.data(), b.size()});
+	}
+	std::vector<size_t> received_sizes(buffers.size());
+	size_t received = 0;
+	while (received < datagrams.size() && receiver.wait_for_data(100_ms)) {
+		const auto count = receiver.receive_datagrams(buffer_views.data(), received_sizes.data(), buffers.size());
+		REQUIRE(count <= buffers.size());
+		for (size_t i = 0; i < count; ++i, ++received) {
+			REQUIRE(received < datagrams.size());
+			const auto& expected = datagrams[received];
+			REQUIRE(received_sizes[i] == expected.size());
+			REQUIRE(std::equal(expected.begin(), expected.end(), buffers[i].begin()));
+		}
+	}
+	REQUIRE(received == datagrams.size());
+}
+
+}
+
+TEST_CASE("Batched datagrams keep boundaries and order", "[sockets]")
+{
+	SECTION("same size") {
+		send_and_receive(std::vector<size_t>(50, 1200));
+	}
+	SECTION("shorter last datagram") {
+		std::vector<size_t> sizes(20, 1400);
+		sizes.push_back(300);
+		sizes.push_back(1400);
+		sizes.push_back(1400);
+		send_and_receive(sizes);
+	}
+	SECTION("varying sizes") {
+		send_and_receive({10, 2000, 2000, 5, 800, 1, 1, 1, 9000});
+	}
+	SECTION("more segments than a single message can hold") {
+		send_and_receive(std::vector<size_t>(150, 100));
+	}
+}
+
+}
+}
@@ -72,7 +72,7 @@ core::pFrame convert_raw_frame(const core::pRawVideoFrame& frame_in, format_t ta
 	resolution_t res = frame_in->get_resolution();
 	core::pRawVideoFrame frame_out = core::RawVideoFrame::create_empty(target, res);
 
-	const uint8_t * src = PLANE_RAW_DATA(frame_in,0);
+	const uint8_t * src = PLANE_CONST_RAW_DATA(frame_in,0);
 	uint8_t * dest = PLANE_RAW_DATA(frame_out,0);
 
 	size_t linesize_in 	= PLANE_DATA(frame_in,0).get_line_size();
@@ -0,0 +1,67 @@
+//
+// Created by neneko on 10/18/26.
+//
+
+#include "WebMetricsResource.h"
+#include "yuri/core/Module.h"
+#include "yuri/core/utils/metrics.h"
+
+namespace yuri {
+    namespace webserver {
+
+        IOTHREAD_GENERATOR(WebMetricsResource)
+
+        core::Parameters WebMetricsResource::configure() {
+            core::Parameters p = core::IOThread::configure();
+            p.set_description("Serves metrics of nodes, pipes and memory pool in Prometheus text format (or as JSON with ?json).");
+            p["server_name"]["Name of server"] = "webserver";
+            p["path"]["Path to the resource"] = "/metrics";
+            return p;
+        }
+
+        WebMetricsResource::WebMetricsResource(const log::Log &log_, core::pwThreadBase parent,
+                                               const core::Parameters &parameters)
+                : core::IOThread(log_, parent, 0, 0, std::string("web_metrics")),
+                  WebResource(log),
+                  server_name_("webserver"),
+                  path_("/metrics") {
+            IOTHREAD_INIT(parameters)
+            // Somebody is going to read the metrics, so let's collect them from the start
+            core::metrics::enable();
+        }
+
+        WebMetricsResource::~WebMetricsResource() noexcept {
+        }
+
+        webserver::response_t WebMetricsResource::do_process_request(const webserver::request_t &request) {
+            if (request.url.params.find("json") != request.url.params.end()) {
+                return response_t{http_code::ok, {{"Content-Type", "application/json"}},
+                                  core::metrics::get_json()};
+            }
+            return response_t{http_code::ok, {{"Content-Type", "text/plain; version=0.0.4"}},
+                              core::metrics::get_prometheus()};
+        }
+
+        void WebMetricsResource::run() {
+            while (still_running() &&
+                   !register_to_server(server_name_, path_,
+                                       std::dynamic_pointer_cast<WebResource>(get_this_ptr()))) {
+                sleep(10_ms);
+            }
+            log[log::info] << "Registered to server";
+            while (still_running()) {
+                sleep(100_ms);
+            }
+        }
+
+        bool WebMetricsResource::set_param(const core::Parameter &param) {
+            if (assign_parameters(param)      //
+                    (server_name_, "server_name") //
+                    (path_, "path")) {
+                return true;
+            }
+            return core::IOThread::set_param(param);
+        }
+
+    }
+}
@@ -0,0 +1,42 @@
+//
+// Created by neneko on 10/18/26.
+//
+
+#ifndef YURI2_WEBMETRICSRESOURCE_H
+#define YURI2_WEBMETRICSRESOURCE_H
+
+#include "yuri/core/thread/IOThread.h"
+#include "WebResource.h"
+
+namespace yuri {
+    namespace webserver {
+
+        /*!
+         * Serves runtime metrics of the application (see core::metrics).
+         * Metrics are returned in Prometheus text format, or as JSON when parameter 'json' is present in the url.
+         */
+        class WebMetricsResource : public core::IOThread, public WebResource {
+        public:
+            IOTHREAD_GENERATOR_DECLARATION
+
+            static core::Parameters configure();
+
+            WebMetricsResource(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters);
+
+            ~WebMetricsResource() noexcept;
+
+        private:
+            virtual void run() override;
+
+            virtual bool set_param(const core::Parameter &param) override;
+
+            virtual webserver::response_t do_process_request(const webserver::request_t &request) override;
+
+            std::string server_name_;
+            std::string path_;
+        };
+
+    }
+}
+
+#endif //YURI2_WEBMETRICSRESOURCE_H
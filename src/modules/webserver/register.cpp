@@ -14,6 +14,7 @@
 #include "WebImageResource.h"
 #include "WebControlResource.h"
 #include "WebDataResource.h"
+#include "WebMetricsResource.h"
 #include "yuri/core/Module.h"
 
 namespace yuri {
@@ -28,6 +29,7 @@ MODULE_REGISTRATION_BEGIN("webserver")
 		REGISTER_IOTHREAD("web_control",WebControlResource)
 		REGISTER_IOTHREAD("web_directory",WebDirectoryResource)
 		REGISTER_IOTHREAD("web_data",WebDataResource)
+		REGISTER_IOTHREAD("web_metrics",WebMetricsResource)
 
 MODULE_REGISTRATION_END()
 
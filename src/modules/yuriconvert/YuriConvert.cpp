@@ -15,7 +15,6 @@
 #include "yuri/core/frame/raw_frame_params.h"
 #include "yuri/core/thread/ConverterRegister.h"
 #include "yuri/core/utils/irange.h"
-#include <future>
 #include <cassert>
 #include "converters_all.h"
 
@@ -42,7 +41,7 @@ namespace yuri {
             template<class T>
             void register_converters(const T &converter_map) {
                 for (const auto &conv: converter_map) {
-                    REGISTER_CONVERTER(conv.first.first, conv.first.second, "yuri_convert", conv.second.second)
+                    REGISTER_CONVERTER(conv.first.first, conv.first.second, "yuri_convert", conv.second.cost)
                 }
             }
         }
@@ -58,13 +57,16 @@ namespace yuri {
             p["colorimetry"]["Colorimetry to use when converting from RGB (BT709, BT601, BT2020)"] = "BT709";
             p["format"]["Output format"] = std::string("YUV422");
             p["full"]["Assume YUV values in full range"] = true;
-            p["threads"]["[EXPERIMENTAL] Number of threads to use. (use 1 to keep old behaviour)"] = 1;
+            p["threads"]["Number of threads to use. Use 0 to select it automatically from frame size."] = 0;
+            p["simd"]["Instruction set for packed YUV 4:2:2 <-> RGB conversions (auto, avx2, sse4, none). 'none' uses the reference double precision code. "
+                    "'auto' can be lowered by environment variable YURI_SIMD, which also sets the costs of these conversions."] = "auto";
             return p;
         }
 
         YuriConvertor::YuriConvertor(log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters)
                 : core::SpecializedIOFilter<core::RawVideoFrame>(log_, parent, "YuriConv"),
-                  colorimetry_(YURI_COLORIMETRY_REC709), full_range_(true), threads_(0) {
+                  colorimetry_(YURI_COLORIMETRY_REC709), full_range_(true), threads_(0),
+                  simd_level_(simd::get_default_level()) {
             IOTHREAD_INIT(parameters)
             converters_ = all_converters();
             log[log::info] << "Initialized " << converters_.size() << " converters";
@@ -88,7 +90,7 @@ namespace yuri {
             converter_t converter;
 
             auto it = converters_.find(conv_pair);
-            if (it != converters_.end()) converter = it->second.first;
+            if (it != converters_.end()) converter = it->second.converter;
             if (converter) {
                 outframe = converter(frame, *this, threads_);
             } else if (in_fmt == target_format) {
@@ -110,6 +112,16 @@ namespace yuri {
             return outframe;
         }
 
+        core::ConverterThread::line_converter_t
+        YuriConvertor::do_get_line_converter(format_t source_format, format_t target_format) const {
+            auto it = converters_.find(std::make_pair(source_format, target_format));
+            if (it == converters_.end() || !it->second.line_converter) return {};
+            const auto line_converter = it->second.line_converter;
+            return [line_converter, this](const uint8_t *src, uint8_t *dest, size_t width) {
+                line_converter(src, dest, width, *this);
+            };
+        }
+
         core::pFrame YuriConvertor::do_special_single_step(core::pRawVideoFrame frame) {
 
             return convert_frame(frame, format_);
@@ -139,6 +151,8 @@ namespace yuri {
                             (colorimetry_, "colorimetry", parse_colorimetry)
                     .parsed<std::string>
                             (format_, "format", core::raw_format::parse_format)
+                    .parsed<std::string>
+                            (simd_level_, "simd", simd::parse_level)
                             (full_range_, "full")
                             (threads_, "threads")) {
                 if (!format_) format_ = core::raw_format::yuyv422;
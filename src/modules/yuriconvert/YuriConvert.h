@@ -15,6 +15,7 @@
 #include "yuri/core/frame/RawVideoFrame.h"
 #include "yuri/core/thread/ConverterThread.h"
 #include "convert_common.h"
+#include "convert_yuv_rgb_simd.h"
 namespace yuri {
 
 namespace video {
@@ -35,14 +36,17 @@ public:
 	static core::Parameters configure();
 	colorimetry_t get_colorimetry() const { return colorimetry_; }
 	bool get_full_range() const { return full_range_; }
+	simd::simd_level_t get_simd_level() const { return simd_level_; }
 private:
 	bool set_param(const core::Parameter &p) override;
 	virtual core::pFrame do_special_single_step(core::pRawVideoFrame frame) override;
 	virtual core::pFrame do_convert_frame(core::pFrame input_frame, format_t target_format) override;
+	virtual line_converter_t do_get_line_converter(format_t source_format, format_t target_format) const override;
 	colorimetry_t colorimetry_;
 	bool full_range_;
 	yuri::format_t format_;
 	size_t threads_;
+	simd::simd_level_t simd_level_;
     converter_map converters_;
 };
 
@@ -196,7 +196,7 @@ namespace yuri {
         }
 
         converter_map get_converters_rgb10bit() {
-            static std::map<format_pair_t, std::pair<converter_t, size_t>> converters_rgb10bit = {
+            static converter_map converters_rgb10bit = {
                     define_conversion<core::raw_format::rgb_r10k_be, core::raw_format::rgb24>(30),
                     define_conversion<core::raw_format::rgb_r10k_be, core::raw_format::bgr24>(30),
                     define_conversion<core::raw_format::rgb_r10k_be, core::raw_format::rgba32>(30),
@@ -6,8 +6,7 @@
 #define YURI2_CONVERT_COMMON_H
 #include "yuri/core/frame/raw_frame_types.h"
 #include "yuri/core/frame/RawVideoFrame.h"
-#include <future>
-#include "yuri/core/utils/irange.h"
+#include "yuri/core/thread/WorkerPool.h"
 
 namespace yuri {
     namespace video {
@@ -17,7 +16,16 @@ namespace yuri {
                                                                size_t)>;
         using format_pair_t = std::pair<yuri::format_t, yuri::format_t>;
 
-        using converter_map = std::map<format_pair_t, std::pair<converter_t, size_t>>;
+        using line_converter_t = void (*)(core::Plane::const_iterator, core::Plane::iterator, size_t, const YuriConvertor &);
+
+        struct conversion_t {
+            converter_t converter;
+            size_t cost;
+            //! Converts a single line, used when the conversion is fused with other steps
+            line_converter_t line_converter;
+        };
+
+        using converter_map = std::map<format_pair_t, conversion_t>;
 
 //	inline unsigned int convY(unsigned int Y) { return (Y*219+4128) >> 6; }
 //	inline unsigned int convC(unsigned int C) {	return (C*7+129) >> 1; }
@@ -39,8 +47,9 @@ namespace yuri {
 
 
         template<format_t fmt_in, format_t fmt_out>
-        std::pair<const format_pair_t, std::pair<converter_t , size_t>> define_conversion(size_t cost) {
-            return std::make_pair(std::make_pair(fmt_in, fmt_out), std::make_pair(&convert_formats<fmt_in, fmt_out>, cost));
+        std::pair<const format_pair_t, conversion_t> define_conversion(size_t cost) {
+            return std::make_pair(std::make_pair(fmt_in, fmt_out),
+                                  conversion_t{&convert_formats<fmt_in, fmt_out>, cost, &convert_line<fmt_in, fmt_out>});
         }
 
 
@@ -97,44 +106,20 @@ namespace yuri {
 //	const size_t linesize_out 	= get_linesize<fmt_out>(width);
             const size_t linesize_in 	= PLANE_DATA(frame,0).get_line_size();
             const size_t linesize_out 	= PLANE_DATA(outframe,0).get_line_size();
-            core::Plane::const_iterator src	= PLANE_DATA(frame,0).begin();
+            core::Plane::const_iterator src	= PLANE_CONST_DATA(frame,0).begin();
             core::Plane::iterator dest		= PLANE_DATA(outframe,0).begin();
 
-            if (!threads || threads == 1) {
-                for (size_t line = 0; line < height; ++line) {
-                    convert_line<fmt_in, fmt_out>(src, dest, width, conv);
-                    src+=linesize_in;
-                    dest+=linesize_out;
-                }
-            } else {
-                size_t task_lines = height / threads;
-                std::vector<std::future<void>> results;
-                size_t start_line = 0;
-                size_t remaining = height;
-                auto f = [&](size_t s, size_t r) {
-                    return convert_multiple_lines<fmt_in, fmt_out>(
-                            linesize_in,
-                            linesize_out,
-                            src + s * linesize_in,
-                            dest + s * linesize_out,
-                            width,
-                            conv,
-                            std::min(task_lines, r)
-                    );
-                };
-                for (auto t: irange(threads)) {
-                    (void)t;
-                    results.push_back(
-                            std::async(std::launch::async,
-                                       f, start_line, remaining)
-                    );
-                    start_line += task_lines;
-                    remaining -= task_lines;
-                }
-                for (auto& t: results) {
-                    t.get();
-                }
-            }
+            core::parallel_for_lines(height, linesize_in + linesize_out, threads,
+                    [&](size_t start, size_t end) {
+                        convert_multiple_lines<fmt_in, fmt_out>(
+                                linesize_in,
+                                linesize_out,
+                                src + start * linesize_in,
+                                dest + start * linesize_out,
+                                width,
+                                conv,
+                                end - start);
+                    });
             return outframe;
         }
 
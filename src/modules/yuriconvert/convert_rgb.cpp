@@ -424,7 +424,7 @@ namespace yuri {
 
 
         converter_map get_converters_rgb() {
-            static std::map<format_pair_t, std::pair<converter_t, size_t>> converters_rgb = {
+            static converter_map converters_rgb = {
                     define_conversion<core::raw_format::rgb24, core::raw_format::rgba32>(12),
                     define_conversion<core::raw_format::bgr24, core::raw_format::bgra32>(12),
                     define_conversion<core::raw_format::rgb24, core::raw_format::argb32>(12),
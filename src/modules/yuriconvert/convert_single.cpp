@@ -300,7 +300,7 @@ namespace yuri {
             }
         }
         converter_map get_converters_single() {
-            static std::map<format_pair_t, std::pair<converter_t, size_t>> converters_single = {
+            static converter_map converters_single = {
                     define_conversion<core::raw_format::u8, core::raw_format::y8>(1),
                     define_conversion<core::raw_format::v8, core::raw_format::y8>(1),
                     define_conversion<core::raw_format::r8, core::raw_format::y8>(1),
@@ -307,8 +307,8 @@ namespace yuri {
         }
 
 
-        std::map<format_pair_t, std::pair<converter_t, size_t>> get_converters_yuv() {
-            return std::map<format_pair_t, std::pair<converter_t, size_t>>{
+        converter_map get_converters_yuv() {
+            return converter_map{
                     define_conversion<core::raw_format::yuyv422, core::raw_format::yuv444>(15),
                     define_conversion<core::raw_format::yuv444, core::raw_format::yuyv422>(15),
                     define_conversion<core::raw_format::uyvy422, core::raw_format::yuv444>(15),
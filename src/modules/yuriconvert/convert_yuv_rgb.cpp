@@ -3,6 +3,7 @@
 //
 
 #include "convert_common.h"
+#include "convert_yuv_rgb_simd.h"
 #include "YuriConvert.h"
 
 namespace yuri{
@@ -51,6 +52,54 @@ namespace yuri{
             }
         }
 
+        template<class colorimetry>
+        simd::yuv_rgb_coefficients_t make_coefficients(bool full_range)
+        {
+            const auto fixed = [](double value) { return static_cast<int16_t>(value * 16384.0 + 0.5); };
+            return {
+                    fixed(1.0 / colorimetry::Kr()),
+                    fixed(colorimetry::WbKbWg()),
+                    fixed(colorimetry::WrKrWg()),
+                    fixed(1.0 / colorimetry::Kb()),
+                    fixed(colorimetry::Wr()),
+                    fixed(colorimetry::Wg()),
+                    fixed(colorimetry::Wb()),
+                    fixed(colorimetry::Kb()),
+                    fixed(colorimetry::Kr()),
+                    full_range
+            };
+        }
+
+        const simd::yuv_rgb_coefficients_t& get_coefficients(const YuriConvertor& conv)
+        {
+            static const simd::yuv_rgb_coefficients_t coefs[3][2] = {
+                    {make_coefficients<colorimetry_traits<Wr_709, Wb_709>>(false),
+                     make_coefficients<colorimetry_traits<Wr_709, Wb_709>>(true)},
+                    {make_coefficients<colorimetry_traits<Wr_601, Wb_601>>(false),
+                     make_coefficients<colorimetry_traits<Wr_601, Wb_601>>(true)},
+                    {make_coefficients<colorimetry_traits<Wr_2020, Wb_2020>>(false),
+                     make_coefficients<colorimetry_traits<Wr_2020, Wb_2020>>(true)},
+            };
+            return coefs[conv.get_colorimetry()][conv.get_full_range() ? 1 : 0];
+        }
+
+        // Converts the line using fixed point SIMD kernels, if they're enabled
+        bool convert_line_simd(simd::yuv_layout_t in, simd::rgb_layout_t out,
+                               core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (conv.get_simd_level() == simd::simd_level_t::none) return false;
+            simd::convert_yuv422_rgb(conv.get_simd_level(), in, out, src, dest, width, get_coefficients(conv));
+            return true;
+        }
+
+        bool convert_line_simd(simd::rgb_layout_t in, simd::yuv_layout_t out,
+                               core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (conv.get_simd_level() == simd::simd_level_t::none) return false;
+            simd::convert_rgb_yuv422(conv.get_simd_level(), in, out, src, dest, width, get_coefficients(conv));
+            return true;
+        }
+
         template<bool full_range>
         uint8_t convert_y_from_double(double value);
 
@@ -127,6 +176,20 @@ namespace yuri{
             *dest++ =   convert_c_from_double<full_range>((v+v2)/2);
         }
 
+        template<class colorimetry, bool full_range>
+        void set_uyvy422_from_rgb(core::Plane::iterator& dest, const double r, const double g, const double b,
+                                  const double r2, const double g2, const double b2)
+        {
+            // Same as set_yuv422_from_rgb, just with different order of components
+            uint8_t yuyv[4];
+            core::Plane::iterator it = yuyv;
+            set_yuv422_from_rgb<colorimetry, full_range>(it, r, g, b, r2, g2, b2);
+            *dest++ = yuyv[1];
+            *dest++ = yuyv[0];
+            *dest++ = yuyv[3];
+            *dest++ = yuyv[2];
+        }
+
         template<class colorimetry, bool full_range>
         void set_rgb_from_yuv(core::Plane::iterator& dest, const double y, const double u, const double v)
         {
@@ -307,6 +370,7 @@ namespace yuri{
         void convert_line<core::raw_format::rgb24, core::raw_format::yuyv422>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::rgb_layout_t::rgb24, simd::yuv_layout_t::yuyv, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_rgb_yuv422>(src, dest, width, col, full_range);
@@ -335,6 +399,7 @@ namespace yuri{
         void convert_line<core::raw_format::rgba32, core::raw_format::yuyv422>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::rgb_layout_t::rgba32, simd::yuv_layout_t::yuyv, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_rgba_yuv422>(src, dest, width, col, full_range);
@@ -389,6 +454,7 @@ namespace yuri{
         void convert_line<core::raw_format::bgr24, core::raw_format::yuyv422>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::rgb_layout_t::bgr24, simd::yuv_layout_t::yuyv, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_bgr_yuv422>(src, dest, width, col, full_range);
@@ -418,6 +484,7 @@ namespace yuri{
         void convert_line<core::raw_format::bgra32, core::raw_format::yuyv422>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::rgb_layout_t::bgra32, simd::yuv_layout_t::yuyv, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_bgra_yuv422>(src, dest, width, col, full_range);
@@ -498,6 +565,7 @@ namespace yuri{
         void convert_line<core::raw_format::yuyv422, core::raw_format::rgb24>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::yuv_layout_t::yuyv, simd::rgb_layout_t::rgb24, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_yuv422_rgb>(src, dest, width, col, full_range);
@@ -523,11 +591,124 @@ namespace yuri{
         void convert_line<core::raw_format::uyvy422, core::raw_format::rgb24>
                 (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
         {
+            if (convert_line_simd(simd::yuv_layout_t::uyvy, simd::rgb_layout_t::rgb24, src, dest, width, conv)) return;
             colorimetry_t col = conv.get_colorimetry();
             bool full_range = conv.get_full_range();
             convert_rgb_yuv_dispatch<convert_line_uyvy422_rgb>(src, dest, width, col, full_range);
         }
 
+        template<class colorimetry, bool full_range>
+        struct convert_line_yuv422_rgba{
+            static void eval
+                    (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width)
+            {
+                for (size_t pixel = 0; pixel < width/2; ++pixel) {
+                    const double y = (*src++)/255.0;
+                    const double u = (*src++)/255.0 - 0.5;
+                    const double y2 = (*src++)/255.0;
+                    const double v = (*src++)/255.0 - 0.5;
+                    set_rgb_from_yuv<colorimetry, full_range>(dest, y, u, v);
+                    *dest++ = 255;
+                    set_rgb_from_yuv<colorimetry, full_range>(dest, y2, u, v);
+                    *dest++ = 255;
+                }
+            }
+        };
+
+        template<>
+        void convert_line<core::raw_format::yuyv422, core::raw_format::rgba32>
+                (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (convert_line_simd(simd::yuv_layout_t::yuyv, simd::rgb_layout_t::rgba32, src, dest, width, conv)) return;
+            colorimetry_t col = conv.get_colorimetry();
+            bool full_range = conv.get_full_range();
+            convert_rgb_yuv_dispatch<convert_line_yuv422_rgba>(src, dest, width, col, full_range);
+        }
+
+        template<class colorimetry, bool full_range>
+        struct convert_line_uyvy422_rgba{
+            static void eval
+                    (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width)
+            {
+                for (size_t pixel = 0; pixel < width/2; ++pixel) {
+                    const double u = (*src++)/255.0 - 0.5;
+                    const double y = (*src++)/255.0;
+                    const double v = (*src++)/255.0 - 0.5;
+                    const double y2 = (*src++)/255.0;
+                    set_rgb_from_yuv<colorimetry, full_range>(dest, y, u, v);
+                    *dest++ = 255;
+                    set_rgb_from_yuv<colorimetry, full_range>(dest, y2, u, v);
+                    *dest++ = 255;
+                }
+            }
+        };
+
+        template<>
+        void convert_line<core::raw_format::uyvy422, core::raw_format::rgba32>
+                (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (convert_line_simd(simd::yuv_layout_t::uyvy, simd::rgb_layout_t::rgba32, src, dest, width, conv)) return;
+            colorimetry_t col = conv.get_colorimetry();
+            bool full_range = conv.get_full_range();
+            convert_rgb_yuv_dispatch<convert_line_uyvy422_rgba>(src, dest, width, col, full_range);
+        }
+
+        template<class colorimetry, bool full_range>
+        struct convert_line_rgb_uyvy422{
+            static void eval
+                    (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width)
+            {
+                for (size_t pixel = 0; pixel < width/2; ++pixel) {
+                    const double r = (*src++)/255.0;
+                    const double g = (*src++)/255.0;
+                    const double b = (*src++)/255.0;
+                    const double r2 = (*src++)/255.0;
+                    const double g2 = (*src++)/255.0;
+                    const double b2 = (*src++)/255.0;
+                    set_uyvy422_from_rgb<colorimetry, full_range>(dest, r, g, b, r2, g2, b2);
+                }
+            }
+        };
+
+        template<>
+        void convert_line<core::raw_format::rgb24, core::raw_format::uyvy422>
+                (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (convert_line_simd(simd::rgb_layout_t::rgb24, simd::yuv_layout_t::uyvy, src, dest, width, conv)) return;
+            colorimetry_t col = conv.get_colorimetry();
+            bool full_range = conv.get_full_range();
+            convert_rgb_yuv_dispatch<convert_line_rgb_uyvy422>(src, dest, width, col, full_range);
+        }
+
+        template<class colorimetry, bool full_range>
+        struct convert_line_rgba_uyvy422{
+            static void eval
+                    (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width)
+            {
+                for (size_t pixel = 0; pixel < width/2; ++pixel) {
+                    const double r = (*src++)/255.0;
+                    const double g = (*src++)/255.0;
+                    const double b = (*src++)/255.0;
+                    src++;
+                    const double r2 = (*src++)/255.0;
+                    const double g2 = (*src++)/255.0;
+                    const double b2 = (*src++)/255.0;
+                    src++;
+                    set_uyvy422_from_rgb<colorimetry, full_range>(dest, r, g, b, r2, g2, b2);
+                }
+            }
+        };
+
+        template<>
+        void convert_line<core::raw_format::rgba32, core::raw_format::uyvy422>
+                (core::Plane::const_iterator src, core::Plane::iterator dest, size_t width, const YuriConvertor& conv)
+        {
+            if (convert_line_simd(simd::rgb_layout_t::rgba32, simd::yuv_layout_t::uyvy, src, dest, width, conv)) return;
+            colorimetry_t col = conv.get_colorimetry();
+            bool full_range = conv.get_full_range();
+            convert_rgb_yuv_dispatch<convert_line_rgba_uyvy422>(src, dest, width, col, full_range);
+        }
+
 
         template<class colorimetry, bool full_range>
         struct convert_line_rgba_yuva4444{
@@ -625,26 +806,34 @@ namespace yuri{
         }
 
         converter_map get_converters_yuv_rgb() {
-            static std::map<format_pair_t, std::pair<converter_t, size_t>> converters_yuv_rgb = {
+            // Packed 4:2:2 conversions have fixed point SIMD implementation, that's considerably faster.
+            // Converters created for conversion paths use the default level, so the costs follow it.
+            const bool simd = simd::get_default_level() >= simd::simd_level_t::sse41;
+            const size_t cost_422 = simd ? 15 : 25;
+            static converter_map converters_yuv_rgb = {
                     define_conversion<core::raw_format::rgb24, core::raw_format::yuv444>(20),
                     define_conversion<core::raw_format::rgba32, core::raw_format::yuv444>(20),
                     define_conversion<core::raw_format::argb32, core::raw_format::yuv444>(20),
                     define_conversion<core::raw_format::bgr24, core::raw_format::yuv444>(20),
                     define_conversion<core::raw_format::bgra32, core::raw_format::yuv444>(20),
                     define_conversion<core::raw_format::abgr32, core::raw_format::yuv444>(20),
-                    define_conversion<core::raw_format::rgb24, core::raw_format::yuyv422>(25),
-                    define_conversion<core::raw_format::rgba32, core::raw_format::yuyv422>(25),
+                    define_conversion<core::raw_format::rgb24, core::raw_format::yuyv422>(cost_422),
+                    define_conversion<core::raw_format::rgba32, core::raw_format::yuyv422>(cost_422),
                     define_conversion<core::raw_format::argb32, core::raw_format::yuyv422>(25),
-                    define_conversion<core::raw_format::bgr24, core::raw_format::yuyv422>(25),
-                    define_conversion<core::raw_format::bgra32, core::raw_format::yuyv422>(25),
+                    define_conversion<core::raw_format::bgr24, core::raw_format::yuyv422>(cost_422),
+                    define_conversion<core::raw_format::bgra32, core::raw_format::yuyv422>(cost_422),
                     define_conversion<core::raw_format::abgr32, core::raw_format::yuyv422>(25),
                     define_conversion<core::raw_format::rgba32, core::raw_format::yuva4444>(25),
                     define_conversion<core::raw_format::bgra32, core::raw_format::yuva4444>(25),
                     define_conversion<core::raw_format::argb32, core::raw_format::yuva4444>(25),
                     define_conversion<core::raw_format::abgr32, core::raw_format::yuva4444>(25),
                     define_conversion<core::raw_format::yuv444, core::raw_format::rgb24>(20),
-                    define_conversion<core::raw_format::yuyv422, core::raw_format::rgb24>(25),
-                    define_conversion<core::raw_format::uyvy422, core::raw_format::rgb24>(25),
+                    define_conversion<core::raw_format::yuyv422, core::raw_format::rgb24>(cost_422),
+                    define_conversion<core::raw_format::uyvy422, core::raw_format::rgb24>(cost_422),
+                    define_conversion<core::raw_format::yuyv422, core::raw_format::rgba32>(cost_422),
+                    define_conversion<core::raw_format::uyvy422, core::raw_format::rgba32>(cost_422),
+                    define_conversion<core::raw_format::rgb24, core::raw_format::uyvy422>(cost_422),
+                    define_conversion<core::raw_format::rgba32, core::raw_format::uyvy422>(cost_422),
             };
             return converters_yuv_rgb;
         }
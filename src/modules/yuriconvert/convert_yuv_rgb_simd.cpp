@@ -0,0 +1,616 @@
+//
+// Created by neneko on 18.10.26.
+//
+
+#include "convert_yuv_rgb_simd.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+
+#ifdef YURI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace yuri {
+    namespace video {
+        namespace simd {
+
+            namespace {
+                // All intermediate values are in 1/64 of 8bit step, so they fit into int16_t
+                const int max_value = 255 * 64;
+                // Offset of chroma (127.5)
+                const int chroma_offset = 8160;
+                // Reference kernels scale limited range RGB by 255/235 and clip it
+                const int limited_rgb_max = 235 * 64;
+                const int limited_rgb_scale = 2789;     // (255/235 - 1) * 2^15
+                const int limited_y_scale = 28142;      // 219/255 * 2^15
+                const int limited_c_scale = 28785;      // 224/255 * 2^15
+
+                struct yuv_offsets_t {
+                    size_t y0, u, y1, v;
+                };
+
+                struct rgb_offsets_t {
+                    size_t r, g, b, bpp;
+                };
+
+                yuv_offsets_t get_offsets(yuv_layout_t layout)
+                {
+                    if (layout == yuv_layout_t::uyvy) return {1, 0, 3, 2};
+                    return {0, 1, 2, 3};
+                }
+
+                rgb_offsets_t get_offsets(rgb_layout_t layout)
+                {
+                    switch (layout) {
+                        case rgb_layout_t::bgr24: return {2, 1, 0, 3};
+                        case rgb_layout_t::rgba32: return {0, 1, 2, 4};
+                        case rgb_layout_t::bgra32: return {2, 1, 0, 4};
+                        case rgb_layout_t::rgb24:
+                        default: return {0, 1, 2, 3};
+                    }
+                }
+
+/* ***************************************************************************
+ * 					Scalar fixed point code
+ *
+ * 	Every operation matches an instruction used in SIMD kernels,
+ * 	so the results are bit exact with them.
+ *************************************************************************** */
+
+                inline int mulhrs(int a, int b)
+                {
+                    return (a * b + 0x4000) >> 15;
+                }
+
+                inline int mulhi_u(int a, int b)
+                {
+                    return static_cast<int>((static_cast<uint32_t>(a) * static_cast<uint32_t>(b)) >> 16);
+                }
+
+                inline uint8_t pack_u8(int value)
+                {
+                    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+                }
+
+                inline uint8_t finish_rgb(int value, bool full_range)
+                {
+                    if (!full_range) {
+                        value = std::min(std::max(value, 0), limited_rgb_max);
+                        value += mulhrs(value, limited_rgb_scale);
+                    }
+                    return pack_u8(value >> 6);
+                }
+
+                inline uint8_t finish_y(int value, bool full_range)
+                {
+                    if (full_range) return pack_u8(value >> 6);
+                    return pack_u8((mulhrs(value, limited_y_scale) >> 6) + 16);
+                }
+
+                inline uint8_t finish_c(int value, bool full_range)
+                {
+                    value += chroma_offset;
+                    if (full_range) return pack_u8(value >> 6);
+                    value = std::min(std::max(value, 0), max_value);
+                    return pack_u8((mulhrs(value, limited_c_scale) >> 6) + 16);
+                }
+
+                void store_rgb_scalar(uint8_t* dest, const rgb_offsets_t& out, int y, int du, int dv,
+                                      const yuv_rgb_coefficients_t& c)
+                {
+                    y <<= 6;
+                    dest[out.r] = finish_rgb(y + mulhrs(dv, c.r_v), c.full_range);
+                    dest[out.g] = finish_rgb(y - mulhrs(du, c.g_u) - mulhrs(dv, c.g_v), c.full_range);
+                    dest[out.b] = finish_rgb(y + mulhrs(du, c.b_u), c.full_range);
+                    if (out.bpp == 4) dest[3] = 255;
+                }
+
+                void yuv422_rgb_scalar(const yuv_offsets_t& in, const rgb_offsets_t& out,
+                                       const uint8_t* src, uint8_t* dest, size_t start, size_t width,
+                                       const yuv_rgb_coefficients_t& c)
+                {
+                    src += start * 2;
+                    dest += start * out.bpp;
+                    for (size_t pixel = start; pixel + 1 < width; pixel += 2) {
+                        const int du = (src[in.u] << 7) - max_value;
+                        const int dv = (src[in.v] << 7) - max_value;
+                        store_rgb_scalar(dest, out, src[in.y0], du, dv, c);
+                        store_rgb_scalar(dest + out.bpp, out, src[in.y1], du, dv, c);
+                        src += 4;
+                        dest += 2 * out.bpp;
+                    }
+                }
+
+                void rgb_yuv422_scalar(const rgb_offsets_t& in, const yuv_offsets_t& out,
+                                       const uint8_t* src, uint8_t* dest, size_t start, size_t width,
+                                       const yuv_rgb_coefficients_t& c)
+                {
+                    src += start * in.bpp;
+                    dest += start * 2;
+                    for (size_t pixel = start; pixel + 1 < width; pixel += 2) {
+                        const uint8_t* src2 = src + in.bpp;
+                        const int y1 = mulhi_u(src[in.r] << 8, c.y_r) + mulhi_u(src[in.g] << 8, c.y_g) +
+                                       mulhi_u(src[in.b] << 8, c.y_b);
+                        const int y2 = mulhi_u(src2[in.r] << 8, c.y_r) + mulhi_u(src2[in.g] << 8, c.y_g) +
+                                       mulhi_u(src2[in.b] << 8, c.y_b);
+                        const int ysum = y1 + y2;
+                        const int u = mulhrs(((src[in.b] + src2[in.b]) << 6) - ysum, c.u_b);
+                        const int v = mulhrs(((src[in.r] + src2[in.r]) << 6) - ysum, c.v_r);
+                        dest[out.y0] = finish_y(y1, c.full_range);
+                        dest[out.y1] = finish_y(y2, c.full_range);
+                        dest[out.u] = finish_c(u, c.full_range);
+                        dest[out.v] = finish_c(v, c.full_range);
+                        src += 2 * in.bpp;
+                        dest += 4;
+                    }
+                }
+
+#ifdef YURI_SIMD_X86
+
+/* ***************************************************************************
+ * 					Shuffle masks
+ *************************************************************************** */
+
+                // Masks extracting 8 components from packed YUV 4:2:2 into 16bit values,
+                // chroma is duplicated for both pixels
+                struct yuv_masks_t {
+                    int8_t y[16];
+                    int8_t u[16];
+                    int8_t v[16];
+                };
+
+                yuv_masks_t get_masks(const yuv_offsets_t& offsets)
+                {
+                    yuv_masks_t masks;
+                    for (int j = 0; j < 8; ++j) {
+                        masks.y[2 * j] = static_cast<int8_t>(2 * j + offsets.y0);
+                        masks.u[2 * j] = static_cast<int8_t>(4 * (j / 2) + offsets.u);
+                        masks.v[2 * j] = static_cast<int8_t>(4 * (j / 2) + offsets.v);
+                        masks.y[2 * j + 1] = masks.u[2 * j + 1] = masks.v[2 * j + 1] = -1;
+                    }
+                    return masks;
+                }
+
+                // Masks extracting components of 4 RGB pixels into 16bit values 0-3 (lo) or 4-7 (hi)
+                struct rgb_masks_t {
+                    int8_t r_lo[16], r_hi[16];
+                    int8_t g_lo[16], g_hi[16];
+                    int8_t b_lo[16], b_hi[16];
+                };
+
+                void fill_rgb_mask(int8_t* lo, int8_t* hi, size_t offset, size_t bpp)
+                {
+                    std::fill(lo, lo + 16, -1);
+                    std::fill(hi, hi + 16, -1);
+                    for (size_t j = 0; j < 4; ++j) {
+                        lo[2 * j] = static_cast<int8_t>(j * bpp + offset);
+                        hi[2 * j + 8] = static_cast<int8_t>(j * bpp + offset);
+                    }
+                }
+
+                rgb_masks_t get_masks(const rgb_offsets_t& offsets)
+                {
+                    rgb_masks_t masks;
+                    fill_rgb_mask(masks.r_lo, masks.r_hi, offsets.r, offsets.bpp);
+                    fill_rgb_mask(masks.g_lo, masks.g_hi, offsets.g, offsets.bpp);
+                    fill_rgb_mask(masks.b_lo, masks.b_hi, offsets.b, offsets.bpp);
+                    return masks;
+                }
+
+                // Rgb24 kernels read 4 bytes after the last pixel
+                size_t get_read_margin(const rgb_offsets_t& offsets)
+                {
+                    return offsets.bpp == 3 ? 2 : 0;
+                }
+
+/* ***************************************************************************
+ * 					SSE 4.1 kernels
+ *************************************************************************** */
+
+                YURI_TARGET_SSE41
+                inline __m128i load_mask(const int8_t* mask)
+                {
+                    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+                }
+
+                YURI_TARGET_SSE41
+                inline __m128i finish_rgb(__m128i value, bool full_range)
+                {
+                    if (!full_range) {
+                        value = _mm_min_epi16(_mm_max_epi16(value, _mm_setzero_si128()), _mm_set1_epi16(limited_rgb_max));
+                        value = _mm_add_epi16(value, _mm_mulhrs_epi16(value, _mm_set1_epi16(limited_rgb_scale)));
+                    }
+                    return _mm_srai_epi16(value, 6);
+                }
+
+                YURI_TARGET_SSE41
+                inline __m128i finish_y(__m128i value, bool full_range)
+                {
+                    if (full_range) return _mm_srai_epi16(value, 6);
+                    value = _mm_srai_epi16(_mm_mulhrs_epi16(value, _mm_set1_epi16(limited_y_scale)), 6);
+                    return _mm_add_epi16(value, _mm_set1_epi16(16));
+                }
+
+                YURI_TARGET_SSE41
+                inline __m128i finish_c(__m128i value, bool full_range)
+                {
+                    value = _mm_add_epi16(value, _mm_set1_epi16(chroma_offset));
+                    if (full_range) return _mm_srai_epi16(value, 6);
+                    value = _mm_min_epi16(_mm_max_epi16(value, _mm_setzero_si128()), _mm_set1_epi16(max_value));
+                    value = _mm_srai_epi16(_mm_mulhrs_epi16(value, _mm_set1_epi16(limited_c_scale)), 6);
+                    return _mm_add_epi16(value, _mm_set1_epi16(16));
+                }
+
+                // Computes R, G, B for 8 pixels of packed YUV 4:2:2
+                YURI_TARGET_SSE41
+                inline void yuv_to_rgb(__m128i yuv, const yuv_masks_t& masks, const yuv_rgb_coefficients_t& c,
+                                       __m128i& r, __m128i& g, __m128i& b)
+                {
+                    const __m128i offset = _mm_set1_epi16(max_value);
+                    const __m128i y = _mm_slli_epi16(_mm_shuffle_epi8(yuv, load_mask(masks.y)), 6);
+                    const __m128i du = _mm_sub_epi16(_mm_slli_epi16(_mm_shuffle_epi8(yuv, load_mask(masks.u)), 7), offset);
+                    const __m128i dv = _mm_sub_epi16(_mm_slli_epi16(_mm_shuffle_epi8(yuv, load_mask(masks.v)), 7), offset);
+                    r = _mm_add_epi16(y, _mm_mulhrs_epi16(dv, _mm_set1_epi16(c.r_v)));
+                    g = _mm_sub_epi16(_mm_sub_epi16(y, _mm_mulhrs_epi16(du, _mm_set1_epi16(c.g_u))),
+                                      _mm_mulhrs_epi16(dv, _mm_set1_epi16(c.g_v)));
+                    b = _mm_add_epi16(y, _mm_mulhrs_epi16(du, _mm_set1_epi16(c.b_u)));
+                    r = finish_rgb(r, c.full_range);
+                    g = finish_rgb(g, c.full_range);
+                    b = finish_rgb(b, c.full_range);
+                }
+
+                // Stores 16 pixels of RGB24 from 4 vectors with 12 valid bytes each
+                YURI_TARGET_SSE41
+                inline void store_rgb24(uint8_t* dest, __m128i q0, __m128i q1, __m128i q2, __m128i q3)
+                {
+                    __m128i* d = reinterpret_cast<__m128i*>(dest);
+                    _mm_storeu_si128(d, _mm_or_si128(q0, _mm_slli_si128(q1, 12)));
+                    _mm_storeu_si128(d + 1, _mm_or_si128(_mm_srli_si128(q1, 4), _mm_slli_si128(q2, 8)));
+                    _mm_storeu_si128(d + 2, _mm_or_si128(_mm_srli_si128(q2, 8), _mm_slli_si128(q3, 4)));
+                }
+
+                const int8_t drop_alpha_mask[16] = {0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1};
+
+                YURI_TARGET_SSE41
+                size_t yuv422_rgb_sse41(const yuv_offsets_t& in, const rgb_offsets_t& out,
+                                        const uint8_t* src, uint8_t* dest, size_t width,
+                                        const yuv_rgb_coefficients_t& c)
+                {
+                    const auto masks = get_masks(in);
+                    const bool swap = out.r != 0;
+                    const __m128i alpha = _mm_set1_epi8(-1);
+                    size_t pixel = 0;
+                    for (; pixel + 16 <= width; pixel += 16) {
+                        __m128i ra, ga, ba, rb, gb, bb;
+                        yuv_to_rgb(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), masks, c, ra, ga, ba);
+                        yuv_to_rgb(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16)), masks, c, rb, gb, bb);
+                        const __m128i r = _mm_packus_epi16(ra, rb);
+                        const __m128i g = _mm_packus_epi16(ga, gb);
+                        const __m128i b = _mm_packus_epi16(ba, bb);
+                        const __m128i c0 = swap ? b : r;
+                        const __m128i c2 = swap ? r : b;
+                        const __m128i t0 = _mm_unpacklo_epi8(c0, g);
+                        const __m128i t1 = _mm_unpackhi_epi8(c0, g);
+                        const __m128i s0 = _mm_unpacklo_epi8(c2, alpha);
+                        const __m128i s1 = _mm_unpackhi_epi8(c2, alpha);
+                        __m128i p0 = _mm_unpacklo_epi16(t0, s0);
+                        __m128i p1 = _mm_unpackhi_epi16(t0, s0);
+                        __m128i p2 = _mm_unpacklo_epi16(t1, s1);
+                        __m128i p3 = _mm_unpackhi_epi16(t1, s1);
+                        if (out.bpp == 4) {
+                            __m128i* d = reinterpret_cast<__m128i*>(dest);
+                            _mm_storeu_si128(d, p0);
+                            _mm_storeu_si128(d + 1, p1);
+                            _mm_storeu_si128(d + 2, p2);
+                            _mm_storeu_si128(d + 3, p3);
+                        } else {
+                            const __m128i drop = load_mask(drop_alpha_mask);
+                            store_rgb24(dest, _mm_shuffle_epi8(p0, drop), _mm_shuffle_epi8(p1, drop),
+                                        _mm_shuffle_epi8(p2, drop), _mm_shuffle_epi8(p3, drop));
+                        }
+                        src += 32;
+                        dest += 16 * out.bpp;
+                    }
+                    return pixel;
+                }
+
+                // Extracts one component of 8 RGB pixels into 16bit values
+                YURI_TARGET_SSE41
+                inline __m128i gather(__m128i lo, __m128i hi, const int8_t* mask_lo, const int8_t* mask_hi)
+                {
+                    return _mm_or_si128(_mm_shuffle_epi8(lo, load_mask(mask_lo)), _mm_shuffle_epi8(hi, load_mask(mask_hi)));
+                }
+
+                YURI_TARGET_SSE41
+                inline __m128i luma(__m128i r, __m128i g, __m128i b, const yuv_rgb_coefficients_t& c)
+                {
+                    return _mm_add_epi16(_mm_add_epi16(
+                            _mm_mulhi_epu16(_mm_slli_epi16(r, 8), _mm_set1_epi16(c.y_r)),
+                            _mm_mulhi_epu16(_mm_slli_epi16(g, 8), _mm_set1_epi16(c.y_g))),
+                            _mm_mulhi_epu16(_mm_slli_epi16(b, 8), _mm_set1_epi16(c.y_b)));
+                }
+
+                const int8_t interleave_uv_mask[16] = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
+
+                YURI_TARGET_SSE41
+                size_t rgb_yuv422_sse41(const rgb_offsets_t& in, const yuv_offsets_t& out,
+                                        const uint8_t* src, uint8_t* dest, size_t width,
+                                        const yuv_rgb_coefficients_t& c)
+                {
+                    const auto m = get_masks(in);
+                    const size_t step = 4 * in.bpp;
+                    size_t pixel = 0;
+                    for (; pixel + 16 + get_read_margin(in) <= width; pixel += 16) {
+                        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+                        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + step));
+                        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * step));
+                        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * step));
+                        const __m128i ra = gather(v0, v1, m.r_lo, m.r_hi);
+                        const __m128i rb = gather(v2, v3, m.r_lo, m.r_hi);
+                        const __m128i ga = gather(v0, v1, m.g_lo, m.g_hi);
+                        const __m128i gb = gather(v2, v3, m.g_lo, m.g_hi);
+                        const __m128i ba = gather(v0, v1, m.b_lo, m.b_hi);
+                        const __m128i bb = gather(v2, v3, m.b_lo, m.b_hi);
+                        const __m128i ya = luma(ra, ga, ba, c);
+                        const __m128i yb = luma(rb, gb, bb, c);
+                        const __m128i ysum = _mm_hadd_epi16(ya, yb);
+                        const __m128i u = _mm_mulhrs_epi16(_mm_sub_epi16(
+                                _mm_slli_epi16(_mm_hadd_epi16(ba, bb), 6), ysum), _mm_set1_epi16(c.u_b));
+                        const __m128i v = _mm_mulhrs_epi16(_mm_sub_epi16(
+                                _mm_slli_epi16(_mm_hadd_epi16(ra, rb), 6), ysum), _mm_set1_epi16(c.v_r));
+                        const __m128i y8 = _mm_packus_epi16(finish_y(ya, c.full_range), finish_y(yb, c.full_range));
+                        const __m128i uv = _mm_shuffle_epi8(_mm_packus_epi16(finish_c(u, c.full_range), finish_c(v, c.full_range)),
+                                                            load_mask(interleave_uv_mask));
+                        __m128i* d = reinterpret_cast<__m128i*>(dest);
+                        if (out.y0 == 0) {
+                            _mm_storeu_si128(d, _mm_unpacklo_epi8(y8, uv));
+                            _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(y8, uv));
+                        } else {
+                            _mm_storeu_si128(d, _mm_unpacklo_epi8(uv, y8));
+                            _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(uv, y8));
+                        }
+                        src += 16 * in.bpp;
+                        dest += 32;
+                    }
+                    return pixel;
+                }
+
+/* ***************************************************************************
+ * 					AVX2 kernels
+ *
+ * 	Most instructions work in 128bit lanes, the computation is the same
+ * 	as for SSE and the pixels are reordered only when storing the results.
+ *************************************************************************** */
+
+                // Functions called from AVX2 kernels have to be compiled for AVX2 as well,
+                // mixing them with legacy SSE code causes expensive state transitions
+                YURI_TARGET_AVX2
+                inline __m256i load_mask256(const int8_t* mask)
+                {
+                    return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+                }
+
+                YURI_TARGET_AVX2
+                inline void store_rgb24_avx2(uint8_t* dest, __m256i q0, __m256i q1)
+                {
+                    const __m128i q[4] = {_mm256_castsi256_si128(q0), _mm256_extracti128_si256(q0, 1),
+                                          _mm256_castsi256_si128(q1), _mm256_extracti128_si256(q1, 1)};
+                    __m128i* d = reinterpret_cast<__m128i*>(dest);
+                    _mm_storeu_si128(d, _mm_or_si128(q[0], _mm_slli_si128(q[1], 12)));
+                    _mm_storeu_si128(d + 1, _mm_or_si128(_mm_srli_si128(q[1], 4), _mm_slli_si128(q[2], 8)));
+                    _mm_storeu_si128(d + 2, _mm_or_si128(_mm_srli_si128(q[2], 8), _mm_slli_si128(q[3], 4)));
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i finish_rgb(__m256i value, bool full_range)
+                {
+                    if (!full_range) {
+                        value = _mm256_min_epi16(_mm256_max_epi16(value, _mm256_setzero_si256()), _mm256_set1_epi16(limited_rgb_max));
+                        value = _mm256_add_epi16(value, _mm256_mulhrs_epi16(value, _mm256_set1_epi16(limited_rgb_scale)));
+                    }
+                    return _mm256_srai_epi16(value, 6);
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i finish_y(__m256i value, bool full_range)
+                {
+                    if (full_range) return _mm256_srai_epi16(value, 6);
+                    value = _mm256_srai_epi16(_mm256_mulhrs_epi16(value, _mm256_set1_epi16(limited_y_scale)), 6);
+                    return _mm256_add_epi16(value, _mm256_set1_epi16(16));
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i finish_c(__m256i value, bool full_range)
+                {
+                    value = _mm256_add_epi16(value, _mm256_set1_epi16(chroma_offset));
+                    if (full_range) return _mm256_srai_epi16(value, 6);
+                    value = _mm256_min_epi16(_mm256_max_epi16(value, _mm256_setzero_si256()), _mm256_set1_epi16(max_value));
+                    value = _mm256_srai_epi16(_mm256_mulhrs_epi16(value, _mm256_set1_epi16(limited_c_scale)), 6);
+                    return _mm256_add_epi16(value, _mm256_set1_epi16(16));
+                }
+
+                YURI_TARGET_AVX2
+                inline void yuv_to_rgb(__m256i yuv, const yuv_masks_t& masks, const yuv_rgb_coefficients_t& c,
+                                       __m256i& r, __m256i& g, __m256i& b)
+                {
+                    const __m256i offset = _mm256_set1_epi16(max_value);
+                    const __m256i y = _mm256_slli_epi16(_mm256_shuffle_epi8(yuv, load_mask256(masks.y)), 6);
+                    const __m256i du = _mm256_sub_epi16(_mm256_slli_epi16(_mm256_shuffle_epi8(yuv, load_mask256(masks.u)), 7), offset);
+                    const __m256i dv = _mm256_sub_epi16(_mm256_slli_epi16(_mm256_shuffle_epi8(yuv, load_mask256(masks.v)), 7), offset);
+                    r = _mm256_add_epi16(y, _mm256_mulhrs_epi16(dv, _mm256_set1_epi16(c.r_v)));
+                    g = _mm256_sub_epi16(_mm256_sub_epi16(y, _mm256_mulhrs_epi16(du, _mm256_set1_epi16(c.g_u))),
+                                         _mm256_mulhrs_epi16(dv, _mm256_set1_epi16(c.g_v)));
+                    b = _mm256_add_epi16(y, _mm256_mulhrs_epi16(du, _mm256_set1_epi16(c.b_u)));
+                    r = finish_rgb(r, c.full_range);
+                    g = finish_rgb(g, c.full_range);
+                    b = finish_rgb(b, c.full_range);
+                }
+
+                YURI_TARGET_AVX2
+                size_t yuv422_rgb_avx2(const yuv_offsets_t& in, const rgb_offsets_t& out,
+                                       const uint8_t* src, uint8_t* dest, size_t width,
+                                       const yuv_rgb_coefficients_t& c)
+                {
+                    const auto masks = get_masks(in);
+                    const bool swap = out.r != 0;
+                    const __m256i alpha = _mm256_set1_epi8(-1);
+                    const __m256i drop = load_mask256(drop_alpha_mask);
+                    size_t pixel = 0;
+                    for (; pixel + 32 <= width; pixel += 32) {
+                        __m256i ra, ga, ba, rb, gb, bb;
+                        // Lanes contain pixels 0-7, 8-15 and 16-23, 24-31
+                        yuv_to_rgb(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), masks, c, ra, ga, ba);
+                        yuv_to_rgb(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)), masks, c, rb, gb, bb);
+                        // Lanes contain pixels 0-7, 16-23 and 8-15, 24-31
+                        const __m256i r = _mm256_packus_epi16(ra, rb);
+                        const __m256i g = _mm256_packus_epi16(ga, gb);
+                        const __m256i b = _mm256_packus_epi16(ba, bb);
+                        const __m256i c0 = swap ? b : r;
+                        const __m256i c2 = swap ? r : b;
+                        const __m256i t0 = _mm256_unpacklo_epi8(c0, g);
+                        const __m256i t1 = _mm256_unpackhi_epi8(c0, g);
+                        const __m256i s0 = _mm256_unpacklo_epi8(c2, alpha);
+                        const __m256i s1 = _mm256_unpackhi_epi8(c2, alpha);
+                        // Lanes contain pixels 0-3, 8-11; 4-7, 12-15; 16-19, 24-27 and 20-23, 28-31
+                        const __m256i p0 = _mm256_unpacklo_epi16(t0, s0);
+                        const __m256i p1 = _mm256_unpackhi_epi16(t0, s0);
+                        const __m256i p2 = _mm256_unpacklo_epi16(t1, s1);
+                        const __m256i p3 = _mm256_unpackhi_epi16(t1, s1);
+                        __m256i o[4] = {
+                                _mm256_permute2x128_si256(p0, p1, 0x20),
+                                _mm256_permute2x128_si256(p0, p1, 0x31),
+                                _mm256_permute2x128_si256(p2, p3, 0x20),
+                                _mm256_permute2x128_si256(p2, p3, 0x31)
+                        };
+                        if (out.bpp == 4) {
+                            __m256i* d = reinterpret_cast<__m256i*>(dest);
+                            for (int i = 0; i < 4; ++i) {
+                                _mm256_storeu_si256(d + i, o[i]);
+                            }
+                        } else {
+                            for (int i = 0; i < 4; i += 2) {
+                                store_rgb24_avx2(dest + i * 24, _mm256_shuffle_epi8(o[i], drop),
+                                                 _mm256_shuffle_epi8(o[i + 1], drop));
+                            }
+                        }
+                        src += 64;
+                        dest += 32 * out.bpp;
+                    }
+                    return pixel;
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i load_pixels(const uint8_t* src, size_t step)
+                {
+                    return _mm256_inserti128_si256(_mm256_castsi128_si256(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + step)), 1);
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i gather(__m256i lo, __m256i hi, const int8_t* mask_lo, const int8_t* mask_hi)
+                {
+                    return _mm256_or_si256(_mm256_shuffle_epi8(lo, load_mask256(mask_lo)),
+                                           _mm256_shuffle_epi8(hi, load_mask256(mask_hi)));
+                }
+
+                YURI_TARGET_AVX2
+                inline __m256i luma(__m256i r, __m256i g, __m256i b, const yuv_rgb_coefficients_t& c)
+                {
+                    return _mm256_add_epi16(_mm256_add_epi16(
+                            _mm256_mulhi_epu16(_mm256_slli_epi16(r, 8), _mm256_set1_epi16(c.y_r)),
+                            _mm256_mulhi_epu16(_mm256_slli_epi16(g, 8), _mm256_set1_epi16(c.y_g))),
+                            _mm256_mulhi_epu16(_mm256_slli_epi16(b, 8), _mm256_set1_epi16(c.y_b)));
+                }
+
+                YURI_TARGET_AVX2
+                size_t rgb_yuv422_avx2(const rgb_offsets_t& in, const yuv_offsets_t& out,
+                                       const uint8_t* src, uint8_t* dest, size_t width,
+                                       const yuv_rgb_coefficients_t& c)
+                {
+                    const auto m = get_masks(in);
+                    const size_t step = 4 * in.bpp;
+                    // Reorders 4 byte groups from lanes 0-3, 8-11, ... | 4-7, 12-15, ... into natural order
+                    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+                    const __m256i interleave = load_mask256(interleave_uv_mask);
+                    size_t pixel = 0;
+                    for (; pixel + 32 + get_read_margin(in) <= width; pixel += 32) {
+                        // Lanes contain pixels 0-3 and 4-7 of every 8 pixels
+                        const __m256i v0 = load_pixels(src, step);
+                        const __m256i v1 = load_pixels(src + 2 * step, step);
+                        const __m256i v2 = load_pixels(src + 4 * step, step);
+                        const __m256i v3 = load_pixels(src + 6 * step, step);
+                        // Lanes contain pixels 0-3, 8-11 and 4-7, 12-15 (16-31 for *b)
+                        const __m256i ra = gather(v0, v1, m.r_lo, m.r_hi);
+                        const __m256i rb = gather(v2, v3, m.r_lo, m.r_hi);
+                        const __m256i ga = gather(v0, v1, m.g_lo, m.g_hi);
+                        const __m256i gb = gather(v2, v3, m.g_lo, m.g_hi);
+                        const __m256i ba = gather(v0, v1, m.b_lo, m.b_hi);
+                        const __m256i bb = gather(v2, v3, m.b_lo, m.b_hi);
+                        const __m256i ya = luma(ra, ga, ba, c);
+                        const __m256i yb = luma(rb, gb, bb, c);
+                        // Pairs stay adjacent, so horizontal adds sum pixels sharing chroma
+                        const __m256i ysum = _mm256_hadd_epi16(ya, yb);
+                        const __m256i u = _mm256_mulhrs_epi16(_mm256_sub_epi16(
+                                _mm256_slli_epi16(_mm256_hadd_epi16(ba, bb), 6), ysum), _mm256_set1_epi16(c.u_b));
+                        const __m256i v = _mm256_mulhrs_epi16(_mm256_sub_epi16(
+                                _mm256_slli_epi16(_mm256_hadd_epi16(ra, rb), 6), ysum), _mm256_set1_epi16(c.v_r));
+                        const __m256i y8 = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(
+                                finish_y(ya, c.full_range), finish_y(yb, c.full_range)), order);
+                        const __m256i uv = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_mm256_packus_epi16(
+                                finish_c(u, c.full_range), finish_c(v, c.full_range)), interleave), order);
+                        // Lanes contain pixels 0-7, 16-23 and 8-15, 24-31
+                        const __m256i lo = out.y0 == 0 ? _mm256_unpacklo_epi8(y8, uv) : _mm256_unpacklo_epi8(uv, y8);
+                        const __m256i hi = out.y0 == 0 ? _mm256_unpackhi_epi8(y8, uv) : _mm256_unpackhi_epi8(uv, y8);
+                        __m256i* d = reinterpret_cast<__m256i*>(dest);
+                        _mm256_storeu_si256(d, _mm256_permute2x128_si256(lo, hi, 0x20));
+                        _mm256_storeu_si256(d + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+                        src += 32 * in.bpp;
+                        dest += 64;
+                    }
+                    return pixel;
+                }
+
+#endif
+            }
+
+            void convert_yuv422_rgb(simd_level_t level, yuv_layout_t in, rgb_layout_t out,
+                                    const uint8_t* src, uint8_t* dest, size_t width,
+                                    const yuv_rgb_coefficients_t& coefs)
+            {
+                const auto in_offsets = get_offsets(in);
+                const auto out_offsets = get_offsets(out);
+                size_t done = 0;
+#ifdef YURI_SIMD_X86
+                if (level == simd_level_t::avx2) {
+                    done = yuv422_rgb_avx2(in_offsets, out_offsets, src, dest, width, coefs);
+                } else if (level == simd_level_t::sse41) {
+                    done = yuv422_rgb_sse41(in_offsets, out_offsets, src, dest, width, coefs);
+                }
+#else
+                (void)level;
+#endif
+                yuv422_rgb_scalar(in_offsets, out_offsets, src, dest, done, width, coefs);
+            }
+
+            void convert_rgb_yuv422(simd_level_t level, rgb_layout_t in, yuv_layout_t out,
+                                    const uint8_t* src, uint8_t* dest, size_t width,
+                                    const yuv_rgb_coefficients_t& coefs)
+            {
+                const auto in_offsets = get_offsets(in);
+                const auto out_offsets = get_offsets(out);
+                size_t done = 0;
+#ifdef YURI_SIMD_X86
+                if (level == simd_level_t::avx2) {
+                    done = rgb_yuv422_avx2(in_offsets, out_offsets, src, dest, width, coefs);
+                } else if (level == simd_level_t::sse41) {
+                    done = rgb_yuv422_sse41(in_offsets, out_offsets, src, dest, width, coefs);
+                }
+#else
+                (void)level;
+#endif
+                rgb_yuv422_scalar(in_offsets, out_offsets, src, dest, done, width, coefs);
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+//
+// Created by neneko on 18.10.26.
+//
+
+#ifndef YURI2_CONVERT_YUV_RGB_SIMD_H
+#define YURI2_CONVERT_YUV_RGB_SIMD_H
+
+#include "yuri/core/utils/cpu_features.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace yuri {
+    namespace video {
+        namespace simd {
+
+            using core::cpu::simd_level_t;
+            using core::cpu::get_supported_level;
+            using core::cpu::get_default_level;
+            using core::cpu::parse_level;
+
+            /*!
+             * Fixed point coefficients for YUV <-> RGB conversions.
+             * All the values are multiplied by 2^14 and rounded.
+             *
+             * Fixed point kernels compute intermediate values in 1/64 of a 8bit step,
+             * mimicking the behaviour of the reference double precision kernels
+             * (including the range handling) within +/- 1 LSB.
+             */
+            struct yuv_rgb_coefficients_t {
+                // YUV -> RGB
+                int16_t r_v;    // 1/Kr
+                int16_t g_u;    // Wb/(Kb*Wg)
+                int16_t g_v;    // Wr/(Kr*Wg)
+                int16_t b_u;    // 1/Kb
+                // RGB -> YUV
+                int16_t y_r;    // Wr
+                int16_t y_g;    // Wg
+                int16_t y_b;    // Wb
+                int16_t u_b;    // Kb
+                int16_t v_r;    // Kr
+                bool full_range;
+            };
+
+            //! Order of components in packed YUV 4:2:2
+            enum class yuv_layout_t {
+                yuyv,
+                uyvy
+            };
+
+            //! Order of components in packed RGB, the alpha is at the end for layouts with alpha
+            enum class rgb_layout_t {
+                rgb24,
+                bgr24,
+                rgba32,
+                bgra32
+            };
+
+            /*!
+             * Converts a line of packed YUV 4:2:2 to packed RGB.
+             * Only pairs of pixels are converted, last pixel on lines with odd width is left untouched.
+             */
+            void convert_yuv422_rgb(simd_level_t level, yuv_layout_t in, rgb_layout_t out,
+                                    const uint8_t* src, uint8_t* dest, size_t width,
+                                    const yuv_rgb_coefficients_t& coefs);
+
+            /*!
+             * Converts a line of packed RGB to packed YUV 4:2:2, chroma is averaged from both pixels.
+             * Only pairs of pixels are converted, last pixel on lines with odd width is left untouched.
+             */
+            void convert_rgb_yuv422(simd_level_t level, rgb_layout_t in, yuv_layout_t out,
+                                    const uint8_t* src, uint8_t* dest, size_t width,
+                                    const yuv_rgb_coefficients_t& coefs);
+        }
+    }
+}
+
+#endif //YURI2_CONVERT_YUV_RGB_SIMD_H
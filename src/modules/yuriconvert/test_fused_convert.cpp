@@ -0,0 +1,71 @@
+//
+// Created by neneko on 18.10.26.
+//
+
+#include "tests/catch.hpp"
+#include "YuriConvert.h"
+#include "yuri/core/thread/Convert.h"
+#include "yuri/core/thread/ConvertUtils.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <random>
+#include <sstream>
+
+extern "C" int yuri2_8_module_register();
+
+namespace yuri {
+    namespace video {
+
+        namespace {
+            std::ostringstream log_sink;
+            log::Log l(log_sink);
+
+            core::pConvert make_convert(bool fused)
+            {
+                auto params = core::Convert::configure();
+                params["fused"] = fused;
+                return std::dynamic_pointer_cast<core::Convert>(core::Convert::generate(l, core::pwThreadBase{}, params));
+            }
+        }
+
+        TEST_CASE("Fused conversion matches conversion by steps", "[yuri_convert]")
+        {
+            yuri2_8_module_register();
+            const auto fused = make_convert(true);
+            const auto stepped = make_convert(false);
+            const std::vector<std::pair<format_t, format_t>> conversions = {
+                    {core::raw_format::yuyv422, core::raw_format::rgb_r10k_le},
+                    {core::raw_format::uyvy422, core::raw_format::abgr32},
+                    {core::raw_format::rgb_r10k_le, core::raw_format::yuyv422},
+                    {core::raw_format::yuv444, core::raw_format::bgr24},
+            };
+
+            size_t multi_step = 0;
+            for (const auto& conv: conversions) {
+                const auto path = core::find_conversion(conv.first, conv.second);
+                if (path.first.size() < 2) continue;
+                ++multi_step;
+                INFO(core::raw_format::get_format_name(conv.first) << " -> "
+                     << core::raw_format::get_format_name(conv.second) << " in " << path.first.size() << " steps");
+
+                std::mt19937 gen(conv.first);
+                std::uniform_int_distribution<int> dist(0, 255);
+                auto frame = core::RawVideoFrame::create_empty(conv.first, {70, 5});
+                for (auto& v: PLANE_DATA(frame, 0)) {
+                    v = static_cast<uint8_t>(dist(gen));
+                }
+
+                const auto expected = std::dynamic_pointer_cast<core::RawVideoFrame>(stepped->convert_frame(frame, conv.second));
+                const auto converted = std::dynamic_pointer_cast<core::RawVideoFrame>(fused->convert_frame(frame, conv.second));
+                REQUIRE(expected);
+                REQUIRE(converted);
+                REQUIRE(converted->get_format() == conv.second);
+                REQUIRE(converted->get_resolution() == expected->get_resolution());
+                const auto& pe = PLANE_DATA(expected, 0);
+                const auto& pc = PLANE_DATA(converted, 0);
+                REQUIRE(pe.size() == pc.size());
+                REQUIRE(std::equal(pe.begin(), pe.end(), pc.begin()));
+            }
+            REQUIRE(multi_step > 0);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//
+// Created by neneko on 18.10.26.
+//
+
+#include "tests/catch.hpp"
+#include "YuriConvert.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <random>
+#include <sstream>
+
+namespace yuri {
+    namespace video {
+
+        namespace {
+            std::ostringstream log_sink;
+            log::Log l(log_sink);
+
+            std::shared_ptr<YuriConvertor> make_convertor(const std::string& simd, const std::string& colorimetry, bool full)
+            {
+                auto params = YuriConvertor::configure();
+                params["simd"] = simd;
+                params["colorimetry"] = colorimetry;
+                params["full"] = full;
+                return std::dynamic_pointer_cast<YuriConvertor>(YuriConvertor::generate(l, core::pwThreadBase{}, params));
+            }
+
+            core::pRawVideoFrame make_random_frame(format_t format, resolution_t res)
+            {
+                std::mt19937 gen(format);
+                std::uniform_int_distribution<int> dist(0, 255);
+                auto frame = core::RawVideoFrame::create_empty(format, res);
+                for (auto& v: PLANE_DATA(frame, 0)) {
+                    v = static_cast<uint8_t>(dist(gen));
+                }
+                return frame;
+            }
+
+            int max_difference(const core::pRawVideoFrame& a, const core::pRawVideoFrame& b)
+            {
+                const auto& pa = PLANE_DATA(a, 0);
+                const auto& pb = PLANE_DATA(b, 0);
+                REQUIRE(pa.size() == pb.size());
+                int diff = 0;
+                for (size_t i = 0; i < pa.size(); ++i) {
+                    diff = std::max(diff, std::abs(static_cast<int>(pa[i]) - static_cast<int>(pb[i])));
+                }
+                return diff;
+            }
+
+            const std::vector<std::pair<format_t, format_t>> simd_conversions = {
+                    {core::raw_format::yuyv422, core::raw_format::rgb24},
+                    {core::raw_format::uyvy422, core::raw_format::rgb24},
+                    {core::raw_format::yuyv422, core::raw_format::rgba32},
+                    {core::raw_format::uyvy422, core::raw_format::rgba32},
+                    {core::raw_format::rgb24, core::raw_format::yuyv422},
+                    {core::raw_format::bgr24, core::raw_format::yuyv422},
+                    {core::raw_format::rgba32, core::raw_format::yuyv422},
+                    {core::raw_format::bgra32, core::raw_format::yuyv422},
+                    {core::raw_format::rgb24, core::raw_format::uyvy422},
+                    {core::raw_format::rgba32, core::raw_format::uyvy422},
+            };
+        }
+
+        TEST_CASE("SIMD YUV <-> RGB matches reference", "[yuri_convert]")
+        {
+            std::vector<std::string> levels = {"sse4", "avx2"};
+            if (simd::get_supported_level() < simd::simd_level_t::avx2) levels.pop_back();
+            if (simd::get_supported_level() < simd::simd_level_t::sse41) levels.clear();
+
+            // Width not divisible by block sizes, so the scalar code for the rest of lines gets tested as well
+            for (auto res: {resolution_t{1920, 4}, resolution_t{70, 3}}) {
+                for (const auto& colorimetry: {"BT709", "BT601", "BT2020"}) {
+                    for (auto full: {true, false}) {
+                        const auto reference = make_convertor("none", colorimetry, full);
+                        REQUIRE(reference->get_simd_level() == simd::simd_level_t::none);
+                        for (const auto& conv: simd_conversions) {
+                            INFO(core::raw_format::get_format_name(conv.first) << " -> "
+                                 << core::raw_format::get_format_name(conv.second) << ", "
+                                 << colorimetry << (full ? " full" : " limited") << ", width " << res.width);
+                            const auto frame = make_random_frame(conv.first, res);
+                            const auto expected = std::dynamic_pointer_cast<core::RawVideoFrame>(
+                                    reference->convert_frame(frame, conv.second));
+                            REQUIRE(expected);
+                            core::pRawVideoFrame previous;
+                            for (const auto& level: levels) {
+                                const auto converted = std::dynamic_pointer_cast<core::RawVideoFrame>(
+                                        make_convertor(level, colorimetry, full)->convert_frame(frame, conv.second));
+                                REQUIRE(converted);
+                                REQUIRE(max_difference(expected, converted) <= 1);
+                                // All the fixed point implementations have to be bit exact
+                                if (previous) REQUIRE(max_difference(previous, converted) == 0);
+                                previous = converted;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*!
+ * @file 		bench_event_expression.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * Compares evaluation of route expressions by the tree interpreter and by compiled expressions.
+ * Usage: yuri_bench_event_expression [evaluation count]
+ */
+
+#include "yuri/event/EventExpression.h"
+#include "yuri/core/utils/time_types.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace yuri;
+
+namespace {
+
+// Typical routes scaling and combining controller values
+const std::vector<std::string> expressions = {
+		"mul(@a, 0.5)",
+		"int(add(mul(@a, 0.25), 64))",
+		"select(gt(@a, 100), [\"high\", \"low\"])",
+		"double(add(mul(@a, div(3.0, 127.0)), min(@b, 1.0)))",
+		"add(mul(sub(@a, 64), mul(2.0, 0.5)), pow(2.0, 3))",
+		"[int(@a), mul(@b, 100), str(@a)]",
+};
+
+const size_t input_values = 1024;
+
+std::vector<event::pBasicEvent> make_inputs(bool integers)
+{
+	std::vector<event::pBasicEvent> values;
+	for (size_t i = 0; i < input_values; ++i) {
+		if (integers) values.push_back(std::make_shared<event::EventInt>(static_cast<int64_t>(i % 128)));
+		else values.push_back(std::make_shared<event::EventDouble>(i / 1000.0));
+	}
+	return values;
+}
+
+duration_t run_interpreter(const event::parser::p_token& ast, size_t count)
+{
+	const auto a = make_inputs(true);
+	const auto b = make_inputs(false);
+	std::map<std::string, event::pBasicEvent> inputs;
+	const timestamp_t start;
+	for (size_t i = 0; i < count; ++i) {
+		inputs["@:a"] = a[i % input_values];
+		inputs["@:b"] = b[i % input_values];
+		event::parser::interpret(ast, inputs);
+	}
+	return timestamp_t{} - start;
+}
+
+duration_t run_compiled(const event::parser::p_token& ast, size_t count)
+{
+	const auto a = make_inputs(true);
+	const auto b = make_inputs(false);
+	event::EventExpression expr(ast);
+	const auto& names = expr.get_inputs();
+	const timestamp_t start;
+	for (size_t i = 0; i < count; ++i) {
+		for (size_t j = 0; j < names.size(); ++j) {
+			expr.set_input(j, names[j].second == "a" ? a[i % input_values] : b[i % input_values]);
+		}
+		expr.evaluate();
+	}
+	return timestamp_t{} - start;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+	std::cout << "Evaluating each expression " << count << " times\n";
+	std::cout << std::setw(52) << std::left << "expression"
+			<< std::setw(16) << std::right << "interpreted" << std::setw(16) << "compiled" << "\n";
+	for (const auto& text: expressions) {
+		const auto ast = event::parser::parse_expr_string(text);
+		const auto interpreted = run_interpreter(ast, count);
+		const auto compiled = run_compiled(ast, count);
+		std::cout << std::setw(52) << std::left << text << std::right << std::fixed << std::setprecision(1)
+				<< std::setw(11) << (interpreted.value * 1.0e3 / count) << " ns/e"
+				<< std::setw(11) << (compiled.value * 1.0e3 / count) << " ns/e\n";
+	}
+}
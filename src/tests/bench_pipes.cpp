@@ -0,0 +1,88 @@
+/*!
+ * @file 		bench_pipes.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * Measures throughput of frames passed between two threads through various pipe types.
+ * Usage: yuri_bench_pipes [frame count]
+ */
+
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/utils/time_types.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace yuri;
+
+namespace {
+
+struct bench_case_t {
+	std::string type;
+	std::string param;
+	size_t		value;
+};
+
+duration_t run_case(const bench_case_t& bench, const std::vector<core::pFrame>& frames, log::Log& l)
+{
+	auto& generator = core::PipeGenerator::get_instance();
+	auto params = generator.configure(bench.type);
+	if (!bench.param.empty()) {
+		params[bench.param] = bench.value;
+	}
+	auto p = generator.generate(bench.type, bench.type, l, params);
+	const auto count = frames.size();
+	const timestamp_t start;
+	std::thread producer([&]{
+		for (const auto& f: frames) {
+			while (!p->push_frame(f)) {
+				std::this_thread::yield();
+			}
+		}
+	});
+	size_t received = 0;
+	while (received < count) {
+		if (p->pop_frame()) {
+			++received;
+		} else {
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+	return timestamp_t{} - start;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	// Pipes report their statistics on destruction, keep them out of the results
+	std::ostringstream log_sink;
+	log::Log l(log_sink);
+	const size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+	auto frame = core::RawVideoFrame::create_empty(core::raw_format::y8, {16, 16});
+	const std::vector<core::pFrame> frames(count, frame);
+
+	const std::vector<bench_case_t> cases = {
+			{"single_blocking",			"",			0},
+			{"count_limited_blocking",	"count",	16},
+			{"size_limited_blocking",	"size",		16 * frame->get_size()},
+			{"spsc_ring_blocking",		"count",	16},
+	};
+
+	std::cout << "Passing " << count << " frames between two threads\n";
+	for (const auto& bench: cases) {
+		const auto dur = run_case(bench, frames, l);
+		std::cout << std::setw(24) << std::left << bench.type
+				<< std::setw(10) << std::right << std::fixed << std::setprecision(1)
+				<< (dur.value / 1.0e3) << " ms"
+				<< std::setw(10) << (dur.value * 1.0e3 / count) << " ns/frame\n";
+	}
+}
@@ -0,0 +1,129 @@
+/*!
+ * @file 		test_async_file.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/utils/AsyncFile.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+namespace {
+
+std::string temp_file_name(const std::string& name)
+{
+	return "/tmp/yuri_test_" + name + "_" + std::to_string(::getpid());
+}
+
+void test_write_read(async_backend_t backend, const std::string& name)
+{
+	const auto path = temp_file_name(name);
+	const size_t block = 64 * 1024;
+	const size_t blocks = 16;
+	std::vector<uint8_t> data(block * blocks);
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+	}
+	{
+		auto file = AsyncFile::open(path, O_WRONLY | O_CREAT | O_TRUNC, 4, backend);
+		REQUIRE(file);
+		std::vector<AsyncFile::request_id_t> ids;
+		// Written in reverse order, so every request needs its own offset
+		for (size_t i = blocks; i > 0; --i) {
+			ids.push_back(file->write(&data[(i - 1) * block], block, (i - 1) * block));
+			REQUIRE(file->get_pending() <= 4);
+		}
+		for (const auto id: ids) {
+			REQUIRE(file->wait(id) == static_cast<int64_t>(block));
+		}
+		REQUIRE(file->get_pending() == 0);
+	}
+	{
+		auto file = AsyncFile::open(path, O_RDONLY, 8, backend);
+		REQUIRE(file);
+		std::vector<uint8_t> read_data(data.size() + block, 0);
+		std::vector<AsyncFile::request_id_t> ids;
+		for (size_t i = 0; i < blocks + 1; ++i) {
+			ids.push_back(file->read(&read_data[i * block], block, i * block));
+		}
+		for (size_t i = 0; i < blocks; ++i) {
+			REQUIRE(file->wait(ids[i]) == static_cast<int64_t>(block));
+		}
+		// Reading past the end of the file
+		REQUIRE(file->wait(ids.back()) == 0);
+		read_data.resize(data.size());
+		REQUIRE(read_data == data);
+		// Reading across the end of the file is short
+		std::vector<uint8_t> tail(block);
+		REQUIRE(file->wait(file->read(tail.data(), block, data.size() - block / 2)) == static_cast<int64_t>(block / 2));
+		REQUIRE(std::equal(tail.begin(), tail.begin() + block / 2, data.end() - block / 2));
+	}
+	::unlink(path.c_str());
+}
+
+}
+
+TEST_CASE("async file with threads", "[async_file]")
+{
+	test_write_read(async_backend_t::threads, "async_threads");
+}
+
+TEST_CASE("async file with automatic backend", "[async_file]")
+{
+	test_write_read(async_backend_t::automatic, "async_auto");
+}
+
+TEST_CASE("async file backend names", "[async_file]")
+{
+	REQUIRE(parse_async_backend("uring") == async_backend_t::uring);
+	REQUIRE(parse_async_backend("threads") == async_backend_t::threads);
+	REQUIRE(parse_async_backend("auto") == async_backend_t::automatic);
+	REQUIRE(parse_async_backend("xyz") == async_backend_t::automatic);
+	auto file = AsyncFile::open("/dev/null", O_RDONLY, 1, async_backend_t::threads);
+	REQUIRE(file);
+	REQUIRE(std::string(file->get_backend_name()) == "threads");
+}
+
+TEST_CASE("async file direct I/O", "[async_file]")
+{
+	const auto path = temp_file_name("async_direct");
+	const size_t size = 256 * 1024;
+	// Pool blocks of at least a page are suitable for direct I/O
+	auto out = FixedMemoryAllocator::get_block(size);
+	auto in = FixedMemoryAllocator::get_block(size);
+	REQUIRE(reinterpret_cast<uintptr_t>(out.first) % AsyncFile::direct_alignment == 0);
+	for (size_t i = 0; i < size; ++i) {
+		out.first[i] = static_cast<uint8_t>(i % 253);
+	}
+	{
+		// The filesystem may not support direct I/O, the file is then opened without it
+		auto file = AsyncFile::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 2);
+		REQUIRE(file);
+		REQUIRE(file->wait(file->write(out.first, size, 0)) == static_cast<int64_t>(size));
+	}
+	{
+		auto file = AsyncFile::open(path, O_RDONLY | O_DIRECT, 2);
+		REQUIRE(file);
+		file->read(in.first, size / 2, 0);
+		file->read(in.first + size / 2, size / 2, size / 2);
+		file->wait_all();
+		REQUIRE(file->get_pending() == 0);
+		REQUIRE(std::equal(out.first, out.first + size, in.first));
+	}
+	out.second(out.first);
+	in.second(in.first);
+	::unlink(path.c_str());
+}
+
+}
+}
@@ -0,0 +1,213 @@
+/*!
+ * @file 		test_audio_ring.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/utils/AudioRing.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+namespace {
+
+std::vector<float> ramp(size_t start, size_t frames, size_t channels)
+{
+	std::vector<float> data(frames * channels);
+	for (size_t i = 0; i < frames; ++i) {
+		for (size_t c = 0; c < channels; ++c) {
+			data[i * channels + c] = static_cast<float>((start + i) * channels + c);
+		}
+	}
+	return data;
+}
+
+struct drift_result_t {
+	uint64_t underruns;
+	size_t min_fill;
+	size_t max_fill;
+	double ratio;
+};
+
+/*
+ * Simulates producer pushing 10ms chunks at nominal rate and a device
+ * reading periods of 256 frames at rate differing by @em drift.
+ * Fill is measured during the second half of the simulation.
+ */
+drift_result_t simulate_drift(double drift, bool compensation, double seconds)
+{
+	const size_t fs = 48000;
+	const size_t chunk = 480;
+	const size_t period = 256;
+	AudioRing ring(1, fs, 8192, 2048, compensation);
+	std::vector<float> input(chunk), output(period);
+	const double producer_interval = static_cast<double>(chunk) / fs;
+	const double consumer_interval = period / (fs * (1.0 + drift));
+	double producer_time = 0.0;
+	double consumer_time = 0.0;
+	size_t generated = 0;
+	drift_result_t result {0, ring.get_capacity(), 0, 1.0};
+	uint64_t underruns_before = 0;
+	while (producer_time < seconds) {
+		if (producer_time <= consumer_time) {
+			for (size_t i = 0; i < chunk; ++i) {
+				input[i] = static_cast<float>(std::sin(2.0 * 3.14159265358979 * 440.0 * (generated + i) / fs));
+			}
+			generated += chunk;
+			ring.push(input.data(), chunk);
+			producer_time += producer_interval;
+		} else {
+			ring.read(output.data(), period);
+			consumer_time += consumer_interval;
+			if (consumer_time > seconds / 2) {
+				result.min_fill = std::min(result.min_fill, ring.available());
+				result.max_fill = std::max(result.max_fill, ring.available());
+			} else {
+				underruns_before = ring.get_underruns();
+			}
+		}
+	}
+	result.underruns = ring.get_underruns() - underruns_before;
+	result.ratio = ring.get_ratio();
+	return result;
+}
+
+}
+
+TEST_CASE("audio ring") {
+	SECTION("prebuffering and wrapping") {
+		AudioRing ring(2, 48000, 8, 4, false);
+		std::vector<float> out(2 * 3, -1.0f);
+		auto data = ramp(0, 3, 2);
+		REQUIRE(ring.push(data.data(), 3) == 3);
+		// Not enough data for target fill, output is silent
+		REQUIRE(ring.read(out.data(), 3) == 0);
+		REQUIRE(std::all_of(out.begin(), out.end(), [](float v){ return v == 0.0f; }));
+		REQUIRE(ring.get_underruns() == 0);
+		data = ramp(3, 3, 2);
+		REQUIRE(ring.push(data.data(), 3) == 3);
+		REQUIRE(ring.read(out.data(), 3) == 3);
+		REQUIRE(out == ramp(0, 3, 2));
+		// Wraps around the end of the ring
+		data = ramp(6, 5, 2);
+		REQUIRE(ring.push(data.data(), 5) == 5);
+		REQUIRE(ring.available() == 8);
+		REQUIRE(ring.space() == 0);
+		REQUIRE(ring.read(out.data(), 3) == 3);
+		REQUIRE(out == ramp(3, 3, 2));
+		std::vector<float> rest(2 * 5);
+		REQUIRE(ring.read(rest.data(), 5) == 5);
+		REQUIRE(rest == ramp(6, 5, 2));
+	}
+	SECTION("underrun and overrun") {
+		AudioRing ring(1, 48000, 4, 2, false);
+		auto data = ramp(0, 6, 1);
+		REQUIRE(ring.push(data.data(), 6) == 4);
+		REQUIRE(ring.get_overruns() == 1);
+		REQUIRE(ring.get_dropped_frames() == 2);
+		std::vector<float> out(3);
+		REQUIRE(ring.read(out.data(), 3) == 3);
+		REQUIRE(ring.read(out.data(), 3) == 1);
+		REQUIRE(out == std::vector<float>({3, 0, 0}));
+		REQUIRE(ring.get_underruns() == 1);
+		REQUIRE(ring.get_missing_frames() == 2);
+		// After underrun, playback waits for the target fill again
+		REQUIRE(ring.push(data.data(), 1) == 1);
+		REQUIRE(ring.read(out.data(), 1) == 0);
+		REQUIRE(ring.get_underruns() == 1);
+		REQUIRE(ring.push(data.data() + 1, 1) == 1);
+		REQUIRE(ring.read(out.data(), 1) == 1);
+	}
+	SECTION("only full reads") {
+		AudioRing ring(1, 48000, 8, 0, false);
+		auto data = ramp(0, 5, 1);
+		ring.push(data.data(), 5);
+		std::vector<float> out(4);
+		REQUIRE(ring.read(out.data(), 4, true) == 4);
+		REQUIRE(ring.read(out.data(), 4, true) == 0);
+		REQUIRE(out == std::vector<float>({0, 0, 0, 0}));
+		REQUIRE(ring.available() == 1);
+	}
+	SECTION("planar") {
+		AudioRing ring(3, 48000, 4, 0, false);
+		auto data = ramp(0, 3, 3);
+		ring.push(data.data(), 3);
+		std::vector<float> a(4, -1.0f), c(4, -1.0f);
+		float* planes[] = {a.data(), nullptr, c.data()};
+		REQUIRE(ring.read_planar(planes, 3) == 3);
+		REQUIRE(a == std::vector<float>({0, 3, 6, -1}));
+		REQUIRE(c == std::vector<float>({2, 5, 8, -1}));
+	}
+	SECTION("unity ratio keeps samples") {
+		AudioRing ring(2, 48000, 64, 0, true);
+		auto data = ramp(0, 16, 2);
+		// First two frames come from the interpolation history
+		REQUIRE(ring.push(data.data(), 16) == 16);
+		std::vector<float> out(2 * 16);
+		REQUIRE(ring.read(out.data(), 16) == 16);
+		REQUIRE(out[0] == 0.0f);
+		REQUIRE(out[3] == 0.0f);
+		for (size_t i = 4; i < out.size(); ++i) REQUIRE(out[i] == data[i - 4]);
+	}
+}
+
+TEST_CASE("audio ring threads") {
+	const size_t total = 1 << 20;
+	AudioRing ring(2, 48000, 4096, 0, false);
+	bool complete_pushes = true;
+	std::thread producer([&ring, &complete_pushes]{
+		size_t pushed = 0;
+		while (pushed < total) {
+			const size_t count = std::min<size_t>(std::min<size_t>(333, ring.space()), total - pushed);
+			if (!count) {
+				std::this_thread::yield();
+				continue;
+			}
+			auto data = ramp(pushed, count, 2);
+			complete_pushes = complete_pushes && ring.push(data.data(), count) == count;
+			pushed += count;
+		}
+	});
+	std::vector<float> out(2 * 256);
+	size_t received = 0;
+	bool ordered = true;
+	while (received < total) {
+		const size_t count = ring.read(out.data(), std::min<size_t>(256, ring.available()));
+		for (size_t i = 0; i < count * 2; ++i) {
+			ordered = ordered && out[i] == static_cast<float>(received * 2 + i);
+		}
+		received += count;
+		if (!count) std::this_thread::yield();
+	}
+	producer.join();
+	REQUIRE(ordered);
+	REQUIRE(complete_pushes);
+	REQUIRE(ring.get_overruns() == 0);
+}
+
+TEST_CASE("audio ring drift compensation") {
+	for (auto drift: {0.001, -0.001}) {
+		const auto uncompensated = simulate_drift(drift, false, 120.0);
+		if (drift > 0) {
+			REQUIRE(uncompensated.underruns > 0);
+		} else {
+			REQUIRE(uncompensated.max_fill > 6000);
+		}
+		const auto compensated = simulate_drift(drift, true, 300.0);
+		REQUIRE(compensated.underruns == 0);
+		REQUIRE(compensated.min_fill > 1500);
+		REQUIRE(compensated.max_fill < 2800);
+		REQUIRE(compensated.ratio == Approx(1.0 + drift).epsilon(2e-4));
+	}
+}
+
+}
+}
@@ -0,0 +1,84 @@
+/*!
+ * @file 		test_convert_costs.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/thread/ConvertUtils.h"
+#include "yuri/core/frame/raw_frame_params.h"
+#include <cstdio>
+
+namespace yuri {
+namespace core {
+
+namespace {
+format_t add_test_format(const std::string& name, const std::string& components = "Y")
+{
+	const auto fmt = raw_format::new_user_format();
+	const auto bits = 8 * components.size();
+	raw_format::add_format({fmt, name, {name}, "", {{components, {bits, 1}, {8}}}});
+	return fmt;
+}
+
+converter_key register_test_converters()
+{
+	const auto f1 = add_test_format("COSTTEST1");
+	const auto f2 = add_test_format("COSTTEST2");
+	auto& reg = ConverterRegister::get_instance();
+	reg.add_value({f1, f2}, {"cost_test_slow", 5});
+	reg.add_value({f1, f2}, {"cost_test_fast", 10});
+	// Lossy converter that is never measured
+	const auto f3 = add_test_format("COSTTEST3", "RGB");
+	reg.add_value({f3, f1}, {"cost_test_lossy", 50});
+	return {f1, f2};
+}
+}
+
+TEST_CASE("measured conversion costs", "[convert]")
+{
+	// Catch runs the test case once per section, but the formats have to be registered only once
+	static const auto formats = register_test_converters();
+	const auto f1 = formats.first;
+	const auto f2 = formats.second;
+	clear_conversion_costs();
+
+	auto path = find_conversion(f1, f2);
+	REQUIRE(path.first.size() == 1);
+	REQUIRE(path.first[0].name == "cost_test_slow");
+
+	SECTION("measurements override static costs") {
+		set_conversion_cost("cost_test_slow", f1, f2, 10.0);
+		set_conversion_cost("cost_test_fast", f1, f2, 1.0);
+		path = find_conversion(f1, f2);
+		REQUIRE(path.first.size() == 1);
+		REQUIRE(path.first[0].name == "cost_test_fast");
+		REQUIRE(get_measured_conversion_cost("cost_test_fast", f1, f2) == 1.0);
+	}
+	SECTION("costs can be stored and loaded") {
+		const std::string filename = "yuri_test_converter_costs";
+		set_conversion_cost("cost_test_slow", f1, f2, 10.0);
+		set_conversion_cost("cost_test_fast", f1, f2, 1.0);
+		REQUIRE(save_conversion_costs(filename));
+		clear_conversion_costs();
+		REQUIRE(find_conversion(f1, f2).first[0].name == "cost_test_slow");
+		REQUIRE(load_conversion_costs(filename));
+		REQUIRE(get_measured_conversion_cost("cost_test_slow", f1, f2) == 10.0);
+		REQUIRE(find_conversion(f1, f2).first[0].name == "cost_test_fast");
+		std::remove(filename.c_str());
+	}
+	SECTION("static costs are not penalized again") {
+		const auto f3 = raw_format::parse_format("COSTTEST3");
+		const auto unmeasured = find_conversion(f3, f1);
+		REQUIRE(unmeasured.first.size() == 1);
+		set_conversion_cost("cost_test_fast", f1, f2, 1.0);
+		REQUIRE(find_conversion(f3, f1).second == unmeasured.second);
+	}
+	clear_conversion_costs();
+}
+
+}
+}
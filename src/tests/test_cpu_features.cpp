@@ -0,0 +1,33 @@
+/*!
+ * @file 		test_cpu_features.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/utils/cpu_features.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace yuri {
+namespace core {
+namespace cpu {
+
+TEST_CASE("SIMD level parsing")
+{
+	REQUIRE(parse_level("none") == simd_level_t::none);
+	REQUIRE(parse_level("auto") == get_default_level());
+	REQUIRE(get_default_level() <= get_supported_level());
+	REQUIRE(parse_level("AVX2") == std::min(simd_level_t::avx2, get_supported_level()));
+	REQUIRE(parse_level("sse4") == std::min(simd_level_t::sse41, get_supported_level()));
+	REQUIRE(parse_level("sse2") <= get_supported_level());
+	REQUIRE_THROWS_AS(parse_level("avx512"), std::invalid_argument);
+	REQUIRE_THROWS_AS(parse_level(""), std::invalid_argument);
+}
+
+}
+}
+}
@@ -0,0 +1,118 @@
+/*!
+ * @file 		test_event_expression.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/event/EventExpression.h"
+#include "yuri/event/BasicEventConversions.h"
+
+namespace yuri {
+namespace event {
+
+namespace {
+
+std::map<std::string, pBasicEvent> get_inputs()
+{
+	return {
+		{"@:a", std::make_shared<EventInt>(7)},
+		{"@:b", std::make_shared<EventDouble>(2.5)},
+		{"@:s", std::make_shared<EventString>("text")},
+		{"@:r", std::make_shared<EventInt>(50, 0, 100)},
+		{"@:t", std::make_shared<EventBool>(true)},
+	};
+}
+
+EventExpression compile(const std::string& text, const std::map<std::string, pBasicEvent>& inputs)
+{
+	auto ast = parser::parse_expr_string(text);
+	REQUIRE(ast);
+	EventExpression expr(ast);
+	const auto& names = expr.get_inputs();
+	for (size_t i = 0; i < names.size(); ++i) {
+		auto it = inputs.find(names[i].first + ":" + names[i].second);
+		if (it != inputs.end()) expr.set_input(i, it->second);
+	}
+	return expr;
+}
+
+std::string to_string(const pBasicEvent& event)
+{
+	return get_value<EventString>(call("str", std::vector<pBasicEvent>{event}));
+}
+
+}
+
+TEST_CASE("event expression matches interpreter") {
+	const auto inputs = get_inputs();
+	const std::vector<std::string> expressions = {
+		"add(@a, 3)", "add(@a, @b)", "sub(@b, @a)", "mul(@a, 2.0)", "div(@a, 2)", "div(@b, 2)",
+		"mod(@a, 4)", "mod(@b, 2)", "min(@a, @b)", "max(@a, 10)", "min(@t, false)",
+		"eq(@a, 7)", "eq(@a, @b, 5)", "eq(@a, 5, 1)", "gt(@b, @a)", "le(@a, 7)", "ge(@t, true)",
+		"and(true, gt(@a, 1))", "or(@a, 8)", "xor(@a, 3)", "not(eq(@a, 7))",
+		"abs(sub(0, @a))", "abs(sub(0.5, @b))", "exp(1)", "ln(@b)", "pow(@a, 2)",
+		"pass(@a)", "pass(@s)", "int(@b)", "double(@a)", "bool(@a)", "int(\"12\")",
+		"add(@s, \"x\")", "str(add(@a, 1))", "mul(@s, 2)",
+		"select(1, [@a, @b, @s])", "select(\"y\", {x: @b, y: add(@a, 1)})", "len([1, 2, @a])",
+		"seconds(@a)", "add(seconds(1), milliseconds(@a))", "lt(seconds(1), milliseconds(@a))",
+		"abs(sub(milliseconds(1), seconds(@a)))",
+		"int(@r, 0, 10)", "double(@a, 0.0, 1.0)", "add(@missing|1, @a)",
+	};
+	for (const auto& text: expressions) {
+		INFO(text);
+		auto expr = compile(text, inputs);
+		const auto expected = parser::interpret(parser::parse_expr_string(text), inputs);
+		const auto result = expr.evaluate();
+		REQUIRE(result);
+		REQUIRE(result->get_type() == expected->get_type());
+		REQUIRE(to_string(result) == to_string(expected));
+		// Second evaluation uses the same program
+		REQUIRE(to_string(expr.evaluate()) == to_string(expected));
+	}
+}
+
+TEST_CASE("event expression errors") {
+	const auto inputs = get_inputs();
+	for (const auto& text: {"add(@a, @s)", "add(@missing, 1)", "not(@a)", "div(@a, 0)", "pass(seconds(1))"}) {
+		INFO(text);
+		auto expr = compile(text, inputs);
+		REQUIRE_THROWS_AS(expr.evaluate(), std::runtime_error);
+	}
+}
+
+TEST_CASE("event expression inputs") {
+	auto expr = compile("add(@a|1, mul(@b|2, 3))", {});
+	REQUIRE(expr.get_inputs().size() == 2);
+	REQUIRE(get_value<EventInt>(expr.evaluate()) == 7);
+	expr.set_input(0, std::make_shared<EventInt>(10));
+	REQUIRE(get_value<EventInt>(expr.evaluate()) == 16);
+	// Ranges of input events are kept
+	auto ranged = compile("int(@r, 0, 10)", {{"@:r", std::make_shared<EventInt>(50, 0, 100)}});
+	REQUIRE(get_value<EventInt>(ranged.evaluate()) == 5);
+	// Null event is the same as a missing input
+	ranged.set_input(0, {});
+	REQUIRE_THROWS_AS(ranged.evaluate(), std::runtime_error);
+}
+
+TEST_CASE("event expression constant folding") {
+	auto expr = compile("add(1, mul(2, 3))", {});
+	REQUIRE(expr.is_constant());
+	const auto result = expr.evaluate();
+	REQUIRE(get_value<EventInt>(result) == 7);
+	// Folded constants are evaluated only once
+	REQUIRE(expr.evaluate() == result);
+	REQUIRE(compile("[1, {x: str(2)}]", {}).is_constant());
+	REQUIRE(!compile("add(@a, mul(2, 3))", {}).is_constant());
+	REQUIRE(!compile("generate(\"%n\")", {}).is_constant());
+	// Errors are reported when evaluating
+	auto invalid = compile("add(1, \"x\")", {});
+	REQUIRE(!invalid.is_constant());
+	REQUIRE_THROWS_AS(invalid.evaluate(), std::runtime_error);
+}
+
+}
+}
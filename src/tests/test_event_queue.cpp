@@ -0,0 +1,169 @@
+/*!
+ * @file 		test_event_queue.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/event/BasicEventProducer.h"
+#include "yuri/event/BasicEventConversions.h"
+#include <iostream>
+#include <thread>
+
+namespace yuri {
+namespace event {
+
+namespace {
+
+log::Log& get_log()
+{
+	static log::Log l(std::clog);
+	return l;
+}
+
+class TestConsumer: public BasicEventConsumer {
+public:
+	TestConsumer():BasicEventConsumer(get_log()) {}
+	using BasicEventConsumer::process_events;
+	using BasicEventConsumer::pending_events;
+	using BasicEventConsumer::wait_for_events;
+	using BasicEventConsumer::set_event_coalescing;
+	std::vector<std::pair<std::string, int64_t>> received;
+private:
+	virtual bool do_process_event(const std::string& event_name, const pBasicEvent& event) override
+	{
+		received.emplace_back(event_name, get_value<EventInt>(event));
+		return true;
+	}
+};
+
+class TestProducer: public BasicEventProducer {
+public:
+	TestProducer():BasicEventProducer(get_log()) {}
+	using BasicEventProducer::emit_event;
+};
+
+}
+
+TEST_CASE("event queue") {
+	EventQueue queue(5);
+	REQUIRE(queue.get_capacity() == 8);
+	REQUIRE(queue.empty());
+	std::string name;
+	pBasicEvent event;
+	REQUIRE(!queue.pop(name, event));
+	for (int64_t i = 0; i < 8; ++i) {
+		REQUIRE(queue.push("e" + std::to_string(i), std::make_shared<EventInt>(i)));
+	}
+	REQUIRE(!queue.push("full", std::make_shared<EventInt>(8)));
+	REQUIRE(queue.size() == 8);
+	// Wraps around the end of the records
+	for (int64_t i = 0; i < 20; ++i) {
+		REQUIRE(queue.pop(name, event));
+		REQUIRE(name == "e" + std::to_string(i));
+		REQUIRE(get_value<EventInt>(event) == i);
+		REQUIRE(queue.push("e" + std::to_string(i + 8), std::make_shared<EventInt>(i + 8)));
+	}
+	REQUIRE(queue.size() == 8);
+}
+
+TEST_CASE("event queue threads") {
+	const size_t producers = 4;
+	const int64_t count = 100000;
+	EventQueue queue(64);
+	std::vector<std::thread> threads;
+	for (size_t p = 0; p < producers; ++p) {
+		threads.emplace_back([&queue, p, count]{
+			const auto name = std::to_string(p);
+			for (int64_t i = 0; i < count; ++i) {
+				auto event = std::make_shared<EventInt>(i);
+				while (!queue.push(name, event)) std::this_thread::yield();
+			}
+		});
+	}
+	std::vector<int64_t> next(producers, 0);
+	bool ordered = true;
+	std::string name;
+	pBasicEvent event;
+	for (size_t received = 0; received < producers * count; ) {
+		if (!queue.pop(name, event)) {
+			std::this_thread::yield();
+			continue;
+		}
+		auto& expected = next[std::stoul(name)];
+		ordered = ordered && get_value<EventInt>(event) == expected;
+		++expected;
+		++received;
+	}
+	for (auto& t: threads) t.join();
+	REQUIRE(ordered);
+	REQUIRE(queue.empty());
+}
+
+TEST_CASE("event delivery") {
+	auto consumer = std::make_shared<TestConsumer>();
+	TestProducer producer;
+	REQUIRE(producer.register_listener("a", consumer, "x"));
+	REQUIRE(!producer.register_listener("a", consumer, "x"));
+	REQUIRE(producer.register_listener("*", consumer, "*"));
+	producer.emit_event("a", 1);
+	producer.emit_event("b", 2);
+	REQUIRE(consumer->pending_events() == 3);
+	REQUIRE(consumer->wait_for_events(1_ms));
+	consumer->process_events();
+	REQUIRE(consumer->received == (std::vector<std::pair<std::string, int64_t>>{{"a", 1}, {"x", 1}, {"b", 2}}));
+	REQUIRE(producer.unregister_listener("*", consumer, "*"));
+	REQUIRE(!producer.unregister_listener("*", consumer, "*"));
+	consumer->received.clear();
+	producer.emit_event("a", 3);
+	producer.emit_event("b", 4);
+	consumer->process_events();
+	REQUIRE(consumer->received == (std::vector<std::pair<std::string, int64_t>>{{"x", 3}}));
+	REQUIRE(!consumer->wait_for_events(1_ms));
+
+	SECTION("overflow discards oldest events") {
+		consumer->received.clear();
+		for (int64_t i = 0; i < 1100; ++i) producer.emit_event("a", i);
+		REQUIRE(consumer->pending_events() == 1024);
+		consumer->process_events();
+		REQUIRE(consumer->received.size() == 1024);
+		REQUIRE(consumer->received.front().second == 76);
+		REQUIRE(consumer->received.back().second == 1099);
+	}
+	SECTION("coalescing") {
+		REQUIRE(producer.register_listener("b", consumer, "y"));
+		consumer->set_event_coalescing(true);
+		consumer->received.clear();
+		for (int64_t i = 0; i < 10; ++i) {
+			producer.emit_event("a", i);
+			if (i < 5) producer.emit_event("b", i);
+		}
+		consumer->process_events();
+		REQUIRE(consumer->received == (std::vector<std::pair<std::string, int64_t>>{{"y", 4}, {"x", 9}}));
+	}
+	SECTION("expired consumers") {
+		consumer.reset();
+		producer.emit_event("a", 5);
+		REQUIRE(producer.register_listener("a", std::make_shared<TestConsumer>(), "x"));
+	}
+}
+
+TEST_CASE("event delivery wakes up waiting consumer") {
+	auto consumer = std::make_shared<TestConsumer>();
+	TestProducer producer;
+	producer.register_listener("a", consumer, "a");
+	std::thread emitter([&producer]{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		producer.emit_event("a", 1);
+	});
+	const timestamp_t start;
+	REQUIRE(consumer->wait_for_events(5_s));
+	REQUIRE(timestamp_t{} - start < 1_s);
+	emitter.join();
+}
+
+}
+}
@@ -0,0 +1,140 @@
+/*!
+ * @file 		test_frame_container.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/frame/frame_container.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/frame/compressed_frame_types.h"
+#include "yuri/core/frame/raw_audio_frame_types.h"
+
+namespace yuri {
+namespace core {
+namespace container {
+
+namespace {
+
+std::vector<uint8_t> serialize(const pFrame& frame, frame_header_t& header)
+{
+	REQUIRE(make_frame_header(frame, header));
+	std::vector<uint8_t> data;
+	for (const auto& p: get_frame_payload(frame)) {
+		data.insert(data.end(), p.first, p.first + p.second);
+	}
+	REQUIRE(data.size() == header.payload_size);
+	return data;
+}
+
+}
+
+TEST_CASE("container headers", "[container]")
+{
+	auto header = make_file_header();
+	REQUIRE(is_valid(header));
+	REQUIRE(header.alignment == default_alignment);
+	header.magic[0] = 'X';
+	REQUIRE(!is_valid(header));
+	REQUIRE(!is_valid(make_file_header(48)));
+
+	auto trailer = make_trailer(1024, 10);
+	REQUIRE(is_valid(trailer));
+	REQUIRE(trailer.index_offset == 1024);
+	REQUIRE(trailer.frame_count == 10);
+
+	REQUIRE(align_offset(0, 64) == 0);
+	REQUIRE(align_offset(1, 64) == 64);
+	REQUIRE(align_offset(64, 64) == 64);
+	REQUIRE(align_offset(65, 64) == 128);
+}
+
+TEST_CASE("container raw video frame", "[container]")
+{
+	auto frame = RawVideoFrame::create_empty(raw_format::yuv420p, {64, 32});
+	for (size_t i = 0; i < frame->get_planes_count(); ++i) {
+		std::fill(PLANE_DATA(frame, i).begin(), PLANE_DATA(frame, i).end(), static_cast<uint8_t>(i + 1));
+	}
+	frame->set_duration(40_ms);
+	frame->set_interlacing(interlace_t::interlaced);
+	frame->set_field_order(field_order_t::bottom_field_first);
+	frame_header_t header;
+	auto data = serialize(frame, header);
+	REQUIRE(header.type == frame_type_t::raw_video);
+	REQUIRE(header.width == 64);
+	REQUIRE(header.height == 32);
+	REQUIRE(header.payload_size == 64 * 32 * 3 / 2);
+	header.index = 5;
+
+	auto owner = std::make_shared<int>(0);
+	auto copy = std::dynamic_pointer_cast<RawVideoFrame>(create_frame(header, data.data(), owner));
+	REQUIRE(copy);
+	REQUIRE(copy->get_format() == raw_format::yuv420p);
+	REQUIRE(copy->get_resolution() == resolution_t{64, 32});
+	REQUIRE(copy->get_planes_count() == 3);
+	REQUIRE(copy->get_duration() == 40_ms);
+	REQUIRE(copy->get_index() == 5);
+	REQUIRE(copy->get_interlacing() == interlace_t::interlaced);
+	REQUIRE(copy->get_field_order() == field_order_t::bottom_field_first);
+	for (size_t i = 0; i < copy->get_planes_count(); ++i) {
+		REQUIRE(PLANE_SIZE(copy, i) == PLANE_SIZE(frame, i));
+		REQUIRE(PLANE_CONST_RAW_DATA(copy, i)[0] == i + 1);
+	}
+	// The payload is used in place, but never modified
+	REQUIRE(PLANE_CONST_RAW_DATA(copy, 0) == data.data());
+	REQUIRE(owner.use_count() > 1);
+	PLANE_DATA(copy, 0)[0] = 42;
+	REQUIRE(data[0] == 1);
+	REQUIRE(PLANE_CONST_RAW_DATA(copy, 0) != data.data());
+	copy.reset();
+	REQUIRE(owner.use_count() == 1);
+
+	header.payload_size -= 1;
+	REQUIRE(!create_frame(header, data.data(), owner));
+
+	// Only the size given by the format is stored, the reader expects the same
+	auto padded = std::make_shared<RawVideoFrame>(raw_format::y8, resolution_t{8, 8}, 0);
+	padded->emplace_back(Plane(80, {8, 8}, 8));
+	REQUIRE(make_frame_header(padded, header));
+	REQUIRE(header.payload_size == 64);
+	auto cropped = std::make_shared<RawVideoFrame>(raw_format::y8, resolution_t{8, 8}, 0);
+	cropped->emplace_back(Plane(48, {8, 8}, 8));
+	REQUIRE(!make_frame_header(cropped, header));
+}
+
+TEST_CASE("container compressed and audio frames", "[container]")
+{
+	const std::vector<uint8_t> bitstream = {0, 0, 0, 1, 0x65, 1, 2, 3, 4};
+	auto frame = CompressedVideoFrame::create_empty(compressed_frame::h264, resolution_t{1920, 1080}, bitstream.data(), bitstream.size());
+	frame_header_t header;
+	auto data = serialize(frame, header);
+	REQUIRE(header.type == frame_type_t::compressed_video);
+	REQUIRE(data == bitstream);
+	auto copy = std::dynamic_pointer_cast<CompressedVideoFrame>(create_frame(header, data.data(), {}));
+	REQUIRE(copy);
+	REQUIRE(copy->get_format() == compressed_frame::h264);
+	REQUIRE(copy->get_resolution() == resolution_t{1920, 1080});
+	REQUIRE(std::equal(copy->begin(), copy->end(), bitstream.begin()));
+	// Compressed frames can't copy on write, so they don't use the payload in place
+	REQUIRE(&*copy->begin() != data.data());
+
+	auto audio = RawAudioFrame::create_empty(raw_audio_format::signed_16bit, 2, 48000, 480);
+	data = serialize(audio, header);
+	REQUIRE(header.type == frame_type_t::raw_audio);
+	REQUIRE(header.channels == 2);
+	REQUIRE(header.sampling_frequency == 48000);
+	auto audio_copy = std::dynamic_pointer_cast<RawAudioFrame>(create_frame(header, data.data(), {}));
+	REQUIRE(audio_copy);
+	REQUIRE(audio_copy->get_sample_count() == 480);
+	REQUIRE(audio_copy->get_sampling_frequency() == 48000);
+}
+
+}
+}
+}
@@ -0,0 +1,164 @@
+/*!
+ * @file 		test_frame_copy.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/thread/WorkerPool.h"
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace yuri {
+namespace core {
+
+namespace {
+pRawVideoFrame make_frame(uint8_t value)
+{
+	auto frame = RawVideoFrame::create_empty(raw_format::yuv422p, {64, 16});
+	for (auto& plane: *frame) {
+		std::fill(plane.begin(), plane.end(), value);
+	}
+	return frame;
+}
+}
+
+TEST_CASE("frame copies share planes until modified", "[frame]")
+{
+	auto frame = make_frame(1);
+	const uint64_t copied = copy_statistics::get_total_copied_bytes();
+	auto copy = std::dynamic_pointer_cast<RawVideoFrame>(frame->get_copy());
+	REQUIRE(copy);
+	REQUIRE(copy->get_planes_count() == 3);
+	REQUIRE(copy_statistics::get_total_copied_bytes() == copied);
+
+	SECTION("reading doesn't copy") {
+		const auto& ccopy = *copy;
+		REQUIRE(ccopy[1][0] == 1);
+		REQUIRE(PLANE_DATA(frame, 1).is_shared());
+		REQUIRE(copy_statistics::get_total_copied_bytes() == copied);
+	}
+	SECTION("only modified plane gets copied") {
+		PLANE_DATA(copy, 1)[0] = 2;
+		REQUIRE(PLANE_DATA(frame, 1)[0] == 1);
+		REQUIRE(PLANE_DATA(copy, 1)[0] == 2);
+		REQUIRE(copy_statistics::get_total_copied_bytes() == copied + PLANE_SIZE(frame, 1));
+		REQUIRE(PLANE_DATA(frame, 0).is_shared());
+		REQUIRE(PLANE_DATA(frame, 2).is_shared());
+		REQUIRE(!PLANE_DATA(frame, 1).is_shared());
+	}
+	SECTION("modified original doesn't overwrite its copies") {
+		PLANE_DATA(frame, 1)[0] = 2;
+		const auto& ccopy = *copy;
+		REQUIRE(ccopy[1][0] == 1);
+		REQUIRE(copy_statistics::get_total_copied_bytes() == copied + PLANE_SIZE(frame, 1));
+	}
+	SECTION("unique original doesn't overwrite its copies") {
+		auto original = get_frame_unique(frame);
+		REQUIRE(original == frame);
+		std::fill(PLANE_DATA(original, 0).begin(), PLANE_DATA(original, 0).end(), 3);
+		const auto& ccopy = *copy;
+		REQUIRE(ccopy[0][0] == 1);
+		REQUIRE(PLANE_DATA(frame, 0)[0] == 3);
+	}
+	SECTION("planes detach once when written from several threads") {
+		parallel_for_lines(16, 1024*1024, 4, [&](size_t begin, size_t end) {
+			auto& plane = PLANE_DATA(copy, 0);
+			const auto line_size = plane.get_line_size();
+			std::fill(plane.begin() + begin * line_size, plane.begin() + end * line_size, 4);
+		});
+		REQUIRE(copy_statistics::get_total_copied_bytes() == copied + PLANE_SIZE(frame, 0));
+		REQUIRE(PLANE_DATA(frame, 0)[0] == 1);
+		const auto& plane = PLANE_DATA(copy, 0);
+		REQUIRE(std::all_of(plane.begin(), plane.end(), [](uint8_t v){ return v == 4; }));
+	}
+}
+
+TEST_CASE("pipe accounts copies of its consumer", "[frame]")
+{
+	std::ostringstream log_sink;
+	log::Log l(log_sink);
+	auto pipe = PipeGenerator::get_instance().generate("unlimited", "copy", l, PipeGenerator::get_instance().configure("unlimited"));
+	auto frame = make_frame(1);
+	REQUIRE(pipe->push_frame(frame));
+	auto popped = pipe->pop_frame();
+	REQUIRE(popped);
+	REQUIRE(pipe->get_bytes_copied() == 0);
+	// The frame is still held by this test, so get_frame_unique has to copy it
+	auto unique = get_frame_unique(std::dynamic_pointer_cast<RawVideoFrame>(popped));
+	REQUIRE(pipe->get_bytes_copied() == 0);
+	PLANE_DATA(unique, 2)[0] = 5;
+	REQUIRE(pipe->get_bytes_copied() == PLANE_SIZE(frame, 2));
+	REQUIRE(PLANE_DATA(frame, 2)[0] == 1);
+}
+
+TEST_CASE("planes wrapping external buffers", "[frame]")
+{
+	auto released = std::make_shared<int>(0);
+	std::vector<uint8_t> buffer(64, 7);
+	{
+		auto frame = std::make_shared<RawVideoFrame>(raw_format::y8, resolution_t{8, 8}, 0);
+		frame->emplace_back(buffer.data(), buffer.size(), resolution_t{8, 8}, 8, [released](void*)noexcept{ ++*released; });
+		REQUIRE(PLANE_RAW_DATA(frame, 0) == buffer.data());
+		auto copy = std::dynamic_pointer_cast<RawVideoFrame>(frame->get_copy());
+		PLANE_DATA(copy, 0)[0] = 1;
+		REQUIRE(buffer[0] == 7);
+		REQUIRE(*released == 0);
+		frame.reset();
+		REQUIRE(*released == 1);
+	}
+	REQUIRE(*released == 1);
+}
+
+TEST_CASE("read-only planes copy data even when not shared", "[frame]")
+{
+	std::vector<uint8_t> buffer(64, 7);
+	auto frame = std::make_shared<RawVideoFrame>(raw_format::y8, resolution_t{8, 8}, 0);
+	frame->emplace_back(buffer.data(), buffer.size(), resolution_t{8, 8}, 8, [](void*)noexcept{});
+	(*frame)[0].set_read_only();
+	REQUIRE(PLANE_CONST_RAW_DATA(frame, 0) == buffer.data());
+	auto copy = std::dynamic_pointer_cast<RawVideoFrame>(frame->get_copy());
+	frame.reset();
+	// The copy shares the read-only data, although the original doesn't exist anymore
+	PLANE_DATA(copy, 0)[0] = 1;
+	REQUIRE(buffer[0] == 7);
+	REQUIRE(PLANE_CONST_RAW_DATA(copy, 0) != buffer.data());
+	REQUIRE(PLANE_CONST_DATA(copy, 0)[1] == 7);
+}
+
+TEST_CASE("read-only data stay valid for readers while the plane detaches", "[frame]")
+{
+	auto released = std::make_shared<std::atomic<int>>(0);
+	std::vector<uint8_t> buffer(64, 7);
+	auto frame = std::make_shared<RawVideoFrame>(raw_format::y8, resolution_t{8, 8}, 0);
+	frame->emplace_back(buffer.data(), buffer.size(), resolution_t{8, 8}, 8, [released](void*)noexcept{ ++*released; });
+	(*frame)[0].set_read_only();
+	std::atomic<int> stage{0};
+	bool valid = false;
+	std::thread reader([&]{
+		const uint8_t* data = PLANE_CONST_RAW_DATA(frame, 0);
+		stage = 1;
+		while (stage != 2) std::this_thread::yield();
+		// The plane detached meanwhile, but the data read here weren't released
+		valid = *released == 0 && data == buffer.data() && data[63] == 7;
+	});
+	while (stage != 1) std::this_thread::yield();
+	PLANE_DATA(frame, 0)[0] = 1;
+	REQUIRE(PLANE_CONST_RAW_DATA(frame, 0) != buffer.data());
+	stage = 2;
+	reader.join();
+	REQUIRE(valid);
+	REQUIRE(buffer[0] == 7);
+	frame.reset();
+	REQUIRE(*released == 1);
+}
+
+}
+}
@@ -0,0 +1,73 @@
+/*!
+ * @file 		test_memory_pool.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <thread>
+
+namespace yuri {
+namespace core {
+
+TEST_CASE("memory pool size classes", "[memory_pool]")
+{
+	REQUIRE(FixedMemoryAllocator::get_size_class(1) == 64);
+	REQUIRE(FixedMemoryAllocator::get_size_class(65) == 128);
+	REQUIRE(FixedMemoryAllocator::get_size_class(4096) == 4096);
+	REQUIRE(FixedMemoryAllocator::get_size_class(4097) == 8192);
+	REQUIRE(FixedMemoryAllocator::get_size_class(2*1024*1024 + 1) == 4*1024*1024);
+}
+
+TEST_CASE("memory pool reuses blocks", "[memory_pool]")
+{
+	const size_t size = 1920*1080*2;
+	const auto before = FixedMemoryAllocator::get_statistics();
+	uint8_t* first = nullptr;
+	{
+		auto block = FixedMemoryAllocator::get_block(size);
+		first = block.first;
+		REQUIRE(reinterpret_cast<uintptr_t>(first) % 64 == 0);
+		block.second(block.first);
+	}
+	auto block = FixedMemoryAllocator::get_block(size);
+	REQUIRE(block.first == first);
+	const auto after = FixedMemoryAllocator::get_statistics();
+	REQUIRE(after.local_hits > before.local_hits);
+	REQUIRE(after.blocks_in_use == before.blocks_in_use + 1);
+	REQUIRE(after.hit_rate() > 0.0);
+	block.second(block.first);
+	REQUIRE(FixedMemoryAllocator::get_statistics().blocks_in_use == before.blocks_in_use);
+}
+
+TEST_CASE("memory pool returns blocks to owning thread", "[memory_pool]")
+{
+	const size_t size = 640*480*3;
+	auto block = FixedMemoryAllocator::get_block(size);
+	auto mem = block.first;
+	const auto before = FixedMemoryAllocator::get_statistics();
+	std::thread([&block]{ block.second(block.first); }).join();
+	auto again = FixedMemoryAllocator::get_block(size);
+	REQUIRE(again.first == mem);
+	REQUIRE(FixedMemoryAllocator::get_statistics().remote_returns == before.remote_returns + 1);
+	again.second(again.first);
+}
+
+TEST_CASE("memory pool preallocation", "[memory_pool]")
+{
+	const size_t size = 12345;
+	FixedMemoryAllocator::remove_blocks(size);
+	REQUIRE(FixedMemoryAllocator::allocate_blocks(size, 3));
+	REQUIRE(FixedMemoryAllocator::preallocated_blocks(size) == 3);
+	REQUIRE(FixedMemoryAllocator::remove_blocks(size, 2));
+	REQUIRE(FixedMemoryAllocator::preallocated_blocks(size) == 1);
+	FixedMemoryAllocator::remove_blocks(size);
+	REQUIRE(FixedMemoryAllocator::preallocated_blocks(size) == 0);
+}
+
+}
+}
@@ -0,0 +1,73 @@
+/*!
+ * @file 		test_metrics.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/utils/metrics.h"
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <sstream>
+
+namespace yuri {
+namespace core {
+
+TEST_CASE("metrics histogram", "[metrics]")
+{
+	metrics::Histogram hist;
+	REQUIRE(hist.get_snapshot().count == 0);
+	REQUIRE(hist.get_snapshot().quantile(0.5) == 0);
+	for (int i = 0; i < 98; ++i) hist.record(15_us);
+	hist.record(10_ms);
+	hist.record(10_s);
+	const auto s = hist.get_snapshot();
+	REQUIRE(s.count == 100);
+	REQUIRE(s.sum == 98 * 15 + 10000 + 10000000);
+	REQUIRE(s.buckets[1] == 98);
+	REQUIRE(s.buckets[9] == 1);
+	REQUIRE(s.buckets[metrics::Histogram::bucket_count - 1] == 1);
+	REQUIRE(s.quantile(0.5) == 20);
+	REQUIRE(s.quantile(0.985) == 10000);
+}
+
+TEST_CASE("metrics registry", "[metrics]")
+{
+	std::ostringstream log_sink;
+	log::Log l(log_sink);
+	auto pipe = PipeGenerator::get_instance().generate("unlimited", "metrics_test_pipe", l, PipeGenerator::get_instance().configure("unlimited"));
+	auto node = metrics::register_node("metrics_test_node", "test");
+	node->steps = 3;
+	node->step_time.record(100_us);
+
+	auto frame = RawVideoFrame::create_empty(raw_format::y8, {16, 16});
+	REQUIRE(pipe->push_frame(frame));
+	REQUIRE(pipe->push_frame(frame));
+	REQUIRE(pipe->pop_frame());
+
+	const auto json = metrics::get_json();
+	REQUIRE(metrics::enabled());
+	REQUIRE(json.find("\"name\":\"metrics_test_node\",\"type\":\"test\",\"steps\":3") != std::string::npos);
+	REQUIRE(json.find("\"name\":\"metrics_test_pipe\",\"frames\":1,\"dropped\":0,\"bytes\":256,\"bytes_copied\":0,\"depth\":1") != std::string::npos);
+	REQUIRE(json.find("\"allocator\":{") != std::string::npos);
+
+	const auto prom = metrics::get_prometheus();
+	REQUIRE(prom.find("yuri_node_steps_total{node=\"metrics_test_node\",type=\"test\"} 3\n") != std::string::npos);
+	REQUIRE(prom.find("yuri_node_step_seconds_bucket{node=\"metrics_test_node\",type=\"test\",le=\"0.0001\"} 1\n") != std::string::npos);
+	REQUIRE(prom.find("yuri_node_step_seconds_count{node=\"metrics_test_node\",type=\"test\"} 1\n") != std::string::npos);
+	REQUIRE(prom.find("yuri_pipe_frames_total{pipe=\"metrics_test_pipe\"} 1\n") != std::string::npos);
+	REQUIRE(prom.find("yuri_pipe_depth{pipe=\"metrics_test_pipe\"} 1\n") != std::string::npos);
+
+	// Released metrics disappear from the output
+	pipe.reset();
+	node.reset();
+	REQUIRE(metrics::get_json().find("metrics_test") == std::string::npos);
+	REQUIRE(metrics::get_prometheus().find("metrics_test") == std::string::npos);
+}
+
+}
+}
@@ -0,0 +1,166 @@
+/*!
+ * @file 		test_pipes.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/pipe/PipeNotification.h"
+#include <thread>
+#include <sstream>
+
+namespace yuri {
+namespace core {
+
+namespace {
+std::ostringstream log_sink;
+log::Log l(log_sink);
+
+pPipe make_pipe(const std::string& type, size_t count)
+{
+	auto params = PipeGenerator::get_instance().configure(type);
+	params["count"] = count;
+	return PipeGenerator::get_instance().generate(type, "test", l, params);
+}
+
+pFrame make_frame(index_t index)
+{
+	auto frame = RawVideoFrame::create_empty(raw_format::y8, {2, 2});
+	frame->set_index(index);
+	return frame;
+}
+
+}
+
+TEST_CASE( "spsc ring pipe", "[pipe]" ) {
+	SECTION("blocking") {
+		auto p = make_pipe("spsc_ring_blocking", 3);
+		REQUIRE(p);
+		REQUIRE(p->is_blocking());
+		REQUIRE(p->is_empty());
+		REQUIRE(!p->pop_frame());
+		for (auto i: {1, 2, 3}) {
+			REQUIRE(p->push_frame(make_frame(i)));
+		}
+		REQUIRE(p->is_full());
+		REQUIRE(!p->push_frame(make_frame(4)));
+		REQUIRE(p->pop_frame()->get_index() == 1);
+		REQUIRE(p->push_frame(make_frame(4)));
+		for (auto i: {2, 3, 4}) {
+			REQUIRE(p->pop_frame()->get_index() == static_cast<index_t>(i));
+		}
+		REQUIRE(p->is_empty());
+	}
+	SECTION("non-blocking drops oldest frames") {
+		auto p = make_pipe("spsc_ring", 2);
+		REQUIRE(p);
+		REQUIRE(!p->is_blocking());
+		for (auto i: {1, 2, 3, 4, 5}) {
+			REQUIRE(p->push_frame(make_frame(i)));
+		}
+		REQUIRE(p->get_size() == 2);
+		REQUIRE(p->pop_frame()->get_index() == 4);
+		REQUIRE(p->pop_frame()->get_index() == 5);
+		REQUIRE(!p->pop_frame());
+	}
+	SECTION("single frame") {
+		auto p = make_pipe("spsc_ring_blocking", 1);
+		REQUIRE(p->push_frame(make_frame(1)));
+		REQUIRE(p->is_full());
+		REQUIRE(!p->push_frame(make_frame(2)));
+		REQUIRE(p->pop_frame()->get_index() == 1);
+		REQUIRE(p->push_frame(make_frame(3)));
+		REQUIRE(p->pop_frame()->get_index() == 3);
+		auto q = make_pipe("spsc_ring", 1);
+		for (auto i: {1, 2, 3}) {
+			REQUIRE(q->push_frame(make_frame(i)));
+		}
+		REQUIRE(q->get_size() == 1);
+		REQUIRE(q->pop_frame()->get_index() == 3);
+		REQUIRE(!q->pop_frame());
+	}
+	SECTION("closed pipe") {
+		auto p = make_pipe("spsc_ring_blocking", 2);
+		REQUIRE(p->push_frame(make_frame(1)));
+		p->close_pipe();
+		REQUIRE(!p->push_frame(make_frame(2)));
+		REQUIRE(!p->is_finished());
+		REQUIRE(p->pop_frame());
+		REQUIRE(p->is_finished());
+	}
+	SECTION("frames keep order between threads") {
+		const index_t frames = 20000;
+		auto p = make_pipe("spsc_ring_blocking", 4);
+		auto frame = make_frame(0);
+		std::thread producer([&]{
+			for (index_t i = 1; i <= frames; ++i) {
+				auto f = frame->get_copy();
+				f->set_index(i);
+				while (!p->push_frame(f)) {
+					std::this_thread::yield();
+				}
+			}
+		});
+		index_t last = 0;
+		bool ordered = true;
+		while (last < frames) {
+			if (auto f = p->pop_frame()) {
+				ordered = ordered && (f->get_index() == last + 1);
+				last = f->get_index();
+			} else {
+				std::this_thread::yield();
+			}
+		}
+		producer.join();
+		REQUIRE(ordered);
+		REQUIRE(p->is_empty());
+	}
+	SECTION("non-blocking pipe between threads") {
+		const index_t frames = 50000;
+		auto p = make_pipe("spsc_ring", 4);
+		auto notifiable = std::make_shared<PipeNotifiable>();
+		p->set_notifiable(notifiable);
+		auto frame = make_frame(0);
+		bool all_pushed = true;
+		std::thread producer([&]{
+			for (index_t i = 1; i <= frames; ++i) {
+				auto f = frame->get_copy();
+				f->set_index(i);
+				all_pushed = p->push_frame(f) && all_pushed;
+				// Lets the consumer empty the pipe now and then
+				if (i % 1000 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		});
+		index_t last = 0;
+		index_t received = 0;
+		bool ordered = true;
+		bool lost_wakeup = false;
+		while (last < frames) {
+			if (auto f = p->pop_frame()) {
+				ordered = ordered && (f->get_index() > last);
+				last = f->get_index();
+				++received;
+			} else {
+				const timestamp_t start;
+				notifiable->wait_for(2_s);
+				lost_wakeup = lost_wakeup || (timestamp_t{} - start > 1_s);
+			}
+		}
+		producer.join();
+		REQUIRE(all_pushed);
+		REQUIRE(ordered);
+		REQUIRE(!lost_wakeup);
+		// The newest frames are never dropped, so the pipe can't be drained by the producer
+		REQUIRE(received >= frames / 1000);
+		REQUIRE(p->is_empty());
+	}
+}
+
+}
+}
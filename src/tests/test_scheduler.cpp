@@ -0,0 +1,153 @@
+/*!
+ * @file 		test_scheduler.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/thread/IOThread.h"
+#include "yuri/core/thread/Scheduler.h"
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include "yuri/core/utils/Timer.h"
+#include <sstream>
+
+namespace yuri {
+namespace core {
+
+namespace {
+std::ostringstream log_sink;
+log::Log l(log_sink);
+
+class CountingSink: public IOThread {
+public:
+	CountingSink(size_t expected):IOThread(l, pwThreadBase{}, 1, 0, "sink"),
+		expected_(expected),received_(0),thread_id_() {
+		set_param(Parameter("scheduler", std::string("pool")));
+	}
+	size_t get_received() const { return received_; }
+	std::thread::id get_thread_id() const { return thread_id_; }
+private:
+	bool step() override {
+		thread_id_ = std::this_thread::get_id();
+		while (pop_frame(0)) {
+			++received_;
+		}
+		return received_ < expected_;
+	}
+	size_t expected_;
+	std::atomic<size_t> received_;
+	std::thread::id thread_id_;
+};
+
+// Pushes all frames in a single step, so it has to wait for the consumers
+class BurstSource: public IOThread {
+public:
+	BurstSource(size_t frames):IOThread(l, pwThreadBase{}, 0, 1, "source"),frames_(frames) {
+		set_param(Parameter("scheduler", std::string("pool")));
+		set_latency(1_ms);
+	}
+private:
+	bool step() override {
+		auto frame = RawVideoFrame::create_empty(raw_format::y8, {2, 2});
+		for (size_t i = 0; i < frames_; ++i) {
+			if (!push_frame(0, frame->get_copy())) return false;
+		}
+		return false;
+	}
+	size_t frames_;
+};
+
+class Relay: public IOThread {
+public:
+	Relay():IOThread(l, pwThreadBase{}, 1, 1, "relay") {
+		set_param(Parameter("scheduler", std::string("pool")));
+	}
+private:
+	bool step() override {
+		while (auto frame = pop_frame(0)) {
+			if (!push_frame(0, frame)) return false;
+		}
+		return true;
+	}
+};
+
+pPipe make_pipe()
+{
+	auto& generator = PipeGenerator::get_instance();
+	auto params = generator.configure("spsc_ring_blocking");
+	params["count"] = 1;
+	return generator.generate("spsc_ring_blocking", "test", l, params);
+}
+
+}
+
+TEST_CASE( "scheduler", "[scheduler]" ) {
+	const size_t frames = 100;
+	auto pipe = PipeGenerator::get_instance().generate("spsc_ring_blocking", "test", l, PipeGenerator::get_instance().configure("spsc_ring_blocking"));
+	auto sink = std::make_shared<CountingSink>(frames);
+	sink->connect_in(0, pipe);
+	REQUIRE(!sink->is_scheduled());
+
+	// The node should detach from calling thread and continue in scheduler
+	(*sink)();
+	REQUIRE(sink->running());
+	REQUIRE(sink->is_scheduled());
+
+	auto frame = RawVideoFrame::create_empty(raw_format::y8, {2, 2});
+	for (size_t i = 0; i < frames; ++i) {
+		while (!pipe->push_frame(frame)) {
+			ThreadBase::sleep(1_ms);
+		}
+	}
+	Timer timer;
+	while (sink->running() && timer.get_duration() < 5_s) {
+		ThreadBase::sleep(1_ms);
+	}
+	REQUIRE(!sink->running());
+	REQUIRE(sink->get_received() == frames);
+	REQUIRE(sink->get_thread_id() != std::this_thread::get_id());
+	REQUIRE(Scheduler::get_instance().get_thread_count() > 0);
+}
+
+TEST_CASE( "scheduler chain with full pipes", "[scheduler]" ) {
+	// Every node in the chain waits for a full pipe most of the time,
+	// so they can make progress only when the waiting node runs its consumer.
+	const size_t frames = 500;
+	const size_t relays = 2 * Scheduler::get_instance().get_thread_count() + 2;
+	auto source = std::make_shared<BurstSource>(frames);
+	auto sink = std::make_shared<CountingSink>(frames);
+	std::vector<std::shared_ptr<Relay>> chain;
+	auto pipe = make_pipe();
+	source->connect_out(0, pipe);
+	for (size_t i = 0; i < relays; ++i) {
+		chain.push_back(std::make_shared<Relay>());
+		chain.back()->connect_in(0, pipe);
+		pipe = make_pipe();
+		chain.back()->connect_out(0, pipe);
+	}
+	sink->connect_in(0, pipe);
+	(*sink)();
+	for (auto& relay: chain) (*relay)();
+	(*source)();
+
+	Timer timer;
+	while (sink->running() && timer.get_duration() < 10_s) {
+		ThreadBase::sleep(1_ms);
+	}
+	REQUIRE(sink->get_received() == frames);
+	for (auto& relay: chain) {
+		relay->request_end();
+		while (relay->running() && timer.get_duration() < 20_s) {
+			ThreadBase::sleep(1_ms);
+		}
+		REQUIRE(!relay->running());
+	}
+}
+
+}
+}
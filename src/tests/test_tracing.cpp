@@ -0,0 +1,93 @@
+/*!
+ * @file 		test_tracing.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/utils/tracing.h"
+#include "yuri/core/pipe/PipeGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_types.h"
+#include <sstream>
+#include <thread>
+
+namespace yuri {
+namespace core {
+
+namespace {
+size_t count_occurrences(const std::string& str, const std::string& what)
+{
+	size_t count = 0;
+	for (auto pos = str.find(what); pos != std::string::npos; pos = str.find(what, pos + 1)) ++count;
+	return count;
+}
+}
+
+TEST_CASE("tracing", "[tracing]")
+{
+	REQUIRE(tracing::intern("trace_test") == tracing::intern(std::string("trace_") + "test"));
+
+	std::ostringstream log_sink;
+	log::Log l(log_sink);
+	auto pipe = PipeGenerator::get_instance().generate("unlimited", "trace_test_pipe", l, PipeGenerator::get_instance().configure("unlimited"));
+	auto frame = RawVideoFrame::create_empty(raw_format::y8, {16, 16});
+	frame->set_index(42);
+
+	SECTION("inactive tracing records nothing") {
+		tracing::stop();
+		{
+			tracing::Span span("trace_test_span", "test");
+			REQUIRE(!span.is_active());
+		}
+		REQUIRE(pipe->push_frame(frame));
+		REQUIRE(pipe->pop_frame());
+		std::ostringstream os;
+		tracing::write_trace(os);
+		REQUIRE(os.str().find("trace_test") == std::string::npos);
+	}
+	SECTION("frame passing through a pipe") {
+		tracing::start();
+		{
+			tracing::Span span(tracing::intern("trace_test_step"), "step");
+			REQUIRE(span.is_active());
+			REQUIRE(pipe->push_frame(frame));
+		}
+		{
+			tracing::Span span(tracing::intern("trace_test_step2"), "step");
+			REQUIRE(pipe->pop_frame());
+			// Empty pop is not recorded
+			REQUIRE(!pipe->pop_frame());
+		}
+		tracing::stop();
+		std::ostringstream os;
+		tracing::write_trace(os);
+		const auto trace = os.str();
+		REQUIRE(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0);
+		REQUIRE(trace.find("\"name\":\"trace_test_step\",\"cat\":\"step\",\"ph\":\"X\"") != std::string::npos);
+		REQUIRE(count_occurrences(trace, "\"name\":\"trace_test_pipe\",\"cat\":\"push\",\"ph\":\"X\"") == 1);
+		REQUIRE(count_occurrences(trace, "\"name\":\"trace_test_pipe\",\"cat\":\"pop\",\"ph\":\"X\"") == 1);
+		REQUIRE(count_occurrences(trace, "\"args\":{\"frame\":42}") == 2);
+		REQUIRE(count_occurrences(trace, "\"name\":\"trace_test_pipe\",\"cat\":\"flow\",\"ph\":\"s\"") == 1);
+		REQUIRE(count_occurrences(trace, "\"name\":\"trace_test_pipe\",\"cat\":\"flow\",\"ph\":\"f\"") == 1);
+		REQUIRE(trace.substr(trace.size() - 3) == "]}\n");
+	}
+	SECTION("thread named before tracing started") {
+		tracing::stop();
+		std::thread([]{
+			tracing::set_thread_name("trace_test_thread");
+			tracing::start();
+			tracing::Span span("trace_test_span", "test");
+		}).join();
+		tracing::stop();
+		std::ostringstream os;
+		tracing::write_trace(os);
+		REQUIRE(os.str().find("\"args\":{\"name\":\"trace_test_thread\"}") != std::string::npos);
+	}
+}
+
+}
+}
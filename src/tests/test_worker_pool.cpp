@@ -0,0 +1,55 @@
+/*!
+ * @file 		test_worker_pool.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "catch.hpp"
+#include "yuri/core/thread/WorkerPool.h"
+#include <stdexcept>
+
+namespace yuri {
+namespace core {
+
+TEST_CASE("worker pool covers whole range", "[worker_pool]")
+{
+	WorkerPool pool(3);
+	for (size_t count: {1, 7, 100, 1081}) {
+		std::vector<std::atomic<int>> hits(count);
+		for (auto& h: hits) h = 0;
+		// Catch assertions are not thread safe, so check the results afterwards
+		pool.parallel_for(count, 16, 4, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) ++hits[i];
+		});
+		for (auto& h: hits) REQUIRE(h == 1);
+	}
+}
+
+TEST_CASE("worker pool rethrows exceptions", "[worker_pool]")
+{
+	WorkerPool pool(2);
+	REQUIRE_THROWS_AS(pool.parallel_for(64, 1, 3, [](size_t begin, size_t) {
+		if (begin == 33) throw std::runtime_error("failed");
+	}), std::runtime_error);
+	// The pool stays usable afterwards
+	std::atomic<size_t> sum {0};
+	pool.parallel_for(64, 1, 3, [&](size_t begin, size_t end) { sum += end - begin; });
+	REQUIRE(sum == 64);
+}
+
+TEST_CASE("parallel lines process remainder", "[worker_pool]")
+{
+	std::vector<int> lines(1081, 0);
+	parallel_for_lines(lines.size(), 1920 * 4, 4, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) ++lines[i];
+	});
+	for (auto l: lines) REQUIRE(l == 1);
+	REQUIRE(get_auto_threads(5, 1) == 5);
+	REQUIRE(get_auto_threads(0, 1) == 1);
+}
+
+}
+}
@@ -82,7 +82,7 @@ template<class Deleter>
 CompressedVideoFrame::CompressedVideoFrame(format_t format, resolution_t resolution, const uint8_t* data, size_t size, Deleter deleter)
 :VideoFrame(format, resolution)
 {
-	data_.set(data, size, deleter);
+	data_.set(const_cast<uint8_t*>(data), size, deleter);
 }
 
 }
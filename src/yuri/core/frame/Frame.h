@@ -35,6 +35,8 @@ is_frame_unique(const std::shared_ptr<T>& frame) {
  *
  * If this frame is shared between more threads, the method returns a copy.
  * Otherwise returns the original frame.
+ * The data may still be shared with other copies of the frame,
+ * raw video frames copy their planes on first modification.
  * @return A version of this frame that is unique and can be directly modified.
  */
 template<class T>
@@ -42,6 +44,7 @@ typename std::enable_if<std::is_base_of<core::Frame, T>::value, std::shared_ptr<
 get_frame_unique(const std::shared_ptr<T>& frame)
 {
 	if (frame && !is_frame_unique(frame)) return std::dynamic_pointer_cast<T>(frame->get_copy());
+	if (frame) frame->make_writable();
 	return frame;
 }
 
@@ -69,10 +72,19 @@ public:
 	EXPORT void 	operator=(Frame&&) 		= delete;
 
 	/*!
-	 * @brief Returns a deep copy of the frame
+	 * @brief Returns a copy of the frame
+	 *
+	 * Raw video frames share plane data with the copy, the planes of the copy
+	 * are copied on first modification.
 	 * @return pointer to the newly created copy
 	 */
 	EXPORT pFrame	get_copy() const { return do_get_copy(); }
+	/*!
+	 * Prepares the frame to be modified, data shared with copies
+	 * of this frame will be copied on first modification.
+	 * It's called from get_frame_unique() for uniquely owned frames.
+	 */
+	EXPORT void		make_writable() { do_make_writable(); }
 
 	/*!
 	 * Returns size of data in frame in bytes
@@ -143,6 +155,10 @@ private:
 	 * @return Copy of current frame
 	 */
 	virtual pFrame	do_get_copy() const = 0;
+	/*!
+	 * Implementation of make_writable(), frames that don't share data don't have to implement it.
+	 */
+	virtual void	do_make_writable() {}
 	/*!
 	 * Implementation od get_size() method
 	 * @return Size of current frame
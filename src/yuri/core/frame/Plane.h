@@ -13,10 +13,30 @@
 
 #include "yuri/core/utils/new_types.h"
 #include "yuri/core/utils/uvector.h"
+#include "yuri/core/frame/copy_statistics.h"
+#include <atomic>
 
 namespace yuri {
 namespace core {
 
+/*!
+ * Single plane of an image.
+ *
+ * Planes created by get_shared_copy() share data with the original plane
+ * and both of them copy the data on first non-const access (copy-on-write).
+ * Planes can be marked to behave the same way by calling set_copy_on_write(),
+ * which is used for frames returned by get_frame_unique().
+ * Planes wrapping memory that mustn't be written at all (mapped files, shared memory)
+ * are marked by set_read_only() and copy the data even if no other plane shares them.
+ * Const access never copies the data, so code only reading the planes
+ * should access them through const reference.
+ *
+ * The data are accessed through an atomic pointer, so const access from other threads
+ * is safe while the plane detaches, as long as the replaced data stay alive: shared data
+ * are kept by the other planes sharing them, read-only data are kept by the plane itself
+ * until it's destroyed or gets new data by set_data(). The content itself is not synchronized,
+ * reading a plane while it's being written still returns partially written data.
+ */
 template<typename T>
 class GenericPlane {
 public:
@@ -32,64 +52,162 @@ public:
 							const_reference;
 
 	GenericPlane(size_t size, resolution_t resolution, dimension_t line_size)
-		:resolution_(resolution),line_size_(line_size),data_(size) {}
+		:GenericPlane(resolution, line_size, std::make_shared<vector_type>(size)) {}
 	GenericPlane(vector_type&& data, resolution_t resolution, dimension_t line_size)
-			:resolution_(resolution),line_size_(line_size),data_(std::move(data)) {}
-	GenericPlane(const GenericPlane& rhs):resolution_(rhs.resolution_),line_size_(rhs.line_size_),data_(rhs.data_)
-	{ }
-	GenericPlane(GenericPlane&& rhs) noexcept:resolution_(rhs.resolution_),line_size_(rhs.line_size_),data_(std::move(rhs.data_))
-	{}
+		:GenericPlane(resolution, line_size, std::make_shared<vector_type>(std::move(data))) {}
+	GenericPlane(const GenericPlane& rhs)
+		:GenericPlane(rhs.resolution_, rhs.line_size_, std::make_shared<vector_type>(rhs.get_vector())) {}
+	GenericPlane(GenericPlane&& rhs) noexcept:resolution_(rhs.resolution_),line_size_(rhs.line_size_),data_(std::move(rhs.data_)),
+			vector_(data_.get()),copy_on_write_(rhs.copy_on_write_.load()),read_only_(rhs.read_only_),
+			retired_(std::move(rhs.retired_))
+	{
+		rhs.reset_data(empty_data());
+		rhs.copy_on_write_ = true;
+		rhs.read_only_ = false;
+	}
 	template<class Deleter>
 	GenericPlane(const T* data, size_t size, resolution_t resolution, dimension_t line_size, Deleter deleter);
 	GenericPlane& operator=(const GenericPlane& rhs) {
 		resolution_ 	= rhs.resolution_;
 		line_size_ 		= rhs.line_size_;
-		data_.resize(rhs.data_.size());
-		std::copy(rhs.data_.begin(), rhs.data_.end(), data_.begin());
+		// Data shared with other planes can't be overwritten
+		if (data_.use_count() > 1 || read_only_) reset_data(std::make_shared<vector_type>());
+		copy_on_write_ = false;
+		read_only_ = false;
+		data_->resize(rhs.size());
+		std::copy(rhs.begin(), rhs.end(), data_->begin());
 		return *this;
 	}
 	GenericPlane& operator=(GenericPlane&& rhs) {
 		resolution_ 	= rhs.resolution_;
 		line_size_ 		= rhs.line_size_;
-		data_.swap(rhs.data_);
+		auto data = std::move(data_);
+		reset_data(std::move(rhs.data_));
+		rhs.reset_data(std::move(data));
+		const bool cow = copy_on_write_;
+		copy_on_write_ = rhs.copy_on_write_.load();
+		rhs.copy_on_write_ = cow;
+		std::swap(read_only_, rhs.read_only_);
+		retired_.swap(rhs.retired_);
 		return *this;
 	}
 	template<class Deleter>
 	void set_data(const T* data, size_t size, Deleter deleter);
 
-	iterator					begin() {return data_.begin();}
-	iterator					end() {return data_.end();}
-	const_iterator				begin() const {return data_.begin();}
-	const_iterator				end() const {return data_.end();}
-	const_iterator				cbegin() const {return data_.cbegin();}
-	const_iterator				cend() const {return data_.cend();}
+	/*!
+	 * Returns plane sharing data with this plane.
+	 * Both planes copy the data on their first non-const access, while they're still shared.
+	 */
+	GenericPlane				get_shared_copy() const {
+		lock_t _(copy_statistics::get_detach_mutex());
+		GenericPlane plane(resolution_, line_size_, data_);
+		plane.copy_on_write_ = true;
+		plane.read_only_ = read_only_;
+		copy_on_write_ = true;
+		return plane;
+	}
+	/*!
+	 * Marks the plane to copy its data on next non-const access, if the data are shared with other planes.
+	 */
+	void						set_copy_on_write() { copy_on_write_ = true; }
+	/*!
+	 * Marks the data as read-only. The plane copies them on next non-const access,
+	 * even if they're not shared with other planes.
+	 */
+	void						set_read_only() {
+		lock_t _(copy_statistics::get_detach_mutex());
+		read_only_ = true;
+		copy_on_write_ = true;
+	}
+	//! Returns true if the data are shared with other planes
+	bool						is_shared() const { return data_.use_count() > 1; }
+
+	iterator					begin() {detach(); return get_vector().begin();}
+	iterator					end() {detach(); return get_vector().end();}
+	const_iterator				begin() const {return get_vector().begin();}
+	const_iterator				end() const {return get_vector().end();}
+	const_iterator				cbegin() const {return get_vector().cbegin();}
+	const_iterator				cend() const {return get_vector().cend();}
 	iterator					data() { return begin(); }
 	const_iterator				data() const { return begin(); }
-	reference					operator[](index_t index) { return data_[index]; }
-	const_reference				operator[](index_t index) const { return data_[index]; }
-	size_t						size() const { return data_.size(); }
+	reference					operator[](index_t index) { detach(); return get_vector()[index]; }
+	const_reference				operator[](index_t index) const { return get_vector()[index]; }
+	size_t						size() const { return get_vector().size(); }
 
 	dimension_t					get_line_size() const { return line_size_; }
 	resolution_t				get_resolution() const { return resolution_; }
 	size_t						get_size() const { return size() * sizeof(value_type);}
 private:
+	GenericPlane(resolution_t resolution, dimension_t line_size, std::shared_ptr<vector_type> data)
+		:resolution_(resolution),line_size_(line_size),data_(std::move(data)),vector_(data_.get()),copy_on_write_(false),read_only_(false) {}
+	static const std::shared_ptr<vector_type>& empty_data() {
+		static const std::shared_ptr<vector_type> empty = std::make_shared<vector_type>();
+		return empty;
+	}
+	vector_type&				get_vector() { return *vector_.load(std::memory_order_acquire); }
+	const vector_type&			get_vector() const { return *vector_.load(std::memory_order_acquire); }
+	//! Replaces the data, only for the owner of the plane, when no other thread accesses it
+	void						reset_data(std::shared_ptr<vector_type> data) {
+		data_ = std::move(data);
+		vector_.store(data_.get(), std::memory_order_release);
+	}
+	/*!
+	 * Makes private copy of the data, if they're shared (or read-only) and the plane is marked as copy-on-write.
+	 * The check is cheap, the copy is done under a lock, as the plane may be accessed
+	 * from several worker threads at once. Other threads keep using the shared data until
+	 * the copy is published, so they never see the vector half-replaced.
+	 * Read-only data not shared with other planes are retired instead of released,
+	 * as other threads may still read them.
+	 */
+	void						detach() {
+		if (copy_on_write_.load(std::memory_order_acquire)) {
+			lock_t _(copy_statistics::get_detach_mutex());
+			if (!copy_on_write_.load(std::memory_order_relaxed)) return;
+			if (data_.use_count() > 1 || read_only_) {
+				auto data = std::make_shared<vector_type>(*data_);
+				data_.swap(data);
+				vector_.store(data_.get(), std::memory_order_release);
+				// Shared data are kept alive by the other planes
+				if (read_only_ && data.use_count() == 1) retired_ = std::move(data);
+				copy_statistics::add_copied_bytes(get_size());
+				read_only_ = false;
+			}
+			copy_on_write_.store(false, std::memory_order_release);
+		}
+	}
 	resolution_t				resolution_;
 	dimension_t					line_size_;
-	vector_type					data_;
+	//! Owns the data, modified only under the detach mutex or by the owner of the plane
+	std::shared_ptr<vector_type>
+								data_;
+	//! Data used by all accessors
+	std::atomic<vector_type*>	vector_;
+	mutable std::atomic<bool>	copy_on_write_;
+	//! Data can't be written even when not shared, modified only under the detach mutex or by the owner
+	bool						read_only_;
+	//! Read-only data replaced by detach(), kept for readers that may still use them
+	std::shared_ptr<vector_type>
+								retired_;
 };
 template<typename T>
 template<class Deleter>
 GenericPlane<T>::GenericPlane(const T* data, size_t size, resolution_t resolution, dimension_t line_size, Deleter deleter)
-:resolution_(resolution),line_size_(line_size)
+:GenericPlane(resolution, line_size, std::make_shared<vector_type>())
 {
-	data_.set(data, size, deleter);
+	data_->set(const_cast<T*>(data), size, deleter);
 }
 
 template<typename T>
 template<class Deleter>
 void GenericPlane<T>::set_data(const T* data, size_t size, Deleter deleter)
 {
-	data_.set(data, size, deleter);
+	// The old data may be shared, so new vector has to be created
+	auto vec = std::make_shared<vector_type>();
+	vec->set(const_cast<T*>(data), size, deleter);
+	reset_data(std::move(vec));
+	copy_on_write_ = false;
+	read_only_ = false;
+	retired_.reset();
 }
 
 typedef GenericPlane<uint8_t>	Plane;
@@ -79,17 +79,26 @@ void RawVideoFrame::push_back(const Plane& plane)
 }
 void RawVideoFrame::push_back(Plane&& plane)
 {
-	planes_.push_back(plane);
+	planes_.push_back(std::move(plane));
 }
 
 pFrame RawVideoFrame::do_get_copy() const {
 	pRawVideoFrame frame = std::make_shared<RawVideoFrame>(get_format(), get_resolution());
 	RawVideoFrame& rvframe = *frame;
 	copy_parameters(rvframe);
-	std::copy(begin(),end(),rvframe.begin());
+	for (index_t i = 0; i < planes_.size(); ++i) {
+		rvframe[i] = planes_[i].get_shared_copy();
+	}
 	return frame;
 }
 
+void RawVideoFrame::do_make_writable()
+{
+	for (auto& plane: planes_) {
+		plane.set_copy_on_write();
+	}
+}
+
 size_t RawVideoFrame::do_get_size() const noexcept
 {
 	return std::accumulate(planes_.begin(), planes_.end(), size_t{},
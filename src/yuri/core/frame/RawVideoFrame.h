@@ -21,6 +21,9 @@ typedef std::shared_ptr<RawVideoFrame> pRawVideoFrame;
 #define PLANE_DATA(pframe, idx) (*pframe)[idx]
 #define PLANE_RAW_DATA(pframe, idx) (*pframe)[idx].data()
 #define PLANE_SIZE(pframe, idx) (*pframe)[idx].size()
+//! Read-only access to a plane, never copies data shared with copies of the frame
+#define PLANE_CONST_DATA(pframe, idx) static_cast<const yuri::core::RawVideoFrame&>(*pframe)[idx]
+#define PLANE_CONST_RAW_DATA(pframe, idx) PLANE_CONST_DATA(pframe, idx).data()
 
 class RawVideoFrame: public VideoFrame
 {
@@ -79,6 +82,10 @@ private:
 	 * @return Copy of current frame
 	 */
 	virtual pFrame	do_get_copy() const;
+	/*!
+	 * Marks all planes to be copied on first modification, if they're shared with copies of this frame.
+	 */
+	virtual void	do_make_writable();
 	/*!
 	 * Implementation od get_size() method
 	 * @return Size of current frame
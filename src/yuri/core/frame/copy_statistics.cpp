@@ -0,0 +1,46 @@
+/*!
+ * @file 		copy_statistics.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "copy_statistics.h"
+
+namespace yuri {
+namespace core {
+namespace copy_statistics {
+
+namespace {
+std::atomic<uint64_t> total_copied {0};
+// Weak reference, so the thread doesn't keep counter of a destroyed pipe alive
+thread_local std::weak_ptr<std::atomic<uint64_t>> thread_counter;
+}
+
+void add_copied_bytes(size_t bytes)
+{
+	total_copied += bytes;
+	if (auto counter = thread_counter.lock()) *counter += bytes;
+}
+
+void set_thread_counter(const pCopyCounter& counter)
+{
+	thread_counter = counter;
+}
+
+uint64_t get_total_copied_bytes()
+{
+	return total_copied;
+}
+
+mutex& get_detach_mutex()
+{
+	static mutex detach_mutex;
+	return detach_mutex;
+}
+
+}
+}
+}
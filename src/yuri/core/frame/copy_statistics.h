@@ -0,0 +1,51 @@
+/*!
+ * @file 		copy_statistics.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef COPY_STATISTICS_H_
+#define COPY_STATISTICS_H_
+
+#include "yuri/core/utils/new_types.h"
+#include <atomic>
+#include <cstdint>
+
+namespace yuri {
+namespace core {
+
+using pCopyCounter = std::shared_ptr<std::atomic<uint64_t>>;
+
+namespace copy_statistics {
+
+/*!
+ * Records @em bytes of frame data copied by current thread.
+ * The bytes are added to the global counter and to the counter set for current thread.
+ */
+EXPORT void add_copied_bytes(size_t bytes);
+
+/*!
+ * Sets the counter accounting copies made by current thread.
+ * Pipes set their counter here whenever a frame is popped from them,
+ * so the copies made while processing the frame are accounted to the pipe.
+ */
+EXPORT void set_thread_counter(const pCopyCounter& counter);
+
+/*!
+ * Returns total number of bytes copied since the start of the application.
+ */
+EXPORT uint64_t get_total_copied_bytes();
+
+/*!
+ * Mutex guarding plane data that are being detached from a shared copy
+ */
+EXPORT mutex& get_detach_mutex();
+
+}
+}
+}
+
+#endif /* COPY_STATISTICS_H_ */
@@ -0,0 +1,177 @@
+/*!
+ * @file 		frame_container.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "frame_container.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/CompressedVideoFrame.h"
+#include "yuri/core/frame/RawAudioFrame.h"
+#include "yuri/core/frame/raw_frame_params.h"
+#include <algorithm>
+
+namespace yuri {
+namespace core {
+namespace container {
+
+namespace {
+const char file_magic[8] = {'Y','U','R','I','F','R','M','C'};
+const char trailer_magic[8] = {'Y','U','R','I','I','N','D','X'};
+// "YFRM" in the file
+const uint32_t frame_magic = 0x4d524659;
+}
+
+file_header_t make_file_header(uint32_t alignment)
+{
+	file_header_t header{};
+	std::copy(std::begin(file_magic), std::end(file_magic), header.magic);
+	header.version = current_version;
+	header.header_size = sizeof(file_header_t);
+	header.alignment = alignment;
+	return header;
+}
+
+bool is_valid(const file_header_t& header)
+{
+	return std::equal(std::begin(file_magic), std::end(file_magic), header.magic) &&
+			header.version == current_version &&
+			header.header_size >= sizeof(file_header_t) &&
+			header.alignment >= 8 && !(header.alignment & (header.alignment - 1));
+}
+
+bool is_valid(const frame_header_t& header)
+{
+	return header.magic == frame_magic;
+}
+
+trailer_t make_trailer(uint64_t index_offset, uint64_t frame_count)
+{
+	trailer_t trailer{};
+	trailer.index_offset = index_offset;
+	trailer.frame_count = frame_count;
+	std::copy(std::begin(trailer_magic), std::end(trailer_magic), trailer.magic);
+	return trailer;
+}
+
+bool is_valid(const trailer_t& trailer)
+{
+	return std::equal(std::begin(trailer_magic), std::end(trailer_magic), trailer.magic);
+}
+
+bool make_frame_header(const pFrame& frame, frame_header_t& header)
+{
+	header = frame_header_t{};
+	header.magic = frame_magic;
+	if (!frame) return false;
+	header.format = frame->get_format();
+	header.duration = frame->get_duration().value;
+	if (auto f = std::dynamic_pointer_cast<RawVideoFrame>(frame)) {
+		header.type = frame_type_t::raw_video;
+		header.width = f->get_width();
+		header.height = f->get_height();
+		header.interlace = static_cast<uint32_t>(f->get_interlacing());
+		header.field_order = static_cast<uint32_t>(f->get_field_order());
+	} else if (auto f2 = std::dynamic_pointer_cast<CompressedVideoFrame>(frame)) {
+		header.type = frame_type_t::compressed_video;
+		header.width = f2->get_width();
+		header.height = f2->get_height();
+		header.interlace = static_cast<uint32_t>(f2->get_interlacing());
+		header.field_order = static_cast<uint32_t>(f2->get_field_order());
+	} else if (auto f3 = std::dynamic_pointer_cast<RawAudioFrame>(frame)) {
+		header.type = frame_type_t::raw_audio;
+		header.channels = f3->get_channel_count();
+		header.sampling_frequency = f3->get_sampling_frequency();
+	} else {
+		return false;
+	}
+	const auto payload = get_frame_payload(frame);
+	if (payload.empty()) return false;
+	for (const auto& p: payload) {
+		header.payload_size += p.second;
+	}
+	return true;
+}
+
+std::vector<std::pair<const uint8_t*, size_t>> get_frame_payload(const pFrame& frame)
+{
+	std::vector<std::pair<const uint8_t*, size_t>> payload;
+	if (auto f = std::dynamic_pointer_cast<RawVideoFrame>(frame)) {
+		try {
+			const auto& info = raw_format::get_format_info(f->get_format());
+			for (size_t i = 0; i < info.planes.size(); ++i) {
+				// Planes are stored with the sizes create_frame() expects, regardless of their actual sizes
+				const auto size = std::get<1>(RawVideoFrame::get_plane_params(info, i, f->get_resolution()));
+				if (i >= f->get_planes_count() || PLANE_CONST_DATA(f, i).size() < size) return {};
+				payload.emplace_back(PLANE_CONST_RAW_DATA(f, i), size);
+			}
+		}
+		catch (std::runtime_error&) {
+			// Unknown format
+			return {};
+		}
+	} else if (auto f2 = std::dynamic_pointer_cast<CompressedVideoFrame>(frame)) {
+		payload.emplace_back(f2->begin(), f2->size());
+	} else if (auto f3 = std::dynamic_pointer_cast<RawAudioFrame>(frame)) {
+		payload.emplace_back(f3->data(), f3->size());
+	}
+	return payload;
+}
+
+pFrame create_frame(const frame_header_t& header, const uint8_t* payload, std::shared_ptr<const void> owner)
+{
+	if (!is_valid(header)) return {};
+	pFrame frame;
+	try {
+		switch (header.type) {
+			case frame_type_t::raw_video: {
+				const resolution_t resolution = {header.width, header.height};
+				const auto& info = raw_format::get_format_info(header.format);
+				auto f = std::make_shared<RawVideoFrame>(header.format, resolution, 0);
+				size_t offset = 0;
+				for (size_t i = 0; i < info.planes.size(); ++i) {
+					size_t line_size, plane_size;
+					resolution_t plane_res;
+					std::tie(line_size, plane_size, plane_res) = RawVideoFrame::get_plane_params(info, i, resolution);
+					if (offset + plane_size > header.payload_size) return {};
+					f->emplace_back(payload + offset, plane_size, plane_res, line_size, [owner](void*)noexcept{});
+					(*f)[i].set_read_only();
+					offset += plane_size;
+				}
+				f->set_interlacing(static_cast<interlace_t>(header.interlace));
+				f->set_field_order(static_cast<field_order_t>(header.field_order));
+				frame = f;
+			} break;
+			// Compressed and audio frames can't copy the data on write, so they get a copy right away
+			case frame_type_t::compressed_video: {
+				auto f = CompressedVideoFrame::create_empty(header.format, resolution_t{header.width, header.height},
+						payload, header.payload_size);
+				f->set_interlacing(static_cast<interlace_t>(header.interlace));
+				f->set_field_order(static_cast<field_order_t>(header.field_order));
+				frame = f;
+			} break;
+			case frame_type_t::raw_audio:
+				frame = RawAudioFrame::create_empty(header.format, header.channels, header.sampling_frequency,
+						payload, header.payload_size);
+				break;
+			default:
+				return {};
+		}
+	}
+	catch (std::runtime_error&) {
+		// Unknown format
+		return {};
+	}
+	if (frame) {
+		frame->set_duration(duration_t{header.duration});
+		frame->set_index(header.index);
+	}
+	return frame;
+}
+
+}
+}
+}
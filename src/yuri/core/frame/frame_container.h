@@ -0,0 +1,132 @@
+/*!
+ * @file 		frame_container.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Simple container for frames with an index.
+ *
+ * The file starts with file_header_t, followed by frames. Every frame starts
+ * at a multiple of file_header_t::alignment with frame_header_t, immediately
+ * followed by the payload (planes of raw video frames are stored one after another,
+ * each with the size given by RawVideoFrame::get_plane_params()). Frame header is 128 bytes,
+ * so the payload keeps the alignment of the frame.
+ * The file ends with the index (one index_entry_t per frame) and trailer_t,
+ * so a reader can find any frame without scanning the file.
+ * Files without a valid trailer (e.g. after a crash) can be indexed by walking the frame headers.
+ *
+ * All values are stored in native byte order.
+ */
+
+#ifndef FRAME_CONTAINER_H_
+#define FRAME_CONTAINER_H_
+
+#include "yuri/core/frame/Frame.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace yuri {
+namespace core {
+namespace container {
+
+enum class frame_type_t: uint32_t {
+	raw_video			= 1,
+	compressed_video	= 2,
+	raw_audio			= 3
+};
+
+struct file_header_t {
+	char		magic[8];
+	uint32_t	version;
+	uint32_t	header_size;
+	//! Alignment of frame headers in the file
+	uint32_t	alignment;
+	uint32_t	reserved[11];
+};
+
+struct frame_header_t {
+	uint32_t	magic;
+	frame_type_t type;
+	uint64_t	format;
+	uint32_t	width;
+	uint32_t	height;
+	uint32_t	channels;
+	uint32_t	sampling_frequency;
+	//! interlace_t of video frames
+	uint32_t	interlace;
+	//! field_order_t of video frames
+	uint32_t	field_order;
+	//! Timestamp relative to the first frame in the file, in microseconds
+	int64_t		timestamp;
+	//! Duration in microseconds
+	int64_t		duration;
+	uint64_t	payload_size;
+	//! Index of the frame in the file
+	uint64_t	index;
+	uint32_t	reserved[14];
+};
+
+struct index_entry_t {
+	//! Offset of frame_header_t in the file
+	uint64_t	offset;
+	int64_t		timestamp;
+	uint64_t	payload_size;
+};
+
+struct trailer_t {
+	uint64_t	index_offset;
+	uint64_t	frame_count;
+	uint64_t	reserved;
+	char		magic[8];
+};
+
+static_assert(sizeof(file_header_t) == 64, "Unexpected size of file_header_t");
+static_assert(sizeof(frame_header_t) == 128, "Unexpected size of frame_header_t");
+static_assert(sizeof(index_entry_t) == 24, "Unexpected size of index_entry_t");
+static_assert(sizeof(trailer_t) == 32, "Unexpected size of trailer_t");
+
+const uint32_t current_version = 2;
+const uint32_t default_alignment = 64;
+
+EXPORT file_header_t make_file_header(uint32_t alignment = default_alignment);
+EXPORT bool is_valid(const file_header_t& header);
+EXPORT bool is_valid(const frame_header_t& header);
+EXPORT trailer_t make_trailer(uint64_t index_offset, uint64_t frame_count);
+EXPORT bool is_valid(const trailer_t& trailer);
+
+//! Returns @em offset rounded up to @em alignment (which has to be a power of two)
+inline uint64_t align_offset(uint64_t offset, uint64_t alignment)
+{
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+/*!
+ * Describes a frame. Timestamp and index are left zero.
+ * @return false if the frame type can't be stored in the container,
+ * 			or planes of raw video frame are smaller than its format requires
+ */
+EXPORT bool make_frame_header(const pFrame& frame, frame_header_t& header);
+
+/*!
+ * Returns memory blocks forming payload of the frame, in order they should be stored.
+ * Empty, when the frame can't be stored.
+ */
+EXPORT std::vector<std::pair<const uint8_t*, size_t>> get_frame_payload(const pFrame& frame);
+
+/*!
+ * Creates a frame from the payload. Raw video frames use the payload in place,
+ * with planes marked read-only, so they copy it on first write. Other frames get a copy.
+ * @param header Header of the frame
+ * @param payload Payload of header.payload_size bytes
+ * @param owner Object keeping the payload valid, it's held by raw video frames
+ * @return the frame or an empty pointer, when the header is not valid
+ */
+EXPORT pFrame create_frame(const frame_header_t& header, const uint8_t* payload, std::shared_ptr<const void> owner);
+
+}
+}
+}
+
+#endif /* FRAME_CONTAINER_H_ */
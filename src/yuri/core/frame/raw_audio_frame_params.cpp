@@ -42,7 +42,7 @@ format_info_map_t raw_audio_formats_info = {
 		{unsigned_48bit_be, {unsigned_48bit_be, "Unsigned 48bit (big endian)", {"u48_be"}, 48, false}},
 		{signed_48bit_be, {signed_48bit_be, "Signed 148bit (big endian)", {"s48_be"}, 48, false}},
 		{float_32bit_be, {float_32bit_be, "Float 32 bit (big endian)", {"f32_be"}, 32, false}},
-		{float_64bit_be, {float_64bit, "Float 64 bit (big endian)", {"f64_be"}, 64, false}},
+		{float_64bit_be, {float_64bit_be, "Float 64 bit (big endian)", {"f64_be"}, 64, false}},
 
 
         {unsigned_8bit_planar, {unsigned_8bit_planar, "Unsigned 8bit planar", {"u8p"}, 8, true, true}},
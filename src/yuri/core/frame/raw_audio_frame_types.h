@@ -39,7 +39,7 @@ const format_t unsigned_32bit_be= 0x20016;
 const format_t signed_48bit_be 	= 0x20017;
 const format_t unsigned_48bit_be= 0x20018;
 const format_t float_32bit_be 	= 0x20019;
-const format_t float_64bit_be 	= 0x2000a;
+const format_t float_64bit_be 	= 0x2001a;
 
 const format_t unsigned_8bit_planar
 								= 0x20030;
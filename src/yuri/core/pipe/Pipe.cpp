@@ -9,13 +9,18 @@
  */
 
 #include "Pipe.h"
+#include "yuri/core/utils/tracing.h"
 
 namespace yuri {
 namespace core {
 
+namespace {
+std::atomic<uint64_t> pipe_counter {0};
+}
 
-Pipe::Pipe(const std::string& name, const log::Log& log_):log(log_),name_(name),
-		finished_(false),closed_(false),frames_passed_(0),frames_dropped_(0)
+Pipe::Pipe(const std::string& name, const log::Log& log_, bool lock_free):log(log_),lock_free_(lock_free),name_(name),
+		finished_(false),closed_(false),metrics_(metrics::register_pipe(name)),
+		bytes_copied_(metrics_, &metrics_->bytes_copied),trace_name_(tracing::intern(name)),trace_id_(++pipe_counter)
 {
 	log.set_label("[Pipe: "+name+"] ");
 }
@@ -23,29 +28,59 @@ Pipe::Pipe(const std::string& name, const log::Log& log_):log(log_),name_(name),
 Pipe::~Pipe() noexcept
 {
 	try {
-		log[log::info] << "Processed " << frames_passed_ << " frames, " << frames_dropped_ << " dropped.";
+		log[log::info] << "Processed " << metrics_->frames << " frames, " << metrics_->dropped << " dropped, "
+				<< get_bytes_copied() << " bytes copied by the consumer.";
 	}
 	// We have to prevent any exception getting out
 	catch (...) {}
 }
 
 pFrame Pipe::pop_frame()
+{
+	tracing::Span span(trace_name_, "pop");
+	pFrame f = lock_free_ ? pop_frame_lock_free() : pop_frame_locked();
+	if (!f) {
+		// Empty pops would only clutter the trace
+		span.discard();
+	} else if (span.is_active()) {
+		span.set_frame_index(f->get_index());
+		tracing::record_flow_end(trace_name_, get_flow_id(f));
+	}
+	return f;
+}
+
+bool Pipe::push_frame(const pFrame &frame)
+{
+	tracing::Span span(trace_name_, "push", frame ? frame->get_index() : 0);
+	// The flow has to start before the frame is visible to the consumer
+	if (span.is_active() && frame) tracing::record_flow_start(trace_name_, get_flow_id(frame));
+	return lock_free_ ? push_frame_lock_free(frame) : push_frame_locked(frame);
+}
+
+uint64_t Pipe::get_flow_id(const pFrame& frame) const noexcept
+{
+	// Frame can be only once in a pipe, so pipe id and frame address are unique
+	return (trace_id_ << 48) ^ reinterpret_cast<uintptr_t>(frame.get());
+}
+
+pFrame Pipe::pop_frame_locked()
 {
 	lock_t _(frame_lock_);
 	const bool was_full = do_is_full();
 	pFrame f = do_pop_frame();
-	if (f) frames_passed_++;
+	if (f) frame_popped(f);
 	if (was_full && is_blocking()) {
 		notify_source();
 	}
 	return f;
 }
 
-bool Pipe::push_frame(const pFrame &frame)
+bool Pipe::push_frame_locked(const pFrame &frame)
 {
 	lock_t _(frame_lock_);
 	const bool was_empty = is_empty();
 	if (!closed_ && do_push_frame(frame)) {
+		metrics_->depth.store(do_get_size(), std::memory_order_relaxed);
 		// It should be optimal to send notifications only
 		// for pipes that were originally empty.
 		// the condition should be removed if causing problems.
@@ -58,6 +93,47 @@ bool Pipe::push_frame(const pFrame &frame)
 
 }
 
+pFrame Pipe::pop_frame_lock_free()
+{
+	// The producer may be pushing concurrently, so the fullness has to be
+	// sampled before the pop, otherwise the notification could be lost.
+	const bool was_full = do_is_full();
+	pFrame f = do_pop_frame();
+	// Pairs with the fence in push_frame_lock_free(). Either the producer sees
+	// the tail moved by this pop, or the next pop sees the frame it pushed.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!f) return f;
+	frame_popped(f);
+	if (was_full && is_blocking()) {
+		notify_source();
+	}
+	return f;
+}
+
+bool Pipe::push_frame_lock_free(const pFrame &frame)
+{
+	if (closed_ || !do_push_frame(frame)) return false;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const size_t size = do_get_size();
+	metrics_->depth.store(size, std::memory_order_relaxed);
+	// The pipe was empty before the push (or the consumer has already taken
+	// the frame), so the consumer may have been waiting for it.
+	// If there are more frames, the consumer hasn't seen the pipe empty yet,
+	// thanks to the fences, and it will find the new frame after popping the older ones.
+	if (size <= 1) {
+		notify();
+	}
+	return true;
+}
+
+void Pipe::frame_popped(const pFrame& frame)
+{
+	metrics_->frames.fetch_add(1, std::memory_order_relaxed);
+	metrics_->bytes.fetch_add(frame->get_size(), std::memory_order_relaxed);
+	metrics_->depth.store(do_get_size(), std::memory_order_relaxed);
+	copy_statistics::set_thread_counter(bytes_copied_);
+}
+
 void Pipe::close_pipe()
 {
 	closed_ = true;
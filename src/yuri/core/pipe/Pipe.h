@@ -13,6 +13,8 @@
 
 #include <atomic>
 #include "yuri/core/frame/Frame.h"
+#include "yuri/core/frame/copy_statistics.h"
+#include "yuri/core/utils/metrics.h"
 #include "yuri/core/pipe/PipeNotification.h"
 #include "yuri/log/Log.h"
 namespace yuri {
@@ -59,12 +61,26 @@ public:
 	 */
 	bool						is_full() const noexcept { return do_is_full();};
 	void						set_notifiable(pwPipeNotifiable) noexcept;
+	//! Returns the object notified about new frames, usually the consumer of the pipe
+	pPipeNotifiable				get_notifiable() const noexcept { return notifiable_.lock(); }
 	void						set_notifiable_source(pwPipeNotifiable) noexcept;
 
 	bool						is_blocking() const noexcept { return do_is_blocking(); }
+	/*!
+	 * Returns number of bytes of frame data copied by the consumer of this pipe.
+	 * Copies are accounted to the pipe the consuming thread popped a frame from the last.
+	 * @return Number of copied bytes
+	 */
+	EXPORT uint64_t				get_bytes_copied() const noexcept { return *bytes_copied_; }
 protected:
-	EXPORT 						Pipe(const std::string& name, const log::Log& log_);
-	EXPORT void					drop_frame(const pFrame &frame) { if(frame) frames_dropped_++; }
+	/*!
+	 * @param name		Name of the pipe
+	 * @param log_		Logger to use
+	 * @param lock_free	Set to true for pipes that synchronize producer and consumer
+	 * 					by themselves. Push and pop won't take @em frame_lock_ then.
+	 */
+	EXPORT 						Pipe(const std::string& name, const log::Log& log_, bool lock_free = false);
+	EXPORT void					drop_frame(const pFrame &frame) { if(frame) metrics_->dropped.fetch_add(1, std::memory_order_relaxed); }
 	log::Log					log;
 private:
 	virtual bool 				do_push_frame(const pFrame &frame) = 0;
@@ -74,14 +90,25 @@ private:
 	void						notify();
 	void						notify_source();
 	virtual bool				do_is_blocking() const noexcept = 0;
+	bool						push_frame_locked(const pFrame &frame);
+	pFrame						pop_frame_locked();
+	bool						push_frame_lock_free(const pFrame &frame);
+	pFrame						pop_frame_lock_free();
+	//! Id of the flow event connecting push and pop of @em frame in the trace
+	uint64_t					get_flow_id(const pFrame& frame) const noexcept;
+	//! Updates statistics after a frame was popped
+	void						frame_popped(const pFrame& frame);
+	const bool					lock_free_;
 	mutex 						frame_lock_;
 	std::string 				name_;
 	mutable std::atomic<bool>	finished_;
 	std::atomic<bool>			closed_;
 	pwPipeNotifiable			notifiable_;
 	pwPipeNotifiable			notifiable_source_;
-	size_t						frames_passed_;
-	size_t						frames_dropped_;
+	metrics::pPipeMetrics		metrics_;
+	pCopyCounter				bytes_copied_;
+	const char*					trace_name_;
+	const uint64_t				trace_id_;
 };
 
 } /* namespace core */
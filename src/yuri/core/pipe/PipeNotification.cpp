@@ -20,6 +20,7 @@ void PipeNotifiable::notify()
 		pending_notification_=true;
 	}
 	variable_.notify_all();
+	notify_hook();
 }
 void PipeNotifiable::wait_for(duration_t dur)
 {
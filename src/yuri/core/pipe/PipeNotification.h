@@ -26,6 +26,12 @@ public:
 	EXPORT void 				notify();
 	EXPORT void					wait_for(duration_t dur);
 private:
+	/*!
+	 * Called after every notification. Classes that don't wait in wait_for()
+	 * can use it to react to notifications.
+	 */
+	EXPORT virtual void			notify_hook() {}
+
 	yuri::mutex					var_mutex_;
 	std::condition_variable		variable_;
 	bool						pending_notification_;
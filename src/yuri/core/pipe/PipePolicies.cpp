@@ -10,6 +10,7 @@
 
 #include "PipePolicies.h"
 #include <cassert>
+#include <thread>
 
 namespace yuri {
 namespace core {
@@ -110,6 +111,29 @@ bool UnreliableSingleFramePolicy<true>::impl_push_frame(const pFrame &frame)
     return true;
 }
 
+template<>
+bool RingBufferPolicy<false>::impl_push_frame(const pFrame &frame)
+{
+	while (!store_frame(frame)) {
+		if (impl_get_size() >= max_count_) {
+			// Ring is full, make space by throwing away the oldest frame.
+			// Only a single frame is dropped before trying to store again.
+			drop_frame(impl_pop_frame());
+		} else {
+			// The consumer has already taken the slot we're about to reuse,
+			// but it hasn't released it yet. Give it a chance to finish.
+			std::this_thread::yield();
+		}
+	}
+	return true;
+}
+
+template<>
+bool RingBufferPolicy<true>::impl_push_frame(const pFrame &frame)
+{
+	return store_frame(frame);
+}
+
 
 
 }
@@ -17,6 +17,9 @@
 #include <deque>
 #include <cassert>
 #include <random>
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
 namespace yuri {
 namespace core {
 
@@ -240,6 +243,117 @@ private:
 };
 
 
+/*!
+ * @brief Policy for bounded lock-free pipes with single producer and single consumer.
+ *
+ * Frames are stored in a ring of slots, each slot carrying a sequence number
+ * telling whether it's ready for the producer or for the consumer.
+ * Blocking variant is wait-free on both sides. Non-blocking variant drops
+ * the oldest frame when full, so the producer competes with the consumer
+ * for the tail and the consumer side is only lock-free.
+ */
+template<bool blocking>
+class RingBufferPolicy {
+public:
+	static Parameters configure() {
+		Parameters p;
+		p.set_description(std::string("Lock-free single producer/single consumer pipe limited by number of frames stored")+(blocking?" (blocking).":"."));
+		p["count"]["Max. number of frames to store"]=10;
+		return p;
+	}
+protected:
+	RingBufferPolicy(const Parameters& parameters):max_count_(0),slot_count_(0),head_(0),tail_(0)
+	{
+		max_count_=parameters["count"].get<size_t>();
+		if (max_count_ < 1) {
+			max_count_ = 1;
+		}
+		// Sequence numbers of a full and an empty slot would be the same with a single slot
+		slot_count_ = std::max<yuri::size_t>(max_count_, 2);
+		slots_.reset(new slot_t[slot_count_]);
+		for (yuri::size_t i = 0; i < slot_count_; ++i) {
+			slots_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+	virtual ~RingBufferPolicy() noexcept {}
+
+	EXPORT bool impl_push_frame(const pFrame &frame);
+	pFrame impl_pop_frame()
+	{
+		auto pos = tail_.load(std::memory_order_relaxed);
+		while (true) {
+			auto& slot = slots_[pos % slot_count_];
+			const auto seq = slot.sequence.load(std::memory_order_acquire);
+			if (seq < pos + 1) return {};
+			if (seq > pos + 1) {
+				// The slot was already taken by the producer dropping old frames
+				pos = tail_.load(std::memory_order_relaxed);
+				continue;
+			}
+			if (blocking) {
+				// Consumer is the only one moving tail in blocking mode
+				tail_.store(pos + 1, std::memory_order_relaxed);
+			} else if (!tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				continue;
+			}
+			pFrame frame = std::move(slot.frame);
+			slot.sequence.store(pos + slot_count_, std::memory_order_release);
+			return frame;
+		}
+	}
+	size_t impl_get_size() const {
+		const auto tail = tail_.load(std::memory_order_acquire);
+		const auto head = head_.load(std::memory_order_acquire);
+		return head > tail ? head - tail : 0;
+	}
+	bool impl_is_full() const noexcept {
+		return impl_get_size() >= max_count_;
+	}
+private:
+	virtual void drop_frame(const pFrame& frame) = 0;
+	bool store_frame(const pFrame& frame)
+	{
+		const auto pos = head_.load(std::memory_order_relaxed);
+		// Only the single frame pipe has a spare slot
+		if (slot_count_ != max_count_ && pos - tail_.load(std::memory_order_acquire) >= max_count_) return false;
+		auto& slot = slots_[pos % slot_count_];
+		if (slot.sequence.load(std::memory_order_acquire) != pos) return false;
+		slot.frame = frame;
+		slot.sequence.store(pos + 1, std::memory_order_release);
+		head_.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	static constexpr yuri::size_t cache_line_size = 64;
+	using counter_t = std::atomic<yuri::size_t>;
+	struct slot_t {
+		std::atomic<yuri::size_t> sequence;
+		pFrame frame;
+	};
+
+	yuri::size_t max_count_;
+	yuri::size_t slot_count_;
+	std::unique_ptr<slot_t[]> slots_;
+	// Head is written only by the producer and tail mostly by the consumer,
+	// keep them on separate cache lines.
+	char pad_head_[cache_line_size];
+	counter_t head_;
+	char pad_tail_[cache_line_size - sizeof(counter_t)];
+	counter_t tail_;
+	char pad_end_[cache_line_size - sizeof(counter_t)];
+};
+
+/*!
+ * Pipes built from policies listed here synchronize by themselves
+ * and don't need to be guarded by a lock in core::Pipe.
+ */
+template<template <bool> class Policy>
+struct is_lock_free_policy: std::false_type {};
+
+template<>
+struct is_lock_free_policy<RingBufferPolicy>: std::true_type {};
+
+
 }
 
 } /* namespace core */
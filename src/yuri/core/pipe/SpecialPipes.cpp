@@ -23,6 +23,8 @@ namespace core {
     REGISTER_PIPE("size_limited",                   NonBlockingSizeLimitedPipe)
     REGISTER_PIPE("unreliable_single_blocking",		BlockingUnreliableSingleFramePipe)
     REGISTER_PIPE("unreliable_single",              NonBlockingUnreliableSingleFramePipe)
+    REGISTER_PIPE("spsc_ring_blocking",             BlockingRingBufferPipe)
+    REGISTER_PIPE("spsc_ring",                      NonBlockingRingBufferPipe)
 }
 }
 
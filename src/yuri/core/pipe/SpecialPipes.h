@@ -21,7 +21,7 @@ template <template <bool> class Policy, bool blocking>
 class SpecialPipe: public Pipe, public Policy<blocking> {
 public:
 								SpecialPipe(const std::string& name, const log::Log& log_, const Parameters& params)
-					:Pipe(name, log_),Policy<blocking>(params) {}
+					:Pipe(name, log_, pipe::is_lock_free_policy<Policy>::value),Policy<blocking>(params) {}
 								~SpecialPipe() noexcept {}
 	static pPipe 				generate(const std::string& name, const log::Log& log_, const Parameters& params) {
 		return std::make_shared<SpecialPipe<Policy, blocking>>(name, log_, params);
@@ -58,11 +58,13 @@ using BlockingSingleFramePipe               = SpecialPipe<pipe::SingleFramePolic
 using BlockingSizeLimitedPipe               = SpecialPipe<pipe::SizeLimitedPolicy, true>;
 using BlockingCountLimitedPipe              = SpecialPipe<pipe::CountLimitedPolicy, true>;
 using BlockingUnreliableSingleFramePipe     = SpecialPipe<pipe::UnreliableSingleFramePolicy, true>;
+using BlockingRingBufferPipe                = SpecialPipe<pipe::RingBufferPolicy, true>;
 using NonBlockingUnlimitedPipe              = SpecialPipe<pipe::UnlimitedPolicy, false>;
 using NonBlockingSingleFramePipe            = SpecialPipe<pipe::SingleFramePolicy, false>;
 using NonBlockingSizeLimitedPipe            = SpecialPipe<pipe::SizeLimitedPolicy, false>;
 using NonBlockingCountLimitedPipe           = SpecialPipe<pipe::CountLimitedPolicy, false>;
 using NonBlockingUnreliableSingleFramePipe  = SpecialPipe<pipe::UnreliableSingleFramePolicy, false>;
+using NonBlockingRingBufferPipe             = SpecialPipe<pipe::RingBufferPolicy, false>;
 
 }
 }
@@ -47,6 +47,27 @@ bool DatagramSocket::ready_to_send() {
 bool DatagramSocket::wait_for_data(duration_t duration) {
 	return do_wait_for_data(duration);
 }
+size_t DatagramSocket::send_datagrams(const datagram_t* datagrams, size_t count) {
+	return do_send_datagrams(datagrams, count);
+}
+size_t DatagramSocket::receive_datagrams(const datagram_buffer_t* buffers, size_t* sizes, size_t count) {
+	return do_receive_datagrams(buffers, sizes, count);
+}
+
+size_t DatagramSocket::do_send_datagrams(const datagram_t* datagrams, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		if (do_send_datagram(datagrams[i].data, datagrams[i].size) != datagrams[i].size) return i;
+	}
+	return count;
+}
+size_t DatagramSocket::do_receive_datagrams(const datagram_buffer_t* buffers, size_t* sizes, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		if (!do_data_available()) return i;
+		sizes[i] = do_receive_datagram(buffers[i].data, buffers[i].size);
+		if (!sizes[i]) return i;
+	}
+	return count;
+}
 
 
 }
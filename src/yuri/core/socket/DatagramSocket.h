@@ -21,6 +21,18 @@ namespace core {
 namespace socket {
 
 typedef uint16_t port_t;
+
+/*!
+ * Memory block holding a single datagram, used for sending or receiving several datagrams at once.
+ */
+template<typename T>
+struct basic_datagram_t {
+	T*		data;
+	size_t	size;
+};
+typedef basic_datagram_t<const uint8_t>	datagram_t;
+typedef basic_datagram_t<uint8_t>		datagram_buffer_t;
+
 class DatagramSocket;
 typedef std::shared_ptr<DatagramSocket> pDatagramSocket;
 class DatagramSocket {
@@ -133,6 +145,27 @@ public:
 	template<typename T, size_t N>
 	size_t receive_datagram(std::array<T, N>& data);
 
+	/*!
+	 * Sends several datagrams at once.
+	 * Sockets supporting it send the whole batch with a single system call.
+	 * @param datagrams Datagrams to send
+	 * @param count Number of datagrams
+	 * @return number of datagrams sent (from the beginning of @em datagrams)
+	 */
+	EXPORT size_t send_datagrams(const datagram_t* datagrams, size_t count);
+	size_t send_datagrams(const std::vector<datagram_t>& datagrams) {
+		return send_datagrams(datagrams.data(), datagrams.size());
+	}
+
+	/*!
+	 * Receives datagrams that are waiting to be read, without blocking.
+	 * @param buffers Buffers to store the datagrams into, one datagram per buffer
+	 * @param sizes Array of @em count elements, receiving sizes of the datagrams
+	 * @param count Number of buffers
+	 * @return number of datagrams received
+	 */
+	EXPORT size_t receive_datagrams(const datagram_buffer_t* buffers, size_t* sizes, size_t count);
+
 protected:
 	log::Log	log;
 private:
@@ -144,6 +177,10 @@ private:
 	virtual bool do_data_available() = 0;
 	virtual bool do_ready_to_send() = 0;
 	virtual bool do_wait_for_data(duration_t duration) = 0;
+	//! Default implementation sends datagrams one by one
+	virtual size_t do_send_datagrams(const datagram_t* datagrams, size_t count);
+	//! Default implementation receives datagrams one by one
+	virtual size_t do_receive_datagrams(const datagram_buffer_t* buffers, size_t* sizes, size_t count);
 };
 
 
@@ -11,11 +11,14 @@
 #include "Convert.h"
 #include "yuri/core/Module.h"
 #include "yuri/core/frame/raw_frame_params.h"
+#include "yuri/core/frame/RawVideoFrame.h"
 #include "yuri/core/frame/compressed_frame_params.h"
 #include "yuri/core/frame/raw_audio_frame_params.h"
 #include "yuri/core/thread/ConvertUtils.h"
 #include "yuri/core/thread/IOThreadGenerator.h"
+#include "yuri/core/thread/WorkerPool.h"
 #include "yuri/core/utils/Timer.h"
+#include "yuri/core/utils/tracing.h"
 #include <unordered_map>
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -51,7 +54,8 @@ core::Parameters Convert::configure()
 	p.set_description("Convert");
 	p["format"]["Target format"]="YUV";
 	p["allow_passthrough"]["Allow passing the original frame though, when invalid output format is specified"]=false;
-	p["threads"]["Number of threads to use (if supported by converter)"]=1;
+	p["threads"]["Number of threads to use (if supported by converter), 0 to select it automatically"]=0;
+	p["fused"]["Run conversions with multiple steps line by line, without allocating intermediate frames (when supported by all the converters in the path)"]=true;
 	return p;
 }
 
@@ -61,10 +65,14 @@ struct Convert::convert_pimpl_ {
 	log::Log &log;
 	size_t threads;
 
-
+	struct converter_t {
+		pConverterThread thread;
+		// Interned when the converter is created, so the conversions don't have to lock the tracing registry
+		const char* trace_name;
+	};
 
 	// Returns already prepared covnerter thread of creates new and returns it.
-	pConverterThread get_thread(const std::string& name, converter_key key)
+	converter_t get_thread(const std::string& name, converter_key key)
 	{
 		auto it = stateless_threads.find(name);
 		if (it!=stateless_threads.end()) return it->second;
@@ -84,37 +92,91 @@ struct Convert::convert_pimpl_ {
 //		log[log::info] << "converter " << name << " " << (iot?"OK":"failed");
 		pConverterThread pct = std::dynamic_pointer_cast<ConverterThread>(iot);
 //		log[log::info] << "pct" << name << " " << (pct?"OK":"failed");
-		if (pct) {
-			if (pct->converter_is_stateless()) {
-				log[log::debug] << "Storing stateless converter " << name;
-				stateless_threads[name]=pct;
-			} else {
-				if (!pct->initialize_converter(key.second)) {
-					return {};
-				}
-				log[log::debug] << "Storing statefull converter " << name;
-				statefull_threads[{name, key}]=pct;
+		if (!pct) return {};
+		const converter_t converter{pct, tracing::intern(name)};
+		if (pct->converter_is_stateless()) {
+			log[log::debug] << "Storing stateless converter " << name;
+			stateless_threads[name]=converter;
+		} else {
+			if (!pct->initialize_converter(key.second)) {
+				return {};
 			}
+			log[log::debug] << "Storing statefull converter " << name;
+			statefull_threads[{name, key}]=converter;
 		}
-		return pct;
+		return converter;
 	}
 
 	pFrame convert_step(pFrame frame_in, const convert::convert_node_t& step) {
-		pConverterThread pct = get_thread(step.name, {step.source_format, step.target_format});
-		if (!pct) return {};
-		return pct->convert_frame(frame_in, step.target_format);
+		const auto converter = get_thread(step.name, {step.source_format, step.target_format});
+		if (!converter.thread) return {};
+		tracing::Span span(converter.trace_name, "convert", frame_in->get_index());
+		return converter.thread->convert_frame(frame_in, step.target_format);
+	}
+
+	// Converts the frame line by line through all the steps, keeping only a single line of each intermediate format.
+	// Returns empty frame if any of the steps can't be fused.
+	pFrame convert_fused(pFrame frame_in, const std::vector<convert::convert_node_t>& path) {
+		pRawVideoFrame frame = std::dynamic_pointer_cast<RawVideoFrame>(frame_in);
+		if (!frame || frame->get_planes_count() != 1) return {};
+		tracing::Span span("fused_conversion", "convert", frame->get_index());
+		const resolution_t res = frame->get_resolution();
+
+		std::vector<ConverterThread::line_converter_t> steps;
+		std::vector<size_t> line_sizes;
+		for (const auto& step: path) {
+			pConverterThread pct = get_thread(step.name, {step.source_format, step.target_format}).thread;
+			if (!pct) return {};
+			auto line_converter = pct->get_line_converter(step.source_format, step.target_format);
+			if (!line_converter) return {};
+			steps.push_back(std::move(line_converter));
+			try {
+				const auto& info = raw_format::get_format_info(step.target_format);
+				if (info.planes.size() != 1) return {};
+				line_sizes.push_back(std::get<0>(RawVideoFrame::get_plane_params(info.planes[0], res)));
+			}
+			catch (std::runtime_error&) {
+				return {};
+			}
+		}
+
+		pRawVideoFrame outframe = RawVideoFrame::create_empty(path.back().target_format, res, true);
+		if (!outframe || outframe->get_planes_count() != 1) return {};
+		outframe->copy_video_params(*frame);
+
+		const size_t linesize_in = PLANE_DATA(frame, 0).get_line_size();
+		const size_t linesize_out = PLANE_DATA(outframe, 0).get_line_size();
+		const uint8_t* src = PLANE_CONST_RAW_DATA(frame, 0);
+		uint8_t* dest = PLANE_RAW_DATA(outframe, 0);
+
+		parallel_for_lines(res.height, linesize_in + linesize_out, threads,
+				[&](size_t begin, size_t end) {
+			std::vector<std::vector<uint8_t>> scratch;
+			for (size_t i = 0; i < steps.size() - 1; ++i) {
+				scratch.emplace_back(line_sizes[i]);
+			}
+			for (size_t line = begin; line < end; ++line) {
+				const uint8_t* line_in = src + line * linesize_in;
+				for (size_t i = 0; i < steps.size(); ++i) {
+					uint8_t* line_out = (i == steps.size() - 1) ? dest + line * linesize_out : scratch[i].data();
+					steps[i](line_in, line_out, res.width);
+					line_in = line_out;
+				}
+			}
+		});
+		return outframe;
 	}
 
 
-	std::unordered_map<std::string, pConverterThread> stateless_threads;
-	std::unordered_map<std::pair<std::string, converter_key>, pConverterThread> statefull_threads;
+	std::unordered_map<std::string, converter_t> stateless_threads;
+	std::unordered_map<std::pair<std::string, converter_key>, converter_t> statefull_threads;
 
 
 };
 
 
 Convert::Convert(const log::Log &log_, core::pwThreadBase parent, const core::Parameters &parameters):
-core::IOFilter(log_,parent,std::string("convert")),allow_passthrough_(false)
+core::IOFilter(log_,parent,std::string("convert")),allow_passthrough_(false),threads_(0),fused_(true)
 {
 	IOTHREAD_INIT(parameters)
 	pimpl_.reset(new convert_pimpl_(log, threads_));
@@ -138,13 +200,19 @@ pFrame Convert::do_convert_frame(pFrame frame_in, format_t target_format)
 		return {};
 	}
 //	log[log::info] << "Path length: " << path.size();
-	pFrame result = frame_in;
-	for (const auto& step: path.first) {
-//		log[log::info] << "Stepping to " << step.name;
-		result = pimpl_->convert_step(result, step);
-		if (!result) {
-			log[log::info] << "Failed!";
-			return {};
+	pFrame result;
+	if (fused_ && path.first.size() > 1) {
+		result = pimpl_->convert_fused(frame_in, path.first);
+	}
+	if (!result) {
+		result = frame_in;
+		for (const auto& step: path.first) {
+//			log[log::info] << "Stepping to " << step.name;
+			result = pimpl_->convert_step(result, step);
+			if (!result) {
+				log[log::info] << "Failed!";
+				return {};
+			}
 		}
 	}
 	if (result->get_duration() == 0_us) {
@@ -174,7 +242,8 @@ pFrame Convert::convert_to_cheapest(pFrame frame, const std::vector<format_t>& f
 	std::vector<std::pair<format_t, size_t>> costs;
 	for (const auto& f: fmts) {
 		auto path = find_conversion(fmt, f);
-		costs.emplace_back(std::make_pair(f, path.second));
+		// Zero cost means there's no conversion available
+		if (path.second) costs.emplace_back(std::make_pair(f, path.second));
 	}
 	std::sort(costs.begin(), costs.end(),
 	   [](const std::pair<format_t, size_t>&a, const std::pair<format_t, size_t>& b)
@@ -195,7 +264,8 @@ bool Convert::set_param(const core::Parameter& param)
 {
 	if (assign_parameters(param) //
 			(allow_passthrough_, "allow_passthrough") //
-			(threads_, "threads"))
+			(threads_, "threads") //
+			(fused_, "fused"))
 		return true;
 	if (param.get_name() == "format") {
 		format_ = raw_format::parse_format(param.get<std::string>());
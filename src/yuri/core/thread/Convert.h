@@ -35,6 +35,7 @@ private:
 	format_t	format_;
 	bool allow_passthrough_;
 	size_t threads_;
+	bool fused_;
 
 	struct convert_pimpl_;
 	std::unique_ptr<convert_pimpl_> pimpl_;
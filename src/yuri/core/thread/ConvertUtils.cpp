@@ -10,8 +10,20 @@
 
 
 #include "ConvertUtils.h"
+#include "yuri/core/thread/IOThreadGenerator.h"
+#include "yuri/core/frame/RawVideoFrame.h"
+#include "yuri/core/frame/raw_frame_params.h"
+#include "yuri/core/frame/compressed_frame_params.h"
+#include "yuri/core/frame/raw_audio_frame_params.h"
+#include "yuri/core/utils/environment.h"
+#include "yuri/core/utils/Timer.h"
 #include <unordered_map>
+#include <map>
 #include <queue>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
 //#include <iostream>
 namespace yuri {
 namespace core {
@@ -21,7 +33,171 @@ namespace {
 
 mutex	path_cache_mutex;
 std::unordered_map<converter_key, std::pair<convert::path_list, size_t>> path_cache;
+// Incremented every time the costs change, so paths found with old costs are not cached
+size_t	path_cache_generation = 0;
 
+using cost_key = std::pair<std::string, converter_key>;
+mutex	costs_mutex;
+std::map<cost_key, double> measured_costs;
+
+std::string get_short_name(format_t fmt)
+{
+	try {
+		const auto& names = raw_format::get_format_info(fmt).short_names;
+		if (!names.empty()) return names.front();
+	}
+	catch (std::runtime_error&) {}
+	try {
+		const auto& names = compressed_frame::get_format_info(fmt).short_names;
+		if (!names.empty()) return names.front();
+	}
+	catch (std::runtime_error&) {}
+	try {
+		const auto& names = raw_audio_format::get_format_info(fmt).short_names;
+		if (!names.empty()) return names.front();
+	}
+	catch (std::runtime_error&) {}
+	return {};
+}
+
+format_t parse_any_format(const std::string& name)
+{
+	if (auto f = raw_format::parse_format(name)) return f;
+	if (auto f = compressed_frame::parse_format(name)) return f;
+	return raw_audio_format::parse_format(name);
+}
+
+bool is_raw_video(format_t fmt)
+{
+	try {
+		return !raw_format::get_format_info(fmt).planes.empty();
+	}
+	catch (std::runtime_error&) {}
+	return false;
+}
+
+/*!
+ * Properties of a format describing how much information it can hold.
+ * Formats that can't be described (e.g. compressed ones) are considered to hold nothing,
+ * so conversions to them are penalized and conversions from them are not.
+ */
+struct format_quality_t {
+	bool	color		= false;
+	bool	alpha		= false;
+	size_t	depth		= 0;
+	// Number of chroma samples per pixel
+	double	chroma		= 0.0;
+};
+
+format_quality_t get_format_quality(format_t fmt)
+{
+	format_quality_t q;
+	try {
+		const auto& info = raw_format::get_format_info(fmt);
+		std::string all;
+		for (const auto& p: info.planes) {
+			const auto& comps = p.components;
+			for (size_t i = 0; i < comps.size(); ++i) {
+				if (comps[i] == '*') continue;
+				const auto& depths = p.component_bit_depths;
+				const auto d = depths.empty() ? 0 : depths[std::min(i, depths.size() - 1)];
+				if (d && (!q.depth || d < q.depth)) q.depth = d;
+			}
+			const auto pixels = std::max<size_t>(p.bit_depth.second, 1) * std::max<size_t>(p.sub_x * p.sub_y, 1);
+			const auto u_samples = std::count(comps.begin(), comps.end(), 'U');
+			if (u_samples) q.chroma = static_cast<double>(u_samples) / pixels;
+			all += comps;
+		}
+		auto has = [&all](char c) { return all.find(c) != std::string::npos; };
+		q.alpha = has('A');
+		const bool rgb = has('R') && has('G') && has('B');
+		q.color = rgb || (has('U') && has('V')) || (has('x') && has('z'));
+		if (rgb) q.chroma = 1.0;
+	}
+	catch (std::runtime_error&) {}
+	return q;
+}
+
+/*!
+ * Returns a penalty for conversions losing information (color, alpha, precision or chroma resolution).
+ *
+ * Static costs of the converters already contain such penalty, measured costs
+ * reflect only the speed, so without it the fastest path could e.g. go through grayscale.
+ */
+size_t get_loss_penalty(format_t source, format_t target)
+{
+	// Losing color is worse than anything else, losing chroma resolution is the least severe
+	const size_t color_penalty		= 8000;
+	const size_t alpha_penalty		= 4000;
+	const size_t depth_penalty		= 2000;
+	const size_t chroma_penalty		= 1000;
+	const auto q1 = get_format_quality(source);
+	const auto q2 = get_format_quality(target);
+	size_t penalty = 0;
+	if (q1.color && !q2.color) penalty += color_penalty;
+	if (q1.alpha && !q2.alpha) penalty += alpha_penalty;
+	if (q2.depth < q1.depth) penalty += depth_penalty;
+	if (q1.color && q2.color && q2.chroma < q1.chroma) penalty += chroma_penalty;
+	return penalty;
+}
+
+double median(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	const auto n = values.size();
+	return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2.0;
+}
+
+/*!
+ * Selects the cheapest converter for each format pair.
+ *
+ * Measured costs are scaled to the static costs of the same converters,
+ * so converters without measurement can still be compared with them.
+ */
+std::unordered_map<converter_key, value_type> get_best_converters()
+{
+	const auto& conv = core::ConverterRegister::get_instance();
+	const auto& keys = conv.list_keys();
+	std::vector<std::pair<cost_key, size_t>> converters;
+	for (const auto& k: keys) {
+		for (const auto& v: conv.find_value(k)) {
+			converters.emplace_back(cost_key{v.first, k}, v.second);
+		}
+	}
+
+	std::map<cost_key, double> measured;
+	{
+		lock_t _(costs_mutex);
+		measured = measured_costs;
+	}
+	std::vector<double> ratios;
+	for (const auto& c: converters) {
+		auto it = measured.find(c.first);
+		if (it != measured.end() && it->second > 0.0) {
+			ratios.push_back(static_cast<double>(c.second) / it->second);
+		}
+	}
+	const double scale = ratios.empty() ? 0.0 : median(ratios);
+
+	std::unordered_map<converter_key, value_type> best;
+	for (const auto& c: converters) {
+		size_t cost = c.second;
+		if (scale > 0.0) {
+			auto it = measured.find(c.first);
+			if (it != measured.end()) {
+				// Static costs already contain the penalty
+				cost = std::max<size_t>(1, static_cast<size_t>(std::lround(it->second * scale)))
+						+ get_loss_penalty(c.first.second.first, c.first.second.second);
+			}
+		}
+		const auto& key = c.first.second;
+		auto bit = best.find(key);
+		if (bit == best.end() || cost < bit->second.second) {
+			best[key] = value_type{c.first.first, cost};
+		}
+	}
+	return best;
+}
 
 }
 
@@ -30,14 +206,16 @@ std::pair<convert::path_list, size_t> find_conversion(format_t format_in, format
 {
 	converter_key search_key{format_in, format_out};
 	if (format_in == format_out) return {};
+	size_t generation = 0;
 	{
 		lock_t _(path_cache_mutex);
 		auto pit = path_cache.find(search_key);
 		if (pit != path_cache.end()) {
 			return pit->second;
 		}
+		generation = path_cache_generation;
 	}
-	std::unordered_map<converter_key, value_type > best_convertor;
+	std::unordered_map<converter_key, value_type > best_convertor = get_best_converters();
 	std::unordered_multimap<format_t, converter_key> starts;
 	std::unordered_map<format_t, size_t> costs;
 	std::unordered_map<format_t, convert::path_list> paths;
@@ -55,13 +233,6 @@ std::pair<convert::path_list, size_t> find_conversion(format_t format_in, format
 
 	for (const auto& k: keys) {
 		starts.emplace(k.first, k); // Prepare all converters
-		auto vals = conv.find_value(k); // Select the best converter for each format pair (when there's multiple converters)
-		for (const auto& v: vals) {
-			auto&& it = best_convertor.find(k);
-			if (it == best_convertor.end() || (v.second < it->second.second)) {
-				best_convertor[k]=v;
-			}
-		}
 	}
 
 	// Populate stack with initial edges
@@ -104,7 +275,7 @@ std::pair<convert::path_list, size_t> find_conversion(format_t format_in, format
 	{
 		lock_t _(path_cache_mutex);
 		auto pit = path_cache.find(search_key);
-		if (pit == path_cache.end()) {
+		if (pit == path_cache.end() && generation == path_cache_generation) {
 			path_cache[search_key]={paths[format_out], costs[format_out]};
 		}
 	}
@@ -113,6 +284,166 @@ std::pair<convert::path_list, size_t> find_conversion(format_t format_in, format
 }
 
 
+void clear_conversion_cache()
+{
+	lock_t _(path_cache_mutex);
+	path_cache.clear();
+	++path_cache_generation;
+}
+
+void set_conversion_cost(const std::string& name, format_t source, format_t target, double ns_per_pixel)
+{
+	{
+		lock_t _(costs_mutex);
+		measured_costs[cost_key{name, {source, target}}] = ns_per_pixel;
+	}
+	clear_conversion_cache();
+}
+
+double get_measured_conversion_cost(const std::string& name, format_t source, format_t target)
+{
+	lock_t _(costs_mutex);
+	auto it = measured_costs.find(cost_key{name, {source, target}});
+	return it == measured_costs.end() ? 0.0 : it->second;
+}
+
+void clear_conversion_costs()
+{
+	{
+		lock_t _(costs_mutex);
+		measured_costs.clear();
+	}
+	clear_conversion_cache();
+}
+
+/*
+ * The file contains one converter per line:
+ * <converter name> <source format> <target format> <ns per pixel>
+ * Formats are stored using their short names, as format ids for user formats
+ * may differ between runs.
+ */
+bool load_conversion_costs(const std::string& filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) return false;
+	std::map<cost_key, double> costs;
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#') continue;
+		std::istringstream ss(line);
+		std::string name, source, target;
+		double cost = 0.0;
+		if (!(ss >> name >> source >> target >> cost) || cost <= 0.0) continue;
+		const auto f1 = parse_any_format(source);
+		const auto f2 = parse_any_format(target);
+		if (!f1 || !f2) continue;
+		costs[cost_key{name, {f1, f2}}] = cost;
+	}
+	{
+		lock_t _(costs_mutex);
+		for (const auto& c: costs) {
+			measured_costs[c.first] = c.second;
+		}
+	}
+	clear_conversion_cache();
+	return true;
+}
+
+bool save_conversion_costs(const std::string& filename)
+{
+	std::ofstream file(filename, std::ios::out | std::ios::trunc);
+	if (!file.is_open()) return false;
+	file << "# converter source_format target_format ns_per_pixel\n";
+	lock_t _(costs_mutex);
+	for (const auto& c: measured_costs) {
+		const auto source = get_short_name(c.first.second.first);
+		const auto target = get_short_name(c.first.second.second);
+		if (source.empty() || target.empty()) continue;
+		file << c.first.first << " " << source << " " << target << " " << c.second << "\n";
+	}
+	return file.good();
 }
+
+std::string get_conversion_costs_file()
+{
+	auto path = utils::get_environment_variable("YURI_CONVERTER_COSTS");
+	if (!path.empty()) return path;
+	const auto home = utils::get_environment_variable("HOME");
+	if (home.empty()) return {};
+	return home + "/.yuri_converter_costs";
 }
 
+size_t calibrate_converters(log::Log& log, const std::vector<resolution_t>& resolutions, duration_t duration)
+{
+	if (resolutions.empty()) return 0;
+	const auto& conv = core::ConverterRegister::get_instance();
+	const auto& gen = IOThreadGenerator::get_instance();
+	size_t measured = 0;
+	std::map<std::string, pConverterThread> stateless_converters;
+	for (const auto& k: conv.list_keys()) {
+		// Only raw video converters can be fed with synthetic frames
+		if (!is_raw_video(k.first) || !is_raw_video(k.second)) continue;
+		for (const auto& v: conv.find_value(k)) {
+			const auto& name = v.first;
+			if (!gen.is_registered(name)) continue;
+			double total = 0.0;
+			try {
+				auto pct = stateless_converters[name];
+				if (!pct) {
+					pct = std::dynamic_pointer_cast<ConverterThread>(
+							gen.generate(name, log, pwThreadBase{}, gen.configure(name)));
+					if (!pct) continue;
+					if (pct->converter_is_stateless()) {
+						stateless_converters[name] = pct;
+					} else if (!pct->initialize_converter(k.second)) {
+						continue;
+					}
+				}
+				bool failed = false;
+				for (const auto& res: resolutions) {
+					auto frame = RawVideoFrame::create_empty(k.first, res, true);
+					// The first run may initialize internal state of the converter
+					if (!frame || !pct->convert_frame(frame, k.second)) {
+						failed = true;
+						break;
+					}
+					// Minimal time of a single conversion is the least noisy estimate
+					using clock_type = std::chrono::steady_clock;
+					auto best = clock_type::duration::max();
+					Timer total_time;
+					size_t iterations = 0;
+					while (iterations < 3 || total_time.get_duration() < duration) {
+						const auto start = clock_type::now();
+						pct->convert_frame(frame, k.second);
+						best = std::min(best, clock_type::now() - start);
+						++iterations;
+					}
+					const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(best).count();
+					total += static_cast<double>(ns) / (res.width * res.height);
+				}
+				if (failed) {
+					log[log::debug] << "Converter " << name << " failed to convert "
+							<< get_short_name(k.first) << " -> " << get_short_name(k.second);
+					continue;
+				}
+			}
+			catch (std::exception& e) {
+				log[log::debug] << "Failed to measure converter " << name << ": " << e.what();
+				continue;
+			}
+			const auto ns_per_pixel = total / resolutions.size();
+			log[log::info] << name << " " << get_short_name(k.first) << " -> " << get_short_name(k.second)
+					<< ": " << ns_per_pixel << " ns/pixel";
+			{
+				lock_t _(costs_mutex);
+				measured_costs[cost_key{name, k}] = ns_per_pixel;
+			}
+			++measured;
+		}
+	}
+	clear_conversion_cache();
+	return measured;
+}
+
+}
+}
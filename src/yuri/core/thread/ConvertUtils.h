@@ -11,6 +11,8 @@
 #ifndef CONVERTUTILS_H_
 #define CONVERTUTILS_H_
 #include "ConverterRegister.h"
+#include "yuri/core/utils/time_types.h"
+#include "yuri/log/Log.h"
 #include <vector>
 namespace yuri {
 namespace core {
@@ -33,6 +35,69 @@ typedef std::vector<convert::convert_node_t> path_list;
  */
 EXPORT std::pair<convert::path_list, size_t> find_conversion(format_t source, format_t target);
 
+/*!
+ * Clears all paths cached by find_conversion()
+ */
+EXPORT void clear_conversion_cache();
+
+/*!
+ * Stores measured cost of a converter.
+ *
+ * Measured costs replace the costs specified when registering the converters.
+ * They are rescaled, so they're comparable with static costs of converters
+ * that weren't measured, and conversions losing information (color, alpha,
+ * bit depth or chroma resolution) are penalized.
+ *
+ * @param name Name of the converter
+ * @param source Input format
+ * @param target Output format
+ * @param ns_per_pixel Measured time per pixel of the input frame (in nanoseconds)
+ */
+EXPORT void set_conversion_cost(const std::string& name, format_t source, format_t target, double ns_per_pixel);
+
+/*!
+ * Returns measured cost of a converter in nanoseconds per pixel, or 0 if it wasn't measured.
+ */
+EXPORT double get_measured_conversion_cost(const std::string& name, format_t source, format_t target);
+
+/*!
+ * Removes all measured costs
+ */
+EXPORT void clear_conversion_costs();
+
+/*!
+ * Loads measured costs from a file created by save_conversion_costs().
+ * Entries for unknown formats are ignored.
+ * @return true if the file was read successfully
+ */
+EXPORT bool load_conversion_costs(const std::string& filename);
+
+/*!
+ * Saves all measured costs to a file.
+ * @return true if the file was written successfully
+ */
+EXPORT bool save_conversion_costs(const std::string& filename);
+
+/*!
+ * Returns default path to the file with measured costs. It's set by environment
+ * variable YURI_CONVERTER_COSTS and defaults to $HOME/.yuri_converter_costs.
+ * The file is never loaded implicitly, applications have to call load_conversion_costs().
+ */
+EXPORT std::string get_conversion_costs_file();
+
+/*!
+ * Measures all registered converters between raw video formats
+ * and stores the results using set_conversion_cost().
+ *
+ * @param log Log to use for the converters and to report the results
+ * @param resolutions Resolutions of the frames to test with
+ * @param duration Time to spend measuring single converter at single resolution
+ * @return number of converters measured
+ */
+EXPORT size_t calibrate_converters(log::Log& log,
+		const std::vector<resolution_t>& resolutions = {{640, 480}, {1920, 1080}},
+		duration_t duration = 20_ms);
+
 
 
 }
@@ -12,6 +12,7 @@
 #define CONVERTERTHREAD_H_
 
 #include "yuri/core/frame/Frame.h"
+#include <functional>
 namespace yuri {
 namespace core {
 class ConverterThread;
@@ -19,6 +20,12 @@ typedef std::shared_ptr<ConverterThread> pConverterThread;
 
 class ConverterThread {
 public:
+	/*!
+	 * Converts single line of the first plane.
+	 * Arguments are source line, destination line and width of the line in pixels.
+	 */
+	using line_converter_t = std::function<void(const uint8_t*, uint8_t*, size_t)>;
+
 	ConverterThread() = default;
 	virtual ~ConverterThread() noexcept {}
 	core::pFrame convert_frame(core::pFrame input_frame, format_t target_format) {
@@ -30,10 +37,19 @@ public:
 	bool converter_is_stateless() const {
 		return do_converter_is_stateless();
 	}
+	/*!
+	 * Returns function converting a single line from @em source_format to @em target_format,
+	 * or an empty function if the converter can't process images line by line.
+	 * Converters providing it can be fused with other steps of a conversion path.
+	 */
+	line_converter_t get_line_converter(format_t source_format, format_t target_format) const {
+		return do_get_line_converter(source_format, target_format);
+	}
 private:
 	virtual core::pFrame do_convert_frame(core::pFrame input_frame, format_t target_format) = 0;
 	virtual bool do_initialize_converter(format_t /*target_format*/) { return true; }
 	virtual bool do_converter_is_stateless() const { return true; }
+	virtual line_converter_t do_get_line_converter(format_t /*source_format*/, format_t /*target_format*/) const { return {}; }
 };
 
 }
@@ -13,8 +13,16 @@
 #include "yuri/exception/InitializationFailed.h"
 #include "yuri/core/thread/IOThreadGenerator.h"
 #include "yuri/core/utils/assign_parameters.h"
-//#include <iostream>
 #include <cassert>
+#include <atomic>
+#include <cstdlib>
+#ifdef YURI_POSIX
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_NUMA
+#include <numa.h>
+#include <sched.h>
+#endif
 namespace yuri {
 
 namespace core {
@@ -24,8 +32,324 @@ MODULE_REGISTRATION_END()
 
 IOTHREAD_GENERATOR(FixedMemoryAllocator)
 
-yuri::mutex FixedMemoryAllocator::mem_lock;
-std::map<yuri::size_t, std::vector<uint8_t* > > FixedMemoryAllocator::memory_pool;
+namespace {
+
+const yuri::size_t min_alignment		= 64;
+const yuri::size_t page_size			= 4096;
+const yuri::size_t huge_page_size		= 2 * 1024 * 1024;
+/**\brief Max. number of blocks of a single size a thread keeps for itself */
+const yuri::size_t max_local_blocks		= 4;
+/**\brief Max. number of bytes a thread keeps for itself */
+const yuri::size_t max_local_bytes		= 64 * 1024 * 1024;
+
+/**\brief Header stored in a free block while it's in a list of returned blocks */
+struct free_block_t {
+	free_block_t	*next;
+	yuri::size_t	size;
+};
+
+using block_map_t = std::map<yuri::size_t, std::vector<uint8_t*>>;
+
+/**\brief Increments counter modified only by a single thread, without locked instructions */
+inline void bump(std::atomic<yuri::size_t>& counter, yuri::size_t value = 1)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+yuri::size_t round_up(yuri::size_t size, yuri::size_t alignment)
+{
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+bool use_numa()
+{
+#ifdef HAVE_NUMA
+	static const bool available = numa_available() >= 0;
+	return available;
+#else
+	return false;
+#endif
+}
+
+yuri::size_t numa_nodes()
+{
+#ifdef HAVE_NUMA
+	if (use_numa()) return static_cast<yuri::size_t>(numa_max_node() + 1);
+#endif
+	return 1;
+}
+
+yuri::size_t current_numa_node()
+{
+#ifdef HAVE_NUMA
+	if (use_numa()) {
+		const auto cpu = sched_getcpu();
+		const auto node = cpu >= 0 ? numa_node_of_cpu(cpu) : 0;
+		if (node > 0 && static_cast<yuri::size_t>(node) < numa_nodes()) return node;
+	}
+#endif
+	return 0;
+}
+
+/*!
+ * Allocates a new block. It has to be called with size already rounded to a size class.
+ * The memory is allocated on the NUMA node of the calling thread.
+ */
+uint8_t* allocate_block(yuri::size_t size)
+{
+#ifdef HAVE_NUMA
+	if (size >= page_size && use_numa()) {
+		if (auto mem = numa_alloc_local(size)) return reinterpret_cast<uint8_t*>(mem);
+		throw std::bad_alloc();
+	}
+#endif
+	const auto alignment = size >= huge_page_size ? huge_page_size :
+						size >= page_size ? page_size : min_alignment;
+	void* mem = nullptr;
+#ifdef YURI_WIN
+	mem = _aligned_malloc(size, alignment);
+	if (!mem) throw std::bad_alloc();
+#else
+	if (posix_memalign(&mem, alignment, size) != 0) throw std::bad_alloc();
+#endif
+#ifdef MADV_HUGEPAGE
+	if (size >= huge_page_size) madvise(mem, size, MADV_HUGEPAGE);
+#endif
+	// Without libnuma at least touch the pages, so the first-touch policy
+	// places them on the node of the allocating thread
+	auto data = reinterpret_cast<uint8_t*>(mem);
+	for (yuri::size_t i = 0; i < size; i += page_size) {
+		data[i] = 0;
+	}
+	return data;
+}
+
+void free_block(uint8_t* mem, yuri::size_t size) noexcept
+{
+#ifdef HAVE_NUMA
+	if (size >= page_size && use_numa()) {
+		numa_free(mem, size);
+		return;
+	}
+#else
+	(void)size;
+#endif
+#ifdef YURI_WIN
+	_aligned_free(mem);
+#else
+	free(mem);
+#endif
+}
+
+}
+
+/**\brief Per thread cache of memory blocks
+ *
+ * Only the owning thread accesses @em blocks, other threads return
+ * blocks into the lock-free list @em remote. Counters are written only
+ * by the owner and can be read by anyone.
+ */
+struct FixedMemoryAllocator::ThreadCache {
+	ThreadCache(yuri::size_t node):node(node),bytes(0),remote(nullptr),retired(false),
+		local_hits(0),global_hits(0),misses(0),remote_returns(0),
+		blocks_out(0),bytes_out(0),blocks_back(0),bytes_back(0),
+		cached_blocks(0),cached_bytes(0) {}
+	~ThreadCache() noexcept;
+
+	yuri::size_t				node;
+	block_map_t					blocks;
+	yuri::size_t				bytes;
+	std::atomic<free_block_t*>	remote;
+	std::atomic<bool>			retired;
+
+	std::atomic<yuri::size_t>	local_hits;
+	std::atomic<yuri::size_t>	global_hits;
+	std::atomic<yuri::size_t>	misses;
+	std::atomic<yuri::size_t>	remote_returns;
+	std::atomic<yuri::size_t>	blocks_out;
+	std::atomic<yuri::size_t>	bytes_out;
+	std::atomic<yuri::size_t>	blocks_back;
+	std::atomic<yuri::size_t>	bytes_back;
+	std::atomic<yuri::size_t>	cached_blocks;
+	std::atomic<yuri::size_t>	cached_bytes;
+};
+
+namespace {
+
+using pThreadCache = std::shared_ptr<FixedMemoryAllocator::ThreadCache>;
+
+/**\brief Global pool of free blocks for a single NUMA node */
+struct node_pool_t {
+	mutex						lock;
+	block_map_t					blocks;
+};
+
+/**\brief Global state of the allocator
+ *
+ * Contains the global pools, registry of thread caches (for statistics)
+ * and statistics of threads that already ended.
+ */
+struct pool_state_t {
+	pool_state_t() {
+		for (yuri::size_t i = 0; i < numa_nodes(); ++i) {
+			pools.emplace_back(new node_pool_t);
+		}
+	}
+	std::vector<std::unique_ptr<node_pool_t>>
+								pools;
+	mutex						registry_lock;
+	std::vector<std::weak_ptr<FixedMemoryAllocator::ThreadCache>>
+								registry;
+	// Totals of threads that already ended and of allocations without any thread cache
+	std::atomic<yuri::size_t>	local_hits {0};
+	std::atomic<yuri::size_t>	global_hits {0};
+	std::atomic<yuri::size_t>	misses {0};
+	std::atomic<yuri::size_t>	remote_returns {0};
+	std::atomic<yuri::size_t>	blocks_out {0};
+	std::atomic<yuri::size_t>	bytes_out {0};
+	std::atomic<yuri::size_t>	blocks_back {0};
+	std::atomic<yuri::size_t>	bytes_back {0};
+};
+
+pool_state_t& pool_state()
+{
+	// Intentionally never destroyed, caches of threads ending during
+	// static destruction (e.g. shared scheduler workers) still return blocks here.
+	static pool_state_t* state = new pool_state_t;
+	return *state;
+}
+
+node_pool_t& node_pool(yuri::size_t node)
+{
+	return *pool_state().pools[node];
+}
+
+void put_global(yuri::size_t node, yuri::size_t size, uint8_t* mem)
+{
+	auto& pool = node_pool(node);
+	lock_t _(pool.lock);
+	pool.blocks[size].push_back(mem);
+}
+
+uint8_t* get_global(yuri::size_t node, yuri::size_t size)
+{
+	auto& pool = node_pool(node);
+	lock_t _(pool.lock);
+	auto it = pool.blocks.find(size);
+	if (it == pool.blocks.end() || it->second.empty()) return nullptr;
+	auto mem = it->second.back();
+	it->second.pop_back();
+	return mem;
+}
+
+bool put_local(FixedMemoryAllocator::ThreadCache& cache, yuri::size_t size, uint8_t* mem)
+{
+	auto& list = cache.blocks[size];
+	if (list.size() >= max_local_blocks || cache.bytes + size > max_local_bytes) {
+		return false;
+	}
+	list.push_back(mem);
+	cache.bytes += size;
+	bump(cache.cached_blocks);
+	bump(cache.cached_bytes, size);
+	return true;
+}
+
+/**\brief Moves blocks returned by other threads to local cache, or to global pool */
+void drain_remote(FixedMemoryAllocator::ThreadCache& cache)
+{
+	if (!cache.remote.load(std::memory_order_relaxed)) return;
+	auto block = cache.remote.exchange(nullptr, std::memory_order_acquire);
+	while (block) {
+		auto next = block->next;
+		const auto size = block->size;
+		auto mem = reinterpret_cast<uint8_t*>(block);
+		bump(cache.remote_returns);
+		bump(cache.blocks_back);
+		bump(cache.bytes_back, size);
+		if (!put_local(cache, size, mem)) {
+			put_global(cache.node, size, mem);
+		}
+		block = next;
+	}
+}
+
+void push_remote(FixedMemoryAllocator::ThreadCache& cache, yuri::size_t size, uint8_t* mem) noexcept
+{
+	auto block = reinterpret_cast<free_block_t*>(mem);
+	block->size = size;
+	block->next = cache.remote.load(std::memory_order_relaxed);
+	while (!cache.remote.compare_exchange_weak(block->next, block,
+			std::memory_order_release, std::memory_order_relaxed)) {}
+}
+
+/**\brief Holder of the cache for current thread. Retires the cache when the thread ends. */
+struct cache_holder_t {
+	~cache_holder_t() noexcept;
+	pThreadCache cache;
+};
+
+thread_local cache_holder_t cache_holder;
+// Set when cache_holder was already destroyed, it must not be used anymore then
+thread_local bool cache_holder_destroyed = false;
+
+cache_holder_t::~cache_holder_t() noexcept
+{
+	cache_holder_destroyed = true;
+	if (!cache) return;
+	cache->retired = true;
+	try {
+		drain_remote(*cache);
+		for (auto& list: cache->blocks) {
+			for (auto mem: list.second) {
+				put_global(cache->node, list.first, mem);
+			}
+		}
+	}
+	catch (...) {}
+	cache->blocks.clear();
+	cache->bytes = 0;
+	cache->cached_blocks = 0;
+	cache->cached_bytes = 0;
+}
+
+FixedMemoryAllocator::ThreadCache* current_cache()
+{
+	if (cache_holder_destroyed) return nullptr;
+	if (!cache_holder.cache) {
+		auto cache = std::make_shared<FixedMemoryAllocator::ThreadCache>(current_numa_node());
+		auto& state = pool_state();
+		lock_t _(state.registry_lock);
+		state.registry.push_back(cache);
+		cache_holder.cache = std::move(cache);
+	}
+	return cache_holder.cache.get();
+}
+
+}
+
+FixedMemoryAllocator::ThreadCache::~ThreadCache() noexcept
+{
+	// Blocks returned after the owner thread retired the cache
+	try {
+		drain_remote(*this);
+		for (auto& list: blocks) {
+			for (auto mem: list.second) {
+				put_global(node, list.first, mem);
+			}
+		}
+	}
+	catch (...) {}
+	auto& state = pool_state();
+	state.local_hits += local_hits;
+	state.global_hits += global_hits;
+	state.misses += misses;
+	state.remote_returns += remote_returns;
+	state.blocks_out += blocks_out;
+	state.bytes_out += bytes_out;
+	state.blocks_back += blocks_back;
+	state.bytes_back += bytes_back;
+}
 
 Parameters FixedMemoryAllocator::configure()
 {
@@ -37,66 +361,87 @@ Parameters FixedMemoryAllocator::configure()
 	//p->set_max_pipes(0,0);
 	return p;
 }
-/** \brief allocate memory blocks and adds them to the pool
+
+/** \brief Rounds size up to a size class
  *
- *  Public version of the method, does lock the pool before accessing it.
- *  \param size Size of the blocks to allocate (in bytes)
- *  \param count number of the blocks to allocate
- *  \return True if all blocks were allocated correctly, false otherwise
+ * Small blocks are rounded to 64B, blocks smaller than 2MB to pages and larger to hugepages.
  */
-
-bool FixedMemoryAllocator::allocate_blocks(yuri::size_t size, yuri::size_t count)
+yuri::size_t FixedMemoryAllocator::get_size_class(yuri::size_t size)
 {
-	lock_t l(mem_lock);
-	return do_allocate_blocks(size,count);
+	if (size <= min_alignment) return min_alignment;
+	if (size < page_size) return round_up(size, min_alignment);
+	if (size < huge_page_size) return round_up(size, page_size);
+	return round_up(size, huge_page_size);
 }
+
 /** \brief allocate memory blocks and adds them to the pool
  *
- *  Private version, does NOT lock_t the pool
  *  \param size Size of the blocks to allocate (in bytes)
  *  \param count number of the blocks to allocate
  *  \return True if all blocks were allocated correctly, false otherwise
  */
-bool FixedMemoryAllocator::do_allocate_blocks(yuri::size_t size, yuri::size_t count)
+bool FixedMemoryAllocator::allocate_blocks(yuri::size_t size, yuri::size_t count)
 {
-	uint8_t *tmp;
-	if (!memory_pool.count(size)) memory_pool[size]=std::vector<uint8_t*>();
-	for (yuri::size_t i=0;i<count;++i) {
-		tmp = new uint8_t[size];
-		if (!tmp) return false;
-		memory_pool[size].push_back(tmp);
-		tmp = 0;
+	size = get_size_class(size);
+	const auto node = current_numa_node();
+	try {
+		for (yuri::size_t i=0;i<count;++i) {
+			put_global(node, size, allocate_block(size));
+		}
+	}
+	catch (std::bad_alloc&) {
+		return false;
 	}
 	return true;
 }
+
 /** \brief Returns pointer to allocated block of requested size.
  *
- * Returns an allocated block from pool, if there's a block available.
- * If there's no block in the pool for the requested size,
- * the method tries to allocate it first.
+ * Returns a block from the cache of current thread, or from the global pool
+ * for current NUMA node. If there's no block available,
+ * the method allocates a new one.
  *
  * \param size Size of the requested block
- * \return Pointer to the allocated block,
- * or null pointer if the block cannot be allocated.
+ * \return Pointer to the allocated block. Throws std::bad_alloc if the block can't be allocated
  */
 FixedMemoryAllocator::memory_block_t FixedMemoryAllocator::get_block(yuri::size_t size)
 {
-	lock_t l(mem_lock);
-	if (memory_pool.count(size)<1 || memory_pool[size].size()<1) {
-		if (!do_allocate_blocks(size,1)) {
-			throw std::bad_alloc();
+	size = get_size_class(size);
+	auto cache = current_cache();
+	if (!cache) {
+		// Called during destruction of the thread
+		auto& state = pool_state();
+		auto mem = get_global(current_numa_node(), size);
+		if (mem) {
+			state.global_hits++;
+		} else {
+			mem = allocate_block(size);
+			state.misses++;
 		}
+		state.blocks_out++;
+		state.bytes_out += size;
+		return std::make_pair(mem, Deleter(size, mem));
 	}
 
-
-	uint8_t * tmp = memory_pool[size].back();
-	memory_block_t block = std::make_pair(tmp,Deleter(size,tmp));
-	memory_pool[size].pop_back();
-//	std::cout << "Serving page "<< static_cast<void*>(tmp) << " of " << size << ". have " << memory_pool[size].size() << " in cache" << std::endl;
-//	std::cout << "Using vector at " << static_cast<void*>(&memory_pool[size]) << ", with data at " << static_cast<void*>(&(memory_pool[size][0])) <<", vector size " << sizeof(std::vector<uint8_t*>)<< std::endl;
-//	const auto& it = memory_pool.find(size);
-//	std::cout << "Memory pool at "  << reinterpret_cast<const void*>(&memory_pool) << ", it: "  << reinterpret_cast<const void*>(&it)<< ": "  << reinterpret_cast<const void*>(&(it->first))<<"/" << reinterpret_cast<const void*>(&(it->second))<<std::endl;
-	return block;
+	drain_remote(*cache);
+	uint8_t* mem = nullptr;
+	auto it = cache->blocks.find(size);
+	if (it != cache->blocks.end() && !it->second.empty()) {
+		mem = it->second.back();
+		it->second.pop_back();
+		cache->bytes -= size;
+		cache->cached_blocks.store(cache->cached_blocks.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+		cache->cached_bytes.store(cache->cached_bytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+		bump(cache->local_hits);
+	} else if ((mem = get_global(cache->node, size))) {
+		bump(cache->global_hits);
+	} else {
+		mem = allocate_block(size);
+		bump(cache->misses);
+	}
+	bump(cache->blocks_out);
+	bump(cache->bytes_out, size);
+	return std::make_pair(mem, Deleter(size, mem, cache_holder.cache));
 }
 /** \brief Returns block to the pool.
  *
@@ -109,15 +454,24 @@ FixedMemoryAllocator::memory_block_t FixedMemoryAllocator::get_block(yuri::size_
  */
 bool FixedMemoryAllocator::return_memory(yuri::size_t size, uint8_t * mem)
 {
-	lock_t l(mem_lock);
-	if (!memory_pool.count(size)) memory_pool[size]=std::vector<uint8_t*>();
-	memory_pool[size].push_back(mem);
-//	std::cout << "Returning page "<< static_cast<void*>(mem) << " of " << size << ". have " << memory_pool[size].size() << " in cache" << std::endl;
+	size = get_size_class(size);
+	if (auto cache = current_cache()) {
+		bump(cache->blocks_back);
+		bump(cache->bytes_back, size);
+		if (put_local(*cache, size, mem)) return true;
+		put_global(cache->node, size, mem);
+	} else {
+		auto& state = pool_state();
+		state.blocks_back++;
+		state.bytes_back += size;
+		put_global(current_numa_node(), size, mem);
+	}
 	return true;
 }
 /**\brief Removes blocks from the memory pool
  *
- * Returns up to \e count blocks of size \e size
+ * Returns up to \e count blocks of size \e size from the global pool.
+ * Blocks cached by threads are not affected.
  *
  * \param size Size of the the block
  * \param count Number of block to remove. Use 0 to remove all blocks.
@@ -126,20 +480,31 @@ bool FixedMemoryAllocator::return_memory(yuri::size_t size, uint8_t * mem)
  */
 bool FixedMemoryAllocator::remove_blocks(yuri::size_t size, yuri::size_t count)
 {
-	lock_t l(mem_lock);
-	if (!memory_pool.count(size)) return true;
-	if (!count) count = memory_pool[size].size();
-	while (count-- > 0) {
-		delete [] memory_pool[size].back();
-		memory_pool[size].pop_back();
+	size = get_size_class(size);
+	const bool all = count == 0;
+	for (auto& pool: pool_state().pools) {
+		lock_t l(pool->lock);
+		auto it = pool->blocks.find(size);
+		if (it == pool->blocks.end()) continue;
+		auto& list = it->second;
+		while (!list.empty() && (all || count > 0)) {
+			free_block(list.back(), size);
+			list.pop_back();
+			--count;
+		}
 	}
 	return true;
 }
 size_t FixedMemoryAllocator::preallocated_blocks(size_t size)
 {
-	lock_t l(mem_lock);
-	if (!memory_pool.count(size)) return 0;
-	return memory_pool[size].size();
+	size = get_size_class(size);
+	size_t count = 0;
+	for (auto& pool: pool_state().pools) {
+		lock_t l(pool->lock);
+		auto it = pool->blocks.find(size);
+		if (it != pool->blocks.end()) count += it->second.size();
+	}
+	return count;
 }
 /** \brief Constructor initializes the object and calls
  * FixedMemoryAllocator::allocate_blocks to allocate requested memory blocks.
@@ -190,23 +555,93 @@ bool FixedMemoryAllocator::step()
 {
 	return true;
 }
+/** \brief Deallocates all free blocks in the global pool and in the cache of current thread.
+ *
+ * \return number of blocks and bytes deallocated
+ */
 std::pair<size_t, size_t> FixedMemoryAllocator::clear_all()
 {
-	lock_t l(mem_lock);
 	size_t total = 0;
 	size_t count = 0;
-	for (auto m: memory_pool) {
-		for (auto v: m.second) {
-			delete [] v;
-			count++;
-			total+=m.first;
+	if (auto cache = current_cache()) {
+		drain_remote(*cache);
+		for (auto& list: cache->blocks) {
+			for (auto mem: list.second) {
+				put_global(cache->node, list.first, mem);
+			}
 		}
+		cache->blocks.clear();
+		cache->bytes = 0;
+		cache->cached_blocks = 0;
+		cache->cached_bytes = 0;
+	}
+	for (auto& pool: pool_state().pools) {
+		lock_t l(pool->lock);
+		for (auto& m: pool->blocks) {
+			for (auto v: m.second) {
+				free_block(v, m.first);
+				count++;
+				total+=m.first;
+			}
+		}
+		pool->blocks.clear();
 	}
-	memory_pool.clear();
 	return std::make_pair(count, total);
 }
 
+memory_pool_stats_t FixedMemoryAllocator::get_statistics()
+{
+	auto& state = pool_state();
+	memory_pool_stats_t stats;
+	stats.local_hits = state.local_hits;
+	stats.global_hits = state.global_hits;
+	stats.misses = state.misses;
+	stats.remote_returns = state.remote_returns;
+	size_t blocks_out = state.blocks_out;
+	size_t bytes_out = state.bytes_out;
+	size_t blocks_back = state.blocks_back;
+	size_t bytes_back = state.bytes_back;
+	stats.blocks_free = 0;
+	stats.bytes_free = 0;
+	{
+		lock_t _(state.registry_lock);
+		auto& registry = state.registry;
+		for (auto it = registry.begin(); it != registry.end();) {
+			auto cache = it->lock();
+			if (!cache) {
+				it = registry.erase(it);
+				continue;
+			}
+			stats.local_hits += cache->local_hits;
+			stats.global_hits += cache->global_hits;
+			stats.misses += cache->misses;
+			stats.remote_returns += cache->remote_returns;
+			blocks_out += cache->blocks_out;
+			bytes_out += cache->bytes_out;
+			blocks_back += cache->blocks_back;
+			bytes_back += cache->bytes_back;
+			stats.blocks_free += cache->cached_blocks;
+			stats.bytes_free += cache->cached_bytes;
+			++it;
+		}
+	}
+	for (auto& pool: state.pools) {
+		lock_t l(pool->lock);
+		for (const auto& m: pool->blocks) {
+			stats.blocks_free += m.second.size();
+			stats.bytes_free += m.second.size() * m.first;
+		}
+	}
+	// Blocks still waiting in remote lists are counted as used
+	stats.blocks_in_use = blocks_out > blocks_back ? blocks_out - blocks_back : 0;
+	stats.bytes_in_use = bytes_out > bytes_back ? bytes_out - bytes_back : 0;
+	return stats;
+}
+
 /** \brief Returns specified block of memory to the memory pool.
+ *
+ * Blocks allocated in the current thread go directly into its cache,
+ * blocks from other threads are passed back to the thread that allocated them.
  *
  * \param mem pointer to the memory block to be deleted.
  */
@@ -214,7 +649,11 @@ void FixedMemoryAllocator::Deleter::operator()(void *mem) const noexcept
 {
 	assert(mem==original_pointer);
 	try { //We should NOT throw here...
-		FixedMemoryAllocator::return_memory(size,reinterpret_cast<uint8_t*>(mem));
+		if (owner && !owner->retired && (cache_holder_destroyed || owner != cache_holder.cache)) {
+			push_remote(*owner, size, reinterpret_cast<uint8_t*>(mem));
+		} else {
+			FixedMemoryAllocator::return_memory(size,reinterpret_cast<uint8_t*>(mem));
+		}
 	} catch(...){}
 }
 
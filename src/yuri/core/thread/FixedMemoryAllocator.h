@@ -12,6 +12,13 @@
  *  reclaiming unused blocks back to pool.
  *  It does NOT explicitly deallocate block unless asked to!!
  *  This could lead to potentially high memory consumption.
+ *
+ *  Requested sizes are rounded up to size classes (64B, page or hugepage multiples),
+ *  blocks are aligned at least to 64B (blocks of a page and larger to pages,
+ *  so they can be used for direct I/O). Every thread keeps a small cache
+ *  of blocks, so most allocations don't need to lock the global pool.
+ *  Blocks released in other threads are passed back to the owning thread
+ *  through a lock-free list. New blocks are allocated on the local NUMA node.
  */
 
 #ifndef FIXEDMEMORYALLOCATOR_H_
@@ -23,18 +30,50 @@ namespace yuri {
 namespace core {
 
 
+/*!
+ * Statistics of the memory pool
+ */
+struct memory_pool_stats_t {
+	/**\brief Requests served from a thread local cache */
+	yuri::size_t local_hits;
+	/**\brief Requests served from the global pool */
+	yuri::size_t global_hits;
+	/**\brief Requests that had to allocate a new block */
+	yuri::size_t misses;
+	/**\brief Blocks returned from other thread than the one that allocated them */
+	yuri::size_t remote_returns;
+	/**\brief Blocks currently used by the application */
+	yuri::size_t blocks_in_use;
+	/**\brief Bytes currently used by the application */
+	yuri::size_t bytes_in_use;
+	/**\brief Free blocks in the global pool and thread caches */
+	yuri::size_t blocks_free;
+	/**\brief Free bytes in the global pool and thread caches */
+	yuri::size_t bytes_free;
+
+	double hit_rate() const {
+		const auto total = local_hits + global_hits + misses;
+		return total ? static_cast<double>(local_hits + global_hits) / total : 0.0;
+	}
+};
+
 class FixedMemoryAllocator: public IOThread {
 public:
+	/**\brief Cache of free blocks owned by a single thread */
+	struct ThreadCache;
 	struct Deleter {
 		Deleter(yuri::size_t size, uint8_t *original_pointer):
 			size(size),original_pointer(original_pointer) {}
-		Deleter(const Deleter& d)noexcept:size(d.size),original_pointer(d.original_pointer) {}
+		Deleter(yuri::size_t size, uint8_t *original_pointer, std::shared_ptr<ThreadCache> owner):
+			size(size),original_pointer(original_pointer),owner(std::move(owner)) {}
+		Deleter(const Deleter& d)noexcept:size(d.size),original_pointer(d.original_pointer),owner(d.owner) {}
 		void operator()(void *mem) const noexcept;
 		/**\brief Size of block associated with this object */
 		yuri::size_t size;
 		/**\brief Pointer to the memory block associated with this object */
 		uint8_t *original_pointer;
-
+		/**\brief Cache of the thread that allocated the block (may be empty) */
+		std::shared_ptr<ThreadCache> owner;
 	};
 	typedef std::pair<uint8_t*, struct Deleter> memory_block_t;
 	IOTHREAD_GENERATOR_DECLARATION
@@ -47,16 +86,19 @@ public:
 	EXPORT static bool remove_blocks(yuri::size_t size, yuri::size_t count=0);
 	EXPORT static size_t preallocated_blocks(size_t size);
 	EXPORT static std::pair<size_t, size_t> clear_all();
+	/*!
+	 * Returns actual statistics of the pool.
+	 * Values are collected from all threads without stopping them, so they're only approximate.
+	 */
+	EXPORT static memory_pool_stats_t get_statistics();
+	/*!
+	 * @return size of block that will be actually allocated for a request of @em size bytes.
+	 */
+	EXPORT static yuri::size_t get_size_class(yuri::size_t size);
 private:
 
 	bool step();
 	EXPORT virtual bool set_param(const Parameter &parameter);
-	static bool do_allocate_blocks(yuri::size_t size, yuri::size_t count);
-
-	/**\brief Global mutex protecting the pool */
-	static mutex mem_lock;
-	/**\brief Global memory pool */
-	static std::map<yuri::size_t, std::vector<uint8_t* > > memory_pool;
 	/**\brief Size of the blocks this object allocates */
 	yuri::size_t block_size;
 	/**\brief Number of the blocks this object allocates */
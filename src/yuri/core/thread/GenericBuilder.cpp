@@ -11,6 +11,7 @@
 #include "yuri/core/thread/IOThreadGenerator.h"
 #include "yuri/core/pipe/PipeGenerator.h"
 #include "yuri/core/utils/irange.h"
+#include "yuri/core/utils/tracing.h"
 namespace yuri {
 namespace core {
 
@@ -55,6 +56,10 @@ bool GenericBuilder::prepare_nodes()
 		Parameters params = IOThreadGenerator::get_instance().configure(class_name);
 		params.merge(record.parameters);
 		params["_node_name"]=name;
+		if (!node_scheduler_.empty() && std::none_of(record.parameters.begin(), record.parameters.end(),
+				[](const Parameters::map_type::value_type& p){ return p.first == "scheduler"; })) {
+			params["scheduler"]=node_scheduler_;
+		}
 		if (!(record.instance = IOThreadGenerator::get_instance().generate(class_name, log, get_this_ptr(), params))) {
 			return false;
 		}
@@ -155,12 +160,29 @@ bool GenericBuilder::do_process_event(const std::string& event_name, const event
 	if (event_name == "stop") {
 		log[log::info] << "Received stop event. Quitting builder.";
 		request_end(yuri_exit_interrupted);
+	} else if (event_name == "trace_dump") {
+		if (tracing::dump()) log[log::info] << "Trace written";
+		else log[log::warning] << "Failed to write trace";
 	}
 	emit_event(event_name, event);
 	return BasicEventParser::do_process_event(event_name, event);
 }
 
 
+bool GenericBuilder::set_param(const Parameter& parameter)
+{
+	if (parameter.get_name() == "scheduler") {
+		node_scheduler_ = parameter.get<std::string>();
+		return true;
+	}
+	if (parameter.get_name() == "trace") {
+		const auto filename = parameter.get<std::string>();
+		if (!filename.empty()) tracing::start(filename);
+		return true;
+	}
+	return IOThread::set_param(parameter);
+}
+
 bool GenericBuilder::step()
 {
 	process_events();
@@ -54,6 +54,11 @@ public:
 
 protected:
 	EXPORT void set_graph(node_map nodes, link_map links, std::string routing = {});
+	/*!
+	 * The builder itself always runs in own thread, 'scheduler' parameter
+	 * sets the default scheduling for the nodes instead.
+	 */
+	EXPORT virtual bool set_param(const Parameter& parameter) override;
 private:
 	EXPORT virtual	void do_connect_in(position_t position, pPipe pipe) override;
 	EXPORT virtual	void do_connect_out(position_t position, pPipe pipe) override;
@@ -62,6 +67,7 @@ private:
 	node_map nodes_;
 	link_map links_;
 	std::string routing_;
+	std::string node_scheduler_;
 
 	bool start_links();
 	bool prepare_nodes();
@@ -10,6 +10,7 @@
 
 #include "IOFilter.h"
 #include "Convert.h"
+#include "yuri/core/utils/tracing.h"
 #include <cassert>
 
 namespace yuri {
@@ -35,6 +36,7 @@ IOFilter::~IOFilter() noexcept
 
 pFrame	IOFilter::simple_single_step(pFrame frame)
 {
+	tracing::Span span(get_trace_name(), "filter", frame->get_index());
 	return do_simple_single_step(std::move(frame));
 }
 
@@ -9,10 +9,13 @@
  */
 
 #include "IOThread.h"
+#include "Scheduler.h"
 #include "yuri/exception/NotImplemented.h"
 #include "yuri/core/frame/Frame.h"
 #include "yuri/core/pipe/Pipe.h"
 #include "yuri/core/utils/assign_parameters.h"
+#include "yuri/core/utils/environment.h"
+#include "yuri/core/utils/tracing.h"
 #include <algorithm>
 #include <stdexcept>
 #include <numeric>
@@ -25,11 +28,15 @@ Parameters IOThread::configure()
 {
     auto p                                                                        = ThreadBase::configure();
     p["fps_stats"]["Print out_ current FPS every n frames. Set to 0 to disable."] = 0;
+    p["scheduler"]["How to run the node. 'thread' runs it in own thread, 'pool' steps it on a shared thread pool whenever data arrives. "
+                   "Only nodes using the default IOThread loop can run in pool. Default can be set by environment variable YURI_SCHEDULER."]
+        = utils::get_environment_variable("YURI_SCHEDULER", "thread");
     return p;
 }
 
 IOThread::IOThread(const log::Log& log_, pwThreadBase parent, position_t inp, position_t outp, const std::string& id)
-    : ThreadBase(log_, parent, id), in_ports_(inp), out_ports_(outp), latency_(200_ms), active_pipes_(0), fps_stats_(0)
+    : ThreadBase(log_, parent, id), in_ports_(inp), out_ports_(outp), latency_(200_ms), active_pipes_(0), fps_stats_(0),
+      pool_requested_(false), scheduled_(false), sched_state_(0), sched_generation_(0), trace_name_(nullptr)
 
 {
     TRACE_METHOD
@@ -46,6 +53,22 @@ IOThread::~IOThread() noexcept
 void IOThread::run()
 {
     TRACE_METHOD
+    const auto& name = get_node_instance_name().empty() ? get_node_id() : get_node_instance_name();
+    metrics_         = metrics::register_node(name, get_node_id());
+    trace_name_      = tracing::intern(name);
+    if (pool_requested_) {
+        // Steps will be executed by the scheduler, so the thread is not needed anymore.
+        log[log::debug] << "Running on shared scheduler";
+        auto self = std::static_pointer_cast<IOThread>(get_this_ptr());
+        // Has to be set before scheduled_, notify_hook() reads it only after checking scheduled_
+        sched_self_ = self;
+        scheduled_  = true;
+        detach_run();
+        Scheduler::get_instance().add_node(std::move(self));
+        return;
+    }
+    // The trace buffer is allocated only with the first span, so the name is set even when tracing is inactive yet
+    tracing::set_thread_name(trace_name_);
     try {
         while (still_running()) {
             if (!active_pipes_ /*&& in_ports_ */) {
@@ -55,7 +78,7 @@ void IOThread::run()
                 wait_for(latency_);
             }
             //			log[log::verbose_debug] << "Stepping";
-            if (!step())
+            if (!measured_step())
                 break;
         }
     } catch (std::runtime_error& e) {
@@ -65,6 +88,58 @@ void IOThread::run()
     close_pipes();
 }
 
+bool IOThread::scheduled_step()
+{
+    TRACE_METHOD
+    try {
+        if (!still_running())
+            return false;
+        // Called for the side effect of releasing finished pipes
+        pipes_data_available();
+        return measured_step();
+    } catch (std::runtime_error& e) {
+        log[log::debug] << "Thread failed: " << e.what();
+    }
+    return false;
+}
+
+bool IOThread::measured_step()
+{
+    metrics_->steps.fetch_add(1, std::memory_order_relaxed);
+    tracing::Span span(trace_name_, "step");
+    if (!metrics::enabled())
+        return step();
+    const timestamp_t start;
+    const bool        ret = step();
+    metrics_->step_time.record(timestamp_t{} - start);
+    return ret;
+}
+
+void IOThread::finish_scheduled()
+{
+    TRACE_METHOD
+    close_pipes();
+    finish_detached_run();
+}
+
+bool IOThread::run_consumer(const pPipe& pipe)
+{
+    auto consumer = std::dynamic_pointer_cast<IOThread>(pipe->get_notifiable());
+    if (!consumer || !consumer->is_scheduled())
+        return false;
+    return Scheduler::get_instance().run_node(consumer);
+}
+
+void IOThread::notify_hook()
+{
+    if (!scheduled_ || !running())
+        return;
+    // The node may be just being destroyed, so it can't use shared_from_this() here
+    if (auto self = sched_self_.lock()) {
+        Scheduler::get_instance().schedule(self);
+    }
+}
+
 // Dummy IOThread::step(), so inherited classes don't have to override it if not needed.
 bool IOThread::step()
 {
@@ -146,8 +221,11 @@ bool IOThread::push_frame(position_t index, pFrame frame)
         if (fps_stats_) {
             frame_sizes_[index] += frame->get_size();
         }
-        while (!out_[index]->push_frame(std::move(frame))) {
-            wait_for(latency_);
+        while (!out_[index]->push_frame(frame)) {
+            // All workers may be waiting for their consumers, so the consumer of the full pipe
+            // is stepped right here. Running any other node could end up waiting for this one.
+            if (!scheduled_ || !run_consumer(out_[index]))
+                wait_for(latency_);
             if (!still_running())
                 return false;
         }
@@ -226,6 +304,14 @@ bool IOThread::set_param(const Parameter& parameter)
         (fps_stats_, "fps_stats")    //
         )
         return true;
+    if (parameter.get_name() == "scheduler") {
+        const auto mode = parameter.get<std::string>();
+        if (mode != "thread" && mode != "pool") {
+            log[log::warning] << "Unknown scheduler '" << mode << "', using own thread";
+        }
+        pool_requested_ = mode == "pool";
+        return true;
+    }
     return ThreadBase::set_param(parameter);
 }
 
@@ -24,6 +24,7 @@
 #include "yuri/core/thread/PipeConnector.h"
 //#include "yuri/core/BasicIOMacros.h"
 #include "yuri/core/thread/ThreadBase.h"
+#include "yuri/core/utils/metrics.h"
 
 namespace yuri {
 namespace core {
@@ -111,6 +112,12 @@ public:
      */
     EXPORT virtual bool set_param(const Parameter& parameter) override;
 
+    /*!
+     * @return true if the node runs on the shared core::Scheduler
+     * instead of in its own thread. Nodes overriding run() are never scheduled.
+     */
+    EXPORT bool is_scheduled() const noexcept { return scheduled_; }
+
     /* ****************************************************************************
      * 							Protected API
      **************************************************************************** */
@@ -230,7 +237,33 @@ protected:
      *
      */
     EXPORT void reset_indices();
+
+    /*!
+     * Returns name of the node used in the trace (valid once the node is running)
+     */
+    const char* get_trace_name() const noexcept { return trace_name_; }
+
 private:
+    friend class Scheduler;
+    /*!
+     * Single iteration of IOThread::run() loop, executed by core::Scheduler.
+     * @return false when the node should finish.
+     */
+    bool scheduled_step();
+    /*!
+     * Calls step() and records its duration into node metrics and the trace.
+     */
+    bool measured_step();
+    /*!
+     * Finishes the node after the last scheduled step.
+     */
+    void finish_scheduled();
+    /*!
+     * Steps the node consuming from @em pipe, when it runs in the scheduler and isn't running already.
+     */
+    bool run_consumer(const pPipe& pipe);
+    EXPORT virtual void notify_hook() override;
+
     position_t                 in_ports_;
     position_t                 out_ports_;
     mutex                      port_lock_;
@@ -246,6 +279,16 @@ private:
     std::vector<timestamp_t>  first_frame_;
     Timer                     pts_timer_;
     std::vector<size_t>       next_indices_;
+
+    bool                      pool_requested_;
+    std::atomic<bool>         scheduled_;
+    //! Weak pointer to itself, valid once the node is scheduled
+    std::weak_ptr<IOThread>   sched_self_;
+    std::atomic<int>          sched_state_;
+    std::atomic<size_t>       sched_generation_;
+
+    metrics::pNodeMetrics     metrics_;
+    const char*               trace_name_;
 };
 }
 }
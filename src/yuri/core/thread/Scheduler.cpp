@@ -0,0 +1,250 @@
+/*!
+ * @file 		Scheduler.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "Scheduler.h"
+#include "yuri/core/thread/IOThread.h"
+#include "yuri/core/utils/environment.h"
+#include "yuri/core/utils.h"
+#ifdef YURI_LINUX
+#include <pthread.h>
+#endif
+
+namespace yuri {
+namespace core {
+
+namespace {
+
+enum node_state_t : int {
+	state_idle 		= 0,
+	state_queued,
+	state_running,
+	state_running_notified,
+	state_finished
+};
+
+// Index of the worker running in current thread, -1 for threads outside of the pool
+thread_local int current_worker = -1;
+
+size_t default_thread_count()
+{
+	const auto env = utils::get_environment_variable("YURI_SCHEDULER_THREADS");
+	if (!env.empty()) {
+		try {
+			if (const auto count = lexical_cast<size_t>(env)) return count;
+		}
+		catch (bad_lexical_cast&) {}
+	}
+	return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void set_thread_name(const std::string& name)
+{
+#ifdef YURI_LINUX
+	pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+	(void)name;
+#endif
+}
+
+}
+
+Scheduler& Scheduler::get_instance()
+{
+	static Scheduler scheduler(default_thread_count());
+	return scheduler;
+}
+
+Scheduler::Scheduler(size_t threads)
+:quit_(false),pending_(0),next_queue_(0)
+{
+	threads = std::max<size_t>(threads, 1);
+	for (size_t i = 0; i < threads; ++i) {
+		queues_.emplace_back(new worker_queue_t);
+	}
+	for (size_t i = 0; i < threads; ++i) {
+		workers_.emplace_back([this, i]{ worker_loop(i); });
+	}
+	timer_thread_ = std::thread([this]{ timer_loop(); });
+}
+
+Scheduler::~Scheduler() noexcept
+{
+	quit_ = true;
+	{
+		lock_t _(idle_lock_);
+	}
+	idle_cv_.notify_all();
+	{
+		lock_t _(timer_lock_);
+	}
+	timer_cv_.notify_all();
+	for (auto& w: workers_) {
+		if (w.joinable()) w.join();
+	}
+	if (timer_thread_.joinable()) timer_thread_.join();
+}
+
+void Scheduler::add_node(pIOThread node)
+{
+	node->sched_state_ = state_idle;
+	schedule(node);
+}
+
+void Scheduler::schedule(const pIOThread& node)
+{
+	auto state = node->sched_state_.load();
+	while (true) {
+		if (state == state_idle) {
+			if (node->sched_state_.compare_exchange_weak(state, state_queued)) {
+				enqueue(node);
+				return;
+			}
+		} else if (state == state_running) {
+			if (node->sched_state_.compare_exchange_weak(state, state_running_notified)) {
+				return;
+			}
+		} else {
+			// Already queued, or it will be stepped again anyway
+			return;
+		}
+	}
+}
+
+bool Scheduler::run_node(const pIOThread& node)
+{
+	if (!claim(node, false)) return false;
+	execute(node);
+	return true;
+}
+
+bool Scheduler::claim(const pIOThread& node, bool only_queued)
+{
+	auto state = node->sched_state_.load();
+	while (state == state_queued || (!only_queued && state == state_idle)) {
+		if (node->sched_state_.compare_exchange_weak(state, state_running)) return true;
+	}
+	return false;
+}
+
+void Scheduler::enqueue(pIOThread node)
+{
+	// Keep the node local to current worker, if there's any
+	const auto index = current_worker >= 0 ?
+			static_cast<size_t>(current_worker) :
+			next_queue_++ % queues_.size();
+	{
+		auto& queue = *queues_[index];
+		lock_t _(queue.lock);
+		queue.nodes.push_back(std::move(node));
+	}
+	pending_++;
+	{
+		lock_t _(idle_lock_);
+	}
+	idle_cv_.notify_one();
+}
+
+bool Scheduler::pop_node(pIOThread& node)
+{
+	if (!pending_) return false;
+	const auto count = queues_.size();
+	const auto own = current_worker >= 0 ? static_cast<size_t>(current_worker) : 0;
+	for (size_t i = 0; i < count; ++i) {
+		auto& queue = *queues_[(own + i) % count];
+		lock_t _(queue.lock);
+		if (queue.nodes.empty()) continue;
+		if (i == 0 && current_worker >= 0) {
+			// Newest node from own queue, it's most likely to have data in cache
+			node = std::move(queue.nodes.back());
+			queue.nodes.pop_back();
+		} else {
+			// Steal the oldest one from others
+			node = std::move(queue.nodes.front());
+			queue.nodes.pop_front();
+		}
+		pending_--;
+		return true;
+	}
+	return false;
+}
+
+void Scheduler::execute(pIOThread node)
+{
+	// The node has to be claimed (in state_running) already
+	++node->sched_generation_;
+	if (!node->scheduled_step()) {
+		node->sched_state_ = state_finished;
+		node->finish_scheduled();
+		return;
+	}
+	int state = state_running;
+	// Same as IOThread::run(), step again right away while there's data on input
+	if (!node->pipes_data_available() &&
+			node->sched_state_.compare_exchange_strong(state, state_idle)) {
+		arm_timer(node);
+	} else {
+		node->sched_state_ = state_queued;
+		enqueue(std::move(node));
+	}
+}
+
+void Scheduler::arm_timer(const pIOThread& node)
+{
+	const auto deadline = sched_clock::now() +
+			std::chrono::microseconds(node->get_latency().value);
+	lock_t _(timer_lock_);
+	const bool earliest = timers_.empty() || deadline < timers_.top().deadline;
+	timers_.push({deadline, node, node->sched_generation_.load()});
+	if (earliest) timer_cv_.notify_one();
+}
+
+void Scheduler::worker_loop(size_t index)
+{
+	set_thread_name("yuri_sched_" + lexical_cast<std::string>(index));
+	current_worker = static_cast<int>(index);
+	while (!quit_) {
+		pIOThread node;
+		if (pop_node(node)) {
+			if (claim(node, true)) execute(std::move(node));
+			continue;
+		}
+		lock_t lock(idle_lock_);
+		idle_cv_.wait(lock, [this]{ return quit_ || pending_ > 0; });
+	}
+}
+
+void Scheduler::timer_loop()
+{
+	set_thread_name("yuri_sched_tm");
+	lock_t lock(timer_lock_);
+	while (!quit_) {
+		if (timers_.empty()) {
+			timer_cv_.wait(lock);
+			continue;
+		}
+		const auto deadline = timers_.top().deadline;
+		if (sched_clock::now() < deadline) {
+			timer_cv_.wait_until(lock, deadline);
+			continue;
+		}
+		auto wakeup = timers_.top();
+		timers_.pop();
+		lock.unlock();
+		// Nodes stepped since the timer was armed don't need the wakeup
+		if (auto node = wakeup.node.lock()) {
+			if (node->sched_generation_ == wakeup.generation) {
+				schedule(node);
+			}
+		}
+		lock.lock();
+	}
+}
+
+}
+}
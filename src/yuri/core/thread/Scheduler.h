@@ -0,0 +1,111 @@
+/*!
+ * @file 		Scheduler.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include "yuri/core/forward.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <queue>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+/*!
+ * Shared work-stealing pool executing steps of IOThreads running
+ * in 'pool' scheduling mode.
+ *
+ * A node is stepped whenever it gets a pipe notification, or when it wasn't
+ * stepped for its latency. A single node is never stepped concurrently.
+ * Steps scheduled from a worker are queued to that worker, so a consumer
+ * usually runs on the same core right after its producer.
+ */
+class Scheduler {
+public:
+	/*!
+	 * Returns the process wide scheduler. It is created on first use with
+	 * number of workers set by environment variable YURI_SCHEDULER_THREADS,
+	 * or equal to the number of cores.
+	 */
+	EXPORT static Scheduler&	get_instance();
+
+	EXPORT 						Scheduler(size_t threads);
+	EXPORT 						~Scheduler() noexcept;
+								Scheduler(const Scheduler&) = delete;
+	Scheduler&					operator=(const Scheduler&) = delete;
+
+	/*!
+	 * Starts stepping a node. The node is kept alive until its step fails
+	 * or it's requested to end.
+	 */
+	EXPORT void					add_node(pIOThread node);
+	/*!
+	 * Requests a step of a node. Has no effect for nodes already queued,
+	 * running nodes will be stepped once more after current step finishes.
+	 */
+	EXPORT void					schedule(const pIOThread& node);
+	/*!
+	 * Executes a step of @em node in the calling thread, if it's not running already.
+	 * Intended for nodes waiting for their consumer inside their own step,
+	 * so the consumer can make progress even when all workers are waiting.
+	 * Only consumers should be run this way, running any other node
+	 * could wait for the blocked node itself.
+	 *
+	 * @return true if a step was executed
+	 */
+	EXPORT bool					run_node(const pIOThread& node);
+	EXPORT size_t				get_thread_count() const noexcept { return workers_.size(); }
+private:
+	struct worker_queue_t {
+		mutex					lock;
+		std::deque<pIOThread>	nodes;
+	};
+	using sched_clock = std::chrono::steady_clock;
+	struct wakeup_t {
+		sched_clock::time_point	deadline;
+		std::weak_ptr<IOThread>	node;
+		size_t					generation;
+		bool operator<(const wakeup_t& rhs) const { return deadline > rhs.deadline; }
+	};
+
+	void						enqueue(pIOThread node);
+	bool						pop_node(pIOThread& node);
+	/*!
+	 * Marks a queued node (or also an idle one, unless @em only_queued is set) as running.
+	 * Queue entries of nodes that were claimed elsewhere are stale and get skipped.
+	 */
+	bool						claim(const pIOThread& node, bool only_queued);
+	void						execute(pIOThread node);
+	void						arm_timer(const pIOThread& node);
+	void						worker_loop(size_t index);
+	void						timer_loop();
+
+	std::vector<std::unique_ptr<worker_queue_t>>
+								queues_;
+	std::vector<std::thread>	workers_;
+	std::atomic<bool>			quit_;
+	std::atomic<size_t>			pending_;
+	std::atomic<size_t>			next_queue_;
+	mutex						idle_lock_;
+	std::condition_variable		idle_cv_;
+
+	mutex						timer_lock_;
+	std::condition_variable		timer_cv_;
+	std::priority_queue<wakeup_t>
+								timers_;
+	std::thread					timer_thread_;
+};
+
+}
+}
+
+#endif /* SCHEDULER_H_ */
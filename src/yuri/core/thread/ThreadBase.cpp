@@ -49,6 +49,7 @@ ThreadBase::ThreadBase(const log::Log& _log, pwThreadBase parent, const std::str
       /*lastChild(0),*/ /*finishWhenChildEnds(false),*/ /*quitWhenChildsEnd(true),*/ // own_tid(0),
       cpu_affinity_(-1),
       running_(false),
+      detached_(false),
       node_id_(id)
 {
 }
@@ -72,6 +73,16 @@ void ThreadBase::operator()()
     running_ = true;
     log[verbose_debug] << "Starting thread";
     run();
+    if (detached_) {
+        log[verbose_debug] << "Thread detached from its OS thread";
+        return;
+    }
+    finish_detached_run();
+}
+
+void ThreadBase::finish_detached_run()
+{
+    TRACE_METHOD
     log[verbose_debug] << "Thread finished execution";
     request_end(yuri_exit_finished);
     running_ = false;
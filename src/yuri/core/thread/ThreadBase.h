@@ -147,6 +147,22 @@ protected:
 	EXPORT virtual bool 		set_param(const Parameter &parameter);
 	template<typename T> bool 	set_param(const std::string& name, const T& value);
 	EXPORT std::string			get_node_name() const;
+	//! Returns identifier of the node class
+	EXPORT const std::string&	get_node_id() const noexcept { return node_id_; }
+	//! Returns name of the node set by the builder (empty for nodes created directly)
+	EXPORT const std::string&	get_node_instance_name() const noexcept { return node_name_; }
+
+	/*!
+	 * Tells ::operator()() that the Thread continues running after ::run() returned,
+	 * driven by some other entity (eg. core::Scheduler). The OS thread is released then.
+	 * Such a Thread has to call ::finish_detached_run() when it finishes.
+	 */
+	EXPORT void					detach_run() noexcept { detached_ = true; }
+	/*!
+	 * Finishes a Thread that detached from its OS thread.
+	 * Does the same as ::operator()() does after ::run() returns.
+	 */
+	EXPORT void					finish_detached_run();
 private:
 	bool 						do_spawn_thread(pThreadBase  thread);
 	bool 						do_add_child(pThreadBase  thread, bool spawned=true);
@@ -180,6 +196,7 @@ private:
 	mutex						ending_childs_mutex_;
 	position_t	 				cpu_affinity_;
 	std::atomic<bool>			running_;
+	std::atomic<bool>			detached_;
 	std::string 				node_id_;
 	std::string					node_name_;
 
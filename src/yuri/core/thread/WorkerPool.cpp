@@ -0,0 +1,168 @@
+/*!
+ * @file 		WorkerPool.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "WorkerPool.h"
+#include "yuri/core/utils/environment.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#ifdef YURI_LINUX
+#include <pthread.h>
+#endif
+
+namespace yuri {
+namespace core {
+
+namespace {
+
+// Data processed by a band of lines (input and output together)
+const size_t band_bytes = 256 * 1024;
+// Minimal amount of data for a single thread
+const size_t min_thread_bytes = 512 * 1024;
+
+size_t default_thread_count()
+{
+	const auto env = utils::get_environment_variable("YURI_WORKER_THREADS");
+	if (!env.empty()) {
+		try {
+			return lexical_cast<size_t>(env);
+		}
+		catch (bad_lexical_cast&) {}
+	}
+	return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+}
+
+}
+
+WorkerPool& WorkerPool::get_instance()
+{
+	static WorkerPool pool(default_thread_count());
+	return pool;
+}
+
+WorkerPool::WorkerPool(size_t threads)
+:quit_(false)
+{
+	for (size_t i = 0; i < threads; ++i) {
+		workers_.emplace_back([this]{ worker_loop(); });
+	}
+}
+
+WorkerPool::~WorkerPool() noexcept
+{
+	{
+		lock_t _(lock_);
+		quit_ = true;
+	}
+	cv_.notify_all();
+	for (auto& w: workers_) {
+		if (w.joinable()) w.join();
+	}
+}
+
+void WorkerPool::parallel_for(size_t count, size_t grain, size_t threads,
+		const std::function<void(size_t, size_t)>& func)
+{
+	if (!count) return;
+	grain = std::max<size_t>(grain, 1);
+	const size_t chunks = (count + grain - 1) / grain;
+	// The calling thread processes chunks too
+	const size_t helpers = threads ? std::min({threads, chunks, workers_.size() + 1}) - 1 : 0;
+	if (!helpers) {
+		func(0, count);
+		return;
+	}
+	auto job = std::make_shared<job_t>(count, grain, helpers, func);
+	{
+		lock_t _(lock_);
+		jobs_.push_back(job);
+	}
+	if (helpers == 1) {
+		cv_.notify_one();
+	} else {
+		cv_.notify_all();
+	}
+	run_chunks(*job);
+	{
+		lock_t l(job->lock);
+		job->done.wait(l, [&job]{ return job->finished == job->chunks; });
+	}
+	{
+		// Remove the job, if no helper picked it up
+		lock_t _(lock_);
+		auto it = std::find(jobs_.begin(), jobs_.end(), job);
+		if (it != jobs_.end()) jobs_.erase(it);
+	}
+	if (job->error) std::rethrow_exception(job->error);
+}
+
+void WorkerPool::run_chunks(job_t& job)
+{
+	while (true) {
+		const auto chunk = job.next++;
+		if (chunk >= job.chunks) break;
+		const auto begin = chunk * job.grain;
+		try {
+			job.func(begin, std::min(begin + job.grain, job.count));
+		}
+		catch (...) {
+			lock_t _(job.lock);
+			if (!job.error) job.error = std::current_exception();
+		}
+		if (++job.finished == job.chunks) {
+			lock_t _(job.lock);
+			job.done.notify_all();
+		}
+	}
+}
+
+void WorkerPool::worker_loop()
+{
+#ifdef YURI_LINUX
+	pthread_setname_np(pthread_self(), "yuri_workers");
+#endif
+	while (true) {
+		pJob job;
+		{
+			lock_t l(lock_);
+			cv_.wait(l, [this]{ return quit_ || !jobs_.empty(); });
+			if (quit_) return;
+			job = jobs_.front();
+			if (!--job->helpers) jobs_.pop_front();
+		}
+		run_chunks(*job);
+	}
+}
+
+size_t get_band_lines(size_t bytes_per_line)
+{
+	return std::max<size_t>(1, band_bytes / std::max<size_t>(bytes_per_line, 1));
+}
+
+size_t get_auto_threads(size_t threads, size_t bytes)
+{
+	if (threads) return threads;
+	const auto max_threads = WorkerPool::get_instance().get_thread_count() + 1;
+	return std::max<size_t>(1, std::min(max_threads, bytes / min_thread_bytes));
+}
+
+void parallel_for_lines(size_t lines, size_t bytes_per_line, size_t threads,
+		const std::function<void(size_t, size_t)>& func)
+{
+	threads = get_auto_threads(threads, lines * bytes_per_line);
+	if (threads < 2) {
+		func(0, lines);
+		return;
+	}
+	// Smaller bands, when there's too few of them to keep all threads busy
+	const auto band = std::min(get_band_lines(bytes_per_line), std::max<size_t>(1, lines / (threads * 2)));
+	WorkerPool::get_instance().parallel_for(lines, band, threads, func);
+}
+
+}
+}
@@ -0,0 +1,111 @@
+/*!
+ * @file 		WorkerPool.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include "yuri/core/utils/new_types.h"
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+/*!
+ * Pool of long-lived threads for data parallel processing of frames.
+ *
+ * Work is split into chunks, the calling thread processes chunks as well,
+ * so it's safe to use the pool recursively or from inside a worker.
+ */
+class WorkerPool {
+public:
+	/*!
+	 * Returns the process wide pool. It is created on first use with
+	 * number of threads set by environment variable YURI_WORKER_THREADS,
+	 * or equal to the number of cores minus one (for the calling thread).
+	 */
+	EXPORT static WorkerPool&	get_instance();
+
+	EXPORT 						WorkerPool(size_t threads);
+	EXPORT 						~WorkerPool() noexcept;
+								WorkerPool(const WorkerPool&) = delete;
+	WorkerPool&					operator=(const WorkerPool&) = delete;
+
+	/*!
+	 * Calls @em func(begin, end) for all chunks of @em grain items in range [0, count)
+	 * and waits for them to finish. Exception thrown from any chunk is rethrown here.
+	 *
+	 * @param count Number of items to process
+	 * @param grain Number of items in a single chunk
+	 * @param threads Max. number of threads to use, including the calling one
+	 * @param func Function processing a chunk
+	 */
+	EXPORT void					parallel_for(size_t count, size_t grain, size_t threads,
+									const std::function<void(size_t, size_t)>& func);
+	EXPORT size_t				get_thread_count() const noexcept { return workers_.size(); }
+private:
+	struct job_t {
+		job_t(size_t count, size_t grain, size_t helpers, const std::function<void(size_t, size_t)>& func)
+			:count(count),grain(grain),chunks((count + grain - 1) / grain),helpers(helpers),func(func),
+			 next(0),finished(0) {}
+		const size_t		count;
+		const size_t		grain;
+		const size_t		chunks;
+		size_t				helpers;
+		const std::function<void(size_t, size_t)>& func;
+		std::atomic<size_t>	next;
+		std::atomic<size_t>	finished;
+		mutex				lock;
+		std::condition_variable done;
+		std::exception_ptr	error;
+	};
+	using pJob = std::shared_ptr<job_t>;
+
+	void						run_chunks(job_t& job);
+	void						worker_loop();
+
+	std::vector<std::thread>	workers_;
+	bool						quit_;
+	mutex						lock_;
+	std::condition_variable		cv_;
+	std::deque<pJob>			jobs_;
+};
+
+/*!
+ * Returns number of lines to process together, so a band of input
+ * and output lines fits into L2 cache.
+ *
+ * @param bytes_per_line Size of an input and output line together
+ */
+EXPORT size_t get_band_lines(size_t bytes_per_line);
+
+/*!
+ * Returns number of threads to use for processing of @em bytes of data.
+ * Nonzero @em threads is returned unchanged, for 0 the count is selected,
+ * so every thread gets enough work to outweigh the synchronization.
+ */
+EXPORT size_t get_auto_threads(size_t threads, size_t bytes);
+
+/*!
+ * Processes @em lines lines of an image in cache sized bands on the shared WorkerPool.
+ *
+ * @param lines Number of lines to process
+ * @param bytes_per_line Size of an input and output line together
+ * @param threads Number of threads to use, 0 to select it automatically
+ * @param func Function processing lines [begin, end)
+ */
+EXPORT void parallel_for_lines(size_t lines, size_t bytes_per_line, size_t threads,
+		const std::function<void(size_t, size_t)>& func);
+
+}
+}
+
+#endif /* WORKERPOOL_H_ */
@@ -13,6 +13,7 @@
 #include "yuri/core/pipe/PipeGenerator.h"
 #include "yuri/core/utils/ModuleLoader.h"
 #include "yuri/core/utils/assign_parameters.h"
+#include "yuri/core/utils/tracing.h"
 #include "builder_utils.h"
 #define TIXML_USE_STL
 #ifdef YURI_WIN
@@ -382,6 +383,8 @@ Parameters XmlBuilder::configure()
 	p["filename"]["Path to  XML file."]="";
 	p["run_limit"]["Runtime limit in seconds"]=0.0;
 	p["variable_events"]["Send all variables as events at startup"]=true;
+	p["trace"]["Record trace of the processing into this file (in Chrome trace format). "
+			"The trace is written when the application finishes or on event 'trace_dump'. Can be set by environment variable YURI_TRACE as well."]="";
 	return p;
 }
 
@@ -462,7 +465,7 @@ bool XmlBuilder::set_param(const Parameter& parameter)
 	{
 		return true;
 	}
-	IOThread::set_param(parameter);
+	GenericBuilder::set_param(parameter);
 	// Return always true so pass-through parameters work without warnings
 	return true;
 }
@@ -491,6 +494,11 @@ void XmlBuilder::run()
 	GenericBuilder::run();
 	log[log::info] << "Finishing run after " << (timestamp_t{} - start_time_);
 	finish_all_threads();
+	if (tracing::enabled()) {
+		tracing::stop();
+		if (tracing::dump()) log[log::info] << "Trace written";
+		else log[log::warning] << "Failed to write trace";
+	}
 }
 bool XmlBuilder::step()
 {
@@ -0,0 +1,453 @@
+/*!
+ * @file 		AsyncFile.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AsyncFile.h"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define YURI_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+#endif
+
+namespace yuri {
+namespace core {
+
+async_backend_t parse_async_backend(const std::string& name)
+{
+	if (name == "uring" || name == "io_uring") return async_backend_t::uring;
+	if (name == "threads") return async_backend_t::threads;
+	return async_backend_t::automatic;
+}
+
+namespace {
+
+/*!
+ * Transfers the whole block, unless end of file or an error is reached.
+ */
+int64_t transfer_block(int fd, bool write, uint8_t* data, size_t size, uint64_t offset)
+{
+	size_t done = 0;
+	while (done < size) {
+		const auto ret = write ? ::pwrite(fd, data + done, size - done, offset + done)
+							: ::pread(fd, data + done, size - done, offset + done);
+		if (ret < 0) {
+			if (errno == EINTR) continue;
+			return done ? static_cast<int64_t>(done) : -errno;
+		}
+		if (ret == 0) break;
+		done += ret;
+	}
+	return done;
+}
+
+/*!
+ * Fallback implementation, requests are processed by a pool of threads
+ * (one thread per slot of the queue, at most 8).
+ */
+class ThreadAsyncFile: public AsyncFile {
+public:
+	ThreadAsyncFile(int fd, bool direct, size_t queue_depth):
+		AsyncFile(fd, direct, queue_depth), stop_(false)
+	{
+		const auto count = std::max<size_t>(1, std::min<size_t>(queue_depth, 8));
+		for (size_t i = 0; i < count; ++i) {
+			threads_.emplace_back([this]{ process_requests(); });
+		}
+	}
+	~ThreadAsyncFile() noexcept
+	{
+		while (get_pending()) collect(true);
+		{
+			lock_t _(mutex_);
+			stop_ = true;
+		}
+		request_cv_.notify_all();
+		for (auto& t: threads_) t.join();
+	}
+	const char* get_backend_name() const override { return "threads"; }
+private:
+	struct request_t {
+		request_id_t id;
+		bool write;
+		uint8_t* data;
+		size_t size;
+		uint64_t offset;
+	};
+
+	void submit(request_id_t id, bool write, uint8_t* data, size_t size, uint64_t offset) override
+	{
+		{
+			lock_t _(mutex_);
+			requests_.push_back({id, write, data, size, offset});
+		}
+		request_cv_.notify_one();
+	}
+
+	int collect(bool block) override
+	{
+		std::unique_lock<mutex> lock(mutex_);
+		if (block) {
+			done_cv_.wait(lock, [this]{ return !done_.empty(); });
+		}
+		auto done = std::move(done_);
+		done_.clear();
+		lock.unlock();
+		for (const auto& d: done) {
+			finish_request(d.first, d.second);
+		}
+		return 0;
+	}
+
+	void process_requests()
+	{
+		std::unique_lock<mutex> lock(mutex_);
+		while (true) {
+			request_cv_.wait(lock, [this]{ return stop_ || !requests_.empty(); });
+			if (stop_) break;
+			const auto r = requests_.front();
+			requests_.pop_front();
+			lock.unlock();
+			const auto result = transfer_block(fd_, r.write, r.data, r.size, r.offset);
+			lock.lock();
+			done_.emplace_back(r.id, result);
+			done_cv_.notify_one();
+		}
+	}
+
+	mutex								mutex_;
+	std::condition_variable				request_cv_;
+	std::condition_variable				done_cv_;
+	std::deque<request_t>				requests_;
+	std::vector<std::pair<request_id_t, int64_t>> done_;
+	std::vector<std::thread>			threads_;
+	bool								stop_;
+};
+
+#ifdef YURI_HAVE_IO_URING
+
+/*!
+ * Mapped submission and completion queues of an io_uring instance
+ */
+struct uring_t {
+	uring_t():fd(-1), sq_ring(MAP_FAILED), cq_ring(MAP_FAILED), sqes(MAP_FAILED),
+		sq_ring_size(0), cq_ring_size(0), sqes_size(0) {}
+	~uring_t() noexcept
+	{
+		if (sqes != MAP_FAILED) ::munmap(sqes, sqes_size);
+		if (cq_ring != MAP_FAILED && cq_ring != sq_ring) ::munmap(cq_ring, cq_ring_size);
+		if (sq_ring != MAP_FAILED) ::munmap(sq_ring, sq_ring_size);
+		if (fd >= 0) ::close(fd);
+	}
+	uring_t(const uring_t&) = delete;
+	uring_t& operator=(const uring_t&) = delete;
+
+	bool init(unsigned queue_depth)
+	{
+		io_uring_params params{};
+		fd = static_cast<int>(::syscall(__NR_io_uring_setup, queue_depth, &params));
+		if (fd < 0) return false;
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+		}
+		sq_ring = ::mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+		if (sq_ring == MAP_FAILED) return false;
+		cq_ring = single_mmap ? sq_ring :
+				::mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		if (cq_ring == MAP_FAILED) return false;
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+		if (sqes == MAP_FAILED) return false;
+
+		sq_tail = field<unsigned>(sq_ring, params.sq_off.tail);
+		sq_mask = *field<unsigned>(sq_ring, params.sq_off.ring_mask);
+		sq_array = field<unsigned>(sq_ring, params.sq_off.array);
+		cq_head = field<unsigned>(cq_ring, params.cq_off.head);
+		cq_tail = field<unsigned>(cq_ring, params.cq_off.tail);
+		cq_mask = *field<unsigned>(cq_ring, params.cq_off.ring_mask);
+		cqes = field<io_uring_cqe>(cq_ring, params.cq_off.cqes);
+		entries = params.sq_entries;
+		return true;
+	}
+
+	int enter(unsigned to_submit, unsigned min_complete, unsigned flags)
+	{
+		while (true) {
+			const auto ret = ::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0);
+			if (ret >= 0 || errno != EINTR) return static_cast<int>(ret);
+		}
+	}
+
+	template<class T>
+	static T* field(void* ring, uint32_t offset)
+	{
+		return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(ring) + offset);
+	}
+
+	int				fd;
+	void*			sq_ring;
+	void*			cq_ring;
+	void*			sqes;
+	size_t			sq_ring_size;
+	size_t			cq_ring_size;
+	size_t			sqes_size;
+	unsigned		entries;
+	unsigned*		sq_tail;
+	unsigned		sq_mask;
+	unsigned*		sq_array;
+	unsigned*		cq_head;
+	unsigned*		cq_tail;
+	unsigned		cq_mask;
+	io_uring_cqe*	cqes;
+};
+
+/*!
+ * Implementation using io_uring directly through system calls,
+ * so there's no dependency on liburing.
+ */
+class UringAsyncFile: public AsyncFile {
+public:
+	UringAsyncFile(int fd, bool direct, size_t queue_depth, std::unique_ptr<uring_t> ring):
+		AsyncFile(fd, direct, queue_depth), ring_(std::move(ring)), iovecs_(ring_->entries)
+	{
+	}
+	~UringAsyncFile() noexcept
+	{
+		// The kernel may still access the buffers, so all requests have to finish first
+		while (get_pending()) {
+			if (collect(true) < 0) break;
+		}
+	}
+	const char* get_backend_name() const override { return "uring"; }
+
+private:
+	struct request_t {
+		bool write;
+		uint8_t* data;
+		size_t size;
+		uint64_t offset;
+		//! Bytes already transferred
+		size_t done;
+	};
+
+	void submit(request_id_t id, bool write, uint8_t* data, size_t size, uint64_t offset) override
+	{
+		requests_[id] = {write, data, size, offset, 0};
+		queue(id);
+	}
+
+	//! Submits the part of a request, that hasn't been transferred yet
+	void queue(request_id_t id)
+	{
+		const auto& r = requests_[id];
+		const unsigned tail = *ring_->sq_tail;
+		const unsigned index = tail & ring_->sq_mask;
+		// Vectors have to stay valid until the kernel consumes the submission
+		iovecs_[index] = {r.data + r.done, r.size - r.done};
+		auto& sqe = reinterpret_cast<io_uring_sqe*>(ring_->sqes)[index];
+		sqe = io_uring_sqe{};
+		sqe.opcode = r.write ? IORING_OP_WRITEV : IORING_OP_READV;
+		sqe.fd = fd_;
+		sqe.addr = reinterpret_cast<uint64_t>(&iovecs_[index]);
+		sqe.len = 1;
+		sqe.off = r.offset + r.done;
+		sqe.user_data = id;
+		ring_->sq_array[index] = index;
+		__atomic_store_n(ring_->sq_tail, tail + 1, __ATOMIC_RELEASE);
+		if (ring_->enter(1, 0, 0) < 1) {
+			// The submission was not consumed, so process it synchronously instead
+			__atomic_store_n(ring_->sq_tail, tail, __ATOMIC_RELEASE);
+			complete(id, transfer_block(fd_, r.write, r.data + r.done, r.size - r.done, r.offset + r.done), true);
+		}
+	}
+
+	/*!
+	 * Processes result of a submission. Short transfers are resubmitted,
+	 * unless the end of the file was reached.
+	 * @param whole The result covers the whole rest of the request
+	 */
+	void complete(request_id_t id, int64_t result, bool whole)
+	{
+		auto it = requests_.find(id);
+		if (it == requests_.end()) return;
+		auto& r = it->second;
+		if (!whole && (result == -EINTR || result == -EAGAIN)) {
+			queue(id);
+			return;
+		}
+		if (result > 0) {
+			r.done += result;
+			if (!whole && r.done < r.size) {
+				queue(id);
+				return;
+			}
+		}
+		// Error after a partial transfer is reported as the partial size, same as transfer_block()
+		const int64_t total = result < 0 && !r.done ? result : static_cast<int64_t>(r.done);
+		requests_.erase(it);
+		finish_request(id, total);
+	}
+
+	int collect(bool block) override
+	{
+		while (true) {
+			unsigned head = *ring_->cq_head;
+			const unsigned tail = __atomic_load_n(ring_->cq_tail, __ATOMIC_ACQUIRE);
+			if (head != tail) {
+				std::vector<std::pair<request_id_t, int64_t>> completed;
+				for (; head != tail; ++head) {
+					const auto& cqe = ring_->cqes[head & ring_->cq_mask];
+					completed.emplace_back(cqe.user_data, cqe.res);
+				}
+				// Completions are released before resubmitting the short transfers
+				__atomic_store_n(ring_->cq_head, head, __ATOMIC_RELEASE);
+				for (const auto& c: completed) {
+					complete(c.first, c.second, false);
+				}
+				return 0;
+			}
+			if (!block || !get_pending()) return 0;
+			if (ring_->enter(0, 1, IORING_ENTER_GETEVENTS) < 0) return -errno;
+		}
+	}
+
+	std::unique_ptr<uring_t>	ring_;
+	std::vector<iovec>			iovecs_;
+	std::unordered_map<request_id_t, request_t>
+								requests_;
+};
+
+#endif
+
+}
+
+AsyncFile::AsyncFile(int fd, bool direct, size_t queue_depth):
+		fd_(fd), direct_(direct), queue_depth_(std::max<size_t>(queue_depth, 1)),
+		next_id_(1), pending_(0)
+{
+}
+
+AsyncFile::~AsyncFile() noexcept
+{
+	::close(fd_);
+}
+
+pAsyncFile AsyncFile::open(const std::string& path, int flags, size_t queue_depth,
+		async_backend_t backend, int mode)
+{
+	int fd = ::open(path.c_str(), flags | O_CLOEXEC, mode);
+	bool direct = false;
+#ifdef O_DIRECT
+	direct = flags & O_DIRECT;
+	if (fd < 0 && direct && errno == EINVAL) {
+		// Filesystem doesn't support direct I/O (e.g. tmpfs)
+		fd = ::open(path.c_str(), (flags & ~O_DIRECT) | O_CLOEXEC, mode);
+		direct = false;
+	}
+#endif
+	if (fd < 0) return {};
+	queue_depth = std::max<size_t>(queue_depth, 1);
+#ifdef YURI_HAVE_IO_URING
+	if (backend != async_backend_t::threads) {
+		std::unique_ptr<uring_t> ring(new uring_t());
+		if (ring->init(static_cast<unsigned>(queue_depth))) {
+			return pAsyncFile(new UringAsyncFile(fd, direct, queue_depth, std::move(ring)));
+		}
+		if (backend == async_backend_t::uring) {
+			::close(fd);
+			return {};
+		}
+	}
+#else
+	(void)backend;
+#endif
+	return pAsyncFile(new ThreadAsyncFile(fd, direct, queue_depth));
+}
+
+AsyncFile::request_id_t AsyncFile::read(uint8_t* data, size_t size, uint64_t offset)
+{
+	return start_request(false, data, size, offset);
+}
+
+AsyncFile::request_id_t AsyncFile::write(const uint8_t* data, size_t size, uint64_t offset)
+{
+	// The buffer is never written to in a write request
+	return start_request(true, const_cast<uint8_t*>(data), size, offset);
+}
+
+AsyncFile::request_id_t AsyncFile::start_request(bool write, uint8_t* data, size_t size, uint64_t offset)
+{
+	const auto id = next_id_++;
+	while (pending_ >= queue_depth_) {
+		const auto ret = collect(true);
+		if (ret < 0) {
+			// The request is not started, the caller gets the error from wait()
+			results_.emplace_back(id, ret);
+			return id;
+		}
+	}
+	++pending_;
+	submit(id, write, data, size, offset);
+	return id;
+}
+
+void AsyncFile::finish_request(request_id_t id, int64_t result)
+{
+	--pending_;
+	results_.emplace_back(id, result);
+}
+
+bool AsyncFile::finished(request_id_t id)
+{
+	collect(false);
+	return std::any_of(results_.begin(), results_.end(),
+			[id](const std::pair<request_id_t, int64_t>& r){ return r.first == id; });
+}
+
+int64_t AsyncFile::wait(request_id_t id)
+{
+	while (true) {
+		auto it = std::find_if(results_.begin(), results_.end(),
+				[id](const std::pair<request_id_t, int64_t>& r){ return r.first == id; });
+		if (it != results_.end()) {
+			const auto result = it->second;
+			results_.erase(it);
+			return result;
+		}
+		if (!pending_) return -EINVAL;
+		const auto ret = collect(true);
+		if (ret < 0) return ret;
+	}
+}
+
+void AsyncFile::wait_all()
+{
+	while (pending_) {
+		if (collect(true) < 0) break;
+	}
+	results_.clear();
+}
+
+}
+}
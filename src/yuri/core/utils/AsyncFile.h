@@ -0,0 +1,128 @@
+/*!
+ * @file 		AsyncFile.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Asynchronous positional reads and writes with several requests in flight.
+ *
+ * Requests are submitted through io_uring when the kernel supports it,
+ * otherwise they are processed by a small pool of threads using pread/pwrite.
+ * Files opened for direct I/O bypass the page cache, so buffers, sizes and offsets
+ * of all requests have to be multiples of AsyncFile::direct_alignment.
+ * Blocks of at least a page from FixedMemoryAllocator satisfy this.
+ */
+
+#ifndef ASYNCFILE_H_
+#define ASYNCFILE_H_
+
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/platform.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+enum class async_backend_t {
+	automatic,
+	uring,
+	threads
+};
+
+/*!
+ * Parses backend name ("auto", "uring" or "threads"), unknown names are treated as "auto".
+ */
+EXPORT async_backend_t parse_async_backend(const std::string& name);
+
+class AsyncFile;
+using pAsyncFile = std::unique_ptr<AsyncFile>;
+
+class AsyncFile {
+public:
+	using request_id_t = uint64_t;
+	//! Required alignment of buffers, sizes and offsets for direct I/O
+	static constexpr size_t direct_alignment = 4096;
+
+	/*!
+	 * Opens a file for asynchronous access.
+	 * @param path Path to the file
+	 * @param flags Flags for open(2). O_DIRECT is removed and the file reopened,
+	 * 				when the filesystem doesn't support it (check is_direct() afterwards)
+	 * @param queue_depth Maximal number of requests in flight.
+	 * 				Submitting more requests blocks until the oldest one finishes.
+	 * @param backend Requested backend. The automatic choice prefers io_uring.
+	 * @param mode Permissions of newly created files
+	 * @return The opened file, or an empty pointer if the file couldn't be opened
+	 */
+	EXPORT static pAsyncFile open(const std::string& path, int flags, size_t queue_depth,
+			async_backend_t backend = async_backend_t::automatic, int mode = 0644);
+
+	EXPORT virtual ~AsyncFile() noexcept;
+	AsyncFile(const AsyncFile&) = delete;
+	AsyncFile& operator=(const AsyncFile&) = delete;
+
+	/*!
+	 * Starts reading @em size bytes at @em offset into @em data.
+	 * The buffer has to stay valid until the request is waited for.
+	 * @return Identifier of the request. When waiting for earlier requests fails,
+	 * 			the request isn't started and wait() returns the error.
+	 */
+	EXPORT request_id_t read(uint8_t* data, size_t size, uint64_t offset);
+	/*!
+	 * Starts writing @em size bytes from @em data at @em offset.
+	 * The buffer has to stay valid until the request is waited for.
+	 * @return Identifier of the request
+	 */
+	EXPORT request_id_t write(const uint8_t* data, size_t size, uint64_t offset);
+	/*!
+	 * Waits for a request to finish.
+	 * @return Number of bytes transferred (less than requested only at the end of the file)
+	 * 			or a negative errno value, also when waiting itself fails
+	 */
+	EXPORT int64_t wait(request_id_t id);
+	//! Waits for all requests (unless waiting fails), the results are discarded
+	EXPORT void wait_all();
+	//! Returns true, when the request has already finished (without waiting for it)
+	EXPORT bool finished(request_id_t id);
+
+	size_t get_pending() const { return pending_; }
+	size_t get_queue_depth() const { return queue_depth_; }
+	int get_fd() const { return fd_; }
+	bool is_direct() const { return direct_; }
+	EXPORT virtual const char* get_backend_name() const = 0;
+
+protected:
+	AsyncFile(int fd, bool direct, size_t queue_depth);
+
+	/*!
+	 * Submits a request. Number of pending requests is lower than queue depth.
+	 */
+	virtual void submit(request_id_t id, bool write, uint8_t* data, size_t size, uint64_t offset) = 0;
+	/*!
+	 * Collects results of finished requests into results_.
+	 * @param block Wait for at least one request to finish
+	 * @return 0 or negative errno value, when waiting failed
+	 */
+	virtual int collect(bool block) = 0;
+
+	//! Stores result of a finished request, called from collect()
+	void finish_request(request_id_t id, int64_t result);
+
+	const int		fd_;
+	const bool		direct_;
+	const size_t	queue_depth_;
+private:
+	request_id_t start_request(bool write, uint8_t* data, size_t size, uint64_t offset);
+
+	request_id_t						next_id_;
+	size_t								pending_;
+	std::vector<std::pair<request_id_t, int64_t>>	results_;
+};
+
+}
+}
+
+#endif /* ASYNCFILE_H_ */
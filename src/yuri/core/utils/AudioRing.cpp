@@ -0,0 +1,193 @@
+/*!
+ * @file 		AudioRing.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "AudioRing.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace yuri {
+namespace core {
+
+namespace {
+
+// Constants of the PI controller for drift compensation. The error is the difference
+// between the fill and the target in seconds. The gains give a critically damped loop
+// settling in about a minute, slow enough to keep the pitch changes inaudible.
+const double proportional_gain = 0.2;
+const double integral_gain = 0.01;
+//! Time constant (in seconds) of averaging the fill, the consumer reads it in whole periods
+const double fill_averaging = 1.0;
+
+// 4-point Catmull-Rom interpolation between x1 and x2
+inline float interpolate(float x0, float x1, float x2, float x3, float f)
+{
+	const float c1 = 0.5f * (x2 - x0);
+	const float c2 = x0 - 2.5f * x1 + 2.0f * x2 - 0.5f * x3;
+	const float c3 = 0.5f * (x3 - x0) + 1.5f * (x1 - x2);
+	return ((c3 * f + c2) * f + c1) * f + x1;
+}
+
+}
+
+constexpr double AudioRing::max_drift;
+
+AudioRing::AudioRing(size_t channels, size_t sampling_frequency, size_t capacity, size_t target, bool drift_compensation):
+	channels_(channels), sampling_frequency_(static_cast<double>(sampling_frequency)), capacity_(capacity), target_(std::min(target, capacity)),
+	drift_compensation_(drift_compensation), data_(channels * capacity, 0.0f),
+	write_position_(0), read_position_(0), running_(false),
+	underruns_(0), missing_frames_(0), overruns_(0), dropped_frames_(0), ratio_(1.0),
+	history_(3 * channels, 0.0f), phase_(1.0), filtered_fill_(0.0), integral_(0.0)
+{
+	if (!channels || !sampling_frequency || !capacity) {
+		throw std::invalid_argument("Audio ring needs nonzero channels, sampling frequency and capacity");
+	}
+}
+
+size_t AudioRing::available() const
+{
+	return static_cast<size_t>(write_position_.load(std::memory_order_acquire) - read_position_.load(std::memory_order_acquire));
+}
+
+size_t AudioRing::space() const
+{
+	return capacity_ - available();
+}
+
+size_t AudioRing::push(const float* data, size_t frames)
+{
+	if (!frames) return 0;
+	if (!drift_compensation_) return write(data, frames);
+	update_ratio(frames);
+	return resample(data, frames);
+}
+
+size_t AudioRing::write(const float* data, size_t frames)
+{
+	const uint64_t position = write_position_.load(std::memory_order_relaxed);
+	const size_t free = capacity_ - static_cast<size_t>(position - read_position_.load(std::memory_order_acquire));
+	const size_t count = std::min(frames, free);
+	const size_t index = static_cast<size_t>(position % capacity_);
+	const size_t first = std::min(count, capacity_ - index);
+	std::copy(data, data + first * channels_, data_.data() + index * channels_);
+	std::copy(data + first * channels_, data + count * channels_, data_.data());
+	write_position_.store(position + count, std::memory_order_release);
+	if (count < frames) {
+		overruns_.fetch_add(1, std::memory_order_relaxed);
+		dropped_frames_.fetch_add(frames - count, std::memory_order_relaxed);
+	}
+	return count;
+}
+
+void AudioRing::update_ratio(size_t frames)
+{
+	const double fill = static_cast<double>(available());
+	if (!running_.load(std::memory_order_acquire)) {
+		// Nothing to compensate while prebuffering
+		filtered_fill_ = fill;
+		integral_ = 0.0;
+		ratio_.store(1.0, std::memory_order_relaxed);
+		return;
+	}
+	const double duration = frames / sampling_frequency_;
+	filtered_fill_ += (fill - filtered_fill_) * std::min(1.0, duration / fill_averaging);
+	const double error = (filtered_fill_ - target_) / sampling_frequency_;
+	integral_ += error * duration;
+	// Limit the integral to the range that can be used to avoid windup
+	const double integral_limit = max_drift / integral_gain;
+	integral_ = std::min(std::max(integral_, -integral_limit), integral_limit);
+	const double ratio = 1.0 - proportional_gain * error - integral_gain * integral_;
+	ratio_.store(std::min(std::max(ratio, 1.0 - max_drift), 1.0 + max_drift), std::memory_order_relaxed);
+}
+
+size_t AudioRing::resample(const float* data, size_t frames)
+{
+	const double step = 1.0 / ratio_.load(std::memory_order_relaxed);
+	scratch_.resize((static_cast<size_t>(frames * (1.0 + max_drift)) + 2) * channels_);
+	// Input frames are indexed after the three frames in history
+	auto sample = [&](size_t index, size_t channel) {
+		return index < 3 ? history_[index * channels_ + channel] : data[(index - 3) * channels_ + channel];
+	};
+	size_t count = 0;
+	while (static_cast<size_t>(phase_) <= frames) {
+		const size_t index = static_cast<size_t>(phase_);
+		const float fraction = static_cast<float>(phase_ - index);
+		float* out = &scratch_[count * channels_];
+		for (size_t c = 0; c < channels_; ++c) {
+			out[c] = interpolate(sample(index - 1, c), sample(index, c), sample(index + 1, c), sample(index + 2, c), fraction);
+		}
+		++count;
+		phase_ += step;
+	}
+	phase_ -= frames;
+	// Keeps the last three input frames for next call.
+	// When updating in place, the frames are read from higher indices than they're written to.
+	for (size_t i = 0; i < 3; ++i) {
+		for (size_t c = 0; c < channels_; ++c) {
+			history_[i * channels_ + c] = sample(frames + i, c);
+		}
+	}
+	return write(scratch_.data(), count);
+}
+
+template<class F>
+size_t AudioRing::do_read(size_t frames, bool only_full, F copy)
+{
+	const uint64_t position = read_position_.load(std::memory_order_relaxed);
+	const size_t stored = static_cast<size_t>(write_position_.load(std::memory_order_acquire) - position);
+	if (!running_.load(std::memory_order_relaxed)) {
+		// Prebuffering, waiting for the target fill
+		if (stored < std::max(target_, frames)) {
+			copy(0, 0, 0, frames);
+			return 0;
+		}
+		running_.store(true, std::memory_order_release);
+	}
+	size_t count = std::min(stored, frames);
+	if (only_full && count < frames) count = 0;
+	const size_t index = static_cast<size_t>(position % capacity_);
+	const size_t first = std::min(count, capacity_ - index);
+	copy(index, 0, first, 0);
+	copy(0, first, count - first, 0);
+	copy(0, count, 0, frames - count);
+	read_position_.store(position + count, std::memory_order_release);
+	if (count < frames) {
+		underruns_.fetch_add(1, std::memory_order_relaxed);
+		missing_frames_.fetch_add(frames - count, std::memory_order_relaxed);
+		running_.store(false, std::memory_order_release);
+	}
+	return count;
+}
+
+size_t AudioRing::read(float* data, size_t frames, bool only_full)
+{
+	// Copies @em count frames from ring index @em index to output offset @em offset,
+	// followed by @em silence frames of silence
+	return do_read(frames, only_full, [this, data](size_t index, size_t offset, size_t count, size_t silence) {
+		std::copy(data_.data() + index * channels_, data_.data() + (index + count) * channels_, data + offset * channels_);
+		std::fill(data + (offset + count) * channels_, data + (offset + count + silence) * channels_, 0.0f);
+	});
+}
+
+size_t AudioRing::read_planar(float* const* planes, size_t frames, bool only_full)
+{
+	return do_read(frames, only_full, [this, planes](size_t index, size_t offset, size_t count, size_t silence) {
+		for (size_t c = 0; c < channels_; ++c) {
+			float* plane = planes[c];
+			if (!plane) continue;
+			const float* src = data_.data() + index * channels_ + c;
+			for (size_t i = 0; i < count; ++i) {
+				plane[offset + i] = src[i * channels_];
+			}
+			std::fill(plane + offset + count, plane + offset + count + silence, 0.0f);
+		}
+	});
+}
+
+}
+}
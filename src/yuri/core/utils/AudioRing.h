@@ -0,0 +1,130 @@
+/*!
+ * @file 		AudioRing.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Lock-free ring of interleaved float samples between a pipeline thread
+ * and an audio device (e.g. JACK process callback).
+ *
+ * There has to be a single producer and a single consumer. The consumer side
+ * (read/read_planar) never blocks nor allocates, so it's safe to call from realtime callbacks.
+ *
+ * Playback starts when the ring is filled up to the target fill and restarts the same way
+ * after every underrun. With drift compensation enabled, the producer resamples the input
+ * by a ratio slightly different from 1.0, keeping the fill near the target,
+ * even when the device clock runs at a slightly different rate than the pipeline.
+ */
+
+#ifndef AUDIORING_H_
+#define AUDIORING_H_
+
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/platform.h"
+#include <atomic>
+#include <vector>
+
+namespace yuri {
+namespace core {
+
+class AudioRing {
+public:
+	//! Maximal relative difference between input and output rate used by drift compensation
+	static constexpr double max_drift = 0.005;
+
+	/*!
+	 * @param channels Number of interleaved channels
+	 * @param sampling_frequency Nominal sampling frequency, used to scale drift compensation
+	 * @param capacity Size of the ring in frames (samples of all channels)
+	 * @param target Target fill of the ring in frames. It's the latency of the output
+	 * and the amount of data prebuffered before starting the playback.
+	 * @param drift_compensation Enables adaptive resampling to keep the fill at @em target
+	 */
+	EXPORT AudioRing(size_t channels, size_t sampling_frequency, size_t capacity, size_t target, bool drift_compensation = true);
+	AudioRing(const AudioRing&) = delete;
+	AudioRing& operator=(const AudioRing&) = delete;
+
+	/*!
+	 * Stores interleaved samples, resampling them when drift compensation is enabled.
+	 * Samples not fitting into the ring are dropped and reported as an overrun.
+	 * Producer side only.
+	 * @return Number of frames stored
+	 */
+	EXPORT size_t push(const float* data, size_t frames);
+
+	/*!
+	 * Copies interleaved samples into @em data, missing samples are replaced by silence.
+	 * Consumer side only, realtime safe.
+	 * @param only_full Output nothing (silence) unless @em frames frames are available
+	 * @return Number of frames read from the ring
+	 */
+	EXPORT size_t read(float* data, size_t frames, bool only_full = false);
+	/*!
+	 * Same as read, but stores samples into separate buffers for each channel.
+	 * Buffers with null pointer are skipped.
+	 */
+	EXPORT size_t read_planar(float* const* planes, size_t frames, bool only_full = false);
+
+	//! Number of frames stored in the ring
+	EXPORT size_t available() const;
+	//! Number of frames that can be stored without overrun
+	EXPORT size_t space() const;
+
+	size_t get_channels() const { return channels_; }
+	size_t get_sampling_frequency() const { return static_cast<size_t>(sampling_frequency_); }
+	size_t get_capacity() const { return capacity_; }
+	size_t get_target() const { return target_; }
+	//! Current ratio of output and input samples
+	double get_ratio() const { return ratio_.load(std::memory_order_relaxed); }
+	//! Number of reads that couldn't be satisfied after the playback started
+	uint64_t get_underruns() const { return underruns_.load(std::memory_order_relaxed); }
+	//! Number of frames replaced by silence during underruns
+	uint64_t get_missing_frames() const { return missing_frames_.load(std::memory_order_relaxed); }
+	//! Number of pushes that didn't fit into the ring
+	uint64_t get_overruns() const { return overruns_.load(std::memory_order_relaxed); }
+	//! Number of frames dropped during overruns
+	uint64_t get_dropped_frames() const { return dropped_frames_.load(std::memory_order_relaxed); }
+
+private:
+	template<class F>
+	size_t do_read(size_t frames, bool only_full, F copy);
+	size_t write(const float* data, size_t frames);
+	size_t resample(const float* data, size_t frames);
+	void update_ratio(size_t frames);
+
+	const size_t channels_;
+	const double sampling_frequency_;
+	const size_t capacity_;
+	const size_t target_;
+	const bool drift_compensation_;
+	std::vector<float> data_;
+
+	// Positions are never wrapped, index into the ring is position modulo capacity
+	std::atomic<uint64_t> write_position_;
+	std::atomic<uint64_t> read_position_;
+	//! Set by the consumer when playback started, cleared after underrun
+	std::atomic<bool> running_;
+
+	std::atomic<uint64_t> underruns_;
+	std::atomic<uint64_t> missing_frames_;
+	std::atomic<uint64_t> overruns_;
+	std::atomic<uint64_t> dropped_frames_;
+	std::atomic<double> ratio_;
+
+	// Producer state for drift compensation
+	//! Last three input frames, needed for interpolation
+	std::vector<float> history_;
+	//! Position of next output sample, relative to the oldest frame in history
+	double phase_;
+	//! Averaged fill, in frames
+	double filtered_fill_;
+	//! Integrated difference from target, in seconds squared
+	double integral_;
+	std::vector<float> scratch_;
+};
+
+}
+}
+
+#endif /* AUDIORING_H_ */
@@ -0,0 +1,65 @@
+/*!
+ * @file 		cpu_features.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "cpu_features.h"
+#include "yuri/core/utils.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace yuri {
+namespace core {
+namespace cpu {
+
+simd_level_t get_supported_level()
+{
+	static const simd_level_t level = [] {
+#ifdef YURI_SIMD_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) return simd_level_t::avx2;
+		if (__builtin_cpu_supports("sse4.1")) return simd_level_t::sse41;
+		if (__builtin_cpu_supports("sse2")) return simd_level_t::sse2;
+#endif
+		return simd_level_t::none;
+	}();
+	return level;
+}
+
+simd_level_t get_default_level()
+{
+	static const simd_level_t level = [] {
+		const char* env = std::getenv("YURI_SIMD");
+		const std::string name = env ? env : "auto";
+		if (!iequals(name, "auto")) {
+			try {
+				return parse_level(name);
+			}
+			catch (std::invalid_argument&) {
+			}
+		}
+		return get_supported_level();
+	}();
+	return level;
+}
+
+simd_level_t parse_level(const std::string& name)
+{
+	if (iequals(name, "auto")) return get_default_level();
+	simd_level_t level = get_supported_level();
+	if (iequals(name, "none")) level = simd_level_t::none;
+	else if (iequals(name, "sse2") || iequals(name, "sse")) level = simd_level_t::sse2;
+	else if (iequals(name, "sse4") || iequals(name, "sse4.1")) level = simd_level_t::sse41;
+	else if (iequals(name, "avx2")) level = simd_level_t::avx2;
+	else throw std::invalid_argument("Unknown instruction set " + name);
+	return std::min(level, get_supported_level());
+}
+
+}
+}
+}
@@ -0,0 +1,67 @@
+/*!
+ * @file 		cpu_features.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Detection of instruction sets used by SIMD kernels in the modules.
+ *
+ * Kernels using an instruction set are compiled with a target attribute
+ * (YURI_TARGET_SSE2, YURI_TARGET_SSE41, YURI_TARGET_AVX2), so the rest of
+ * the module doesn't depend on it, and they're selected at runtime by simd_level_t.
+ * The macros are only defined when YURI_SIMD_X86 is defined.
+ */
+
+#ifndef CPU_FEATURES_H_
+#define CPU_FEATURES_H_
+
+#include "yuri/core/utils/new_types.h"
+#include <string>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define YURI_SIMD_X86
+#define YURI_TARGET_SSE2 __attribute__((target("sse2")))
+#define YURI_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define YURI_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace yuri {
+namespace core {
+namespace cpu {
+
+//! Instruction sets ordered by capabilities, every level implies all the lower ones
+enum class simd_level_t {
+	none,
+	sse2,
+	sse41,
+	avx2
+};
+
+/*!
+ * Returns the best instruction set supported by current CPU.
+ * Always returns none on other architectures than x86.
+ */
+EXPORT simd_level_t get_supported_level();
+
+/*!
+ * Returns the instruction set selected by 'auto'. It's the supported one,
+ * unless lowered by environment variable YURI_SIMD (with a name accepted by parse_level).
+ * Converters register their costs for this level, as converters created
+ * implicitly use it.
+ */
+EXPORT simd_level_t get_default_level();
+
+/*!
+ * Parses name of instruction set (auto, none, sse2, sse4, sse4.1, avx2).
+ * 'auto' returns get_default_level(), levels not supported by current CPU
+ * are lowered to the supported one.
+ * @throw std::invalid_argument for unknown names
+ */
+EXPORT simd_level_t parse_level(const std::string& name);
+
+}
+}
+}
+
+#endif /* CPU_FEATURES_H_ */
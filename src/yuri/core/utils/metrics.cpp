@@ -0,0 +1,324 @@
+/*!
+ * @file 		metrics.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "metrics.h"
+#include "yuri/core/utils/environment.h"
+#include "yuri/core/utils/global_time.h"
+#include "yuri/core/thread/FixedMemoryAllocator.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace yuri {
+namespace core {
+namespace metrics {
+
+namespace {
+
+bool enabled_from_environment()
+{
+	const auto env = utils::get_environment_variable("YURI_METRICS");
+	return !env.empty() && env != "0";
+}
+
+std::atomic<bool> collecting {enabled_from_environment()};
+
+struct registry_t {
+	mutex lock;
+	std::vector<std::weak_ptr<node_metrics_t>> nodes;
+	std::vector<std::weak_ptr<pipe_metrics_t>> pipes;
+};
+
+registry_t& get_registry()
+{
+	static registry_t registry;
+	return registry;
+}
+
+// Returns live metrics and drops the expired ones. Has to be called with registry locked.
+template<class T>
+std::vector<std::shared_ptr<T>> collect(std::vector<std::weak_ptr<T>>& list)
+{
+	std::vector<std::shared_ptr<T>> live;
+	for (const auto& w: list) {
+		if (auto p = w.lock()) live.push_back(std::move(p));
+	}
+	list.erase(std::remove_if(list.begin(), list.end(),
+			[](const std::weak_ptr<T>& w){ return w.expired(); }), list.end());
+	return live;
+}
+
+std::string escape_json(const std::string& str)
+{
+	std::ostringstream ss;
+	for (const auto c: str) {
+		switch (c) {
+			case '"': ss << "\\\""; break;
+			case '\\': ss << "\\\\"; break;
+			case '\n': ss << "\\n"; break;
+			case '\t': ss << "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+				} else {
+					ss << c;
+				}
+		}
+	}
+	return ss.str();
+}
+
+std::string escape_label(const std::string& str)
+{
+	std::string out;
+	for (const auto c: str) {
+		switch (c) {
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			default: out += c;
+		}
+	}
+	return out;
+}
+
+double rate(uint64_t value, uint64_t last, double seconds)
+{
+	return seconds > 0 ? (value - last) / seconds : 0.0;
+}
+
+void write_type(std::ostream& os, const std::string& name, const std::string& type, const std::string& help)
+{
+	os << "# HELP " << name << " " << help << "\n";
+	os << "# TYPE " << name << " " << type << "\n";
+}
+
+}
+
+/* ****************************************************************************
+ * 							Histogram
+ **************************************************************************** */
+
+Histogram::Histogram():sum_(0)
+{
+	for (auto& b: buckets_) b = 0;
+}
+
+const Histogram::bounds_t& Histogram::get_bounds()
+{
+	static const bounds_t bounds = {{10, 20, 50, 100, 200, 500,
+			1000, 2000, 5000, 10000, 20000, 50000,
+			100000, 200000, 500000}};
+	return bounds;
+}
+
+void Histogram::record(duration_t duration) noexcept
+{
+	const auto& bounds = get_bounds();
+	const auto value = std::max<int64_t>(duration.value, 0);
+	const auto idx = std::lower_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+	buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+	sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+Histogram::snapshot_t Histogram::get_snapshot() const noexcept
+{
+	snapshot_t snapshot;
+	snapshot.count = 0;
+	for (size_t i = 0; i < bucket_count; ++i) {
+		snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+		snapshot.count += snapshot.buckets[i];
+	}
+	snapshot.sum = sum_.load(std::memory_order_relaxed);
+	return snapshot;
+}
+
+int64_t Histogram::snapshot_t::quantile(double q) const
+{
+	const auto& bounds = get_bounds();
+	if (!count) return 0;
+	const auto limit = static_cast<uint64_t>(q * count);
+	uint64_t seen = 0;
+	for (size_t i = 0; i < bounds.size(); ++i) {
+		seen += buckets[i];
+		if (seen > limit) return bounds[i];
+	}
+	return bounds.back();
+}
+
+/* ****************************************************************************
+ * 							Registry
+ **************************************************************************** */
+
+pipe_metrics_t::pipe_metrics_t(std::string name):name(std::move(name)),
+		frames(0),dropped(0),bytes(0),depth(0),bytes_copied(0),
+		last_frames(0),last_dropped(0),last_bytes(0)
+{
+}
+
+bool enabled() noexcept
+{
+	return collecting.load(std::memory_order_relaxed);
+}
+
+void enable() noexcept
+{
+	collecting = true;
+}
+
+pNodeMetrics register_node(const std::string& name, const std::string& type)
+{
+	auto node = std::make_shared<node_metrics_t>(name, type);
+	auto& registry = get_registry();
+	lock_t _(registry.lock);
+	registry.nodes.push_back(node);
+	return node;
+}
+
+pPipeMetrics register_pipe(const std::string& name)
+{
+	auto pipe = std::make_shared<pipe_metrics_t>(name);
+	auto& registry = get_registry();
+	lock_t _(registry.lock);
+	registry.pipes.push_back(pipe);
+	return pipe;
+}
+
+std::string get_json()
+{
+	enable();
+	auto& registry = get_registry();
+	std::ostringstream os;
+	const timestamp_t now;
+	os << "{\"uptime\":" << (now - utils::get_global_start_time()).value / 1.0e6;
+
+	lock_t _(registry.lock);
+	os << ",\"nodes\":[";
+	bool first = true;
+	for (const auto& node: collect(registry.nodes)) {
+		const auto s = node->step_time.get_snapshot();
+		os << (first ? "" : ",") << "{\"name\":\"" << escape_json(node->name) << "\""
+			<< ",\"type\":\"" << escape_json(node->type) << "\""
+			<< ",\"steps\":" << node->steps.load()
+			<< ",\"step_time\":{\"count\":" << s.count
+			<< ",\"sum_us\":" << s.sum
+			<< ",\"mean_us\":" << (s.count ? static_cast<double>(s.sum) / s.count : 0.0)
+			<< ",\"p50_us\":" << s.quantile(0.5)
+			<< ",\"p99_us\":" << s.quantile(0.99)
+			<< ",\"buckets\":[";
+		const auto& bounds = Histogram::get_bounds();
+		for (size_t i = 0; i < Histogram::bucket_count; ++i) {
+			os << (i ? "," : "") << "{\"le_us\":";
+			if (i < bounds.size()) os << bounds[i];
+			else os << "null";
+			os << ",\"count\":" << s.buckets[i] << "}";
+		}
+		os << "]}}";
+		first = false;
+	}
+	os << "],\"pipes\":[";
+	first = true;
+	for (const auto& pipe: collect(registry.pipes)) {
+		const uint64_t frames = pipe->frames;
+		const uint64_t dropped = pipe->dropped;
+		const uint64_t bytes = pipe->bytes;
+		const double seconds = (now - pipe->last_time).value / 1.0e6;
+		const uint64_t new_frames = frames - pipe->last_frames;
+		const uint64_t new_dropped = dropped - pipe->last_dropped;
+		os << (first ? "" : ",") << "{\"name\":\"" << escape_json(pipe->name) << "\""
+			<< ",\"frames\":" << frames
+			<< ",\"dropped\":" << dropped
+			<< ",\"bytes\":" << bytes
+			<< ",\"bytes_copied\":" << pipe->bytes_copied.load()
+			<< ",\"depth\":" << pipe->depth.load()
+			<< ",\"fps\":" << rate(frames, pipe->last_frames, seconds)
+			<< ",\"bytes_per_second\":" << rate(bytes, pipe->last_bytes, seconds)
+			<< ",\"drop_rate\":" << (new_frames + new_dropped ? static_cast<double>(new_dropped) / (new_frames + new_dropped) : 0.0)
+			<< "}";
+		pipe->last_time = now;
+		pipe->last_frames = frames;
+		pipe->last_dropped = dropped;
+		pipe->last_bytes = bytes;
+		first = false;
+	}
+	const auto mem = FixedMemoryAllocator::get_statistics();
+	os << "],\"allocator\":{\"local_hits\":" << mem.local_hits
+		<< ",\"global_hits\":" << mem.global_hits
+		<< ",\"misses\":" << mem.misses
+		<< ",\"hit_rate\":" << mem.hit_rate()
+		<< ",\"remote_returns\":" << mem.remote_returns
+		<< ",\"blocks_in_use\":" << mem.blocks_in_use
+		<< ",\"bytes_in_use\":" << mem.bytes_in_use
+		<< ",\"blocks_free\":" << mem.blocks_free
+		<< ",\"bytes_free\":" << mem.bytes_free
+		<< "}}";
+	return os.str();
+}
+
+std::string get_prometheus()
+{
+	enable();
+	auto& registry = get_registry();
+	std::ostringstream os;
+	lock_t _(registry.lock);
+
+	const auto nodes = collect(registry.nodes);
+	write_type(os, "yuri_node_steps_total", "counter", "Number of steps executed by the node");
+	for (const auto& node: nodes) {
+		os << "yuri_node_steps_total{node=\"" << escape_label(node->name) << "\",type=\""
+			<< escape_label(node->type) << "\"} " << node->steps.load() << "\n";
+	}
+	write_type(os, "yuri_node_step_seconds", "histogram", "Duration of node steps");
+	const auto& bounds = Histogram::get_bounds();
+	for (const auto& node: nodes) {
+		const auto s = node->step_time.get_snapshot();
+		const auto labels = "node=\"" + escape_label(node->name) + "\",type=\"" + escape_label(node->type) + "\"";
+		uint64_t cumulative = 0;
+		for (size_t i = 0; i < bounds.size(); ++i) {
+			cumulative += s.buckets[i];
+			os << "yuri_node_step_seconds_bucket{" << labels << ",le=\"" << bounds[i] / 1.0e6 << "\"} " << cumulative << "\n";
+		}
+		os << "yuri_node_step_seconds_bucket{" << labels << ",le=\"+Inf\"} " << s.count << "\n";
+		os << "yuri_node_step_seconds_sum{" << labels << "} " << s.sum / 1.0e6 << "\n";
+		os << "yuri_node_step_seconds_count{" << labels << "} " << s.count << "\n";
+	}
+
+	const auto pipes = collect(registry.pipes);
+	auto write_pipes = [&](const std::string& name, const std::string& type, const std::string& help,
+			std::atomic<uint64_t> pipe_metrics_t::* value) {
+		write_type(os, name, type, help);
+		for (const auto& pipe: pipes) {
+			os << name << "{pipe=\"" << escape_label(pipe->name) << "\"} " << ((*pipe).*value).load() << "\n";
+		}
+	};
+	write_pipes("yuri_pipe_frames_total", "counter", "Frames passed through the pipe", &pipe_metrics_t::frames);
+	write_pipes("yuri_pipe_dropped_frames_total", "counter", "Frames dropped by the pipe", &pipe_metrics_t::dropped);
+	write_pipes("yuri_pipe_bytes_total", "counter", "Bytes passed through the pipe", &pipe_metrics_t::bytes);
+	write_pipes("yuri_pipe_copied_bytes_total", "counter", "Bytes of frame data copied by the consumer of the pipe", &pipe_metrics_t::bytes_copied);
+	write_pipes("yuri_pipe_depth", "gauge", "Frames waiting in the pipe", &pipe_metrics_t::depth);
+
+	const auto mem = FixedMemoryAllocator::get_statistics();
+	write_type(os, "yuri_allocator_requests_total", "counter", "Requests for memory blocks");
+	os << "yuri_allocator_requests_total{result=\"local_hit\"} " << mem.local_hits << "\n";
+	os << "yuri_allocator_requests_total{result=\"global_hit\"} " << mem.global_hits << "\n";
+	os << "yuri_allocator_requests_total{result=\"miss\"} " << mem.misses << "\n";
+	write_type(os, "yuri_allocator_hit_ratio", "gauge", "Ratio of requests served from the pool");
+	os << "yuri_allocator_hit_ratio " << mem.hit_rate() << "\n";
+	write_type(os, "yuri_allocator_remote_returns_total", "counter", "Blocks returned from other thread than the one that allocated them");
+	os << "yuri_allocator_remote_returns_total " << mem.remote_returns << "\n";
+	write_type(os, "yuri_allocator_bytes", "gauge", "Bytes held by the memory pool");
+	os << "yuri_allocator_bytes{state=\"in_use\"} " << mem.bytes_in_use << "\n";
+	os << "yuri_allocator_bytes{state=\"free\"} " << mem.bytes_free << "\n";
+	return os.str();
+}
+
+}
+}
+}
@@ -0,0 +1,126 @@
+/*!
+ * @file 		metrics.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Runtime metrics of nodes, pipes and the memory pool.
+ *
+ * Nodes and pipes own their metrics and only update atomic counters,
+ * the registry keeps weak references and collects the values when somebody
+ * asks for them. Timing of node steps is enabled only after the metrics
+ * were read for the first time (or when environment variable YURI_METRICS is set),
+ * so there's no measurable overhead for applications not using them.
+ */
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include "yuri/core/utils/time_types.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace yuri {
+namespace core {
+namespace metrics {
+
+/*!
+ * Histogram of durations with fixed, roughly exponential, buckets.
+ * It can be updated and read concurrently.
+ */
+class Histogram {
+public:
+	static const size_t bucket_count = 16;
+	using bounds_t = std::array<int64_t, bucket_count - 1>;
+	struct snapshot_t {
+		//! Number of values in each bucket (not cumulative)
+		std::array<uint64_t, bucket_count> buckets;
+		uint64_t count;
+		//! Sum of all values in microseconds
+		uint64_t sum;
+		/*!
+		 * Returns approximate quantile (upper bound of the bucket containing it) in microseconds.
+		 * Values in the last bucket are reported as the last bound.
+		 */
+		EXPORT int64_t quantile(double q) const;
+	};
+
+	EXPORT Histogram();
+	//! Upper bounds of the buckets in microseconds, the last bucket is unbounded
+	EXPORT static const bounds_t& get_bounds();
+	EXPORT void record(duration_t duration) noexcept;
+	EXPORT snapshot_t get_snapshot() const noexcept;
+private:
+	std::array<std::atomic<uint64_t>, bucket_count> buckets_;
+	std::atomic<uint64_t> sum_;
+};
+
+struct node_metrics_t {
+	node_metrics_t(std::string name, std::string type):name(std::move(name)),type(std::move(type)),steps(0) {}
+	//! Name of the node in the graph
+	const std::string name;
+	//! Class of the node
+	const std::string type;
+	std::atomic<uint64_t> steps;
+	Histogram step_time;
+};
+
+struct pipe_metrics_t {
+	pipe_metrics_t(std::string name);
+	const std::string name;
+	std::atomic<uint64_t> frames;
+	std::atomic<uint64_t> dropped;
+	std::atomic<uint64_t> bytes;
+	//! Number of frames currently waiting in the pipe
+	std::atomic<uint64_t> depth;
+	//! Bytes copied by the consumer (see copy_statistics)
+	std::atomic<uint64_t> bytes_copied;
+
+	// Values from the previous snapshot, used to compute rates. Guarded by the registry.
+	timestamp_t last_time;
+	uint64_t last_frames;
+	uint64_t last_dropped;
+	uint64_t last_bytes;
+};
+
+using pNodeMetrics = std::shared_ptr<node_metrics_t>;
+using pPipeMetrics = std::shared_ptr<pipe_metrics_t>;
+
+/*!
+ * Returns true when timing should be collected.
+ */
+EXPORT bool enabled() noexcept;
+/*!
+ * Enables collection of timing.
+ */
+EXPORT void enable() noexcept;
+
+/*!
+ * Creates metrics for a node and registers them.
+ * The metrics are unregistered when the returned pointer is released.
+ */
+EXPORT pNodeMetrics register_node(const std::string& name, const std::string& type);
+/*!
+ * Creates metrics for a pipe and registers them.
+ * The metrics are unregistered when the returned pointer is released.
+ */
+EXPORT pPipeMetrics register_pipe(const std::string& name);
+
+/*!
+ * Returns all metrics as a JSON document.
+ * Pipe rates are computed from the values since the previous call.
+ */
+EXPORT std::string get_json();
+/*!
+ * Returns all metrics in Prometheus text exposition format.
+ */
+EXPORT std::string get_prometheus();
+
+}
+}
+}
+
+#endif /* METRICS_H_ */
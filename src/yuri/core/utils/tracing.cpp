@@ -0,0 +1,251 @@
+/*!
+ * @file 		tracing.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "tracing.h"
+#include "yuri/core/utils/environment.h"
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace yuri {
+namespace core {
+namespace tracing {
+
+namespace detail {
+std::atomic<bool> active {false};
+}
+
+namespace {
+
+struct event_t {
+	const char* name;
+	const char* category;
+	int64_t timestamp;
+	int64_t duration;
+	//! Frame index for spans, flow id for flow events
+	uint64_t value;
+	//! Phase of the event as defined by Chrome trace format
+	char phase;
+};
+
+/*!
+ * Block of events written by a single thread.
+ * The writer publishes events by incrementing count, readers
+ * see only events below count, so no locking is needed.
+ */
+struct chunk_t {
+	static const size_t capacity = 4096;
+	chunk_t():count(0),next(nullptr) {}
+	std::array<event_t, capacity> events;
+	std::atomic<size_t> count;
+	std::atomic<chunk_t*> next;
+};
+
+// Limit of events recorded by a single thread (about 48MB)
+const size_t max_chunks = 256;
+
+struct thread_buffer_t {
+	thread_buffer_t(uint64_t tid):tid(tid),name(nullptr),head(new chunk_t),tail(head.get()),chunks(1),dropped(0) {}
+	~thread_buffer_t() noexcept {
+		auto c = head->next.load();
+		while (c) {
+			auto next = c->next.load();
+			delete c;
+			c = next;
+		}
+	}
+	void push(const event_t& event) noexcept
+	{
+		auto idx = tail->count.load(std::memory_order_relaxed);
+		if (idx == chunk_t::capacity) {
+			if (chunks >= max_chunks) {
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			auto c = new (std::nothrow) chunk_t;
+			if (!c) {
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			tail->next.store(c, std::memory_order_release);
+			tail = c;
+			++chunks;
+			idx = 0;
+		}
+		tail->events[idx] = event;
+		tail->count.store(idx + 1, std::memory_order_release);
+	}
+
+	const uint64_t tid;
+	std::atomic<const char*> name;
+	const std::unique_ptr<chunk_t> head;
+	// Accessed only by the owning thread
+	chunk_t* tail;
+	size_t chunks;
+	std::atomic<uint64_t> dropped;
+};
+
+using pThreadBuffer = std::shared_ptr<thread_buffer_t>;
+
+mutex registry_mutex;
+std::vector<pThreadBuffer> buffers;
+std::set<std::string> interned;
+std::string trace_file;
+const timestamp_t epoch;
+
+thread_local pThreadBuffer thread_buffer;
+//! Name set before the thread recorded anything, it's assigned to the buffer once it's created
+thread_local const char* thread_name = nullptr;
+
+thread_buffer_t& get_thread_buffer()
+{
+	if (!thread_buffer) {
+		lock_t _(registry_mutex);
+		thread_buffer = std::make_shared<thread_buffer_t>(buffers.size() + 1);
+		thread_buffer->name = thread_name;
+		buffers.push_back(thread_buffer);
+	}
+	return *thread_buffer;
+}
+
+int64_t since_epoch(const timestamp_t& t)
+{
+	return (t - epoch).value;
+}
+
+void write_string(std::ostream& os, const char* str)
+{
+	os << '"';
+	for (; str && *str; ++str) {
+		const char c = *str;
+		if (c == '"' || c == '\\') os << '\\' << c;
+		else if (static_cast<unsigned char>(c) < 0x20) os << ' ';
+		else os << c;
+	}
+	os << '"';
+}
+
+void write_event(std::ostream& os, uint64_t tid, const event_t& e)
+{
+	os << "{\"name\":";
+	write_string(os, e.name);
+	os << ",\"cat\":";
+	write_string(os, e.category);
+	os << ",\"ph\":\"" << e.phase << "\",\"ts\":" << e.timestamp << ",\"pid\":1,\"tid\":" << tid;
+	if (e.phase == 'X') {
+		os << ",\"dur\":" << e.duration << ",\"args\":{\"frame\":" << e.value << "}";
+	} else {
+		os << ",\"id\":\"0x" << std::hex << e.value << std::dec << "\"";
+		// Binds the end of the flow to the enclosing span (pop from the pipe)
+		if (e.phase == 'f') os << ",\"bp\":\"e\"";
+	}
+	os << "}";
+}
+
+// Enables tracing when YURI_TRACE is set
+struct environment_init_t {
+	environment_init_t() {
+		const auto file = utils::get_environment_variable("YURI_TRACE", "");
+		if (!file.empty()) start(file);
+	}
+} environment_init;
+
+}
+
+void start(const std::string& filename)
+{
+	{
+		lock_t _(registry_mutex);
+		if (!filename.empty()) trace_file = filename;
+	}
+	detail::active = true;
+}
+
+void stop()
+{
+	detail::active = false;
+}
+
+bool dump(const std::string& filename)
+{
+	std::string file = filename;
+	if (file.empty()) {
+		lock_t _(registry_mutex);
+		file = trace_file;
+	}
+	if (file.empty()) return false;
+	std::ofstream os(file, std::ios::out | std::ios::trunc);
+	if (!os.is_open()) return false;
+	write_trace(os);
+	return os.good();
+}
+
+void write_trace(std::ostream& os)
+{
+	std::vector<pThreadBuffer> bufs;
+	{
+		lock_t _(registry_mutex);
+		bufs = buffers;
+	}
+	os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"yuri\"}}";
+	for (const auto& buf: bufs) {
+		if (const auto name = buf->name.load()) {
+			os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buf->tid << ",\"args\":{\"name\":";
+			write_string(os, name);
+			os << "}}";
+		}
+		for (auto c = buf->head.get(); c; c = c->next.load(std::memory_order_acquire)) {
+			const auto count = c->count.load(std::memory_order_acquire);
+			for (size_t i = 0; i < count; ++i) {
+				os << ",\n";
+				write_event(os, buf->tid, c->events[i]);
+			}
+		}
+		if (const auto dropped = buf->dropped.load()) {
+			os << ",\n{\"name\":\"dropped_events\",\"ph\":\"C\",\"pid\":1,\"tid\":" << buf->tid << ",\"ts\":0,\"args\":{\"dropped\":" << dropped << "}}";
+		}
+	}
+	os << "]}\n";
+}
+
+const char* intern(const std::string& name)
+{
+	lock_t _(registry_mutex);
+	return interned.insert(name).first->c_str();
+}
+
+void set_thread_name(const char* name)
+{
+	thread_name = name;
+	if (thread_buffer) thread_buffer->name = name;
+}
+
+void record_span(const char* name, const char* category, const timestamp_t& start, index_t frame_index)
+{
+	const timestamp_t end;
+	get_thread_buffer().push({name, category, since_epoch(start), (end - start).value, frame_index, 'X'});
+}
+
+void record_flow_start(const char* name, uint64_t id)
+{
+	get_thread_buffer().push({name, "flow", since_epoch(timestamp_t{}), 0, id, 's'});
+}
+
+void record_flow_end(const char* name, uint64_t id)
+{
+	get_thread_buffer().push({name, "flow", since_epoch(timestamp_t{}), 0, id, 'f'});
+}
+
+}
+}
+}
@@ -0,0 +1,131 @@
+/*!
+ * @file 		tracing.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Frame level tracing of the processing graph.
+ *
+ * When enabled, node steps, filter invocations, conversions and pipe operations
+ * are recorded as timestamped spans tagged with frame index. Every thread writes
+ * into its own buffer without any locking, the buffers are collected only when
+ * the trace is dumped in Chrome trace format (loadable in chrome://tracing or Perfetto).
+ * Frames passed through pipes are connected by flow events, so the path of
+ * a frame through the graph (and its end-to-end latency) is visible in the viewer.
+ *
+ * Tracing is enabled by setting environment variable YURI_TRACE to the name of the output file,
+ * by parameter 'trace' of the builder or by calling start().
+ */
+
+#ifndef TRACING_H_
+#define TRACING_H_
+
+#include "yuri/core/utils/new_types.h"
+#include "yuri/core/utils/time_types.h"
+#include <atomic>
+#include <string>
+
+namespace yuri {
+namespace core {
+namespace tracing {
+
+namespace detail {
+extern EXPORT std::atomic<bool> active;
+}
+
+/*!
+ * Returns true when tracing is active
+ */
+inline bool enabled() noexcept
+{
+	return detail::active.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Starts tracing.
+ * @param filename File the trace will be written to by dump().
+ *   Empty filename keeps the previously set file.
+ */
+EXPORT void start(const std::string& filename = {});
+/*!
+ * Stops recording new events. Already recorded events are kept.
+ */
+EXPORT void stop();
+/*!
+ * Writes all events recorded so far in Chrome trace JSON format.
+ * @param filename File to write to, empty to use the file set by start()
+ * @return false if there's nowhere to write or the file can't be written
+ */
+EXPORT bool dump(const std::string& filename = {});
+/*!
+ * Writes the trace to @em os
+ */
+EXPORT void write_trace(std::ostream& os);
+
+/*!
+ * Returns a pointer to a copy of @em name valid for the whole lifetime of the application.
+ * The pointers are compared as strings, so identical names return the same pointer.
+ */
+EXPORT const char* intern(const std::string& name);
+
+/*!
+ * Sets name of current thread shown in the trace.
+ * It can be called even when tracing is inactive, the name is used
+ * once the thread records its first event (e.g. after a later start()).
+ * @param name Name returned from intern() (or a string literal)
+ */
+EXPORT void set_thread_name(const char* name);
+
+/*!
+ * Records a span of @em name from @em start until now.
+ * @param name Name of the span, returned from intern() (or a string literal)
+ * @param category Category of the span, a string literal
+ */
+EXPORT void record_span(const char* name, const char* category, const timestamp_t& start, index_t frame_index);
+/*!
+ * Records beginning of a flow (e.g. frame pushed into a pipe)
+ */
+EXPORT void record_flow_start(const char* name, uint64_t id);
+/*!
+ * Records end of a flow started by record_flow_start() with the same id
+ */
+EXPORT void record_flow_end(const char* name, uint64_t id);
+
+/*!
+ * Records a span covering lifetime of the object.
+ * Nothing is recorded when the tracing was inactive at its construction.
+ */
+class Span {
+public:
+	Span(const char* name, const char* category, index_t frame_index = 0) noexcept
+		:name_(name),category_(category),frame_index_(frame_index),active_(enabled()),
+		start_(active_ ? yuri::detail::clock_t::now() : yuri::detail::time_point{}) {}
+	~Span() noexcept {
+		if (active_) {
+			try {
+				record_span(name_, category_, start_, frame_index_);
+			}
+			catch (...) {}
+		}
+	}
+	Span(const Span&) = delete;
+	Span& operator=(const Span&) = delete;
+	bool is_active() const noexcept { return active_; }
+	//! Sets frame index, for spans that don't know the frame until they finish
+	void set_frame_index(index_t frame_index) noexcept { frame_index_ = frame_index; }
+	//! Drops the span, nothing will be recorded
+	void discard() noexcept { active_ = false; }
+private:
+	const char* name_;
+	const char* category_;
+	index_t frame_index_;
+	bool active_;
+	timestamp_t start_;
+};
+
+}
+}
+}
+
+#endif /* TRACING_H_ */
@@ -9,10 +9,13 @@
  */
 
 #include "BasicEventConsumer.h"
+#include <algorithm>
 namespace yuri {
 namespace event {
 
-BasicEventConsumer::BasicEventConsumer(log::Log& log):log_c_(log),lost_events_(0)
+BasicEventConsumer::BasicEventConsumer(log::Log& log)
+:incomming_events_(incomming_max_size_),waiting_(0),log_c_(log),lost_events_(0),
+ coalesce_events_(false)
 {
 
 }
@@ -27,49 +30,93 @@ BasicEventConsumer::~BasicEventConsumer()
 
 bool BasicEventConsumer::receive_event(const std::string& event_name, const pBasicEvent& event)
 {
-	lock_t _(incomming_mutex_);
 	return do_receive_event(event_name, event);
 }
 
 bool BasicEventConsumer::do_receive_event(const std::string& event_name, const pBasicEvent& event)
 {
-	event_record_t rec{event_name, event};
-	incomming_events_.push_back(rec);
-	while (incomming_events_.size() > incomming_max_size_) {
-		incomming_events_.pop_front();
-		++lost_events_;
+	while (!incomming_events_.push(event_name, event)) {
+		// The queue is full, so the oldest event is discarded
+		std::string name;
+		pBasicEvent discarded;
+		if (incomming_events_.pop(name, discarded)) ++lost_events_;
+	}
+	// Pairs with the fence in wait_for_events(), either the waiting thread sees the event,
+	// or we see the waiting thread.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (waiting_.load(std::memory_order_relaxed) > 0) {
+		lock_t _(incomming_mutex_);
+		incomming_notification_.notify_all();
 	}
-	incomming_notification_.notify_all();
 	receive_event_hook();
 	return true;
 }
-bool BasicEventConsumer::process_events(ssize_t max_count)
+
+void BasicEventConsumer::process_incomming_event(const std::string& event_name, const pBasicEvent& event)
 {
+	try {
+		//if (!do_process_event(rec.first, rec.second)) return false;
+		do_process_event(event_name, event);
+	}
+	catch (std::runtime_error& e) {
+		log_c_[log::debug] << "Error while processing incoming event '" << event_name <<"': "<< e.what();
+	}
+}
 
+bool BasicEventConsumer::process_events(ssize_t max_count)
+{
+	if (coalesce_events_) return process_coalesced_events(max_count);
+	std::string event_name;
+	pBasicEvent event;
 	for(;;) {
-		auto rec = get_pending_event();
-		if (!rec.second) break;
-
-		try {
-			//if (!do_process_event(rec.first, rec.second)) return false;
-			do_process_event(rec.first, rec.second);
-		}
-		catch (std::runtime_error& e) {
-			log_c_[log::debug] << "Error while processing incoming event '" << rec.first <<"': "<< e.what();
-		}
+		if (!incomming_events_.pop(event_name, event)) break;
+		process_incomming_event(event_name, event);
 		if (max_count == 0) break;
 		if (max_count > 0) max_count--;
 	}
 	return true;
 }
 
+bool BasicEventConsumer::process_coalesced_events(ssize_t max_count)
+{
+	auto& events = coalesced_events_;
+	const size_t max_events = max_count < 0 ? incomming_events_.get_capacity() : max_count + 1;
+	size_t count = 0;
+	while (count < max_events) {
+		if (events.size() == count) events.emplace_back();
+		if (!incomming_events_.pop(events[count].first, events[count].second)) break;
+		++count;
+	}
+	if (count > 1) {
+		// Sorting by name (and position for the same names) puts the latest event last in each group
+		auto& order = coalesced_order_;
+		order.resize(count);
+		for (size_t i = 0; i < count; ++i) order[i] = i;
+		std::sort(order.begin(), order.end(), [&events](size_t a, size_t b) {
+			const int cmp = events[a].first.compare(events[b].first);
+			return cmp < 0 || (cmp == 0 && a < b);
+		});
+		for (size_t i = 0; i + 1 < count; ++i) {
+			if (events[order[i]].first == events[order[i + 1]].first) {
+				events[order[i]].second.reset();
+			}
+		}
+	}
+	for (size_t i = 0; i < count; ++i) {
+		auto& rec = events[i];
+		if (!rec.second) continue;
+		process_incomming_event(rec.first, rec.second);
+		rec.second.reset();
+	}
+	return true;
+}
+
 event_record_t BasicEventConsumer::get_pending_event()
 {
-	lock_t lock(incomming_mutex_);
-	if (incomming_events_.empty()) return {{},{}};
-	auto event = incomming_events_.front();
-	incomming_events_.pop_front();
-	return event;
+	std::string event_name;
+	pBasicEvent event;
+	if (!incomming_events_.pop(event_name, event)) return {{},{}};
+	return {std::move(event_name), std::move(event)};
 }
 //bool BasicEventConsumer::do_process_events(ssize_t max_count)
 //{
@@ -89,15 +136,19 @@ event_record_t BasicEventConsumer::get_pending_event()
 //}
 size_t	BasicEventConsumer::pending_events() const
 {
-	lock_t _(incomming_mutex_);
 	return incomming_events_.size();
 }
 bool BasicEventConsumer::wait_for_events(duration_t timeout)
 {
+	if (!incomming_events_.empty()) return true;
 	lock_t l(incomming_mutex_);
-	if (incomming_events_.size()) return true;
-	incomming_notification_.wait_for(l, std::chrono::microseconds(timeout));
-	return incomming_events_.size() != 0;
+	waiting_.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (incomming_events_.empty()) {
+		incomming_notification_.wait_for(l, std::chrono::microseconds(timeout));
+	}
+	waiting_.fetch_sub(1);
+	return !incomming_events_.empty();
 }
 
 
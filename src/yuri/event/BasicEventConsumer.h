@@ -11,8 +11,8 @@
 #ifndef BASICEVENTCONSUMER_H_
 #define BASICEVENTCONSUMER_H_
 #include "yuri/event/BasicEvent.h"
+#include "yuri/event/EventQueue.h"
 #include "yuri/log/Log.h"
-#include <deque>
 #include "yuri/core/utils/time_types.h"
 
 namespace yuri {
@@ -36,16 +36,31 @@ protected:
 	EXPORT bool 				process_events(ssize_t max_count = -1);
 	EXPORT size_t				pending_events() const;
 	EXPORT bool					wait_for_events(duration_t timeout);
+	/*!
+	 * Enables coalescing of events in process_events(). When several events with the same name
+	 * are pending, only the latest one is processed (at the position of the latest one).
+	 * Suitable for consumers interested only in the current values (e.g. controller positions).
+	 */
+	void						set_event_coalescing(bool coalesce) { coalesce_events_ = coalesce; }
 private:
 	EXPORT bool 				do_receive_event(const std::string& event_name, const pBasicEvent& event);
 	EXPORT bool 				do_process_events(ssize_t max_count);
+	bool 						process_coalesced_events(ssize_t max_count);
+	void 						process_incomming_event(const std::string& event_name, const pBasicEvent& event);
 	virtual bool 				do_process_event(const std::string& event_name, const pBasicEvent& event) = 0;
-	std::deque<event_record_t> 	incomming_events_;
-	mutable mutex				incomming_mutex_;
-	size_t						incomming_max_size_ = 1024;
-	log::Log					log_c_;
+	static const size_t			incomming_max_size_ = 1024;
+	EventQueue				 	incomming_events_;
+	mutex						incomming_mutex_;
 	std::condition_variable		incomming_notification_;
-	size_t						lost_events_;
+	//! Number of threads waiting in wait_for_events()
+	std::atomic<size_t>			waiting_;
+	log::Log					log_c_;
+	std::atomic<size_t>			lost_events_;
+	bool						coalesce_events_;
+	//! Events drained from the queue while coalescing and their order by name
+	std::vector<std::pair<std::string, pBasicEvent>>
+								coalesced_events_;
+	std::vector<size_t>			coalesced_order_;
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include "BasicEventParser.h"
 #include "BasicEventConversions.h"
+#include "EventExpression.h"
 #include "yuri/core/utils/make_unique.h"
 #include <iostream>
 #include <algorithm>
@@ -492,19 +493,20 @@ BasicEventParser::BasicEventParser(log::Log& log)
 
 namespace {
 
+	using input_map_t = std::map<std::string, pBasicEvent>;
 	struct value_provider {
-		virtual pBasicEvent get_value(const EventRouter& router) const = 0;
+		virtual pBasicEvent get_value(const input_map_t& inputs) const = 0;
 		virtual ~value_provider() {}
 	};
 	struct null_value: public value_provider {
 		null_value():value_provider(){}
-		pBasicEvent get_value(const EventRouter& /*router*/) const {
+		pBasicEvent get_value(const input_map_t& /*inputs*/) const {
 			return pBasicEvent();
 		}
 	};
 	struct bang_value: public value_provider {
 		bang_value():value_provider(),value(new EventBang()){}
-		pBasicEvent get_value(const EventRouter& /*router*/) const {
+		pBasicEvent get_value(const input_map_t& /*inputs*/) const {
 			return value;
 		}
 		pBasicEvent value;
@@ -513,18 +515,18 @@ namespace {
 	struct const_value: public value_provider {
 		const_value(const pBasicEvent& value):value_provider(),value(value) {}
 		pBasicEvent value;
-		pBasicEvent get_value(const EventRouter& /*router*/) const {
+		pBasicEvent get_value(const input_map_t& /*inputs*/) const {
 			return value;
 		}
 	};
 	struct vec_value: public value_provider {
 		vec_value():value_provider() {}
 		std::vector<std::unique_ptr<value_provider>> inputs;
-		pBasicEvent get_value(const EventRouter& router) const {
+		pBasicEvent get_value(const input_map_t& input_events) const {
 			auto vec = std::make_shared<EventVector>();
 			for (const auto& in: inputs) {
 				assert(in);
-				vec->push_back(in->get_value(router));
+				vec->push_back(in->get_value(input_events));
 			}
 			return vec;
 		}
@@ -532,11 +534,11 @@ namespace {
 	struct dict_value: public value_provider {
 		dict_value():value_provider() {}
 		std::map<std::string, std::unique_ptr<value_provider>> inputs;
-		pBasicEvent get_value(const EventRouter& router) const {
+		pBasicEvent get_value(const input_map_t& input_events) const {
 			auto dict = std::make_shared<EventDict>();
 			auto& dmap = dict->get_value();
 			for (const auto& in: inputs) {
-				dmap[in.first] = (in.second)->get_value(router);
+				dmap[in.first] = (in.second)->get_value(input_events);
 			}
 			return dict;
 		}
@@ -546,7 +548,12 @@ namespace {
 				name(node+":"+name) {}
 		std::string name;
 		std::unique_ptr<value_provider> init;
-		pBasicEvent get_value(const EventRouter& router) const;
+		pBasicEvent get_value(const input_map_t& inputs) const {
+			auto it = inputs.find(name);
+			if (it != inputs.end() && it->second) return it->second;
+			if (init) return init->get_value(inputs);
+			throw std::runtime_error("bah");
+		}
 	};
 	struct func_call: public value_provider {
 		func_call(const std::string& fname, parser::func_mode_t mode):value_provider(),
@@ -555,12 +562,11 @@ namespace {
 		parser::func_mode_t mode;
 		std::vector<std::unique_ptr<value_provider>> inputs;
 
-		pBasicEvent get_value(const EventRouter& router) const {
+		pBasicEvent get_value(const input_map_t& input_events) const {
 			std::vector<pBasicEvent> in;
-//			std::cout << "func_call::get_value()  (" << inputs.size()<< "\n";
 			for (const auto& input: inputs) {
 				assert(input);
-				in.push_back(input->get_value(router));
+				in.push_back(input->get_value(input_events));
 			}
 			return call(fname,in);
 		}
@@ -572,132 +578,103 @@ namespace {
 		assert(const_token);
 		return std::unique_ptr<const_value>(new const_value(std::make_shared<event_type>(const_token->val)));
 	}
+	std::unique_ptr<value_provider> process_tree(const parser::p_token& ast)
+	{
+		switch (ast->type) {
+			case parser::token_type_t::int_const: return process_const<parser::int_const_token, EventInt>(ast);
+			case parser::token_type_t::double_const: return process_const<parser::double_const_token, EventDouble>(ast);
+			case parser::token_type_t::bool_const: return process_const<parser::bool_const_token, EventBool>(ast);
+			case parser::token_type_t::string_const: return process_const<parser::string_const_token, EventString>(ast);
+			case parser::token_type_t::bang_const: return make_unique<bang_value>();
+			case parser::token_type_t::spec: {
+				const auto& token = std::dynamic_pointer_cast<parser::spec_token>(ast);
+				std::unique_ptr<event_value> spec (new event_value(token->node, token->name));
+				if (token->init) {
+					spec->init = process_tree(token->init);
+				}
+				return spec;
+			}
+			case parser::token_type_t::func_name: {
+				const auto& token = std::dynamic_pointer_cast<parser::func_token>(ast);
+				std::unique_ptr<func_call> func {new func_call(token->fname, token->mode)};
+				for (const auto& arg: token->args) {
+					func->inputs.push_back(process_tree(arg));
+				}
+				return func;
+			}
+			case parser::token_type_t::vector_const: {
+				const auto& token = std::dynamic_pointer_cast<parser::vector_const_token>(ast);
+				std::unique_ptr<vec_value> vec {new vec_value()};
+				for (const auto& arg: token->members) {
+					vec->inputs.push_back(process_tree(arg));
+				}
+				return vec;
+			}
+			case parser::token_type_t::dict_const: {
+				const auto& token = std::dynamic_pointer_cast<parser::dict_const_token>(ast);
+				std::unique_ptr<dict_value> dict {new dict_value()};
+				for (const auto& arg: token->members) {
+					dict->inputs[arg.first] = process_tree(arg.second);
+				}
+				return dict;
+			}
+			case parser::token_type_t::null_const: {
+				std::unique_ptr<null_value> n (new null_value{});
+				assert(n);
+				return n;
+			}
+			default: break;
+		}
+
+		throw std::runtime_error("Bad tree!");
+	}
+}
+
+pBasicEvent parser::interpret(const p_token& ast, const std::map<std::string, pBasicEvent>& inputs)
+{
+	return process_tree(ast)->get_value(inputs);
 }
+
 	class EventRouter: public BasicEventConsumer, public BasicEventProducer
 	{
 	public:
 		EventRouter(const parser::p_token& token, log::Log& log)
-			:BasicEventConsumer(log),BasicEventProducer(log),log_er_(log)
+			:BasicEventConsumer(log),BasicEventProducer(log),expression_(token)
 		{
-			(void)log_er_;
-//			assert(token->type == parser::token_type_t::func_name);
-			provider = process_tree(token);
-
-		}
-		pBasicEvent get_value(const std::string& name) const
-		{
-//			log_er_[log::info] << "Looking up value " << name;
-			auto it = input_events.find(name);
-			if (it==input_events.end()) return pBasicEvent();
-//			log_er_[log::info] << "found " << name;
-			return it->second;
-//			throw std::runtime_error("No value");
+			const auto& inputs = expression_.get_inputs();
+			for (size_t i = 0; i < inputs.size(); ++i) {
+				const auto name = inputs[i].first + ":" + inputs[i].second;
+				input_map[inputs[i]] = name;
+				input_index_[name] = i;
+			}
 		}
 		void process() {
 			process_events();
 		}
 		pBasicEvent get_event()
 		{
-			try {
-//				log_er_[log::info] << "GE";
-				return provider->get_value(*this);
-			}
-			catch (std::runtime_error& /* e */)
-			{
-				//log_er_[log::info] << "BOO: " << e.what();
-				throw;
-			}
+			return expression_.evaluate();
 		}
 		void try_emit_event() {
-//			try {
-//				std::cout << "emit impl\n";
-				emit_event("out",get_event());
-//				std::cout << "emit done\n";
-//			}
-//			catch (std::runtime_error& e)
-//			{
-//				std::cout << "Error " << e.what() << "\n";
-//				throw;
-//			}
+			emit_event("out",get_event());
 		}
 
 	private:
-		log::Log&	log_er_;
-		std::unique_ptr<value_provider> process_tree(const parser::p_token& ast)
-		{
-			switch (ast->type) {
-				case parser::token_type_t::int_const: return process_const<parser::int_const_token, EventInt>(ast);
-				case parser::token_type_t::double_const: return process_const<parser::double_const_token, EventDouble>(ast);
-				case parser::token_type_t::bool_const: return process_const<parser::bool_const_token, EventBool>(ast);
-				case parser::token_type_t::string_const: return process_const<parser::string_const_token, EventString>(ast);
-				case parser::token_type_t::bang_const: return make_unique<bang_value>();
-				// TODO: Implement other constants
-				case parser::token_type_t::spec: {
-//					std::cout << "Processing spec\n";
-					const auto& token = std::dynamic_pointer_cast<parser::spec_token>(ast);
-					input_map[{token->node, token->name}]=token->node+":"+token->name;
-					std::unique_ptr<event_value> spec (new event_value(token->node, token->name));
-					if (token->init) {
-						spec->init = process_tree(token->init);
-					}
-					return spec;
-				}
-				case parser::token_type_t::func_name: {
-//					std::cout << "Processing func\n";
-					const auto& token = std::dynamic_pointer_cast<parser::func_token>(ast);
-					std::unique_ptr<func_call> func {new func_call(token->fname, token->mode)};
-					for (const auto& arg: token->args) {
-						func->inputs.push_back(process_tree(arg));
-					}
-					return func;
-				}
-				case parser::token_type_t::vector_const: {
-//					std::cout << "New vector const\n";
-					const auto& token = std::dynamic_pointer_cast<parser::vector_const_token>(ast);
-					std::unique_ptr<vec_value> vec {new vec_value()};
-					for (const auto& arg: token->members) {
-						vec->inputs.push_back(process_tree(arg));
-					}
-					return vec;
-				}
-				case parser::token_type_t::dict_const: {
-					const auto& token = std::dynamic_pointer_cast<parser::dict_const_token>(ast);
-					std::unique_ptr<dict_value> dict {new dict_value()};
-					for (const auto& arg: token->members) {
-						dict->inputs[arg.first] = process_tree(arg.second);
-					}
-					return dict;
-				}
-				case parser::token_type_t::null_const: {
-					std::unique_ptr<null_value> n (new null_value{});
-					assert(n);
-					return n;
-				}
-				default: break;
-			}
-
-			throw std::runtime_error("Bad tree!");
-		}
 		virtual bool do_process_event(const std::string& event_name, const pBasicEvent& event)
 		{
-			input_events[event_name] = event;
+			auto it = input_index_.find(event_name);
+			if (it != input_index_.end()) {
+				expression_.set_input(it->second, event);
+			}
 			// TODO: This should depend on 'mode' attribute...
 			try_emit_event();
 			return true;
 		}
-		std::map<std::string, pBasicEvent> input_events;
-		std::unique_ptr<value_provider> provider;
+		EventExpression expression_;
+		std::map<std::string, size_t> input_index_;
 	public:
 		std::map<std::pair<std::string, std::string>, std::string> input_map;
 	};
-namespace {
-	pBasicEvent event_value::get_value(const EventRouter& router) const {
-		if (auto event = router.get_value(name)) return event;
-		if (init) return init->get_value(router);
-		throw std::runtime_error("bah");
-
-	}
-}
 pBasicEvent BasicEventParser::parse_const(const std::string& text)
 {
 //	log_pa_[log::info] << "Parsing " << text;
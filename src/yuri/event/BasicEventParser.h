@@ -108,6 +108,12 @@ struct bang_const_token: public token {
 EXPORT bool 					is_simple_route(const p_token& ast);
 EXPORT std::pair<std::vector<p_token>, std::string>
 								parse_string(const std::string& text);
+EXPORT p_token					parse_expr_string(const std::string& text);
+/*!
+ * Evaluates an expression by walking the tree, values of inputs are looked up by "node:name".
+ * Routes use compiled expressions (EventExpression), this is kept as a reference for them.
+ */
+EXPORT pBasicEvent				interpret(const p_token& ast, const std::map<std::string, pBasicEvent>& inputs);
 
 
 
@@ -12,7 +12,8 @@
 
 namespace yuri {
 namespace event {
-BasicEventProducer::BasicEventProducer(log::Log& log_):log_p_(log_)
+BasicEventProducer::BasicEventProducer(log::Log& log_)
+:consumers_(std::make_shared<event_targets_t>()),log_p_(log_)
 {
 	(void)log_p_;// Getting rid of compiler warning in CLANG
 }
@@ -39,14 +40,16 @@ bool BasicEventProducer::do_register_listener(const std::string& event_name, pwB
 {
 	event_target_t target{consumer, target_name};
 	// Try to verify whether this target was already registered
-	if (consumers_.count(event_name) > 0) {
-		auto range = consumers_.equal_range(event_name);
+	if (consumers_->count(event_name) > 0) {
+		auto range = consumers_->equal_range(event_name);
 		for (auto it = range.first; it != range.second; ++it) {
 			if (targets_equal(it->second, target)) return false;
 		}
 
 	}
-	consumers_.insert({event_name, target});
+	auto consumers = std::make_shared<event_targets_t>(*consumers_);
+	consumers->insert({event_name, target});
+	std::atomic_store(&consumers_, std::shared_ptr<const event_targets_t>(std::move(consumers)));
 	return true;
 }
 bool BasicEventProducer::unregister_listener(const std::string& event_name, pwBasicEventConsumer consumer, const std::string& target_name)
@@ -58,47 +61,65 @@ bool BasicEventProducer::do_unregister_listener(const std::string& event_name, p
 {
 	const event_target_t target{consumer, target_name};
 	size_t erased = 0;
-	if (consumers_.count(event_name) == 0) return false;
-	auto range = consumers_.equal_range(event_name);
-	for (auto it = range.first; it != range.second; ++it) {
+	if (consumers_->count(event_name) == 0) return false;
+	auto consumers = std::make_shared<event_targets_t>(*consumers_);
+	auto range = consumers->equal_range(event_name);
+	for (auto it = range.first; it != range.second; ) {
 		if (targets_equal(it->second, target)) {
-			consumers_.erase(it);
+			it = consumers->erase(it);
 			erased++;
+		} else {
+			++it;
 		}
 	}
+	if (erased > 0) {
+		std::atomic_store(&consumers_, std::shared_ptr<const event_targets_t>(std::move(consumers)));
+	}
 	return erased > 0;
 }
+void BasicEventProducer::remove_expired_listeners()
+{
+	yuri::lock_t _(consumers_mutex_);
+	auto consumers = std::make_shared<event_targets_t>(*consumers_);
+	for (auto it = consumers->begin(); it != consumers->end(); ) {
+		if (it->second.first.expired()) it = consumers->erase(it);
+		else ++it;
+	}
+	std::atomic_store(&consumers_, std::shared_ptr<const event_targets_t>(std::move(consumers)));
+}
 bool BasicEventProducer::emit_event(const std::string& event_name, pBasicEvent event)
 {
 	if (!event) return false;
-	yuri::lock_t _(consumers_mutex_);
-	if (consumers_.count("*")) {
-		auto range = consumers_.equal_range("*");
+	// Snapshot of the listeners, it stays valid even when listeners are changed concurrently
+	const auto consumers = std::atomic_load(&consumers_);
+	if (consumers->empty()) return true;
+	bool expired = false;
+	if (consumers->count("*")) {
+		auto range = consumers->equal_range("*");
 		for (auto it = range.first; it != range.second; ++it) {
 			auto& target = it->second;
 			auto consumer = target.first.lock();
-			if (!consumer) continue;
-			if (target.second == "*") {
+			if (!consumer) {
+				expired = true;
+			} else if (target.second == "*") {
 				consumer->receive_event(event_name, event);
 			} else {
 				consumer->receive_event(target.second, event);
 			}
 		}
 	}
-	if (!consumers_.count(event_name)) return true;
-	auto range = consumers_.equal_range(event_name);
-	std::vector<decltype(consumers_.begin())> expired_iterators;
+	auto range = consumers->equal_range(event_name);
 	for (auto it = range.first; it != range.second; ++it) {
 		auto& target = it->second;
 		auto consumer = target.first.lock();
 		if (!consumer) {
-			// Basic clean up. The consumer ptr has already expired, so it can be removed from consumers_
-			expired_iterators.push_back(it);
+			expired = true;
 		} else {
 			consumer->receive_event(target.second, event);
 		}
 	}
-	for (auto it: expired_iterators) { consumers_.erase(it); }
+	// Basic clean up. Some consumers have already expired, so they can be removed from consumers_
+	if (expired) remove_expired_listeners();
 	return true;
 }
 std::vector<event_info_t> BasicEventProducer::list_events()
@@ -23,6 +23,9 @@ using pBasicEventProducer = std::shared_ptr<BasicEventProducer>;
 typedef std::pair<std::string, event_type_t>
 								event_info_t;
 
+typedef std::unordered_multimap<std::string, event_target_t>
+								event_targets_t;
+
 class BasicEventProducer {
 public:
 	EXPORT 						BasicEventProducer(log::Log&);
@@ -98,7 +101,13 @@ private:
 	EXPORT virtual	std::vector<event_info_t>
 								do_list_events() { return {}; }
 	EXPORT virtual bool			verify_register_event(const::std::string& event_name);
-	std::unordered_multimap<std::string, event_target_t>
+	void						remove_expired_listeners();
+	/*!
+	 * Registered listeners. The map is never modified after publishing,
+	 * changes make a new copy, so emit_event() only loads the current one.
+	 * Modifications are serialized by consumers_mutex_.
+	 */
+	std::shared_ptr<const event_targets_t>
 								consumers_;
 	yuri::mutex					consumers_mutex_;
 	log::Log&					log_p_;
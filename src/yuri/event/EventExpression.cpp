@@ -0,0 +1,532 @@
+/*!
+ * @file 		EventExpression.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "EventExpression.h"
+#include "BasicEventConversions.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <unordered_map>
+
+namespace yuri {
+namespace event {
+
+using namespace expression;
+
+namespace {
+
+const std::unordered_map<std::string, native_t> native_functions = {
+		{"add", native_t::add},
+		{"sub", native_t::sub},
+		{"mul", native_t::mul},
+		{"div", native_t::div},
+		{"mod", native_t::mod},
+		{"min", native_t::min},
+		{"max", native_t::max},
+		{"eq", native_t::eq},
+		{"gt", native_t::gt},
+		{"ge", native_t::ge},
+		{"lt", native_t::lt},
+		{"le", native_t::le},
+		{"and", native_t::log_and},
+		{"or", native_t::log_or},
+		{"xor", native_t::log_xor},
+		{"not", native_t::log_not},
+		{"abs", native_t::abs},
+		{"exp", native_t::exp},
+		{"ln", native_t::ln},
+		{"pow", native_t::pow},
+		{"pass", native_t::pass},
+		{"int", native_t::to_int},
+		{"double", native_t::to_double},
+		{"bool", native_t::to_bool},
+};
+
+//! Functions returning different values for the same parameters, these are never folded
+const std::set<std::string> impure_functions = {"generate"};
+
+value_t make_bool(bool val)
+{
+	value_t v;
+	v.type = event_type_t::boolean_event;
+	v.b = val;
+	return v;
+}
+
+value_t make_int(int64_t val)
+{
+	value_t v;
+	v.type = event_type_t::integer_event;
+	v.i = val;
+	return v;
+}
+
+value_t make_double(long double val)
+{
+	value_t v;
+	v.type = event_type_t::double_event;
+	v.d = val;
+	return v;
+}
+
+value_t make_duration(int64_t val)
+{
+	value_t v;
+	v.type = event_type_t::duration_event;
+	v.i = val;
+	return v;
+}
+
+/*!
+ * Unboxes scalar values. Events of other types, null events and events
+ * of unexpected classes are stored only as the event and never evaluated natively.
+ */
+value_t make_value(const pBasicEvent& event)
+{
+	value_t v;
+	v.type = event_type_t::undetermined_event;
+	v.event = event;
+	if (!event) return v;
+	switch (event->get_type()) {
+		case event_type_t::boolean_event:
+			if (auto e = std::dynamic_pointer_cast<EventBool>(event)) {
+				v.type = event_type_t::boolean_event;
+				v.b = e->get_value();
+			}
+			break;
+		case event_type_t::integer_event:
+			if (auto e = std::dynamic_pointer_cast<EventInt>(event)) {
+				v.type = event_type_t::integer_event;
+				v.i = e->get_value();
+			}
+			break;
+		case event_type_t::double_event:
+			if (auto e = std::dynamic_pointer_cast<EventDouble>(event)) {
+				v.type = event_type_t::double_event;
+				v.d = e->get_value();
+			}
+			break;
+		case event_type_t::duration_event:
+			if (auto e = std::dynamic_pointer_cast<EventDuration>(event)) {
+				v.type = event_type_t::duration_event;
+				v.i = e->get_value().value;
+			}
+			break;
+		default:
+			v.type = event->get_type();
+			break;
+	}
+	return v;
+}
+
+pBasicEvent box(const value_t& v)
+{
+	if (v.event) return v.event;
+	switch (v.type) {
+		case event_type_t::boolean_event: return std::make_shared<EventBool>(v.b);
+		case event_type_t::integer_event: return std::make_shared<EventInt>(v.i);
+		case event_type_t::double_event: return std::make_shared<EventDouble>(v.d);
+		case event_type_t::duration_event: return std::make_shared<EventDuration>(duration_t(v.i));
+		default: break;
+	}
+	return {};
+}
+
+bool is_number(const value_t& v)
+{
+	return v.type == event_type_t::integer_event || v.type == event_type_t::double_event;
+}
+
+long double as_double(const value_t& v)
+{
+	return v.type == event_type_t::integer_event ? static_cast<long double>(v.i) : v.d;
+}
+
+/*
+ * The native functions follow the functions registered in BasicEventConversions.cpp,
+ * including the implicit conversion of integers to doubles.
+ * They return false for combinations of types they don't handle.
+ */
+
+template<class T>
+bool compare(native_t fn, const T& a, const T& b, value_t& r)
+{
+	switch (fn) {
+		case native_t::eq: r = make_bool(a == b); return true;
+		case native_t::gt: r = make_bool(a > b); return true;
+		case native_t::ge: r = make_bool(a >= b); return true;
+		case native_t::lt: r = make_bool(a < b); return true;
+		case native_t::le: r = make_bool(a <= b); return true;
+		default: break;
+	}
+	return false;
+}
+
+bool eval_bool(native_t fn, bool a, bool b, value_t& r)
+{
+	switch (fn) {
+		case native_t::min: r = make_bool(std::min(a, b)); return true;
+		case native_t::max: r = make_bool(std::max(a, b)); return true;
+		case native_t::log_and: r = make_bool(a && b); return true;
+		case native_t::log_or: r = make_bool(a || b); return true;
+		default: break;
+	}
+	return compare(fn, a, b, r);
+}
+
+bool eval_int(native_t fn, int64_t a, int64_t b, value_t& r)
+{
+	switch (fn) {
+		case native_t::add: r = make_int(a + b); return true;
+		case native_t::sub: r = make_int(a - b); return true;
+		case native_t::mul: r = make_int(a * b); return true;
+		case native_t::div:
+			if (!b) throw bad_event_cast("Division by zero in div()");
+			r = make_int(a / b);
+			return true;
+		case native_t::mod:
+			if (!b) throw bad_event_cast("Division by zero in mod()");
+			r = make_int(a % b);
+			return true;
+		case native_t::min: r = make_int(std::min(a, b)); return true;
+		case native_t::max: r = make_int(std::max(a, b)); return true;
+		case native_t::log_and: r = make_int(a & b); return true;
+		case native_t::log_or: r = make_int(a | b); return true;
+		case native_t::log_xor: r = make_int(a ^ b); return true;
+		case native_t::pow:
+			r = make_double(std::pow(static_cast<long double>(a), static_cast<long double>(b)));
+			return true;
+		default: break;
+	}
+	return compare(fn, a, b, r);
+}
+
+bool eval_double(native_t fn, long double a, long double b, value_t& r)
+{
+	switch (fn) {
+		case native_t::add: r = make_double(a + b); return true;
+		case native_t::sub: r = make_double(a - b); return true;
+		case native_t::mul: r = make_double(a * b); return true;
+		case native_t::div: r = make_double(a / b); return true;
+		case native_t::mod: r = make_double(std::fmod(a, b)); return true;
+		case native_t::min: r = make_double(std::min(a, b)); return true;
+		case native_t::max: r = make_double(std::max(a, b)); return true;
+		case native_t::pow: r = make_double(std::pow(a, b)); return true;
+		default: break;
+	}
+	return compare(fn, a, b, r);
+}
+
+bool eval_duration(native_t fn, int64_t a, int64_t b, value_t& r)
+{
+	switch (fn) {
+		case native_t::add: r = make_duration(a + b); return true;
+		case native_t::sub: r = make_duration(a - b); return true;
+		case native_t::min: r = make_duration(std::min(a, b)); return true;
+		case native_t::max: r = make_duration(std::max(a, b)); return true;
+		default: break;
+	}
+	return compare(fn, a, b, r);
+}
+
+bool eval_unary(native_t fn, const value_t& a, value_t& r)
+{
+	const auto type = a.type;
+	switch (fn) {
+		case native_t::log_not:
+			if (type != event_type_t::boolean_event) return false;
+			r = make_bool(!a.b);
+			return true;
+		case native_t::abs:
+			if (type == event_type_t::integer_event) r = make_int(std::abs(a.i));
+			else if (type == event_type_t::double_event) r = make_double(std::abs(a.d));
+			else if (type == event_type_t::duration_event) r = make_duration(a.i < 0 ? -a.i : a.i);
+			else return false;
+			return true;
+		case native_t::exp:
+			if (!is_number(a)) return false;
+			r = make_double(std::exp(as_double(a)));
+			return true;
+		case native_t::ln:
+			if (!is_number(a)) return false;
+			r = make_double(std::log(as_double(a)));
+			return true;
+		case native_t::pass:
+			if (!is_number(a) && type != event_type_t::boolean_event) return false;
+			r = a;
+			return true;
+		case native_t::to_int:
+			if (type == event_type_t::integer_event) r = a;
+			else if (type == event_type_t::double_event) r = make_int(static_cast<int64_t>(a.d));
+			else return false;
+			return true;
+		case native_t::to_double:
+			if (type == event_type_t::double_event) r = a;
+			else if (type == event_type_t::integer_event) r = make_double(static_cast<long double>(a.i));
+			else return false;
+			return true;
+		case native_t::to_bool:
+			if (type == event_type_t::boolean_event) r = a;
+			else if (type == event_type_t::integer_event) r = make_bool(a.i != 0);
+			else return false;
+			return true;
+		default: break;
+	}
+	return false;
+}
+
+bool eval_binary(native_t fn, const value_t& a, const value_t& b, value_t& r)
+{
+	if (a.type == b.type) {
+		switch (a.type) {
+			case event_type_t::boolean_event: return eval_bool(fn, a.b, b.b, r);
+			case event_type_t::integer_event: return eval_int(fn, a.i, b.i, r);
+			case event_type_t::double_event: return eval_double(fn, a.d, b.d, r);
+			case event_type_t::duration_event: return eval_duration(fn, a.i, b.i, r);
+			default: return false;
+		}
+	}
+	if (is_number(a) && is_number(b)) {
+		// Mixed integer and double, the integer is converted
+		return eval_double(fn, as_double(a), as_double(b), r);
+	}
+	return false;
+}
+
+bool eval_native(native_t fn, const value_t* args, size_t count, value_t& r)
+{
+	switch (count) {
+		case 1: return eval_unary(fn, args[0], r);
+		case 2: return eval_binary(fn, args[0], args[1], r);
+		case 3:
+			// eq with tolerance
+			if (fn != native_t::eq) return false;
+			if (!is_number(args[0]) || !is_number(args[1]) || !is_number(args[2])) return false;
+			if (args[0].type == event_type_t::integer_event &&
+					args[1].type == event_type_t::integer_event &&
+					args[2].type == event_type_t::integer_event) {
+				r = make_bool(std::abs(args[0].i - args[1].i) <= args[2].i);
+			} else {
+				r = make_bool(std::abs(as_double(args[0]) - as_double(args[1])) <= as_double(args[2]));
+			}
+			return true;
+		default: break;
+	}
+	return false;
+}
+
+}
+
+EventExpression::EventExpression(const parser::p_token& ast):depth_(0),max_depth_(0)
+{
+	if (!ast) throw bad_event_cast("Empty expression");
+	compile(ast);
+	stack_.reserve(max_depth_);
+}
+
+void EventExpression::set_input(size_t index, const pBasicEvent& event)
+{
+	inputs_.at(index) = make_value(event);
+}
+
+bool EventExpression::is_constant() const
+{
+	return program_.size() == 1 && program_[0].op == opcode_t::constant;
+}
+
+pBasicEvent EventExpression::evaluate()
+{
+	stack_.clear();
+	for (size_t pc = 0; pc < program_.size(); ++pc) {
+		const auto& instruction = program_[pc];
+		switch (instruction.op) {
+			case opcode_t::constant:
+				stack_.push_back(constants_[instruction.arg]);
+				break;
+			case opcode_t::input: {
+				const auto& input = inputs_[instruction.arg];
+				if (input.event) {
+					stack_.push_back(input);
+					if (instruction.jump) pc = instruction.jump - 1;
+				} else if (!instruction.jump) {
+					const auto& name = input_names_[instruction.arg];
+					throw bad_event_cast("No value for " + name.first + ":" + name.second);
+				}
+			} break;
+			default:
+				execute(instruction, stack_);
+				break;
+		}
+	}
+	auto result = box(stack_.back());
+	stack_.clear();
+	return result;
+}
+
+void EventExpression::execute(const instruction_t& instruction, std::vector<value_t>& stack)
+{
+	const size_t count = instruction.count;
+	const size_t first = stack.size() - count;
+	value_t result;
+	switch (instruction.op) {
+		case opcode_t::call:
+			if (instruction.native == native_t::none || !eval_native(instruction.native, &stack[first], count, result)) {
+				args_.clear();
+				for (size_t i = first; i < stack.size(); ++i) args_.push_back(box(stack[i]));
+				result = make_value(call(names_[instruction.arg], args_));
+				args_.clear();
+			}
+			break;
+		case opcode_t::vector: {
+			auto vec = std::make_shared<EventVector>();
+			vec->reserve(count);
+			for (size_t i = first; i < stack.size(); ++i) vec->push_back(box(stack[i]));
+			result = make_value(vec);
+		} break;
+		case opcode_t::dict: {
+			auto dict = std::make_shared<EventDict>();
+			auto& values = dict->get_value();
+			const auto& keys = keys_[instruction.arg];
+			for (size_t i = 0; i < count; ++i) values[keys[i]] = box(stack[first + i]);
+			result = make_value(dict);
+		} break;
+		default:
+			return;
+	}
+	stack.resize(first);
+	stack.push_back(std::move(result));
+}
+
+void EventExpression::push(opcode_t op, size_t arg, size_t count, native_t native)
+{
+	program_.push_back({op, native, arg, count, 0});
+	if (op == opcode_t::constant || op == opcode_t::input) {
+		++depth_;
+	} else {
+		depth_ = depth_ - count + 1;
+	}
+	max_depth_ = std::max(max_depth_, depth_);
+}
+
+void EventExpression::compile(const parser::p_token& ast)
+{
+	using parser::token_type_t;
+	auto push_constant = [this](const pBasicEvent& event) {
+		constants_.push_back(make_value(event));
+		push(opcode_t::constant, constants_.size() - 1);
+	};
+	switch (ast->type) {
+		case token_type_t::int_const:
+			push_constant(std::make_shared<EventInt>(std::dynamic_pointer_cast<parser::int_const_token>(ast)->val));
+			return;
+		case token_type_t::double_const:
+			push_constant(std::make_shared<EventDouble>(std::dynamic_pointer_cast<parser::double_const_token>(ast)->val));
+			return;
+		case token_type_t::bool_const:
+			push_constant(std::make_shared<EventBool>(std::dynamic_pointer_cast<parser::bool_const_token>(ast)->val));
+			return;
+		case token_type_t::string_const:
+			push_constant(std::make_shared<EventString>(std::dynamic_pointer_cast<parser::string_const_token>(ast)->val));
+			return;
+		case token_type_t::bang_const:
+			push_constant(std::make_shared<EventBang>());
+			return;
+		case token_type_t::null_const:
+			push_constant({});
+			return;
+		case token_type_t::spec: {
+			const auto token = std::dynamic_pointer_cast<parser::spec_token>(ast);
+			const auto name = std::make_pair(token->node, token->name);
+			auto it = std::find(input_names_.begin(), input_names_.end(), name);
+			const size_t index = std::distance(input_names_.begin(), it);
+			if (it == input_names_.end()) {
+				input_names_.push_back(name);
+				inputs_.push_back(make_value({}));
+			}
+			push(opcode_t::input, index);
+			if (token->init) {
+				const size_t input_pos = program_.size() - 1;
+				compile(token->init);
+				// Only one of the input and initializer is pushed to the stack
+				--depth_;
+				program_[input_pos].jump = program_.size();
+			}
+			return;
+		}
+		case token_type_t::func_name:
+		case token_type_t::vector_const:
+		case token_type_t::dict_const:
+			compile_function(ast);
+			return;
+		default: break;
+	}
+	throw bad_event_cast("Unsupported expression");
+}
+
+void EventExpression::compile_function(const parser::p_token& ast)
+{
+	using parser::token_type_t;
+	const size_t first_instruction = program_.size();
+	const size_t first_constant = constants_.size();
+	bool pure = true;
+	if (ast->type == token_type_t::func_name) {
+		const auto token = std::dynamic_pointer_cast<parser::func_token>(ast);
+		for (const auto& arg: token->args) compile(arg);
+		auto it = std::find(names_.begin(), names_.end(), token->fname);
+		const size_t index = std::distance(names_.begin(), it);
+		if (it == names_.end()) names_.push_back(token->fname);
+		const auto native = native_functions.find(token->fname);
+		push(opcode_t::call, index, token->args.size(),
+				native == native_functions.end() ? native_t::none : native->second);
+		pure = !impure_functions.count(token->fname);
+	} else if (ast->type == token_type_t::vector_const) {
+		const auto token = std::dynamic_pointer_cast<parser::vector_const_token>(ast);
+		for (const auto& member: token->members) compile(member);
+		push(opcode_t::vector, 0, token->members.size());
+	} else {
+		const auto token = std::dynamic_pointer_cast<parser::dict_const_token>(ast);
+		std::vector<std::string> keys;
+		for (const auto& member: token->members) {
+			keys.push_back(member.first);
+			compile(member.second);
+		}
+		keys_.push_back(std::move(keys));
+		push(opcode_t::dict, keys_.size() - 1, token->members.size());
+	}
+
+	// Folds the function when all the arguments are constant
+	const auto instruction = program_.back();
+	if (!pure || program_.size() - first_instruction != instruction.count + 1) return;
+	std::vector<value_t> stack;
+	for (size_t i = first_instruction; i < program_.size() - 1; ++i) {
+		if (program_[i].op != opcode_t::constant) return;
+		stack.push_back(constants_[program_[i].arg]);
+	}
+	try {
+		execute(instruction, stack);
+	}
+	catch (std::runtime_error&) {
+		// Evaluation will fail again at runtime, reporting the error to the user
+		return;
+	}
+	program_.resize(first_instruction);
+	constants_.resize(first_constant);
+	depth_ = depth_ - 1;
+	const auto max_depth = max_depth_;
+	// The event is created once, evaluation of the constant doesn't allocate
+	auto value = stack.back();
+	value.event = box(value);
+	constants_.push_back(value);
+	push(opcode_t::constant, constants_.size() - 1);
+	max_depth_ = max_depth;
+}
+
+}
+}
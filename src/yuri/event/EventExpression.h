@@ -0,0 +1,125 @@
+/*!
+ * @file 		EventExpression.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Expressions from event routes compiled into a flat program for a stack machine.
+ *
+ * Booleans, integers, doubles and durations are kept unboxed on the stack and the common
+ * functions (arithmetic, comparisons, logic, conversions) are evaluated directly on them.
+ * Other functions and types go through the generic event functions (event::call).
+ * Subexpressions without inputs are evaluated during compilation, so events are allocated
+ * only for the result and for the values passed to generic functions.
+ */
+
+#ifndef EVENTEXPRESSION_H_
+#define EVENTEXPRESSION_H_
+#include "BasicEventParser.h"
+
+namespace yuri {
+namespace event {
+namespace expression {
+
+//! Functions evaluated directly on unboxed values
+enum class native_t {
+	none,
+	add, sub, mul, div, mod,
+	min, max,
+	eq, gt, ge, lt, le,
+	log_and, log_or, log_xor, log_not,
+	abs, exp, ln, pow,
+	pass, to_int, to_double, to_bool
+};
+
+enum class opcode_t {
+	//! Pushes constants_[arg]
+	constant,
+	//! Pushes inputs_[arg], when set, and continues at @em jump. Otherwise continues with the initializer.
+	input,
+	//! Replaces @em count values with result of function names_[arg]
+	call,
+	//! Replaces @em count values with a vector
+	vector,
+	//! Replaces @em count values with a dictionary with keys from keys_[arg]
+	dict,
+};
+
+struct instruction_t {
+	opcode_t					op;
+	native_t					native;
+	size_t						arg;
+	size_t						count;
+	//! Target of input instruction, zero when there is no initializer
+	size_t						jump;
+};
+
+/*!
+ * Value on the stack. Scalar values are stored unboxed, @em event holds the original event
+ * (if any) and it's the only representation of the other types.
+ */
+struct value_t {
+	event_type_t				type;
+	union {
+		bool					b;
+		int64_t					i;
+		long double				d;
+	};
+	pBasicEvent					event;
+};
+
+}
+
+class EventExpression {
+public:
+	/*!
+	 * Compiles an expression.
+	 * @param ast Expression parsed by parser::parse_expr_string or an expression of a route
+	 * @throw bad_event_cast for unsupported expressions
+	 */
+	EXPORT explicit				EventExpression(const parser::p_token& ast);
+
+	//! Inputs (node and event name) referenced in the expression, position in the vector is the input index
+	const std::vector<std::pair<std::string, std::string>>&
+								get_inputs() const { return input_names_; }
+	EXPORT void 				set_input(size_t index, const pBasicEvent& event);
+	//! Returns true if the expression was folded into a single constant
+	EXPORT bool					is_constant() const;
+
+	/*!
+	 * Evaluates the expression.
+	 * @throw std::runtime_error when the expression can't be evaluated
+	 * (input without a value, wrong types of parameters, ...)
+	 */
+	EXPORT pBasicEvent 			evaluate();
+private:
+	void 						compile(const parser::p_token& ast);
+	void 						compile_function(const parser::p_token& ast);
+	void 						execute(const expression::instruction_t& instruction, std::vector<expression::value_t>& stack);
+	void 						push(expression::opcode_t op, size_t arg = 0, size_t count = 0,
+										expression::native_t native = expression::native_t::none);
+
+	std::vector<expression::instruction_t>
+								program_;
+	std::vector<expression::value_t>
+								constants_;
+	std::vector<std::string>	names_;
+	std::vector<std::vector<std::string>>
+								keys_;
+	std::vector<std::pair<std::string, std::string>>
+								input_names_;
+	std::vector<expression::value_t>
+								inputs_;
+
+	size_t						depth_;
+	size_t						max_depth_;
+	std::vector<expression::value_t>
+								stack_;
+	std::vector<pBasicEvent>	args_;
+};
+
+}
+}
+
+#endif /* EVENTEXPRESSION_H_ */
@@ -0,0 +1,86 @@
+/*!
+ * @file 		EventQueue.cpp
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ */
+
+#include "EventQueue.h"
+
+namespace yuri {
+namespace event {
+
+namespace {
+size_t round_capacity(size_t capacity)
+{
+	size_t rounded = 2;
+	while (rounded < capacity) rounded <<= 1;
+	return rounded;
+}
+}
+
+EventQueue::EventQueue(size_t capacity)
+:mask_(round_capacity(capacity) - 1),records_(new record_t[mask_ + 1]),
+ write_position_(0),read_position_(0)
+{
+	for (size_t i = 0; i <= mask_; ++i) {
+		records_[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+EventQueue::~EventQueue() noexcept
+{
+}
+
+bool EventQueue::push(const std::string& event_name, const pBasicEvent& event)
+{
+	auto position = write_position_.load(std::memory_order_relaxed);
+	record_t* record = nullptr;
+	for (;;) {
+		record = &records_[position & mask_];
+		const auto sequence = record->sequence.load(std::memory_order_acquire);
+		const auto diff = static_cast<ssize_t>(sequence - position);
+		if (diff == 0) {
+			if (write_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+		} else if (diff < 0) {
+			// The record wasn't read yet, so the queue is full
+			return false;
+		} else {
+			position = write_position_.load(std::memory_order_relaxed);
+		}
+	}
+	// Reuses the buffer of the string stored in the record
+	record->name.assign(event_name);
+	record->event = event;
+	record->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+bool EventQueue::pop(std::string& event_name, pBasicEvent& event)
+{
+	auto position = read_position_.load(std::memory_order_relaxed);
+	record_t* record = nullptr;
+	for (;;) {
+		record = &records_[position & mask_];
+		const auto sequence = record->sequence.load(std::memory_order_acquire);
+		const auto diff = static_cast<ssize_t>(sequence - (position + 1));
+		if (diff == 0) {
+			if (read_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+		} else if (diff < 0) {
+			// Empty, or the writer hasn't finished the record yet
+			return false;
+		} else {
+			position = read_position_.load(std::memory_order_relaxed);
+		}
+	}
+	event_name.swap(record->name);
+	event = std::move(record->event);
+	record->event.reset();
+	record->sequence.store(position + mask_ + 1, std::memory_order_release);
+	return true;
+}
+
+}
+}
@@ -0,0 +1,74 @@
+/*!
+ * @file 		EventQueue.h
+ * @author 		Zdenek Travnicek <travnicek@iim.cz>
+ * @date 		18.10.2026
+ * @copyright	Institute of Intermedia, CTU in Prague, 2026
+ * 				Distributed under modified BSD Licence, details in file doc/LICENSE
+ *
+ * @details		Bounded lock-free queue of incoming events.
+ *
+ * The queue is an array of preallocated records, each with a sequence number
+ * telling whether it's free for a writer or ready for a reader (D. Vyukov's bounded queue).
+ * Any number of threads can push and pop concurrently without locking. Records are reused,
+ * so the names are exchanged with the caller's strings and their buffers are recycled.
+ */
+
+#ifndef EVENTQUEUE_H_
+#define EVENTQUEUE_H_
+#include "yuri/event/BasicEvent.h"
+#include <atomic>
+
+namespace yuri {
+namespace event {
+
+class EventQueue {
+public:
+	//! Capacity is rounded up to the nearest power of two
+	EXPORT explicit				EventQueue(size_t capacity);
+	EXPORT						~EventQueue() noexcept;
+								EventQueue(const EventQueue&) = delete;
+	EventQueue&					operator=(const EventQueue&) = delete;
+
+	/*!
+	 * Appends an event to the queue.
+	 * @return false if the queue is full
+	 */
+	EXPORT bool					push(const std::string& event_name, const pBasicEvent& event);
+	/*!
+	 * Removes the oldest event from the queue.
+	 * The previous content of @em event_name is kept in the queue for reuse.
+	 * @return false if there's no event ready
+	 */
+	EXPORT bool					pop(std::string& event_name, pBasicEvent& event);
+
+	//! Number of queued events. It's only approximate while other threads use the queue.
+	size_t						size() const;
+	bool						empty() const { return size() == 0; }
+	size_t						get_capacity() const { return mask_ + 1; }
+private:
+	struct record_t {
+		std::atomic<size_t>		sequence;
+		std::string				name;
+		pBasicEvent				event;
+	};
+
+	const size_t				mask_;
+	std::unique_ptr<record_t[]>	records_;
+	// Positions are on separate cache lines, so writers don't disturb the reader
+	alignas(64) std::atomic<size_t>
+								write_position_;
+	alignas(64) std::atomic<size_t>
+								read_position_;
+};
+
+inline size_t EventQueue::size() const
+{
+	const auto read = read_position_.load(std::memory_order_acquire);
+	const auto write = write_position_.load(std::memory_order_acquire);
+	return write > read ? write - read : 0;
+}
+
+}
+}
+
+#endif /* EVENTQUEUE_H_ */
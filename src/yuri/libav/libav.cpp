@@ -209,6 +209,37 @@ core::pRawVideoFrame yuri_frame_from_av(const AVFrame& av_frame)
 	return frame;
 }
 
+core::pRawVideoFrame yuri_frame_from_av_ref(const AVFrame& av_frame)
+{
+#ifdef YURI_USING_LEGACY_FFMPEG
+	return yuri_frame_from_av(av_frame);
+#else
+	format_t fmt = libav::yuri_pixelformat_from_av(static_cast<AVPixelFormat>(av_frame.format));
+	if (fmt == 0) return {};
+	if (!av_frame.buf[0] || !av_frame_is_writable(const_cast<AVFrame*>(&av_frame))) return yuri_frame_from_av(av_frame);
+
+	const resolution_t resolution = {static_cast<dimension_t>(av_frame.width), static_cast<dimension_t>(av_frame.height)};
+	const auto& fi = core::raw_format::get_format_info(fmt);
+	if (fi.planes.size() > AV_NUM_DATA_POINTERS) return yuri_frame_from_av(av_frame);
+	for (size_t i=0;i<fi.planes.size();++i) {
+		const auto line_size = std::get<0>(core::RawVideoFrame::get_plane_params(fi, i, resolution));
+		if (!av_frame.data[i] || static_cast<size_t>(av_frame.linesize[i]) != line_size) return yuri_frame_from_av(av_frame);
+	}
+
+	// The reference is released after all planes sharing the buffers are destroyed
+	std::shared_ptr<AVFrame> ref (av_frame_clone(&av_frame), [](AVFrame* f){av_frame_free(&f);});
+	if (!ref) return yuri_frame_from_av(av_frame);
+	auto frame = std::make_shared<core::RawVideoFrame>(fmt, resolution, 0);
+	for (size_t i=0;i<fi.planes.size();++i) {
+		size_t line_size, plane_size;
+		resolution_t plane_res;
+		std::tie(line_size, plane_size, plane_res) = core::RawVideoFrame::get_plane_params(fi, i, resolution);
+		frame->emplace_back(ref->data[i], plane_size, plane_res, line_size, [ref](void*)noexcept{});
+	}
+	return frame;
+#endif
+}
+
 }
 }
 
@@ -39,6 +39,15 @@ yuri::format_t yuri_audio_from_av(AVSampleFormat format);
 
 core::pRawVideoFrame yuri_frame_from_av(const AVFrame& frame);
 
+/*!
+ * Creates frame sharing buffers with @em frame (keeping a reference to them),
+ * without copying the data.
+ * Falls back to yuri_frame_from_av() when the buffers are still referenced elsewhere
+ * (e.g. reference pictures held by a decoder), as the consumers may modify the frame in place,
+ * or when the layout of the buffers doesn't match yuri frames (padded lines).
+ */
+core::pRawVideoFrame yuri_frame_from_av_ref(const AVFrame& frame);
+
 lock_t get_libav_lock();
 
 template<typename T>